@@ -271,7 +271,9 @@ cdef extern from "yac_interface.h":
                                   double scale_factor, double scale_summand,
                                   int num_src_mask_names,
                                   const char * const * src_mask_names,
-                                  const char * tgt_mask_name)
+                                  const char * tgt_mask_name,
+                                  int use_single_precision,
+                                  double weight_pruning_threshold)
   void yac_cget_ ( const int field_id,
                    const int collection_size,
                    double *recv_field,
@@ -583,7 +585,9 @@ class YAC:
                    interp_stack, src_lag = 0, tgt_lag = 0,
                    weight_file = None, mapping_on_source = 1,
                    scale_factor = 1.0, scale_summand = 0.0,
-                   src_masks_names = None, tgt_mask_name = None):
+                   src_masks_names = None, tgt_mask_name = None,
+                   use_single_precision = 0,
+                   weight_pruning_threshold = 0.0):
         """
         @see yac_cdef_couple_instance
         """
@@ -613,7 +617,9 @@ class YAC:
                                   interp_stack.interp_stack_id, src_lag, tgt_lag,
                                   weight_file_ptr, mapping_on_source,
                                   scale_factor, scale_summand,
-                                  0, src_mask_names_ptr, tgt_mask_name_ptr)
+                                  0, src_mask_names_ptr, tgt_mask_name_ptr,
+                                  use_single_precision,
+                                  weight_pruning_threshold)
 
     def enddef(self):
         """
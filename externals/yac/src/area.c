@@ -492,6 +492,190 @@ double yac_huiliers_area (struct grid_cell cell) {
   return fabs(area);
 }
 
+/* ----------------------------------- */
+
+// number of triangles that are processed at once by
+// yac_huiliers_area_batch
+#define TRI_AREA_BLOCK_SIZE (256)
+
+// branch-free version of tri_area_quarter_angle
+static inline void tri_area_quarter_angle_bf(
+  double angle_sin, double angle_cos, double * q_sin, double * q_cos) {
+
+  double tan = fabs(angle_sin / (1.0 + fabs(angle_cos)));
+  double one_plus_sq_tan = 1.0 + tan * tan;
+  double sqrt_one_plus_sq_tan = sqrt(one_plus_sq_tan);
+
+  // second and third quadrant
+  int second_third = angle_cos < 0.0;
+  double a = second_third?tan:1.0;
+  double b = second_third?1.0:tan;
+
+  double scale = M_SQRT1_2 / sqrt(one_plus_sq_tan + a * sqrt_one_plus_sq_tan);
+  double x = clamp_abs_one(b * scale);
+  double y = clamp_abs_one((a + sqrt_one_plus_sq_tan) * scale);
+
+  // angles >= 7*PI/4 are assumed to be caused by numerical inaccuracy
+  int is_zero = (angle_sin < 0.0) & (angle_cos >= M_SQRT1_2);
+  int first_second = angle_sin >= 0.0;
+
+  *q_sin = is_zero?0.0:(first_second?x:y);
+  *q_cos = is_zero?1.0:(first_second?y:x);
+}
+
+// branch-free version of get_vector_angle_2
+static inline void get_vector_angle_bf(
+  double ax, double ay, double az, double bx, double by, double bz,
+  double * angle_sin, double * angle_cos) {
+
+  double cross_x = det2_kahan(ay, az, by, bz);
+  double cross_y = det2_kahan(az, ax, bz, bx);
+  double cross_z = det2_kahan(ax, ay, bx, by);
+
+  *angle_sin =
+    clamp_abs_one(
+      sqrt(cross_x * cross_x + cross_y * cross_y + cross_z * cross_z));
+  *angle_cos = clamp_abs_one(ax * bx + ay * by + az * bz);
+}
+
+/** signed areas of a block of triangles (see tri_area_ and
+  * yac_huiliers_area); all loops are free of branches and operate on
+  * contiguous arrays, such that they can be vectorised by the compiler
+  */
+static void tri_area_block(
+  size_t n, double const (* restrict coords)[TRI_AREA_BLOCK_SIZE],
+  double * restrict area) {
+
+  // coordinates of the three corners of each triangle
+  double const * restrict ux = coords[0];
+  double const * restrict uy = coords[1];
+  double const * restrict uz = coords[2];
+  double const * restrict vx = coords[3];
+  double const * restrict vy = coords[4];
+  double const * restrict vz = coords[5];
+  double const * restrict wx = coords[6];
+  double const * restrict wy = coords[7];
+  double const * restrict wz = coords[8];
+
+YAC_OMP(simd)
+  for (size_t i = 0; i < n; ++i) {
+
+    double sin_a, cos_a, sin_b, cos_b, sin_c, cos_c;
+    get_vector_angle_bf(
+      ux[i], uy[i], uz[i], vx[i], vy[i], vz[i], &sin_a, &cos_a);
+    get_vector_angle_bf(
+      ux[i], uy[i], uz[i], wx[i], wy[i], wz[i], &sin_b, &cos_b);
+    get_vector_angle_bf(
+      wx[i], wy[i], wz[i], vx[i], vy[i], vz[i], &sin_c, &cos_c);
+
+    // triangles with an edge of length zero have no area
+    int is_degenerated =
+      ((sin_a == 0.0) & (cos_a > 0.0)) |
+      ((sin_b == 0.0) & (cos_b > 0.0)) |
+      ((sin_c == 0.0) & (cos_c > 0.0));
+
+    double sin_sin = sin_a * sin_b;
+    double sin_cos = sin_a * cos_b;
+    double cos_sin = cos_a * sin_b;
+    double cos_cos = cos_a * cos_b;
+
+    double sin_sin_sin = sin_sin * sin_c;
+    double sin_sin_cos = sin_sin * cos_c;
+    double sin_cos_sin = sin_cos * sin_c;
+    double sin_cos_cos = sin_cos * cos_c;
+    double cos_sin_sin = cos_sin * sin_c;
+    double cos_sin_cos = cos_sin * cos_c;
+    double cos_cos_sin = cos_cos * sin_c;
+    double cos_cos_cos = cos_cos * cos_c;
+
+    double t_sin_a = sin_sin_sin - sin_cos_cos;
+    double t_sin_b = cos_sin_cos + cos_cos_sin;
+    double t_sin_c = sin_sin_sin + sin_cos_cos;
+    double t_sin_d = cos_sin_cos - cos_cos_sin;
+    double t_cos_a = cos_cos_cos - cos_sin_sin;
+    double t_cos_b = sin_sin_cos + sin_cos_sin;
+    double t_cos_c = cos_cos_cos + cos_sin_sin;
+    double t_cos_d = sin_sin_cos - sin_cos_sin;
+
+    double q_sin[4], q_cos[4];
+    tri_area_quarter_angle_bf(
+      - t_sin_a + t_sin_b, + t_cos_a - t_cos_b, &q_sin[0], &q_cos[0]);
+    tri_area_quarter_angle_bf(
+      + t_sin_a + t_sin_b, + t_cos_a + t_cos_b, &q_sin[1], &q_cos[1]);
+    tri_area_quarter_angle_bf(
+      + t_sin_c - t_sin_d, + t_cos_c + t_cos_d, &q_sin[2], &q_cos[2]);
+    tri_area_quarter_angle_bf(
+      + t_sin_c + t_sin_d, + t_cos_c - t_cos_d, &q_sin[3], &q_cos[3]);
+
+    double t = (q_sin[0] * q_sin[1] * q_sin[2] * q_sin[3]) /
+               (q_cos[0] * q_cos[1] * q_cos[2] * q_cos[3]);
+
+    // the orientation of the triangle determines the sign of its area
+    // (see yac_huiliers_area)
+    double norm_x = det2_kahan(vy[i], vz[i], wy[i], wz[i]);
+    double norm_y = det2_kahan(vz[i], vx[i], wz[i], wx[i]);
+    double norm_z = det2_kahan(vx[i], vy[i], wx[i], wy[i]);
+    double norm_scale =
+      sqrt(norm_x * norm_x + norm_y * norm_y + norm_z * norm_z);
+    double scalar_base = norm_x * ux[i] + norm_y * uy[i] + norm_z * uz[i];
+    int is_skipped = norm_scale <= yac_angle_tol;
+
+    // the area is computed in a separate loop, because most math libraries
+    // do not provide a vectorised version of atan
+    area[i] =
+      (is_degenerated | is_skipped)?
+        0.0:((scalar_base > 0.0)?sqrt(fabs(t)):-sqrt(fabs(t)));
+  }
+
+  for (size_t i = 0; i < n; ++i)
+    area[i] = 4.0 * atan(area[i]);
+}
+
+void yac_huiliers_area_batch(
+  size_t num_cells, size_t const * num_corners_per_cell,
+  double const * x, double const * y, double const * z, double * areas) {
+
+  double coords[9][TRI_AREA_BLOCK_SIZE];
+  double tri_areas[TRI_AREA_BLOCK_SIZE];
+  size_t tri_cell_idx[TRI_AREA_BLOCK_SIZE];
+  size_t num_tris = 0;
+
+  // each cell is split into triangles, which all share the first corner of
+  // the cell; the triangles are processed in blocks
+  for (size_t i = 0, offset = 0; i < num_cells; ++i) {
+
+    size_t M = num_corners_per_cell[i];
+    areas[i] = 0.0;
+
+    for (size_t j = 2; j < M; ++j) {
+
+      size_t corner_idx[3] = {offset, offset + j - 1, offset + j};
+      for (int k = 0; k < 3; ++k) {
+        coords[3*k+0][num_tris] = x[corner_idx[k]];
+        coords[3*k+1][num_tris] = y[corner_idx[k]];
+        coords[3*k+2][num_tris] = z[corner_idx[k]];
+      }
+      tri_cell_idx[num_tris] = i;
+
+      if (++num_tris == TRI_AREA_BLOCK_SIZE) {
+        tri_area_block(
+          num_tris, (double const (*)[TRI_AREA_BLOCK_SIZE])coords, tri_areas);
+        for (size_t k = 0; k < num_tris; ++k)
+          areas[tri_cell_idx[k]] += tri_areas[k];
+        num_tris = 0;
+      }
+    }
+    offset += M;
+  }
+
+  tri_area_block(
+    num_tris, (double const (*)[TRI_AREA_BLOCK_SIZE])coords, tri_areas);
+  for (size_t k = 0; k < num_tris; ++k)
+    areas[tri_cell_idx[k]] += tri_areas[k];
+
+  for (size_t i = 0; i < num_cells; ++i) areas[i] = fabs(areas[i]);
+}
+
 static double tri_area_info(
   double ref[3], double a[3], double b[3],
   double * barycenter, double sign) {
@@ -171,6 +171,29 @@ double yac_planar_3dcell_area (struct grid_cell cell);
   * to our implementation of Huilier's algorithm for edge lengths of up to 1 km.
   */
 double yac_huiliers_area(struct grid_cell cell);
+
+/**
+  * \brief computes the areas of multiple cells based on L'Huilier's Theorem
+  *
+  * Same algorithm as \ref yac_huiliers_area, but the coordinates are
+  * provided as structure-of-arrays and the cells are processed in blocks of
+  * triangles. The core loop contains no branches, such that it can be
+  * vectorised by the compiler. Results match \ref yac_huiliers_area up to
+  * rounding errors.
+  *
+  * @param[in]  num_cells            number of cells
+  * @param[in]  num_corners_per_cell number of corners per cell
+  * @param[in]  x                    x-coordinates of the corners of all cells
+  * @param[in]  y                    y-coordinates of the corners of all cells
+  * @param[in]  z                    z-coordinates of the corners of all cells
+  * @param[out] areas                area of each cell
+  *
+  * \remark all edges have to be on great circles (cells with circle of
+  *         latitude edges have to be handled by \ref yac_huiliers_area)
+  */
+void yac_huiliers_area_batch(
+  size_t num_cells, size_t const * num_corners_per_cell,
+  double const * x, double const * y, double const * z, double * areas);
 double yac_huiliers_area_info(
   struct grid_cell cell, double * barycenter, double sign);
 
@@ -105,27 +105,155 @@ static enum yac_cell_type get_cell_type(struct grid_cell target_cell);
 
 /* ------------------------- */
 
-static struct grid_cell * overlap_cell_buffer = NULL;
-static size_t overlap_cell_buffer_size = 0;
+struct yac_clipping_buffer {
+
+  // overlap cells generated by yac_compute_overlap_info_r
+  struct grid_cell * overlap_cells;
+  size_t overlap_cells_array_size;
+
+  // edge circles of the target and source cells
+  struct yac_circle * circles;
+  size_t circles_array_size;
+
+  // point lists (the elements of these lists are being reused across calls)
+  struct point_list target_list, source_list, temp_list;
+
+  // structure-of-arrays copy of the overlap cells for the area computation
+  double * soa_coords;
+  size_t soa_coords_array_size;
+  size_t * num_corners;
+  size_t num_corners_array_size;
+  double * areas;
+  size_t areas_array_size;
+};
+
+// buffer used by the non-reentrant interfaces
+static struct yac_clipping_buffer * default_clipping_buffer = NULL;
+
+static void init_clipping_buffer(struct yac_clipping_buffer * buffer) {
+
+  buffer->overlap_cells = NULL;
+  buffer->overlap_cells_array_size = 0;
+  buffer->circles = NULL;
+  buffer->circles_array_size = 0;
+  init_point_list(&(buffer->target_list));
+  init_point_list(&(buffer->source_list));
+  init_point_list(&(buffer->temp_list));
+  buffer->soa_coords = NULL;
+  buffer->soa_coords_array_size = 0;
+  buffer->num_corners = NULL;
+  buffer->num_corners_array_size = 0;
+  buffer->areas = NULL;
+  buffer->areas_array_size = 0;
+}
 
-static inline struct grid_cell * get_overlap_cell_buffer(size_t N) {
+static void free_clipping_buffer(struct yac_clipping_buffer * buffer) {
+
+  for (size_t i = 0; i < buffer->overlap_cells_array_size; ++i)
+    yac_free_grid_cell(buffer->overlap_cells + i);
+  free(buffer->overlap_cells);
+  free(buffer->circles);
+  free_point_list(&(buffer->target_list));
+  free_point_list(&(buffer->source_list));
+  free_point_list(&(buffer->temp_list));
+  free(buffer->soa_coords);
+  free(buffer->num_corners);
+  free(buffer->areas);
+  init_clipping_buffer(buffer);
+}
+
+struct yac_clipping_buffer * yac_clipping_buffer_new() {
+
+  struct yac_clipping_buffer * buffer = xmalloc(1 * sizeof(*buffer));
+  init_clipping_buffer(buffer);
+  return buffer;
+}
+
+void yac_clipping_buffer_delete(struct yac_clipping_buffer * buffer) {
+
+  if (buffer == NULL) return;
+  free_clipping_buffer(buffer);
+  free(buffer);
+}
+
+static inline struct grid_cell * get_overlap_cell_buffer(
+  struct yac_clipping_buffer * buffer, size_t N) {
 
   // ensure that there are enough buffer cells
 
-  if (overlap_cell_buffer_size < N) {
+  if (buffer->overlap_cells_array_size < N) {
 
-    size_t old_overlap_cell_buffer_size = overlap_cell_buffer_size;
+    size_t old_overlap_cells_array_size = buffer->overlap_cells_array_size;
 
-    ENSURE_ARRAY_SIZE(overlap_cell_buffer, overlap_cell_buffer_size, N);
+    ENSURE_ARRAY_SIZE(
+      buffer->overlap_cells, buffer->overlap_cells_array_size, N);
 
-    for (; old_overlap_cell_buffer_size < overlap_cell_buffer_size;
-         ++old_overlap_cell_buffer_size)
-      yac_init_grid_cell(overlap_cell_buffer + old_overlap_cell_buffer_size);
+    for (; old_overlap_cells_array_size < buffer->overlap_cells_array_size;
+         ++old_overlap_cells_array_size)
+      yac_init_grid_cell(buffer->overlap_cells + old_overlap_cells_array_size);
   }
 
-  return overlap_cell_buffer;
+  return buffer->overlap_cells;
 }
 
+// computes the areas of the overlap cells, cells that only have great circle
+// edges are processed by the batched area computation
+static void compute_overlap_cell_areas(
+  struct yac_clipping_buffer * buffer, size_t N,
+  struct grid_cell * overlap_cells, double * areas) {
+
+  size_t total_num_corners = 0;
+  for (size_t i = 0; i < N; ++i)
+    total_num_corners += overlap_cells[i].num_corners;
+
+  ENSURE_ARRAY_SIZE(
+    buffer->soa_coords, buffer->soa_coords_array_size,
+    3 * total_num_corners);
+  ENSURE_ARRAY_SIZE(buffer->num_corners, buffer->num_corners_array_size, N);
+  double * x = buffer->soa_coords;
+  double * y = x + total_num_corners;
+  double * z = y + total_num_corners;
+  size_t * num_corners = buffer->num_corners;
+
+  int has_lat_cells = 0;
+  for (size_t i = 0, k = 0; i < N; ++i) {
+
+    struct grid_cell cell = overlap_cells[i];
+
+    int is_lat_cell = 0;
+    for (size_t j = 0; j < cell.num_corners; ++j)
+      is_lat_cell |= cell.edge_type[j] == LAT_CIRCLE_EDGE;
+    has_lat_cells |= is_lat_cell;
+
+    // cells with circle of latitude edges are skipped here
+    num_corners[i] = is_lat_cell?0:cell.num_corners;
+    for (size_t j = 0; j < num_corners[i]; ++j, ++k) {
+      x[k] = cell.coordinates_xyz[j][0];
+      y[k] = cell.coordinates_xyz[j][1];
+      z[k] = cell.coordinates_xyz[j][2];
+    }
+  }
+
+  yac_huiliers_area_batch(N, num_corners, x, y, z, areas);
+
+  if (has_lat_cells)
+    for (size_t i = 0; i < N; ++i)
+      if ((num_corners[i] == 0) && (overlap_cells[i].num_corners > 1))
+        areas[i] = yac_huiliers_area(overlap_cells[i]);
+}
+
+static struct yac_clipping_buffer * get_default_clipping_buffer() {
+
+  if (default_clipping_buffer == NULL)
+    default_clipping_buffer = yac_clipping_buffer_new();
+  return default_clipping_buffer;
+}
+
+static void cell_clipping(
+  struct yac_clipping_buffer * buffer, size_t N,
+  struct grid_cell * source_cell, struct grid_cell target_cell,
+  struct grid_cell * overlap_buffer);
+
 /* ------------------------- */
 
 static double get_edge_direction(
@@ -154,12 +282,24 @@ void yac_compute_overlap_info (size_t N,
                                double * overlap_areas,
                                double (*overlap_barycenters)[3]) {
 
+  yac_compute_overlap_info_r(
+    get_default_clipping_buffer(), N, source_cell, target_cell,
+    overlap_areas, overlap_barycenters);
+}
+
+void yac_compute_overlap_info_r (struct yac_clipping_buffer * buffer,
+                                 size_t N,
+                                 struct grid_cell * source_cell,
+                                 struct grid_cell target_cell,
+                                 double * overlap_areas,
+                                 double (*overlap_barycenters)[3]) {
+
   YAC_ASSERT(
     target_cell.num_corners > 2,
     "ERROR(yac_compute_overlap_info): "
     "target cell has too few corners")
 
-  struct grid_cell * overlap_buffer = get_overlap_cell_buffer(N);
+  struct grid_cell * overlap_buffer = get_overlap_cell_buffer(buffer, N);
   enum yac_cell_type target_cell_type;
 
   // initialise barycenter coordinates if available
@@ -175,25 +315,25 @@ void yac_compute_overlap_info (size_t N,
   // special case: target is a triangle or a lon-lat cell -> no triangulation
   // of the target is required
   if ( target_cell.num_corners < 4 || target_cell_type == LON_LAT_CELL ) {
-    yac_cell_clipping ( N, source_cell, target_cell, overlap_buffer);
+    cell_clipping(buffer, N, source_cell, target_cell, overlap_buffer);
+    if (overlap_barycenters == NULL) {
+      compute_overlap_cell_areas(buffer, N, overlap_buffer, overlap_areas);
+      return;
+    }
     for (size_t i = 0; i < N; ++i) {
       if (overlap_buffer[i].num_corners > 1) {
-        if (overlap_barycenters == NULL)
-          overlap_areas[i] = yac_huiliers_area (overlap_buffer[i]);
-        else {
-          overlap_areas[i] =
-            yac_huiliers_area_info(
-              overlap_buffer[i], overlap_barycenters[i], 1.0);
-          if ((overlap_barycenters[i][0] != 0.0) ||
-              (overlap_barycenters[i][1] != 0.0) ||
-              (overlap_barycenters[i][2] != 0.0))
-            normalise_vector(overlap_barycenters[i]);
-          if (overlap_areas[i] < 0.0) {
-            overlap_areas[i] = -overlap_areas[i];
-            overlap_barycenters[i][0] = -overlap_barycenters[i][0];
-            overlap_barycenters[i][1] = -overlap_barycenters[i][1];
-            overlap_barycenters[i][2] = -overlap_barycenters[i][2];
-          }
+        overlap_areas[i] =
+          yac_huiliers_area_info(
+            overlap_buffer[i], overlap_barycenters[i], 1.0);
+        if ((overlap_barycenters[i][0] != 0.0) ||
+            (overlap_barycenters[i][1] != 0.0) ||
+            (overlap_barycenters[i][2] != 0.0))
+          normalise_vector(overlap_barycenters[i]);
+        if (overlap_areas[i] < 0.0) {
+          overlap_areas[i] = -overlap_areas[i];
+          overlap_barycenters[i][0] = -overlap_barycenters[i][0];
+          overlap_barycenters[i][1] = -overlap_barycenters[i][1];
+          overlap_barycenters[i][2] = -overlap_barycenters[i][2];
         }
       } else {
         overlap_areas[i] = 0.0;
@@ -250,20 +390,27 @@ void yac_compute_overlap_info (size_t N,
     target_partial_cell.coordinates_xyz[2][2] = corner_b[2];
 
     // clip the current target cell triangle with all source cells
-    yac_cell_clipping(N, source_cell, target_partial_cell, overlap_buffer);
+    cell_clipping(
+      buffer, N, source_cell, target_partial_cell, overlap_buffer);
 
-    // for all source cells
-    for (size_t n = 0; n < N; n++) {
+    if (overlap_barycenters == NULL) {
 
-      if (overlap_buffer[n].num_corners == 0) continue;
+      ENSURE_ARRAY_SIZE(buffer->areas, buffer->areas_array_size, N);
+      compute_overlap_cell_areas(buffer, N, overlap_buffer, buffer->areas);
+      for (size_t n = 0; n < N; n++)
+        overlap_areas[n] += buffer->areas[n] * edge_direction;
+
+    } else {
+
+      // for all source cells
+      for (size_t n = 0; n < N; n++) {
+
+        if (overlap_buffer[n].num_corners == 0) continue;
 
-      if (overlap_barycenters == NULL)
-        overlap_areas[n] +=
-          yac_huiliers_area(overlap_buffer[n]) * edge_direction;
-      else
         overlap_areas[n] +=
           yac_huiliers_area_info(
             overlap_buffer[n], overlap_barycenters[n], edge_direction);
+      }
     }
   }
 
@@ -311,6 +458,57 @@ void yac_compute_overlap_areas (size_t N,
     N, source_cell, target_cell, partial_areas, NULL);
 }
 
+void yac_compute_overlap_areas_r (struct yac_clipping_buffer * buffer,
+                                  size_t N,
+                                  struct grid_cell * source_cell,
+                                  struct grid_cell target_cell,
+                                  double * partial_areas) {
+
+  yac_compute_overlap_info_r(
+    buffer, N, source_cell, target_cell, partial_areas, NULL);
+}
+
+void yac_compute_overlap_info_batch (size_t num_tgt_cells,
+                                     struct grid_cell * target_cells,
+                                     size_t const * num_src_per_tgt,
+                                     struct grid_cell * source_cells,
+                                     double * overlap_areas,
+                                     double (*overlap_barycenters)[3]) {
+
+  size_t * src_offsets =
+    xmalloc((num_tgt_cells + 1) * sizeof(*src_offsets));
+  src_offsets[0] = 0;
+  for (size_t i = 0; i < num_tgt_cells; ++i)
+    src_offsets[i+1] = src_offsets[i] + num_src_per_tgt[i];
+
+  // each thread works with its own buffer, the target cells are distributed
+  // dynamically, because the clipping costs can vary strongly between cells
+YAC_OMP(parallel)
+  {
+    struct yac_clipping_buffer buffer;
+    init_clipping_buffer(&buffer);
+
+YAC_OMP(for schedule(dynamic, 16))
+    for (size_t i = 0; i < num_tgt_cells; ++i) {
+
+      size_t src_offset = src_offsets[i];
+      size_t src_count = src_offsets[i+1] - src_offset;
+
+      if (src_count == 0) continue;
+
+      yac_compute_overlap_info_r(
+        &buffer, src_count, source_cells + src_offset, target_cells[i],
+        overlap_areas + src_offset,
+        (overlap_barycenters != NULL)?
+          (overlap_barycenters + src_offset):NULL);
+    }
+
+    free_clipping_buffer(&buffer);
+  }
+
+  free(src_offsets);
+}
+
 /* ------------------------- */
 
 static enum yac_cell_type get_cell_type(struct grid_cell target_cell) {
@@ -1122,6 +1320,18 @@ void yac_cell_clipping (size_t N,
                         struct grid_cell target_cell,
                         struct grid_cell * overlap_buffer) {
 
+  // a temporary buffer keeps this interface thread-safe
+  struct yac_clipping_buffer buffer;
+  init_clipping_buffer(&buffer);
+  cell_clipping(&buffer, N, source_cell, target_cell, overlap_buffer);
+  free_clipping_buffer(&buffer);
+}
+
+static void cell_clipping(
+  struct yac_clipping_buffer * buffer, size_t N,
+  struct grid_cell * source_cell, struct grid_cell target_cell,
+  struct grid_cell * overlap_buffer) {
+
   if (target_cell.num_corners < 2) {
     for (size_t n = 0; n < N; n++ ) overlap_buffer[n].num_corners = 0;
     return;
@@ -1146,23 +1356,21 @@ void yac_cell_clipping (size_t N,
   for (size_t n = 0; n < N; ++n)
     if (source_cell[n].num_corners > max_num_src_cell_corners)
       max_num_src_cell_corners = source_cell[n].num_corners;
-  struct yac_circle * circle_buffer =
-    xmalloc(
-      (target_cell.num_corners + max_num_src_cell_corners) *
-       sizeof(*circle_buffer));
+  ENSURE_ARRAY_SIZE(
+    buffer->circles, buffer->circles_array_size,
+    target_cell.num_corners + max_num_src_cell_corners);
+  struct yac_circle * circle_buffer = buffer->circles;
   struct yac_circle * src_circle_buffer =
     circle_buffer + target_cell.num_corners;
 
   // generate point list for target cell (clip cell)
-  struct point_list target_list;
-  init_point_list(&target_list);
+  struct point_list * target_list = &(buffer->target_list);
   size_t nct =
     generate_point_list(
-      &target_list, target_cell, target_ordering, circle_buffer);
+      target_list, target_cell, target_ordering, circle_buffer);
 
-  struct point_list source_list, temp_list;
-  init_point_list(&temp_list);
-  init_point_list(&source_list);
+  struct point_list * source_list = &(buffer->source_list);
+  struct point_list * temp_list = &(buffer->temp_list);
 
   // for all source cells
   for (size_t n = 0; n < N; n++ ) {
@@ -1187,7 +1395,7 @@ void yac_cell_clipping (size_t N,
     // generate point list for current source list
     size_t ncs =
       generate_point_list(
-        &source_list, source_cell[n], source_ordering, src_circle_buffer);
+        source_list, source_cell[n], source_ordering, src_circle_buffer);
 
     struct point_list * overlap;
     double fabs_tgt_coordinate_z = fabs(target_cell.coordinates_xyz[0][2]);
@@ -1202,26 +1410,22 @@ void yac_cell_clipping (size_t N,
         ((tgt_cell_type == LAT_CELL) && (src_cell_type == LAT_CELL) &&
          (fabs_tgt_coordinate_z > fabs_src_coordinate_z))) {
 
-      copy_point_list(target_list, &temp_list);
+      copy_point_list(*target_list, temp_list);
 
-      point_list_clipping(&temp_list, source_list, ncs);
+      point_list_clipping(temp_list, *source_list, ncs);
 
-      overlap = &temp_list;
+      overlap = temp_list;
 
     } else {
 
-      point_list_clipping(&source_list, target_list, nct);
+      point_list_clipping(source_list, *target_list, nct);
 
-      overlap = &source_list;
+      overlap = source_list;
     }
 
     generate_cell(overlap, overlap_buffer + n);
 
   }
-  free(circle_buffer);
-  free_point_list(&source_list);
-  free_point_list(&target_list);
-  free_point_list(&temp_list);
 }
 
 static void yac_lon_lat_cell_lat_clipping(
@@ -61,6 +61,25 @@
 
 struct yac_circle;
 
+/**
+ * scratch space for the clipping routines\n
+ * Each thread calling the reentrant clipping routines (e.g.
+ * \ref yac_compute_overlap_info_r) has to use its own buffer.
+ */
+struct yac_clipping_buffer;
+
+/**
+ * generates a new scratch buffer for the reentrant clipping routines
+ * @return clipping buffer
+ */
+struct yac_clipping_buffer * yac_clipping_buffer_new();
+
+/**
+ * frees all memory associated with a clipping buffer
+ * @param[in] buffer clipping buffer
+ */
+void yac_clipping_buffer_delete(struct yac_clipping_buffer * buffer);
+
 /**
   * \brief cell clipping to get the cells describing the intersections
   *
@@ -84,6 +103,9 @@ struct yac_circle;
   *         using \ref yac_init_grid_cell; initialisation have to be done only once,
   *         in consecutive calls, the cells can be reused with have to be
   *         reinitialised)
+  * \remark this routine allocates and frees its own scratch buffer in each
+  *         call and is therefore thread-safe; the reentrant routines (e.g.
+  *         \ref yac_compute_overlap_info_r) reuse a caller-owned buffer
   *
  **/
 void yac_cell_clipping (size_t N,
@@ -147,12 +169,33 @@ void yac_cell_lat_clipping (size_t N,
   * @param[out] partial_areas   list of N partial weights, one weight for each
   *                             source-target intersection
   *
+  * \remark this routine uses an internal buffer and is therefore not
+  *         thread-safe (see \ref yac_compute_overlap_areas_r)
+  *
  **/
 void yac_compute_overlap_areas (size_t N,
                                 struct grid_cell * source_cell,
                                 struct grid_cell target_cell,
                                 double * partial_areas);
 
+/**
+  * \brief reentrant version of \ref yac_compute_overlap_areas
+  *
+  * @param[in]  buffer          clipping buffer (see
+  *                             \ref yac_clipping_buffer_new)
+  * @param[in]  N               number of source cells
+  * @param[in]  source_cell     list of source cells
+  * @param[in]  target_cell     target cell
+  * @param[out] partial_areas   list of N partial weights, one weight for each
+  *                             source-target intersection
+  *
+ **/
+void yac_compute_overlap_areas_r (struct yac_clipping_buffer * buffer,
+                                  size_t N,
+                                  struct grid_cell * source_cell,
+                                  struct grid_cell target_cell,
+                                  double * partial_areas);
+
 /**
   * \brief calculates partial areas for all overlapping parts of the source
   *        cells with arbitrary target cells, this is required for conservative
@@ -178,12 +221,60 @@ void yac_compute_overlap_areas (size_t N,
   * @param[out] overlap_barycenters coordinates of the barycenters of the
   *                                 overlap cell
   *
+  * \remark this routine uses an internal buffer and is therefore not
+  *         thread-safe (see \ref yac_compute_overlap_info_r)
+  *
  **/
 void yac_compute_overlap_info (size_t N,
                                struct grid_cell * source_cell,
                                struct grid_cell target_cell,
                                double * overlap_areas,
                                double (*overlap_barycenters)[3]);
+
+/**
+  * \brief reentrant version of \ref yac_compute_overlap_info
+  *
+  * @param[in]  buffer              clipping buffer (see
+  *                                 \ref yac_clipping_buffer_new)
+  * @param[in]  N                   number of source cells
+  * @param[in]  source_cell         list of source cells
+  * @param[in]  target_cell         target cell
+  * @param[out] overlap_areas       list of N partial weights, one weight for
+  *                                 each source-target intersection
+  * @param[out] overlap_barycenters coordinates of the barycenters of the
+  *                                 overlap cell (may be NULL)
+  *
+ **/
+void yac_compute_overlap_info_r (struct yac_clipping_buffer * buffer,
+                                 size_t N,
+                                 struct grid_cell * source_cell,
+                                 struct grid_cell target_cell,
+                                 double * overlap_areas,
+                                 double (*overlap_barycenters)[3]);
+
+/**
+  * \brief computes the overlaps for a batch of target cells, each with its
+  *        own list of source cells
+  *
+  * The source cells of all target cells are stored consecutively in
+  * source_cells. If YAC was compiled with OpenMP support, the target cells
+  * are processed in parallel.
+  *
+  * @param[in]  num_tgt_cells       number of target cells
+  * @param[in]  target_cells        target cells
+  * @param[in]  num_src_per_tgt     number of source cells per target cell
+  * @param[in]  source_cells        source cells of all target cells
+  * @param[out] overlap_areas       overlap areas for all source cells
+  * @param[out] overlap_barycenters coordinates of the barycenters of the
+  *                                 overlap cells (may be NULL)
+  *
+ **/
+void yac_compute_overlap_info_batch (size_t num_tgt_cells,
+                                     struct grid_cell * target_cells,
+                                     size_t const * num_src_per_tgt,
+                                     struct grid_cell * source_cells,
+                                     double * overlap_areas,
+                                     double (*overlap_barycenters)[3]);
 /**
   * \brief correct interpolation weights
   *
@@ -102,6 +102,10 @@ struct field_couple_buffer {
   char const ** src_mask_names;
   size_t num_src_mask_names;
   char const * tgt_mask_name;
+
+  int use_single_precision;
+
+  double weight_pruning_threshold;
 };
 
 enum yaml_base_key_types {
@@ -130,6 +134,8 @@ enum yaml_couple_key_types {
   SOURCE_MASK_NAME,
   SOURCE_MASK_NAMES,
   TARGET_MASK_NAME,
+  PRECISION,
+  WEIGHT_PRUNING_THRESHOLD,
 };
 
 #define CAST_NAME_TYPE_PAIRS(...) (struct yac_name_type_pair[]) {__VA_ARGS__}
@@ -166,7 +172,9 @@ DEF_NAME_TYPE_PAIRS(
   DEF_NAME_TYPE_PAIR(interpolation,    INTERPOLATION),
   DEF_NAME_TYPE_PAIR(src_mask_name,    SOURCE_MASK_NAME),
   DEF_NAME_TYPE_PAIR(src_mask_names,   SOURCE_MASK_NAMES),
-  DEF_NAME_TYPE_PAIR(tgt_mask_name,    TARGET_MASK_NAME));
+  DEF_NAME_TYPE_PAIR(tgt_mask_name,    TARGET_MASK_NAME),
+  DEF_NAME_TYPE_PAIR(precision,        PRECISION),
+  DEF_NAME_TYPE_PAIR(weight_pruning_threshold, WEIGHT_PRUNING_THRESHOLD));
 
 DEF_NAME_TYPE_PAIRS(
   bool_names,
@@ -207,7 +215,13 @@ DEF_NAME_TYPE_PAIRS(
 DEF_NAME_TYPE_PAIRS(
   mapping_sides,
   DEF_NAME_TYPE_PAIR(source, 1),
-  DEF_NAME_TYPE_PAIR(target, 0));
+  DEF_NAME_TYPE_PAIR(target, 0),
+  DEF_NAME_TYPE_PAIR(auto,   2));
+
+DEF_NAME_TYPE_PAIRS(
+  precisions,
+  DEF_NAME_TYPE_PAIR(single, 1),
+  DEF_NAME_TYPE_PAIR(double, 0));
 
 typedef
 #if defined __NVCOMPILER && __NVCOMPILER_MAJOR__ <= 24
@@ -1154,6 +1168,17 @@ static void yaml_parse_couple_map_pair(
         yaml_parse_string_value(
           value_node, couple_key_name, yaml_filename);
       break;
+    case (PRECISION):
+      field_buffer->use_single_precision =
+        yaml_parse_enum_value(
+          precisions, num_precisions,
+          value_node, couple_key_name, yaml_filename);
+      break;
+    case (WEIGHT_PRUNING_THRESHOLD):
+      field_buffer->weight_pruning_threshold =
+        yaml_parse_double_value(
+          value_node, couple_key_name, yaml_filename);
+      break;
   }
 }
 
@@ -1186,7 +1211,9 @@ static void yaml_parse_couple(
     .scale_summand = 0.0,
     .src_mask_names = NULL,
     .num_src_mask_names = 0,
-    .tgt_mask_name = NULL};
+    .tgt_mask_name = NULL,
+    .use_single_precision = 0,
+    .weight_pruning_threshold = 0.0};
 
   // parse couple
   void * iter = NULL;
@@ -1243,7 +1270,9 @@ static void yaml_parse_couple(
       field_buffer.scale_summand,
       field_buffer.num_src_mask_names,
       field_buffer.src_mask_names,
-      field_buffer.tgt_mask_name);
+      field_buffer.tgt_mask_name,
+      field_buffer.use_single_precision,
+      field_buffer.weight_pruning_threshold);
 
   // cleanup
   free((void*)field_buffer.field_names);
@@ -1941,6 +1970,26 @@ static void yac_yaml_append_couple_field_nodes(
         yaml_couple_keys, num_yaml_couple_keys, TARGET_MASK_NAME),
       tgt_mask_name);
 
+  // add precision (only if it differs from the default)
+  if (yac_couple_config_use_single_precision(
+        couple_config, couple_idx, field_couple_idx))
+    yac_yaml_map_append_scalar(
+      field_couple_node,
+      yac_name_type_pair_get_name(
+        yaml_couple_keys, num_yaml_couple_keys, PRECISION),
+      yac_name_type_pair_get_name(precisions, num_precisions, 1));
+
+  // add weight pruning threshold (only if pruning is enabled)
+  double weight_pruning_threshold =
+    yac_couple_config_get_weight_pruning_threshold(
+      couple_config, couple_idx, field_couple_idx);
+  if (weight_pruning_threshold > 0.0)
+    yac_yaml_map_append_scalar_dble(
+      field_couple_node,
+      yac_name_type_pair_get_name(
+        yaml_couple_keys, num_yaml_couple_keys, WEIGHT_PRUNING_THRESHOLD),
+      weight_pruning_threshold);
+
   int appending_failed =
     fy_node_sequence_append(coupling_node, field_couple_node);
   YAC_ASSERT(
@@ -113,6 +113,10 @@ struct yac_couple_config_field_couple {
   char ** src_mask_names;
   size_t num_src_mask_names;
   char * tgt_mask_name;
+
+  int use_single_precision;
+
+  double weight_pruning_threshold;
 };
 
 struct yac_couple_config_couple {
@@ -602,6 +606,17 @@ static void yac_couple_config_field_couple_merge(
     "ERROR(yac_couple_config_field_couple_merge): "
     "inconsistent target mask name (\"%s\" != \"%s\")",
     a->tgt_mask_name, b->tgt_mask_name)
+  YAC_ASSERT_F(
+    a->use_single_precision == b->use_single_precision,
+    "ERROR(yac_couple_config_field_couple_merge): "
+    "inconsistent field data precision (%s != %s)",
+    a->use_single_precision?"single":"double",
+    b->use_single_precision?"single":"double")
+  YAC_ASSERT_F(
+    a->weight_pruning_threshold == b->weight_pruning_threshold,
+    "ERROR(yac_couple_config_field_couple_merge): "
+    "inconsistent weight pruning threshold (%lf != %lf)",
+    a->weight_pruning_threshold, b->weight_pruning_threshold)
 }
 
 static void merge_field_couples(
@@ -1569,6 +1584,21 @@ double yac_couple_config_get_scale_summand(
           scale_summand;
 }
 
+double yac_couple_config_get_weight_pruning_threshold(
+  struct yac_couple_config * couple_config,
+  size_t couple_idx, size_t field_couple_idx) {
+
+  check_field_couple_idx(
+    couple_config, couple_idx, field_couple_idx,
+    "yac_couple_config_get_weight_pruning_threshold", __LINE__);
+
+  return
+    couple_config->
+      couples[couple_idx].
+        field_couples[field_couple_idx].
+          weight_pruning_threshold;
+}
+
 void yac_couple_config_get_src_mask_names(
   struct yac_couple_config * couple_config,
   size_t couple_idx, size_t field_couple_idx,
@@ -1591,6 +1621,21 @@ void yac_couple_config_get_src_mask_names(
           num_src_mask_names;
 }
 
+int yac_couple_config_use_single_precision(
+  struct yac_couple_config * couple_config,
+  size_t couple_idx, size_t field_couple_idx) {
+
+  check_field_couple_idx(
+    couple_config, couple_idx, field_couple_idx,
+    "yac_couple_config_use_single_precision", __LINE__);
+
+  return
+    couple_config->
+      couples[couple_idx].
+        field_couples[field_couple_idx].
+          use_single_precision;
+}
+
 char const * yac_couple_config_get_tgt_mask_name(
   struct yac_couple_config * couple_config,
   size_t couple_idx, size_t field_couple_idx) {
@@ -1749,9 +1794,9 @@ static size_t yac_couple_config_get_field_couple_pack_size(
   struct yac_couple_config_field_couple * field_couple, MPI_Comm comm) {
 
   int ints_pack_size;
-  yac_mpi_call(MPI_Pack_size(10, MPI_INT, comm, &ints_pack_size), comm);
+  yac_mpi_call(MPI_Pack_size(11, MPI_INT, comm, &ints_pack_size), comm);
   int doubles_pack_size;
-  yac_mpi_call(MPI_Pack_size(2, MPI_DOUBLE, comm, &doubles_pack_size), comm);
+  yac_mpi_call(MPI_Pack_size(3, MPI_DOUBLE, comm, &doubles_pack_size), comm);
   int src_mask_names_pack_size = 0;
   if (field_couple->num_src_mask_names > 0)
     for (size_t i = 0; i < field_couple->num_src_mask_names; ++i)
@@ -1770,6 +1815,7 @@ static size_t yac_couple_config_get_field_couple_pack_size(
                              // coupling_period_operation
                              // enforce_write_weight_file
                              // num_src_mask_names
+                             // use_single_precision
     yac_interp_stack_config_get_pack_size(
       field_couple->interp_stack, comm) +
     yac_couple_config_get_string_pack_size(
@@ -1778,6 +1824,7 @@ static size_t yac_couple_config_get_field_couple_pack_size(
       field_couple->weight_file_name, comm) +
     doubles_pack_size + // scale_factor
                         // scale_summand
+                        // weight_pruning_threshold
     src_mask_names_pack_size +
     yac_couple_config_get_string_pack_size(
       field_couple->tgt_mask_name, comm);
@@ -2002,7 +2049,7 @@ static void yac_couple_config_pack_field_couple(
     "ERROR(yac_couple_config_pack_field_couple): "
     "num_src_mask_names bigger than INT_MAX")
 
-  int ints[10] = {
+  int ints[11] = {
     field_couple->source.component_idx,
     field_couple->source.field_idx,
     field_couple->source.lag,
@@ -2012,22 +2059,24 @@ static void yac_couple_config_pack_field_couple(
     field_couple->mapping_on_source,
     field_couple->coupling_period_operation,
     field_couple->enforce_write_weight_file,
-    field_couple->num_src_mask_names};
+    field_couple->num_src_mask_names,
+    field_couple->use_single_precision};
 
   yac_mpi_call(
-    MPI_Pack(ints, 10, MPI_INT, buffer, buffer_size, position, comm), comm);
+    MPI_Pack(ints, 11, MPI_INT, buffer, buffer_size, position, comm), comm);
 
   yac_couple_config_pack_string(
     field_couple->coupling_period, buffer, buffer_size, position, comm);
   yac_couple_config_pack_string(
     field_couple->weight_file_name, buffer, buffer_size, position, comm);
 
-  double doubles[2] = {
+  double doubles[3] = {
     field_couple->scale_factor,
-    field_couple->scale_summand};
+    field_couple->scale_summand,
+    field_couple->weight_pruning_threshold};
 
   yac_mpi_call(
-    MPI_Pack(doubles, 2, MPI_DOUBLE, buffer, buffer_size, position, comm),
+    MPI_Pack(doubles, 3, MPI_DOUBLE, buffer, buffer_size, position, comm),
     comm);
 
   yac_interp_stack_config_pack(
@@ -2260,10 +2309,10 @@ static void yac_couple_config_unpack_field_couple(
   struct yac_couple_config_field_couple * field_couple,
   MPI_Comm comm) {
 
-  int ints[10];
+  int ints[11];
   yac_mpi_call(
     MPI_Unpack(
-      buffer, buffer_size, position, ints, 10, MPI_INT, comm), comm);
+      buffer, buffer_size, position, ints, 11, MPI_INT, comm), comm);
 
   YAC_ASSERT(
     ints[0] >= 0,
@@ -2309,19 +2358,21 @@ static void yac_couple_config_unpack_field_couple(
     (enum yac_reduction_type)(ints[7]);
   field_couple->enforce_write_weight_file = ints[8];
   field_couple->num_src_mask_names = (size_t)(ints[9]);
+  field_couple->use_single_precision = ints[10];
 
   field_couple->coupling_period =
     yac_couple_config_unpack_string(buffer, buffer_size, position, comm);
   field_couple->weight_file_name =
     yac_couple_config_unpack_string(buffer, buffer_size, position, comm);
 
-  double doubles[2];
+  double doubles[3];
   yac_mpi_call(
     MPI_Unpack(
-      buffer, buffer_size, position, doubles, 2, MPI_DOUBLE, comm), comm);
+      buffer, buffer_size, position, doubles, 3, MPI_DOUBLE, comm), comm);
 
   field_couple->scale_factor = doubles[0];
   field_couple->scale_summand = doubles[1];
+  field_couple->weight_pruning_threshold = doubles[2];
 
   field_couple->interp_stack =
     yac_interp_stack_config_unpack(buffer, buffer_size, position, comm);
@@ -2425,7 +2476,8 @@ void yac_couple_config_def_couple(
   const char* weight_file_name, int mapping_on_source,
   double scale_factor, double scale_summand,
   size_t num_src_mask_names, char const * const * src_mask_names,
-  char const * tgt_mask_name) {
+  char const * tgt_mask_name, int use_single_precision,
+  double weight_pruning_threshold) {
 
   YAC_ASSERT(src_comp_name && src_comp_name[0] != '\0',
     "ERROR(yac_couple_config_def_couple): invalid parameter: src_comp_name");
@@ -2448,12 +2500,21 @@ void yac_couple_config_def_couple(
     (time_reduction == TIME_MINIMUM) ||
     (time_reduction == TIME_MAXIMUM),
     "ERROR(yac_couple_config_def_couple): invalid parameter: time_reduction");
+  YAC_ASSERT_F(
+    (mapping_on_source >= 0) && (mapping_on_source <= 2),
+    "ERROR(yac_couple_config_def_couple): \"%d\" is not a valid mapping side",
+    mapping_on_source);
   YAC_ASSERT_F(isnormal(scale_factor),
     "ERROR(yac_couple_config_def_couple): \"%lf\" is not a valid scale factor",
     scale_factor);
   YAC_ASSERT_F(isnormal(scale_summand) || (scale_summand == 0.0),
     "ERROR(yac_couple_config_def_couple): \"%lf\" is not a valid scale summand",
     scale_summand);
+  YAC_ASSERT_F(
+    (weight_pruning_threshold >= 0.0) && (weight_pruning_threshold < 1.0),
+    "ERROR(yac_couple_config_def_couple): \"%lf\" is not a valid weight "
+    "pruning threshold (has to be in the range [0.0,1.0))",
+    weight_pruning_threshold);
 
   // get component indices
   size_t src_comp_idx =
@@ -2549,6 +2610,8 @@ void yac_couple_config_def_couple(
   }
   field_couple->tgt_mask_name =
     (tgt_mask_name != NULL)?strdup(tgt_mask_name):NULL;
+  field_couple->use_single_precision = use_single_precision != 0;
+  field_couple->weight_pruning_threshold = weight_pruning_threshold;
 }
 
 static void couple_config_sync_time(
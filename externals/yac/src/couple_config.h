@@ -192,7 +192,8 @@ void yac_couple_config_def_couple(
   char const * weight_file_name, int mapping_on_source,
   double scale_factor, double scale_summand,
   size_t num_src_mask_names, char const * const * src_mask_names,
-  char const * tgt_mask_name);
+  char const * tgt_mask_name, int use_single_precision,
+  double weight_pruning_threshold);
 int yac_couple_config_component_name_is_valid(
   struct yac_couple_config * couple_config, char const * component_name);
 size_t yac_couple_config_get_num_components(
@@ -268,6 +269,12 @@ void yac_couple_config_get_src_mask_names(
 char const * yac_couple_config_get_tgt_mask_name(
   struct yac_couple_config * couple_config,
   size_t couple_idx, size_t field_couple_idx);
+int yac_couple_config_use_single_precision(
+  struct yac_couple_config * couple_config,
+  size_t couple_idx, size_t field_couple_idx);
+double yac_couple_config_get_weight_pruning_threshold(
+  struct yac_couple_config * couple_config,
+  size_t couple_idx, size_t field_couple_idx);
 
 /**
  * synchronises the coupling configuration across all processes in comm
@@ -63,6 +63,8 @@
 #include "ensure_array_size.h"
 #include "interp_grid.h"
 #include "yac_interface.h"
+#include "setup_stats.h"
+#include "id_hash.h"
 
 struct single_remote_point {
   yac_int global_id;
@@ -141,8 +143,7 @@ struct dist_grid {
   size_t total_count[3];
   size_t count[3];
   int * core_mask[3];
-  yac_int * sorted_ids[3];
-  size_t * sorted_reorder_idx[3];
+  struct yac_id_hash * id_hash[3]; // global id -> local index
   struct yac_field_data_set field_data;
   MPI_Comm comm;
 };
@@ -169,27 +170,15 @@ struct missing_edge_neighbour {
   size_t neigh_idx;
 };
 
-// looks up positions of ids in an array of sorted ids
+// looks up positions of ids in a hash index
 static void id2idx(
-  yac_int * ids, size_t * idx, size_t num_ids,
-  yac_int * ref_sorted_ids, size_t num_sorted_ids) {
+  yac_int const * ids, size_t * idx, size_t num_ids,
+  struct yac_id_hash const * id_hash) {
 
-  size_t * reorder = xmalloc(num_ids * sizeof(*reorder));
-  for (size_t i = 0; i < num_ids; ++i) reorder[i] = i;
-
-  yac_quicksort_index_yac_int_size_t(ids, num_ids, reorder);
-
-  for (size_t i = 0, j = 0; i < num_ids; ++i) {
-
-    yac_int curr_id = ids[i];
-    while ((j < num_sorted_ids) && (ref_sorted_ids[j] < curr_id)) ++j;
-    YAC_ASSERT(
-      (j < num_sorted_ids) && (ref_sorted_ids[j] == curr_id),
-      "ERROR(id2idx): id not found")
-    idx[reorder[i]] = j;
+  for (size_t i = 0; i < num_ids; ++i) {
+    int found = yac_id_hash_lookup(id_hash, ids[i], idx + i);
+    YAC_ASSERT(found, "ERROR(id2idx): id not found")
   }
-
-  free(reorder);
 }
 
 // returns the index of the cell vertex with the lowest global id
@@ -390,24 +379,21 @@ static struct remote_point_infos copy_remote_point_infos(
 }
 
 static struct remote_point_infos * generate_remote_point_infos(
-  yac_int * sorted_ids, size_t * reorder_idx, size_t count,
+  struct yac_id_hash const * id_hash, size_t count,
   struct remote_points * points) {
 
   struct remote_point_infos * point_infos = xmalloc(count * sizeof(*point_infos));
+  for (size_t i = 0; i < count; ++i) point_infos[i].count = -1;
 
   size_t id_owner_count = points->count;
   struct remote_point * points_ = points->data;
 
-  for (size_t i = 0, j = 0; i < count; ++i) {
-
-    yac_int curr_id = sorted_ids[i];
-
-    while ((j < id_owner_count) && (points_[j].global_id < curr_id)) ++j;
+  for (size_t i = 0; i < id_owner_count; ++i) {
 
-    if ((j >= id_owner_count) || (points_[j].global_id != curr_id))
-      point_infos[reorder_idx[i]].count = -1;
-    else
-      point_infos[reorder_idx[i]] = copy_remote_point_infos(points_[j].data);
+    size_t idx;
+    if (yac_id_hash_lookup(id_hash, points_[i].global_id, &idx) &&
+        (point_infos[idx].count == -1))
+      point_infos[idx] = copy_remote_point_infos(points_[i].data);
   }
 
   return point_infos;
@@ -688,8 +674,7 @@ static void generate_dist_grid_remote_point_infos(
   for (int location = 0; location < 3; ++location)
     dist_grid->owners[location] =
       generate_remote_point_infos(
-        dist_grid->sorted_ids[location],
-        dist_grid->sorted_reorder_idx[location],
+        dist_grid->id_hash[location],
         dist_grid->count[location], dist_owner[location]);
 
   size_t num_missing_vertices = 0;
@@ -2007,21 +1992,6 @@ static struct remote_points ** generate_dist_remote_points(
   return dist_owners;
 }
 
-static void generate_sorted_ids(
-  yac_int * ids, size_t count, yac_int ** sorted_ids, size_t ** reorder_idx) {
-
-  yac_int * sorted_ids_ = xrealloc(*sorted_ids, count * sizeof(*sorted_ids_));
-  size_t * reorder_idx_ = xrealloc(*reorder_idx, count * sizeof(*reorder_idx_));
-
-  memcpy(sorted_ids_, ids, count * sizeof(*sorted_ids_));
-  for (size_t i = 0; i < count; ++i) reorder_idx_[i] = i;
-
-  yac_quicksort_index_yac_int_size_t(sorted_ids_, count, reorder_idx_);
-
-  *sorted_ids = sorted_ids_;
-  *reorder_idx = reorder_idx_;
-}
-
 static Xt_xmap generate_xmap_data(
   void * data, size_t count, MPI_Comm comm,
   void(*set_sendcounts)(void*,size_t,size_t*),
@@ -2605,6 +2575,9 @@ static struct dist_grid generate_dist_grid(
   size_t_2_pointer edge_to_vertex =
     xmalloc(num_edges * sizeof(*edge_to_vertex));
 
+  struct yac_id_hash * vertex_id_hash =
+    yac_id_hash_new_from_ids(vertex_ids, num_vertices);
+
   // get edge to vertex
   {
     yac_int * vertex_id_buffer =
@@ -2623,7 +2596,7 @@ static struct dist_grid generate_dist_grid(
       redist_edge_2yac_int, grid_edge_vertex_ids, edge_vertex_ids);
 
     id2idx(edge_vertex_ids, &(edge_to_vertex[0][0]), 2 * num_edges,
-           vertex_ids, num_vertices);
+           vertex_id_hash);
 
     free(vertex_id_buffer);
   }
@@ -2647,14 +2620,10 @@ static struct dist_grid generate_dist_grid(
      .edge_to_vertex = edge_to_vertex,
      .cell_bnd_circles = cell_bnd_circles,
      .edge_type = edge_type,
-     .sorted_ids = {NULL, NULL, NULL},
-     .sorted_reorder_idx = {NULL, NULL, NULL}};
-  generate_sorted_ids(cell_ids, num_cells, &(dist_grid.sorted_ids[CELL]),
-                      &(dist_grid.sorted_reorder_idx[CELL]));
-  generate_sorted_ids(vertex_ids, num_vertices, &(dist_grid.sorted_ids[CORNER]),
-                      &(dist_grid.sorted_reorder_idx[CORNER]));
-  generate_sorted_ids(edge_ids, num_edges, &(dist_grid.sorted_ids[EDGE]),
-                      &(dist_grid.sorted_reorder_idx[EDGE]));
+     .id_hash =
+       {yac_id_hash_new_from_ids(cell_ids, num_cells),
+        vertex_id_hash,
+        yac_id_hash_new_from_ids(edge_ids, num_edges)}};
   dist_grid.field_data.cell = cell_field_data;
   dist_grid.field_data.vertex = vertex_field_data;
   dist_grid.field_data.edge = edge_field_data;
@@ -2785,18 +2754,24 @@ struct dist_grid_pair * yac_dist_grid_pair_new(
   //   * each process covers a unique area on the sphere
   //   * number of cells (from grid_a and/or grid_b) per area
   //     is roughly the same
+  yac_setup_stats_start(YAC_SETUP_PHASE_REDISTRIBUTE_CELLS);
   grid_pair->proc_sphere_part =
     generate_dist_grid_decomposition(grid_a, grid_b, comm);
+  yac_setup_stats_stop(YAC_SETUP_PHASE_REDISTRIBUTE_CELLS);
 
   // redistribute grid_a and grid_b according to decomposition
+  yac_setup_stats_start(YAC_SETUP_PHASE_GENERATE_DIST_GRID);
   grid_pair->dist_grid[0] =
     generate_dist_grid(grid_pair->proc_sphere_part, grid_a, comm);
   grid_pair->dist_grid[1] =
     generate_dist_grid(grid_pair->proc_sphere_part, grid_b, comm);
+  yac_setup_stats_stop(YAC_SETUP_PHASE_GENERATE_DIST_GRID);
 
   // build search data structures for local cells and vertices in
   // distributed grid
+  yac_setup_stats_start(YAC_SETUP_PHASE_SEARCH_DATA);
   setup_search_data(grid_pair);
+  yac_setup_stats_stop(YAC_SETUP_PHASE_SEARCH_DATA);
 
   return grid_pair;
 }
@@ -2949,6 +2924,131 @@ coordinate_pointer yac_dist_grid_get_field_coords(
   return coords;
 }
 
+static uint64_t hash_dist_grid_point(
+  struct dist_grid * dist_grid, enum yac_location location, size_t idx) {
+
+  int32_t location_int = (int32_t)location;
+  uint64_t hash =
+    yac_hash_bytes(YAC_HASH_INIT, &location_int, sizeof(location_int));
+  hash =
+    yac_hash_bytes(
+      hash, dist_grid->ids[location] + idx, sizeof(*(dist_grid->ids[location])));
+
+  switch (location) {
+    default:
+    case (CORNER):
+      hash =
+        yac_hash_bytes(
+          hash, dist_grid->vertex_coordinates[idx],
+          sizeof(dist_grid->vertex_coordinates[idx]));
+      break;
+    case (CELL): {
+      int num_vertices = dist_grid->num_vertices_per_cell[idx];
+      size_t const * cell_to_vertex =
+        dist_grid->cell_to_vertex + dist_grid->cell_to_vertex_offsets[idx];
+      size_t const * cell_to_edge =
+        dist_grid->cell_to_edge + dist_grid->cell_to_edge_offsets[idx];
+      hash = yac_hash_bytes(hash, &num_vertices, sizeof(num_vertices));
+      for (int i = 0; i < num_vertices; ++i) {
+        int32_t edge_type = (int32_t)(dist_grid->edge_type[cell_to_edge[i]]);
+        hash =
+          yac_hash_bytes(
+            hash, dist_grid->ids[CORNER] + cell_to_vertex[i],
+            sizeof(*(dist_grid->ids[CORNER])));
+        hash = yac_hash_bytes(hash, &edge_type, sizeof(edge_type));
+      }
+      break;
+    }
+    case (EDGE): {
+      int32_t edge_type = (int32_t)(dist_grid->edge_type[idx]);
+      for (int i = 0; i < 2; ++i)
+        hash =
+          yac_hash_bytes(
+            hash, dist_grid->ids[CORNER] + dist_grid->edge_to_vertex[idx][i],
+            sizeof(*(dist_grid->ids[CORNER])));
+      hash = yac_hash_bytes(hash, &edge_type, sizeof(edge_type));
+      break;
+    }
+  };
+
+  return yac_hash_finalize(hash);
+}
+
+static uint64_t hash_dist_grid_field_point(
+  struct dist_grid * dist_grid, struct interp_field field, size_t field_idx,
+  int const * mask, coordinate_pointer coords, size_t idx) {
+
+  uint64_t field_idx_uint64 = (uint64_t)field_idx;
+  int32_t location_int = (int32_t)(field.location);
+  uint64_t hash =
+    yac_hash_bytes(YAC_HASH_INIT, &field_idx_uint64, sizeof(field_idx_uint64));
+  hash = yac_hash_bytes(hash, &location_int, sizeof(location_int));
+  hash =
+    yac_hash_bytes(
+      hash, dist_grid->ids[field.location] + idx,
+      sizeof(*(dist_grid->ids[field.location])));
+  if (mask != NULL) {
+    int32_t mask_value = (int32_t)(mask[idx] != 0);
+    hash = yac_hash_bytes(hash, &mask_value, sizeof(mask_value));
+  }
+  if (coords != NULL)
+    hash = yac_hash_bytes(hash, coords[idx], sizeof(coords[idx]));
+
+  return yac_hash_finalize(hash);
+}
+
+uint64_t yac_dist_grid_pair_get_hash(
+  struct dist_grid_pair * grid_pair, char const * grid_name,
+  struct interp_field const * fields, size_t num_fields) {
+
+  struct dist_grid * dist_grid =
+    yac_dist_grid_pair_get_dist_grid(grid_pair, grid_name);
+  MPI_Comm comm = grid_pair->comm;
+
+  // the hashes of all points are summed up, which makes the result
+  // independent of the decomposition and the order of the points
+  // (each point is only taken into account by the process for which it is
+  // part of the core)
+  uint64_t * hashes = xcalloc(3 + num_fields, sizeof(*hashes));
+
+  enum yac_location locations[3] = {CELL, CORNER, EDGE};
+  for (int i = 0; i < 3; ++i) {
+    enum yac_location location = locations[i];
+    size_t count = dist_grid->total_count[location];
+    int const * core_mask = dist_grid->core_mask[location];
+    for (size_t j = 0; j < count; ++j)
+      if (core_mask[j])
+        hashes[i] += hash_dist_grid_point(dist_grid, location, j);
+  }
+
+  for (size_t i = 0; i < num_fields; ++i) {
+    struct interp_field field = fields[i];
+    size_t count = dist_grid->total_count[field.location];
+    int const * core_mask = dist_grid->core_mask[field.location];
+    int const * mask = yac_dist_grid_get_field_mask(dist_grid, field);
+    // vertex coordinates are already included in the hash
+    coordinate_pointer coords =
+      (field.coordinates_idx != SIZE_MAX)?
+        yac_dist_grid_get_field_coords(dist_grid, field):NULL;
+    for (size_t j = 0; j < count; ++j)
+      if (core_mask[j])
+        hashes[3 + i] +=
+          hash_dist_grid_field_point(dist_grid, field, i, mask, coords, j);
+  }
+
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, hashes, (int)(3 + num_fields), MPI_UINT64_T, MPI_SUM,
+      comm), comm);
+
+  uint64_t hash =
+    yac_hash_bytes(
+      YAC_HASH_INIT, hashes, (3 + num_fields) * sizeof(*hashes));
+  free(hashes);
+
+  return yac_hash_finalize(hash);
+}
+
 size_t yac_dist_grid_get_unmasked_local_count(
   struct dist_grid * dist_grid, struct interp_field field) {
 
@@ -2967,6 +3067,137 @@ size_t yac_dist_grid_get_unmasked_local_count(
   return unmasked_local_count;
 }
 
+struct mask_change {
+  yac_int global_id;
+  int is_valid;
+};
+
+static int compare_mask_change(const void * a, const void * b) {
+
+  struct mask_change const * a_ = a, * b_ = b;
+
+  return (a_->global_id > b_->global_id) - (a_->global_id < b_->global_id);
+}
+
+void yac_dist_grid_pair_update_field_mask(
+  struct dist_grid_pair * grid_pair, struct yac_basic_grid * grid,
+  struct interp_field field, yac_int ** global_ids, int ** is_valid,
+  size_t * count) {
+
+  MPI_Comm comm = grid_pair->comm;
+  int comm_size;
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  struct dist_grid * dist_grid =
+    yac_dist_grid_pair_get_dist_grid(
+      grid_pair, yac_basic_grid_get_name(grid));
+
+  int * dist_mask = (int*)yac_dist_grid_get_field_mask(dist_grid, field);
+
+  YAC_ASSERT(
+    dist_mask != NULL,
+    "ERROR(yac_dist_grid_pair_update_field_mask): field has no mask")
+
+  struct yac_field_data * orig_field_data =
+    yac_basic_grid_get_field_data(grid, field.location);
+  YAC_ASSERT(
+    (orig_field_data == NULL) ||
+    (field.masks_idx < orig_field_data->masks_count),
+    "ERROR(yac_dist_grid_pair_update_field_mask): invalid mask_idx")
+  int * orig_mask =
+    (orig_field_data != NULL)?orig_field_data->masks[field.masks_idx].data:NULL;
+
+  // get the current mask values from one of the original owners of each point
+  size_t total_count = yac_dist_grid_get_count(dist_grid, field.location);
+  struct remote_point_infos * owners = dist_grid->owners[field.location];
+  struct remote_point_info * point_infos =
+    xmalloc(total_count * sizeof(*point_infos));
+  for (size_t i = 0; i < total_count; ++i)
+    point_infos[i] =
+      (owners[i].count == 1)?owners[i].data.single:owners[i].data.multi[0];
+  Xt_xmap xmap =
+    generate_xmap_from_remote_point_info(point_infos, total_count, comm);
+  free(point_infos);
+  Xt_redist redist_mask = xt_redist_p2p_new(xmap, MPI_INT);
+  xt_xmap_delete(xmap);
+  int * new_mask = xmalloc(total_count * sizeof(*new_mask));
+  xt_redist_s_exchange1(redist_mask, orig_mask, new_mask);
+  xt_redist_delete(redist_mask);
+
+  // determine all local points whose mask value changed
+  int const * core_mask =
+    yac_dist_grid_get_core_mask(dist_grid, field.location);
+  yac_int const * ids =
+    yac_dist_grid_get_global_ids(dist_grid, field.location);
+  size_t local_count = 0;
+  for (size_t i = 0; i < total_count; ++i)
+    if (core_mask[i] && ((dist_mask[i] != 0) != (new_mask[i] != 0)))
+      ++local_count;
+  yac_int * local_ids = xmalloc(local_count * sizeof(*local_ids));
+  int * local_is_valid = xmalloc(local_count * sizeof(*local_is_valid));
+  for (size_t i = 0, j = 0; i < total_count; ++i) {
+    if (core_mask[i] && ((dist_mask[i] != 0) != (new_mask[i] != 0))) {
+      local_ids[j] = ids[i];
+      local_is_valid[j] = new_mask[i] != 0;
+      ++j;
+    }
+  }
+  memcpy(dist_mask, new_mask, total_count * sizeof(*dist_mask));
+  free(new_mask);
+
+  // gather the changes from all processes
+  YAC_ASSERT(
+    local_count <= INT_MAX,
+    "ERROR(yac_dist_grid_pair_update_field_mask): "
+    "number of changed points exceeds INT_MAX")
+  int local_count_int = (int)local_count;
+  int * recvcounts = xmalloc(2 * (size_t)comm_size * sizeof(*recvcounts));
+  int * rdispls = recvcounts + comm_size;
+  yac_mpi_call(
+    MPI_Allgather(
+      &local_count_int, 1, MPI_INT, recvcounts, 1, MPI_INT, comm), comm);
+  size_t recv_count = 0;
+  for (int i = 0; i < comm_size; ++i) {
+    rdispls[i] = (int)recv_count;
+    recv_count += (size_t)(recvcounts[i]);
+  }
+  yac_int * recv_ids = xmalloc(recv_count * sizeof(*recv_ids));
+  int * recv_is_valid = xmalloc(recv_count * sizeof(*recv_is_valid));
+  yac_mpi_call(
+    MPI_Allgatherv(
+      local_ids, local_count_int, yac_int_dt,
+      recv_ids, recvcounts, rdispls, yac_int_dt, comm), comm);
+  yac_mpi_call(
+    MPI_Allgatherv(
+      local_is_valid, local_count_int, MPI_INT,
+      recv_is_valid, recvcounts, rdispls, MPI_INT, comm), comm);
+  free(recvcounts);
+  free(local_is_valid);
+  free(local_ids);
+
+  // sort the changes and remove duplicated entries
+  struct mask_change * changes = xmalloc(recv_count * sizeof(*changes));
+  for (size_t i = 0; i < recv_count; ++i) {
+    changes[i].global_id = recv_ids[i];
+    changes[i].is_valid = recv_is_valid[i];
+  }
+  qsort(changes, recv_count, sizeof(*changes), compare_mask_change);
+  size_t unique_count = 0;
+  for (size_t i = 0; i < recv_count; ++i) {
+    if ((unique_count == 0) ||
+        (recv_ids[unique_count-1] != changes[i].global_id)) {
+      recv_ids[unique_count] = changes[i].global_id;
+      recv_is_valid[unique_count] = changes[i].is_valid;
+      ++unique_count;
+    }
+  }
+  free(changes);
+
+  *global_ids = xrealloc(recv_ids, unique_count * sizeof(*recv_ids));
+  *is_valid = xrealloc(recv_is_valid, unique_count * sizeof(*recv_is_valid));
+  *count = unique_count;
+}
+
 static void yac_remote_point_infos_free(
   struct remote_point_infos * point_infos, size_t count) {
 
@@ -2988,8 +3219,7 @@ static void yac_dist_grid_free(struct dist_grid grid) {
   for (int i = 0; i < 3; ++i) {
     free(grid.ids[i]);
     free(grid.core_mask[i]);
-    free(grid.sorted_ids[i]);
-    free(grid.sorted_reorder_idx[i]);
+    yac_id_hash_delete(grid.id_hash[i]);
     yac_remote_point_infos_free(grid.owners[i], grid.total_count[i]);
   }
   yac_field_data_set_free(grid.field_data);
@@ -3151,23 +3381,14 @@ static void lookup_single_remote_point_reorder_locally(
     (location == CELL) || (location == CORNER) || (location == EDGE),
     "ERROR(lookup_single_remote_point_reorder_locally): invalid location")
 
-  yac_int * sorted_ids = dist_grid->sorted_ids[location];
-  size_t * reorder_idx = dist_grid->sorted_reorder_idx[location];
-  size_t num_ids = dist_grid->total_count[location];
+  struct yac_id_hash * id_hash = dist_grid->id_hash[location];
 
   size_t count_ = *count;
   size_t new_count = 0;
 
-  // sort ids by global ids
-  qsort(ids, count_, sizeof(*ids),
-    compare_single_remote_point_reorder_global_id);
-
-  for (size_t i = 0, j = 0; i < count_; ++i) {
-    yac_int curr_id = ids[i].data.global_id;
-    while ((j < num_ids) && (sorted_ids[j] < curr_id)) ++j;
-    if ((j < num_ids) && (sorted_ids[j] == curr_id)) {
-      idx[ids[i].reorder_idx] = reorder_idx[j];
-    } else {
+  for (size_t i = 0; i < count_; ++i) {
+    if (!yac_id_hash_lookup(
+          id_hash, ids[i].data.global_id, idx + ids[i].reorder_idx)) {
       if (i != new_count) ids[new_count] = ids[i];
       ++new_count;
     }
@@ -3574,15 +3795,6 @@ static void unpack_grid_data_edge(
     buffer, buffer_size, position, idx, temp_edge_field_data, comm);
 }
 
-static int compare_global_vertex_reorder_global_id(
-  const void * a, const void * b) {
-
-  return (((const struct global_vertex_reorder *)a)->global_id >
-          ((const struct global_vertex_reorder *)b)->global_id) -
-         (((const struct global_vertex_reorder *)a)->global_id <
-          ((const struct global_vertex_reorder *)b)->global_id);
-}
-
 static void add_field_data(
   struct yac_field_data * field_data, struct temp_field_data temp_field_data,
   void * reorder_idx, size_t reorder_idx_size,
@@ -3631,49 +3843,29 @@ static void yac_dist_grid_add_vertices(
 
   if (count == 0) return;
 
-  // sort vertices global ids
-  qsort(vertices, count, sizeof(*vertices),
-        compare_global_vertex_reorder_global_id);
-
-  yac_int * sorted_vertex_ids = dist_grid->sorted_ids[CORNER];
-  size_t * sorted_vertex_reorder_idx = dist_grid->sorted_reorder_idx[CORNER];
+  struct yac_id_hash * vertex_id_hash = dist_grid->id_hash[CORNER];
 
-  yac_int prev_global_id = vertices[0].global_id - 1;
-  size_t prev_idx = 0;
   size_t add_count = 0;
   size_t num_total_vertices = dist_grid->total_count[CORNER];
 
   // determine which vertices need to be added to local data
-  for (size_t i = 0, j = 0; i < count; ++i) {
-
-    yac_int curr_global_id = vertices[i].global_id;
-    size_t curr_reorder_idx = vertices[i].reorder_idx;
-
-    // if the current global id is a duplicate
-    if (prev_global_id == curr_global_id) {
-      if (idx != NULL) idx[curr_reorder_idx] = prev_idx;
-      yac_remote_point_infos_single_free(&(vertices[i].owners));
-      continue;
-    }
-    prev_global_id = curr_global_id;
+  // (new vertices are directly inserted into the hash index, which also
+  //  detects duplicates within the new vertices)
+  for (size_t i = 0; i < count; ++i) {
 
-    // check whether the current global id is already part of the local
-    // grid data
-    while ((j < num_total_vertices) && (sorted_vertex_ids[j] < curr_global_id))
-      ++j;
+    size_t new_idx = num_total_vertices + add_count;
+    size_t vertex_idx =
+      yac_id_hash_insert(vertex_id_hash, vertices[i].global_id, new_idx);
+    if (idx != NULL) idx[vertices[i].reorder_idx] = vertex_idx;
 
-    // if we found a match in the local data
-    if ((j < num_total_vertices) && (sorted_vertex_ids[j] == curr_global_id)) {
+    // if the current vertex is already part of the local grid data
+    if (vertex_idx != new_idx) {
 
-      if (idx != NULL) idx[curr_reorder_idx] = sorted_vertex_reorder_idx[j];
-      prev_idx = sorted_vertex_reorder_idx[j];
       yac_remote_point_infos_single_free(&(vertices[i].owners));
 
     // if we need to add the current vertex to the local data
     } else {
 
-      if (idx != NULL) idx[curr_reorder_idx] = num_total_vertices + add_count;
-      prev_idx = num_total_vertices + add_count;
       if (add_count != i) vertices[add_count] = vertices[i];
       ++add_count;
     }
@@ -3691,13 +3883,6 @@ static void yac_dist_grid_add_vertices(
   struct remote_point_infos * vertex_owners =
     xrealloc(dist_grid->owners[CORNER], new_num_total_vertices *
              sizeof(*vertex_owners));
-  sorted_vertex_ids =
-    xrealloc(
-      sorted_vertex_ids, new_num_total_vertices * sizeof(*sorted_vertex_ids));
-  sorted_vertex_reorder_idx =
-    xrealloc(
-      sorted_vertex_reorder_idx, new_num_total_vertices *
-      sizeof(*sorted_vertex_reorder_idx));
 
   // add the selected vertices to the local grid data
   for (size_t i = 0, j = num_total_vertices; i < add_count; ++i, ++j) {
@@ -3708,82 +3893,49 @@ static void yac_dist_grid_add_vertices(
     vertex_ids[j] = vertices[i].global_id;
     core_vertex_mask[j] = 0;
     vertex_owners[j] = vertices[i].owners;
-    sorted_vertex_ids[j] = vertices[i].global_id;
-    sorted_vertex_reorder_idx[j] = j;
   }
   // add field data
   add_field_data(
     &(dist_grid->field_data.vertex), temp_vertex_field_data,
     vertices, sizeof(*vertices),
     num_total_vertices, new_num_total_vertices);
-  yac_quicksort_index_yac_int_size_t(
-    sorted_vertex_ids, new_num_total_vertices, sorted_vertex_reorder_idx);
 
   dist_grid->vertex_coordinates = vertex_coordinates;
   dist_grid->ids[CORNER] = vertex_ids;
   dist_grid->core_mask[CORNER] = core_vertex_mask;
   dist_grid->owners[CORNER] = vertex_owners;
-  dist_grid->sorted_ids[CORNER] = sorted_vertex_ids;
-  dist_grid->sorted_reorder_idx[CORNER] = sorted_vertex_reorder_idx;
   dist_grid->total_count[CORNER] = new_num_total_vertices;
 }
 
-static int compare_global_edge_reorder_global_id(
-  const void * a, const void * b) {
-
-  return (((const struct global_edge_reorder *)a)->global_id >
-          ((const struct global_edge_reorder *)b)->global_id) -
-         (((const struct global_edge_reorder *)a)->global_id <
-          ((const struct global_edge_reorder *)b)->global_id);
-}
-
 static void yac_dist_grid_add_edges(
   struct dist_grid * dist_grid, struct global_edge_reorder * edges,
   size_t count, size_t * idx, struct temp_field_data temp_edge_field_data) {
 
   if (count == 0) return;
 
-  // sort edges global ids
-  qsort(edges, count, sizeof(*edges), compare_global_edge_reorder_global_id);
+  struct yac_id_hash * edge_id_hash = dist_grid->id_hash[EDGE];
 
-  yac_int * sorted_edge_ids = dist_grid->sorted_ids[EDGE];
-  size_t * sorted_edge_reorder_idx = dist_grid->sorted_reorder_idx[EDGE];
-
-  yac_int prev_global_id = edges[0].global_id - 1;
-  size_t prev_idx = 0;
   size_t add_count = 0;
   size_t num_total_edges = dist_grid->total_count[EDGE];
 
   // determine which edges need to be added to local data
-  for (size_t i = 0, j = 0; i < count; ++i) {
-
-    yac_int curr_global_id = edges[i].global_id;
-    size_t curr_reorder_idx = edges[i].reorder_idx;
-
-    // if the current global id is a duplicate
-    if (prev_global_id == curr_global_id) {
-      if (idx != NULL) idx[curr_reorder_idx] = prev_idx;
-      yac_remote_point_infos_single_free(&(edges[i].owners));
-      continue;
-    }
-    prev_global_id = curr_global_id;
+  // (new edges are directly inserted into the hash index, which also
+  //  detects duplicates within the new edges)
+  for (size_t i = 0; i < count; ++i) {
 
-    // check whether the current global id is already part of the local
-    // grid data
-    while ((j < num_total_edges) && (sorted_edge_ids[j] < curr_global_id)) ++j;
+    size_t new_idx = num_total_edges + add_count;
+    size_t edge_idx =
+      yac_id_hash_insert(edge_id_hash, edges[i].global_id, new_idx);
+    if (idx != NULL) idx[edges[i].reorder_idx] = edge_idx;
 
-    // if we found a match in the local data
-    if ((j < num_total_edges) && (sorted_edge_ids[j] == curr_global_id)) {
+    // if the current edge is already part of the local grid data
+    if (edge_idx != new_idx) {
 
-      if (idx != NULL) idx[curr_reorder_idx] = sorted_edge_reorder_idx[j];
-      prev_idx = sorted_edge_reorder_idx[j];
       yac_remote_point_infos_single_free(&(edges[i].owners));
 
     // if we need to add the current edge to the local data
     } else {
 
-      if (idx != NULL) idx[curr_reorder_idx] = num_total_edges + add_count;
-      prev_idx = num_total_edges + add_count;
       if (add_count != i) edges[add_count] = edges[i];
       ++add_count;
     }
@@ -3801,16 +3953,8 @@ static void yac_dist_grid_add_edges(
   int * core_edge_mask =
     xrealloc(dist_grid->core_mask[EDGE], new_num_total_edges *
              sizeof(*core_edge_mask));
-  sorted_edge_ids =
-    xrealloc(
-      sorted_edge_ids, new_num_total_edges * sizeof(*sorted_edge_ids));
-  sorted_edge_reorder_idx =
-    xrealloc(
-      sorted_edge_reorder_idx, new_num_total_edges *
-      sizeof(*sorted_edge_reorder_idx));
 
-  yac_int * vertex_ids = xmalloc(2 * add_count * sizeof(*vertex_ids));
-  size_t * reorder = xmalloc(2 * add_count * sizeof(*reorder));
+  struct yac_id_hash * vertex_id_hash = dist_grid->id_hash[CORNER];
 
   // add the selected edges to the local grid data
   for (size_t i = 0, j = num_total_edges; i < add_count; ++i, ++j) {
@@ -3819,48 +3963,25 @@ static void yac_dist_grid_add_edges(
     edge_type[j] = edges[i].edge_type;
     core_edge_mask[j] = 0;
     edge_owners[j] = edges[i].owners;
-    sorted_edge_ids[j] = edges[i].global_id;
-    sorted_edge_reorder_idx[j] = j;
 
-    vertex_ids[2 * i + 0] = edges[i].edge_to_vertex[0];
-    vertex_ids[2 * i + 1] = edges[i].edge_to_vertex[1];
-    reorder[2 * i + 0] = 2 * num_total_edges + 2 * i + 0;
-    reorder[2 * i + 1] = 2 * num_total_edges + 2 * i + 1;
+    // determine vertex indices for edge_to_vertex
+    for (int k = 0; k < 2; ++k) {
+      int found =
+        yac_id_hash_lookup(
+          vertex_id_hash, edges[i].edge_to_vertex[k], &(edge_to_vertex[j][k]));
+      YAC_ASSERT(found, "ERROR(yac_dist_grid_add_edges): vertex id not found")
+    }
   }
   // add field data
   add_field_data(
     &(dist_grid->field_data.edge), temp_edge_field_data, edges, sizeof(*edges),
     num_total_edges, new_num_total_edges);
-  yac_quicksort_index_yac_int_size_t(
-    sorted_edge_ids, new_num_total_edges, sorted_edge_reorder_idx);
-
-  { // determine vertex indices for edge_to_vertex
-    yac_quicksort_index_yac_int_size_t(vertex_ids, 2 * add_count, reorder);
-    yac_int * sorted_vertex_ids = dist_grid->sorted_ids[CORNER];
-    size_t * sorted_vertex_reorder_idx = dist_grid->sorted_reorder_idx[CORNER];
-    size_t total_num_vertices = dist_grid->total_count[CORNER];
-    size_t * edge_to_vertex_ = (size_t*)&(edge_to_vertex[0][0]);
-    // lookup global ids
-    for (size_t i = 0, j = 0; i < 2 * add_count; ++i) {
-      yac_int curr_id = vertex_ids[i];
-      while ((j < total_num_vertices) && (sorted_vertex_ids[j] < curr_id)) ++j;
-      YAC_ASSERT(
-        (j < total_num_vertices) && (sorted_vertex_ids[j] == curr_id),
-        "ERROR(yac_dist_grid_add_edges): vertex id not found")
-      edge_to_vertex_[reorder[i]] = sorted_vertex_reorder_idx[j];
-    }
-  }
-
-  free(vertex_ids);
-  free(reorder);
 
   dist_grid->ids[EDGE] = edge_ids;
   dist_grid->edge_type = edge_type;
   dist_grid->edge_to_vertex = edge_to_vertex;
   dist_grid->owners[EDGE] = edge_owners;
   dist_grid->core_mask[EDGE] = core_edge_mask;
-  dist_grid->sorted_ids[EDGE] = sorted_edge_ids;
-  dist_grid->sorted_reorder_idx[EDGE] = sorted_edge_reorder_idx;
   dist_grid->total_count[EDGE] = new_num_total_edges;
 }
 
@@ -3874,49 +3995,35 @@ static void yac_dist_grid_add_cells(
   if (count == 0) return;
 
   size_t * reorder_idx = xmalloc(count * sizeof(reorder_idx));
-  for (size_t i = 0; i < count; ++i) reorder_idx[i] = i;
 
   size_t * prescan = xmalloc(count * sizeof(*prescan));
   for (size_t i = 0, accu = 0; i < count;
        accu += (size_t)(num_vertices_per_cell[i++])) prescan[i] = accu;
 
-  // sort cells global ids
-  yac_quicksort_index_yac_int_size_t(cell_ids, count, reorder_idx);
+  struct yac_id_hash * cell_id_hash = dist_grid->id_hash[CELL];
 
-  yac_int * sorted_cell_ids = dist_grid->sorted_ids[CELL];
-  size_t * sorted_cell_reorder_idx = dist_grid->sorted_reorder_idx[CELL];
-
-  yac_int prev_global_id = cell_ids[0] - 1;
   size_t cell_add_count = 0;
   size_t relations_add_count = 0;
   size_t num_total_cells = dist_grid->total_count[CELL];
 
   // determine which cells need to be added to local data
-  for (size_t i = 0, j = 0; i < count; ++i) {
+  // (new cells are directly inserted into the hash index, which also
+  //  detects duplicates within the new cells)
+  for (size_t i = 0; i < count; ++i) {
 
-    yac_int curr_global_id = cell_ids[i];
-    size_t curr_reorder_idx = reorder_idx[i];
+    size_t new_idx = num_total_cells + cell_add_count;
 
-    // if the current global id is a duplicate
-    if (prev_global_id == curr_global_id) {
-      yac_remote_point_infos_single_free(cell_owners + curr_reorder_idx);
-      continue;
-    }
-    prev_global_id = curr_global_id;
+    // if the current cell is already part of the local grid data
+    if (yac_id_hash_insert(cell_id_hash, cell_ids[i], new_idx) != new_idx) {
 
-    // check whether the current global id is already part of the local
-    // grid data
-    while ((j < num_total_cells) && (sorted_cell_ids[j] < curr_global_id)) ++j;
+      yac_remote_point_infos_single_free(cell_owners + i);
 
-    // if we did not find a match in the local data
-    if ((j >= num_total_cells) || (sorted_cell_ids[j] != curr_global_id)) {
+    // if we need to add the current cell to the local data
+    } else {
 
-      if (cell_add_count != i) {
-        cell_ids[cell_add_count] = curr_global_id;
-        reorder_idx[cell_add_count] = curr_reorder_idx;
-      }
+      reorder_idx[cell_add_count] = i;
       ++cell_add_count;
-      relations_add_count += (size_t)(num_vertices_per_cell[curr_reorder_idx]);
+      relations_add_count += (size_t)(num_vertices_per_cell[i]);
     }
   }
 
@@ -3947,13 +4054,6 @@ static void yac_dist_grid_add_cells(
     xrealloc(dist_grid->core_mask[CELL], new_num_total_cells * sizeof(*core_cell_mask));
   struct remote_point_infos * new_cell_owners =
     xrealloc(dist_grid->owners[CELL], new_num_total_cells * sizeof(*cell_owners));
-  sorted_cell_ids =
-    xrealloc(
-      sorted_cell_ids, new_num_total_cells * sizeof(*sorted_cell_ids));
-  sorted_cell_reorder_idx =
-    xrealloc(
-      sorted_cell_reorder_idx, new_num_total_cells *
-      sizeof(*sorted_cell_reorder_idx));
 
   // add the selected cells to the local grid data
   for (size_t i = 0, j = num_total_cells; i < cell_add_count;
@@ -3963,7 +4063,7 @@ static void yac_dist_grid_add_cells(
     int curr_num_vertices = num_vertices_per_cell[curr_reorder_idx];
     size_t curr_relation_idx = prescan[curr_reorder_idx];
 
-    new_cell_ids[j] = cell_ids[i];
+    new_cell_ids[j] = cell_ids[curr_reorder_idx];
     new_num_vertices_per_cell[j] = curr_num_vertices;
     cell_to_vertex_offsets[j] = num_total_relations;
     for (int j = 0; j < curr_num_vertices;
@@ -3973,8 +4073,6 @@ static void yac_dist_grid_add_cells(
       new_cell_to_edge[num_total_relations] = cell_to_edge[curr_relation_idx];
     }
     core_cell_mask[j] = 0;
-    sorted_cell_ids[j] = cell_ids[i];
-    sorted_cell_reorder_idx[j] = j;
     new_cell_bnd_circles[j] = cell_bnd_circles[curr_reorder_idx];
     new_cell_owners[j] = cell_owners[curr_reorder_idx];
   }
@@ -3983,8 +4081,6 @@ static void yac_dist_grid_add_cells(
     &(dist_grid->field_data.cell), temp_cell_field_data,
     reorder_idx, sizeof(*reorder_idx),
     num_total_cells, new_num_total_cells);
-  yac_quicksort_index_yac_int_size_t(
-    sorted_cell_ids, new_num_total_cells, sorted_cell_reorder_idx);
 
   dist_grid->ids[CELL] = new_cell_ids;
   dist_grid->num_vertices_per_cell = new_num_vertices_per_cell;
@@ -3994,8 +4090,6 @@ static void yac_dist_grid_add_cells(
   dist_grid->cell_to_edge_offsets = cell_to_vertex_offsets;
   dist_grid->core_mask[CELL] = core_cell_mask;
   dist_grid->owners[CELL] = new_cell_owners;
-  dist_grid->sorted_ids[CELL] = sorted_cell_ids;
-  dist_grid->sorted_reorder_idx[CELL] = sorted_cell_reorder_idx;
   dist_grid->cell_bnd_circles = new_cell_bnd_circles;
   dist_grid->total_count[CELL] = new_num_total_cells;
 
@@ -4794,7 +4888,7 @@ void yac_dist_grid_pair_do_nnn_search(
   size_t * num_results = xcalloc(count, sizeof(*num_results));
 
   // do local search
-  yac_point_sphere_part_search_NNN(
+  yac_point_sphere_part_search_NNN_batch(
     sphere_part, count, search_coords, n, &cos_angles, &cos_angles_array_size,
     &result_coords, &result_coords_array_size, &result_points,
     &result_points_array_size, num_results);
@@ -4909,7 +5003,7 @@ void yac_dist_grid_pair_do_nnn_search(
   memset(num_results, 0, recv_count * sizeof(*num_results));
 
   // do local search for requests
-  yac_point_sphere_part_search_NNN(
+  yac_point_sphere_part_search_NNN_batch(
     sphere_part, recv_count, recv_request_coords, n, &cos_angles,
     &cos_angles_array_size, &result_coords, &result_coords_array_size,
     &result_points, &result_points_array_size, num_results);
@@ -5573,38 +5667,24 @@ static void yac_dist_grid_get_cell_neighbours(
       send_buffer, sendcounts, sdispls,
       recv_buffer, recvcounts, rdispls, comm);
 
-    yac_int * request_edge_ids =
-      xmalloc(recv_count * sizeof(*request_edge_ids));
-    size_t * reorder_idx = xmalloc(recv_count * sizeof(*reorder_idx));
     struct single_remote_point * point_info_buffer =
       xmalloc(
         (send_count + recv_count) * sizeof(*point_info_buffer));
     struct single_remote_point * point_send_buffer = point_info_buffer;
     struct single_remote_point * point_recv_buffer =
       point_info_buffer + recv_count;
-    for (size_t i = 0; i < recv_count; ++i) {
-      request_edge_ids[i] = recv_buffer[2 * i + 0];
-      reorder_idx[i] = i;
-    }
-
-    yac_quicksort_index_yac_int_size_t(
-      request_edge_ids, recv_count, reorder_idx);
-    yac_int * sorted_edge_ids = dist_grid->sorted_ids[EDGE];
-    size_t * sorted_edge_reorder_idx = dist_grid->sorted_reorder_idx[EDGE];
-    size_t num_edges = dist_grid->total_count[EDGE];
+    struct yac_id_hash const * edge_id_hash = dist_grid->id_hash[EDGE];
     yac_int * cell_ids = dist_grid->ids[CELL];
 
     // lookup the requested edge locally
-    for (size_t i = 0, j = 0; i < recv_count; ++i) {
-
-      yac_int curr_edge_id = request_edge_ids[i];
-      size_t curr_reorder_idx = reorder_idx[i];
+    for (size_t i = 0; i < recv_count; ++i) {
 
-      while ((j < num_edges) && (sorted_edge_ids[j] < curr_edge_id)) ++j;
+      size_t local_edge_idx;
 
       // if the edge is not available locally
-      if ((j >= num_edges) || (sorted_edge_ids[j] != curr_edge_id)) {
-        point_send_buffer[curr_reorder_idx] =
+      if (!yac_id_hash_lookup(
+             edge_id_hash, recv_buffer[2 * i + 0], &local_edge_idx)) {
+        point_send_buffer[i] =
         (struct single_remote_point)
           {.global_id = XT_INT_MAX,
            .data = {.rank = comm_rank, .orig_pos = UINT64_MAX}};
@@ -5612,9 +5692,9 @@ static void yac_dist_grid_get_cell_neighbours(
       }
 
       // id of the cell that is available on the other process
-      yac_int available_edge_cell_id = recv_buffer[2 * curr_reorder_idx + 1];
+      yac_int available_edge_cell_id = recv_buffer[2 * i + 1];
 
-      size_t * local_edge_cell_ids = edge_to_cell[sorted_edge_reorder_idx[j]];
+      size_t * local_edge_cell_ids = edge_to_cell[local_edge_idx];
       yac_int global_edge_cell_ids[2];
       for (int k = 0; k < 2; ++k)
         global_edge_cell_ids[k] =
@@ -5630,15 +5710,13 @@ static void yac_dist_grid_get_cell_neighbours(
         "ERROR(yac_dist_grid_get_cell_neighbours): "
         "inconsistent cell edge grid data")
 
-      point_send_buffer[curr_reorder_idx].global_id =
+      point_send_buffer[i].global_id =
         global_edge_cell_ids[missing_idx];
-      point_send_buffer[curr_reorder_idx].data.rank = comm_rank;
-      point_send_buffer[curr_reorder_idx].data.orig_pos =
+      point_send_buffer[i].data.rank = comm_rank;
+      point_send_buffer[i].data.orig_pos =
         (local_edge_cell_ids[missing_idx] == SIZE_MAX)?
           (uint64_t)UINT64_MAX:local_edge_cell_ids[missing_idx];
     }
-    free(reorder_idx);
-    free(request_edge_ids);
     free(yac_int_buffer);
 
     for (int i = 0; i < comm_size; ++i) {
@@ -280,6 +280,26 @@ void yac_dist_grid_get_local_unmasked_points(
   struct dist_grid * grid, struct interp_field field,
   size_t ** indices, size_t * count);
 
+/**
+ * updates the mask of a field in the distributed grid pair with the current
+ * mask values of the respective basic grid
+ * @param[in]  grid_pair   distributed grid pair
+ * @param[in]  grid        basic grid containing the updated mask
+ *                         (can be an empty grid on processes that do not
+ *                          have the grid)
+ * @param[in]  field       field whose mask is to be updated
+ * @param[out] global_ids  sorted global ids of all points whose mask value
+ *                         changed
+ * @param[out] is_valid    new mask values of these points
+ * @param[out] count       number of entries in global_ids and is_valid
+ * @remark the results are identical on all processes of the grid pair
+ * @remark this routine is collective for all processes of the grid pair
+ */
+void yac_dist_grid_pair_update_field_mask(
+  struct dist_grid_pair * grid_pair, struct yac_basic_grid * grid,
+  struct interp_field field, yac_int ** global_ids, int ** is_valid,
+  size_t * count);
+
 /**
  * generates an MPI Datatype for struct remote_point_info
  * @param[in] comm communicator
@@ -472,6 +492,23 @@ int const * yac_dist_grid_get_field_mask(
 coordinate_pointer yac_dist_grid_get_field_coords(
   struct dist_grid * dist_grid, struct interp_field field);
 
+/**
+ * computes a hash of one of the grids of a distributed grid pair, which is
+ * independent of the decomposition
+ * (includes global ids, vertex coordinates, connectivity, and edge types of
+ *  the grid as well as the masks and coordinates of the provided fields)
+ * @param[in] grid_pair  distributed grid pair
+ * @param[in] grid_name  grid name of the selected grid
+ * @param[in] fields     fields whose masks and coordinates are to be
+ *                       included in the hash
+ * @param[in] num_fields number of entries in fields
+ * @return hash
+ * @remark this routine is collective for all processes of the grid pair
+ */
+uint64_t yac_dist_grid_pair_get_hash(
+  struct dist_grid_pair * grid_pair, char const * grid_name,
+  struct interp_field const * fields, size_t num_fields);
+
 /**
  * returns the data for a selected grid cell
  * @param[in]  grid_data basic grid data
@@ -46,12 +46,19 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include "event.h"
 #include "utils.h"
 #include "component.h"
 #include "fields.h"
 #include "interpolation.h"
 
+// alignment (in bytes) of the accumulation buffers of the put operations
+// (each buffer starts at a cache line boundary, which allows the
+// compiler to use aligned vector loads/stores in the accumulation loops)
+#define PUT_OP_ACC_ALIGNMENT (64)
+#define PUT_OP_ACC_ALIGNMENT_DBLE (PUT_OP_ACC_ALIGNMENT / sizeof(double))
+
 struct coupling_field {
 
   // general field related information
@@ -66,6 +73,10 @@ struct coupling_field {
   size_t num_interp_fields;
   size_t collection_size; //!< number of vertical levels or bundles
   char* timestep;
+  int stable_put_buffer; //!< user guarantees that put data is not modified
+                         //!< until the put is completed
+  int eager_setup; //!< interpolations are generated during the setup, even
+                   //!< if lazy setup is enabled
 
   char current_datetime[MAX_DATETIME_STR_LEN]; // updated only in yac_coupling_field_get_datetime
 
@@ -78,6 +89,8 @@ struct coupling_field {
       struct {
         struct event * event;
         struct interpolation * interpolation;
+        yac_coupling_field_setup_func setup; //!< generates interpolation
+        void * setup_data;                   //!< on first use
         int time_accumulation_count;
         double *** send_field_acc;
         double *** send_frac_mask_acc;
@@ -88,6 +101,8 @@ struct coupling_field {
     struct {
       struct event * event;
       struct interpolation * interpolation;
+      yac_coupling_field_setup_func setup; //!< generates interpolation
+      void * setup_data;                   //!< on first use
       int * mask;
     } get;
   } exchange_data;
@@ -109,6 +124,8 @@ yac_coupling_field_new(char const * field_name, struct component * component,
   cpl_field->collection_size   = collection_size;
   cpl_field->timestep          = strdup(timestep);
   cpl_field->exchange_type     = NOTHING;
+  cpl_field->stable_put_buffer = 0;
+  cpl_field->eager_setup = 0;
 
   if (num_interp_fields != 0) {
 
@@ -136,6 +153,28 @@ const char* yac_get_coupling_field_timestep(struct coupling_field * field) {
    return field->timestep;
 }
 
+int yac_get_coupling_field_stable_put_buffer(struct coupling_field * field) {
+
+  return field->stable_put_buffer;
+}
+
+void yac_set_coupling_field_stable_put_buffer(
+  struct coupling_field * field, int is_stable) {
+
+  field->stable_put_buffer = is_stable != 0;
+}
+
+int yac_get_coupling_field_eager_setup(struct coupling_field * field) {
+
+  return field->eager_setup;
+}
+
+void yac_set_coupling_field_eager_setup(
+  struct coupling_field * field, int is_eager) {
+
+  field->eager_setup = is_eager != 0;
+}
+
 size_t yac_coupling_field_get_num_interp_fields(struct coupling_field * field) {
 
   return field->num_interp_fields;
@@ -188,21 +227,33 @@ size_t yac_coupling_field_get_data_size(
   return yac_basic_grid_get_data_size(field->grid, location);
 }
 
+// number of doubles reserved for one accumulation buffer (padded to
+// a multiple of the alignment)
+static size_t get_put_op_acc_buffer_size(
+  struct interp_field field, struct yac_basic_grid * grid) {
+
+  size_t num_points = get_interp_field_size(field, grid);
+  return ((num_points + PUT_OP_ACC_ALIGNMENT_DBLE - 1) /
+          PUT_OP_ACC_ALIGNMENT_DBLE) * PUT_OP_ACC_ALIGNMENT_DBLE;
+}
+
+static size_t get_put_op_acc_total_size(struct coupling_field * field) {
+
+  size_t total_size = 0;
+  for (size_t j = 0; j < field->num_interp_fields; j++)
+    total_size +=
+      get_put_op_acc_buffer_size(field->interp_fields[j], field->grid);
+  return total_size * field->collection_size;
+}
+
 static void init_put_op_acc(
   struct coupling_field * field, double init_value, double *** acc) {
 
-  size_t num_interp_fields = field->num_interp_fields;
-  size_t collection_size = field->collection_size;
-
-  for (size_t h = 0; h < collection_size; ++h) {
-    for (size_t j = 0; j < num_interp_fields; j++) {
-      size_t num_points =
-        get_interp_field_size(field->interp_fields[j], field->grid);
-      for (size_t m = 0; m < num_points; m++ ) {
-        acc[h][j][m] = init_value;
-      }
-    }
-  }
+  // all accumulation buffers are stored contiguously in memory
+  // (padding included)
+  double * data = acc[0][0];
+  size_t total_size = get_put_op_acc_total_size(field);
+  for (size_t m = 0; m < total_size; m++) data[m] = init_value;
 }
 
 static void get_put_op_acc(
@@ -222,19 +273,43 @@ static void get_put_op_acc(
   size_t num_interp_fields = field->num_interp_fields;
   size_t collection_size = field->collection_size;
 
+  YAC_ASSERT_F(
+    (collection_size > 0) && (num_interp_fields > 0),
+    "ERROR(%s): field has no data", routine_name)
+
   /* Allocate memory for the accumulation */
 
-  *acc = xmalloc(collection_size * sizeof(**acc));
+  // the pointer arrays and all accumulation buffers are allocated in a
+  // single memory block, such that the accumulator can be freed with a
+  // single call to free:
+  // [collection_size pointers to the interpolation field pointers]
+  // [collection_size * num_interp_fields pointers to the buffers]
+  // [padding for alignment]
+  // [buffers: collection_size * num_interp_fields, each aligned]
+  size_t ptr_size =
+    collection_size * sizeof(**acc) +
+    collection_size * num_interp_fields * sizeof(***acc);
+  size_t data_size = get_put_op_acc_total_size(field) * sizeof(****acc);
+  char * block = xmalloc(ptr_size + PUT_OP_ACC_ALIGNMENT + data_size);
+
+  double ** field_ptrs = (double **)(block + collection_size * sizeof(**acc));
+  uintptr_t data_addr = (uintptr_t)(block + ptr_size);
+  double * data =
+    (double *)(
+      block + ptr_size +
+      ((PUT_OP_ACC_ALIGNMENT - data_addr % PUT_OP_ACC_ALIGNMENT) %
+       PUT_OP_ACC_ALIGNMENT));
+
+  *acc = (double ***)block;
 
   for (size_t h = 0; h < collection_size; ++h) {
 
-    (*acc)[h] = xmalloc(num_interp_fields * sizeof(***acc));
+    (*acc)[h] = field_ptrs + h * num_interp_fields;
 
-    for (size_t j = 0; j < num_interp_fields; j++)
-      (*acc)[h][j] =
-        xmalloc(
-          get_interp_field_size(
-            field->interp_fields[j], field->grid) * sizeof(****acc));
+    for (size_t j = 0; j < num_interp_fields; j++) {
+      (*acc)[h][j] = data;
+      data += get_put_op_acc_buffer_size(field->interp_fields[j], field->grid);
+    }
   }
 
   /* Initialise memory for the accumulation */
@@ -519,7 +594,7 @@ void yac_set_coupling_field_put_op(
     field->exchange_data.put.puts = NULL;
     field->exchange_data.put.num_puts = 0;
     field->exchange_type = SOURCE;
-    field->exchange_data.get.mask = NULL;
+    field->exchange_data.put.mask = NULL;
   }
 
   unsigned num_puts = field->exchange_data.put.num_puts;
@@ -531,6 +606,8 @@ void yac_set_coupling_field_put_op(
 
   field->exchange_data.put.puts[num_puts].event = event;
   field->exchange_data.put.puts[num_puts].interpolation = interpolation;
+  field->exchange_data.put.puts[num_puts].setup = NULL;
+  field->exchange_data.put.puts[num_puts].setup_data = NULL;
   field->exchange_data.put.puts[num_puts].time_accumulation_count = 0;
   field->exchange_data.put.puts[num_puts].send_field_acc = NULL;
   field->exchange_data.put.puts[num_puts].send_frac_mask_acc = NULL;
@@ -548,7 +625,120 @@ void yac_set_coupling_field_get_op(
   field->exchange_type = TARGET;
   field->exchange_data.get.event = event;
   field->exchange_data.get.interpolation = interpolation;
-  field->exchange_data.put.mask = NULL;
+  field->exchange_data.get.setup = NULL;
+  field->exchange_data.get.setup_data = NULL;
+  field->exchange_data.get.mask = NULL;
+}
+
+void yac_set_coupling_field_put_op_setup(
+  struct coupling_field * field, unsigned put_idx,
+  yac_coupling_field_setup_func setup, void * setup_data) {
+
+  YAC_ASSERT_F(
+    (field->exchange_type == SOURCE) &&
+    (put_idx < field->exchange_data.put.num_puts),
+    "ERROR(yac_set_coupling_field_put_op_setup): "
+    "invalid put operation (field \"%s\")", field->name)
+
+  field->exchange_data.put.puts[put_idx].setup = setup;
+  field->exchange_data.put.puts[put_idx].setup_data = setup_data;
+}
+
+void yac_set_coupling_field_get_op_setup(
+  struct coupling_field * field,
+  yac_coupling_field_setup_func setup, void * setup_data) {
+
+  YAC_ASSERT_F(
+    field->exchange_type == TARGET,
+    "ERROR(yac_set_coupling_field_get_op_setup): "
+    "no get operation has been set (field \"%s\")", field->name)
+
+  field->exchange_data.get.setup = setup;
+  field->exchange_data.get.setup_data = setup_data;
+}
+
+void yac_coupling_field_put_op_complete_setup(
+  struct coupling_field * field, unsigned put_idx) {
+
+  YAC_ASSERT(
+    field->exchange_type == SOURCE, "ERROR: wrong field exchange type")
+
+  YAC_ASSERT(
+    put_idx < field->exchange_data.put.num_puts, "ERROR: put_idx is invalid")
+
+  // the setup routine may generate the interpolations of multiple
+  // operations, therefore it has to be reset before it is called
+  yac_coupling_field_setup_func setup =
+    field->exchange_data.put.puts[put_idx].setup;
+  field->exchange_data.put.puts[put_idx].setup = NULL;
+
+  if (setup != NULL)
+    setup(field->exchange_data.put.puts[put_idx].setup_data);
+
+  YAC_ASSERT_F(
+    field->exchange_data.put.puts[put_idx].interpolation != NULL,
+    "ERROR(yac_coupling_field_put_op_complete_setup): "
+    "no interpolation available for put operation (field \"%s\")",
+    field->name)
+}
+
+void yac_coupling_field_get_op_complete_setup(struct coupling_field * field) {
+
+  YAC_ASSERT(
+    field->exchange_type == TARGET, "ERROR: wrong field exchange type")
+
+  yac_coupling_field_setup_func setup = field->exchange_data.get.setup;
+  field->exchange_data.get.setup = NULL;
+
+  if (setup != NULL) setup(field->exchange_data.get.setup_data);
+
+  YAC_ASSERT_F(
+    field->exchange_data.get.interpolation != NULL,
+    "ERROR(yac_coupling_field_get_op_complete_setup): "
+    "no interpolation available for get operation (field \"%s\")",
+    field->name)
+}
+
+void yac_set_coupling_field_put_op_interpolation(
+  struct coupling_field * field, unsigned put_idx,
+  struct interpolation * interpolation) {
+
+  YAC_ASSERT_F(
+    (field->exchange_type == SOURCE) &&
+    (put_idx < field->exchange_data.put.num_puts),
+    "ERROR(yac_set_coupling_field_put_op_interpolation): "
+    "invalid put operation (field \"%s\")", field->name)
+
+  yac_interpolation_delete(
+    field->exchange_data.put.puts[put_idx].interpolation);
+  field->exchange_data.put.puts[put_idx].interpolation = interpolation;
+}
+
+void yac_set_coupling_field_get_op_interpolation(
+  struct coupling_field * field, struct interpolation * interpolation) {
+
+  YAC_ASSERT_F(
+    field->exchange_type == TARGET,
+    "ERROR(yac_set_coupling_field_get_op_interpolation): "
+    "no get operation has been set (field \"%s\")", field->name)
+
+  yac_interpolation_delete(field->exchange_data.get.interpolation);
+  field->exchange_data.get.interpolation = interpolation;
+}
+
+void yac_coupling_field_reset_masks(struct coupling_field * field) {
+
+  if ((field->exchange_type == SOURCE) &&
+      (field->exchange_data.put.mask != NULL)) {
+    for (size_t i = 0; i < field->num_interp_fields; ++i)
+      free(field->exchange_data.put.mask[i]);
+    free(field->exchange_data.put.mask);
+    field->exchange_data.put.mask = NULL;
+  } else if ((field->exchange_type == TARGET) &&
+             (field->exchange_data.get.mask != NULL)) {
+    free(field->exchange_data.get.mask);
+    field->exchange_data.get.mask = NULL;
+  }
 }
 
 struct interp_field const * yac_coupling_field_get_interp_fields(
@@ -576,7 +766,6 @@ char* yac_coupling_field_get_datetime(
 
 void yac_coupling_field_delete(struct coupling_field * cpl_field) {
 
-  size_t collection_size = cpl_field->collection_size;
   size_t num_interp_fields = cpl_field->num_interp_fields;
 
   if (cpl_field->exchange_type == SOURCE) {
@@ -592,23 +781,10 @@ void yac_coupling_field_delete(struct coupling_field * cpl_field) {
       double ***send_frac_mask_acc =
         cpl_field->exchange_data.put.puts[put_idx].send_frac_mask_acc;
 
-      if (send_field_acc != NULL) {
-        for (size_t h = 0; h < collection_size; ++h) {
-          for (size_t j = 0; j < num_interp_fields; ++j)
-            free(send_field_acc[h][j]);
-          free(send_field_acc[h]);
-        }
-        free(send_field_acc);
-      }
-
-      if (send_frac_mask_acc != NULL) {
-        for (size_t h = 0; h < collection_size; ++h) {
-          for (size_t j = 0; j < num_interp_fields; ++j)
-            free(send_frac_mask_acc[h][j]);
-          free(send_frac_mask_acc[h]);
-        }
-        free(send_frac_mask_acc);
-      }
+      // the accumulators are allocated in a single memory block
+      // (see get_put_op_acc)
+      free(send_field_acc);
+      free(send_frac_mask_acc);
 
       yac_event_delete(event);
       yac_interpolation_delete(interpolation);
@@ -106,6 +106,47 @@ unsigned yac_get_coupling_field_collection_size(
 const char* yac_get_coupling_field_timestep(
   struct coupling_field * field);
 
+/**
+ * gets whether the user guarantees that the data passed to a put is
+ * neither modified nor freed until the put has been completed
+ *
+ * @param[in] field
+ * @return 1 if put data is stable, 0 otherwise
+ * @see yac_set_coupling_field_stable_put_buffer
+ */
+int yac_get_coupling_field_stable_put_buffer(struct coupling_field * field);
+
+/**
+ * sets whether the user guarantees that the data passed to a put is
+ * neither modified nor freed until the put has been completed, which
+ * allows puts to send the data without copying it first
+ *
+ * @param[in,out] field
+ * @param[in]     is_stable
+ */
+void yac_set_coupling_field_stable_put_buffer(
+  struct coupling_field * field, int is_stable);
+
+/**
+ * gets whether the interpolations of the coupling field have to be generated
+ * during the setup, even if lazy setup is enabled
+ *
+ * @param[in] field
+ * @return 1 if the setup has to be eager, 0 otherwise
+ * @see yac_set_coupling_field_eager_setup
+ */
+int yac_get_coupling_field_eager_setup(struct coupling_field * field);
+
+/**
+ * sets whether the interpolations of the coupling field have to be generated
+ * during the setup, even if lazy setup is enabled
+ *
+ * @param[in,out] field
+ * @param[in]     is_eager
+ */
+void yac_set_coupling_field_eager_setup(
+  struct coupling_field * field, int is_eager);
+
 /**
  * gets the name of the coupling field
  * @param[in] field
@@ -226,6 +267,9 @@ yac_get_coupling_field_put_op_interpolation(struct coupling_field * field,
  *          undefined results
  * @remarks when this routine is called the first time for a put operation
  *          it will be allocated and initialised with zeros
+ * @remarks the buffers of all collection entries and interpolation fields
+ *          are stored in a single contiguous memory block, each buffer
+ *          is aligned to a cache line
  * @see get_coupling_field_num_puts
  */
 double ***
@@ -242,6 +286,9 @@ yac_get_coupling_field_put_op_send_field_acc(struct coupling_field * field,
  *          undefined results
  * @remarks when this routine is called the first time for a put operation
  *          it will be allocated and initialised with zeros
+ * @remarks the buffers of all collection entries and interpolation fields
+ *          are stored in a single contiguous memory block, each buffer
+ *          is aligned to a cache line
  * @see get_coupling_field_num_puts
  */
 double ***
@@ -345,6 +392,13 @@ struct event * yac_get_coupling_field_get_op_event(
 struct interpolation *
 yac_get_coupling_field_get_op_interpolation(struct coupling_field * field);
 
+/**
+ * routine that generates the interpolations of put and get operations on
+ * their first use
+ * @param[in] data data that was provided together with the routine
+ */
+typedef void (*yac_coupling_field_setup_func)(void * data);
+
 /**
  * sets the put operation for the coupling field
  * @param[in,out] field
@@ -369,6 +423,78 @@ void yac_set_coupling_field_get_op(
   struct coupling_field * field, struct event * event,
   struct interpolation * interpolation);
 
+/**
+ * replaces the interpolation of a put operation of the coupling field
+ * @param[in,out] field
+ * @param[in]     put_idx       index of the put operation
+ * @param[in]     interpolation new interpolation
+ * @remarks the coupling field takes control of the new interpolation and
+ *          deletes the previous one
+ */
+void yac_set_coupling_field_put_op_interpolation(
+  struct coupling_field * field, unsigned put_idx,
+  struct interpolation * interpolation);
+
+/**
+ * replaces the interpolation of the get operation of the coupling field
+ * @param[in,out] field
+ * @param[in]     interpolation new interpolation
+ * @remarks the coupling field takes control of the new interpolation and
+ *          deletes the previous one
+ */
+void yac_set_coupling_field_get_op_interpolation(
+  struct coupling_field * field, struct interpolation * interpolation);
+
+/**
+ * sets a routine, which generates the interpolation of a put operation on
+ * its first use
+ * @param[in,out] field
+ * @param[in]     put_idx    index of the put operation
+ * @param[in]     setup      setup routine
+ * @param[in]     setup_data data passed to the setup routine
+ * @remarks the routine is expected to set the interpolation using
+ *          \ref yac_set_coupling_field_put_op_interpolation
+ */
+void yac_set_coupling_field_put_op_setup(
+  struct coupling_field * field, unsigned put_idx,
+  yac_coupling_field_setup_func setup, void * setup_data);
+
+/**
+ * sets a routine, which generates the interpolation of the get operation on
+ * its first use
+ * @param[in,out] field
+ * @param[in]     setup      setup routine
+ * @param[in]     setup_data data passed to the setup routine
+ * @remarks the routine is expected to set the interpolation using
+ *          \ref yac_set_coupling_field_get_op_interpolation
+ */
+void yac_set_coupling_field_get_op_setup(
+  struct coupling_field * field,
+  yac_coupling_field_setup_func setup, void * setup_data);
+
+/**
+ * runs the setup routine of a put operation, if it has not yet been run
+ * @param[in,out] field
+ * @param[in]     put_idx index of the put operation
+ * @remarks the setup routine may be collective
+ */
+void yac_coupling_field_put_op_complete_setup(
+  struct coupling_field * field, unsigned put_idx);
+
+/**
+ * runs the setup routine of the get operation, if it has not yet been run
+ * @param[in,out] field
+ * @remarks the setup routine may be collective
+ */
+void yac_coupling_field_get_op_complete_setup(struct coupling_field * field);
+
+/**
+ * discards the put/get masks that were generated from the masks of the
+ * grid (has to be called after a mask of the grid was modified)
+ * @param[in,out] field
+ */
+void yac_coupling_field_reset_masks(struct coupling_field * field);
+
 
 /**
  * get the current datetime of the coupling field
@@ -370,6 +370,29 @@ size_t yac_basic_grid_add_mask(
       &grid->field_data_set, location, mask, count, mask_name);
 }
 
+void yac_basic_grid_update_mask(
+  struct yac_basic_grid * grid, enum yac_location location,
+  size_t masks_idx, int const * mask) {
+
+  YAC_ASSERT(
+    grid, "ERROR(yac_basic_grid_update_mask): "
+    "NULL is not a valid value for argument grid")
+  YAC_ASSERT_F(
+    !grid->is_empty, "ERROR(yac_basic_grid_update_mask): "
+    "grid \"%s\" is an empty grid", grid->name)
+
+  struct yac_field_data * data =
+    get_field_data(&grid->field_data_set, location);
+
+  YAC_ASSERT(
+    masks_idx < data->masks_count,
+    "ERROR(yac_basic_grid_update_mask): invalid mask_idx")
+
+  memcpy(
+    data->masks[masks_idx].data, mask,
+    yac_basic_grid_get_data_size(grid, location) * sizeof(*mask));
+}
+
 struct yac_field_data * yac_basic_grid_get_field_data(
   struct yac_basic_grid * grid, enum yac_location location) {
 
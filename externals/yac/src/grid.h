@@ -187,6 +187,9 @@ size_t yac_basic_grid_add_mask(
 size_t yac_basic_grid_add_mask_nocpy(
   struct yac_basic_grid * grid, enum yac_location location,
   int const * mask, char const * mask_name);
+void yac_basic_grid_update_mask(
+  struct yac_basic_grid * grid, enum yac_location location,
+  size_t masks_idx, int const * mask);
 void yac_basic_grid_delete(struct yac_basic_grid * grid);
 
 void yac_basic_grid_data_free(struct basic_grid_data grid);
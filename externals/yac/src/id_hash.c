@@ -0,0 +1,173 @@
+/**
+ * @file id_hash.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#include "id_hash.h"
+
+// the table is resized if it is more than half full
+enum {
+  MIN_TABLE_SIZE = 16,
+  MAX_LOAD_FACTOR_INV = 2,
+};
+
+#define EMPTY_ENTRY (SIZE_MAX)
+
+struct id_hash_entry {
+  yac_int id;
+  size_t idx; // EMPTY_ENTRY for unused entries
+};
+
+struct yac_id_hash {
+  struct id_hash_entry * table;
+  size_t table_size; // always a power of two
+  size_t count;
+};
+
+// finaliser of splitmix64, scatters consecutive ids over the whole table
+static inline size_t get_hash(yac_int id, size_t table_size) {
+
+  uint64_t x = (uint64_t)id;
+  x ^= x >> 30;
+  x *= UINT64_C(0xbf58476d1ce4e5b9);
+  x ^= x >> 27;
+  x *= UINT64_C(0x94d049bb133111eb);
+  x ^= x >> 31;
+  return (size_t)x & (table_size - 1);
+}
+
+static size_t get_table_size(size_t count) {
+
+  size_t table_size = MIN_TABLE_SIZE;
+  while (table_size < MAX_LOAD_FACTOR_INV * count) table_size <<= 1;
+  return table_size;
+}
+
+static struct id_hash_entry * alloc_table(size_t table_size) {
+
+  struct id_hash_entry * table = xmalloc(table_size * sizeof(*table));
+  for (size_t i = 0; i < table_size; ++i) table[i].idx = EMPTY_ENTRY;
+  return table;
+}
+
+// returns the entry that contains the id or the empty entry in which it has
+// to be inserted
+static inline struct id_hash_entry * find_entry(
+  struct id_hash_entry * table, size_t table_size, yac_int id) {
+
+  size_t mask = table_size - 1;
+  for (size_t i = get_hash(id, table_size);; i = (i + 1) & mask) {
+    struct id_hash_entry * entry = table + i;
+    if ((entry->idx == EMPTY_ENTRY) || (entry->id == id)) return entry;
+  }
+}
+
+static void resize(struct yac_id_hash * hash, size_t table_size) {
+
+  struct id_hash_entry * old_table = hash->table;
+  size_t old_table_size = hash->table_size;
+
+  struct id_hash_entry * table = alloc_table(table_size);
+  for (size_t i = 0; i < old_table_size; ++i)
+    if (old_table[i].idx != EMPTY_ENTRY)
+      *find_entry(table, table_size, old_table[i].id) = old_table[i];
+
+  free(old_table);
+  hash->table = table;
+  hash->table_size = table_size;
+}
+
+struct yac_id_hash * yac_id_hash_new(size_t count) {
+
+  struct yac_id_hash * hash = xmalloc(1 * sizeof(*hash));
+  hash->table_size = get_table_size(count);
+  hash->table = alloc_table(hash->table_size);
+  hash->count = 0;
+  return hash;
+}
+
+struct yac_id_hash * yac_id_hash_new_from_ids(
+  yac_int const * ids, size_t count) {
+
+  struct yac_id_hash * hash = yac_id_hash_new(count);
+  for (size_t i = 0; i < count; ++i) {
+    size_t idx = yac_id_hash_insert(hash, ids[i], i);
+    YAC_ASSERT(idx == i, "ERROR(yac_id_hash_new_from_ids): duplicated id")
+  }
+  return hash;
+}
+
+size_t yac_id_hash_insert(struct yac_id_hash * hash, yac_int id, size_t idx) {
+
+  YAC_ASSERT(
+    idx != EMPTY_ENTRY, "ERROR(yac_id_hash_insert): invalid index")
+
+  if (MAX_LOAD_FACTOR_INV * (hash->count + 1) > hash->table_size)
+    resize(hash, 2 * hash->table_size);
+
+  struct id_hash_entry * entry = find_entry(hash->table, hash->table_size, id);
+  if (entry->idx == EMPTY_ENTRY) {
+    entry->id = id;
+    entry->idx = idx;
+    hash->count++;
+  }
+  return entry->idx;
+}
+
+int yac_id_hash_lookup(
+  struct yac_id_hash const * hash, yac_int id, size_t * idx) {
+
+  struct id_hash_entry * entry =
+    find_entry(hash->table, hash->table_size, id);
+  if (entry->idx == EMPTY_ENTRY) return 0;
+  *idx = entry->idx;
+  return 1;
+}
+
+size_t yac_id_hash_get_count(struct yac_id_hash const * hash) {
+
+  return hash->count;
+}
+
+void yac_id_hash_delete(struct yac_id_hash * hash) {
+
+  if (hash == NULL) return;
+  free(hash->table);
+  free(hash);
+}
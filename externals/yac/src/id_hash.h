@@ -0,0 +1,102 @@
+/**
+ * @file id_hash.h
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ID_HASH_H
+#define ID_HASH_H
+
+#include <stddef.h>
+
+#include "utils.h"
+
+/** \example test_id_hash.c
+ * This contains a test of the global id hash index.
+ */
+
+/**
+ * hash index that maps global ids to local indices
+ * (open addressing with linear probing)
+ */
+struct yac_id_hash;
+
+/**
+ * generates an empty hash index
+ * @param[in] count expected number of entries (used to size the table)
+ * @return hash index
+ */
+struct yac_id_hash * yac_id_hash_new(size_t count);
+
+/**
+ * generates a hash index for an array of unique ids, the local index of
+ * each id is its position in the array
+ * @param[in] ids   global ids
+ * @param[in] count number of ids
+ * @return hash index
+ */
+struct yac_id_hash * yac_id_hash_new_from_ids(
+  yac_int const * ids, size_t count);
+
+/**
+ * inserts an id into the hash index, if the id is not yet available
+ * @param[in] hash hash index
+ * @param[in] id   global id
+ * @param[in] idx  local index of the id
+ * @return local index of the id (differs from idx if the id was
+ *         already available)
+ */
+size_t yac_id_hash_insert(struct yac_id_hash * hash, yac_int id, size_t idx);
+
+/**
+ * looks up the local index of an id
+ * @param[in]  hash hash index
+ * @param[in]  id   global id
+ * @param[out] idx  local index of the id (unchanged if the id is not
+ *                  available)
+ * @return 1 if the id was found, 0 otherwise
+ */
+int yac_id_hash_lookup(
+  struct yac_id_hash const * hash, yac_int id, size_t * idx);
+
+/**
+ * returns the number of ids in the hash index
+ * @param[in] hash hash index
+ * @return number of ids
+ */
+size_t yac_id_hash_get_count(struct yac_id_hash const * hash);
+
+/**
+ * @param[in] hash hash index
+ */
+void yac_id_hash_delete(struct yac_id_hash * hash);
+
+#endif // ID_HASH_H
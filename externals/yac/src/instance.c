@@ -51,6 +51,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 
 #include "utils.h"
 #include "yac_interface.h"
@@ -65,6 +66,8 @@
 #include "interp_grid.h"
 #include "interp_weights.h"
 #include "interp_method.h"
+#include "weight_cache.h"
+#include "setup_stats.h"
 #include "config_yaml.h"
 
 enum yac_instance_phase {
@@ -128,6 +131,20 @@ struct yac_instance {
   MPI_Comm comm;
 
   enum yac_instance_phase phase;
+
+  struct yac_setup_stats * setup_stats;
+
+  // data kept after the setup for the update of masks
+  // (see yac_instance_update_masks)
+  int dynamic_masks_enabled;
+  struct dynamic_mask_data * dynamic_masks;
+
+  // component pairs whose interpolations are generated on first use
+  // (see yac_instance_enable_lazy_setup)
+  int lazy_setup_enabled;
+  struct lazy_comp_pair ** lazy_comp_pairs;
+  size_t num_lazy_comp_pairs;
+  MPI_Comm lazy_setup_comm; //!< used to check the order of the lazy setups
 };
 
 enum field_type {
@@ -169,6 +186,7 @@ struct src_field_config {
 
   struct yac_interp_stack_config * interp_stack;
   const char * weight_file_name;
+  double weight_pruning_threshold;
   struct field_config_event_data event_data;
 };
 
@@ -198,6 +216,64 @@ struct field_config {
   double scale_factor, scale_summand;
 
   size_t collection_size;
+
+  int use_single_precision;
+};
+
+// distributed grid pair that is used by at least one couple with masks
+struct dynamic_mask_grid_pair {
+  struct dist_grid_pair * dist_grid_pair;
+  struct comp_grid_pair_config comp_grid_pair;
+};
+
+// interpolation grid of a couple with masks
+struct dynamic_mask_interp_grid {
+  struct interp_grid * interp_grid;
+  size_t grid_pair_idx;
+  int src_comp_idx;
+  struct interp_field * src_fields;
+  size_t num_src_fields;
+  struct interp_field tgt_field;
+};
+
+// interpolation weights of a couple with masks and all field
+// configurations using them
+struct dynamic_mask_weights {
+  struct interp_weights * weights;
+  size_t interp_grid_idx;
+  struct yac_interp_stack_config * interp_stack;
+  double weight_pruning_threshold;
+  struct field_config * field_configs;
+  unsigned * put_idx;
+  size_t num_field_configs;
+
+  // global ids of all local unmasked target points (sorted) and the index of
+  // the method of the stack that generated their stencils
+  yac_int * tgt_ids;
+  size_t * method_idx;
+  size_t num_tgt_ids;
+
+  // global ids of all target points, whose stencils changed since the
+  // interpolations were built (sorted, identical on all processes)
+  yac_int * patch_tgt_ids;
+  size_t num_patch_tgt_ids;
+
+  // global number of stencils at the time the interpolations were built
+  size_t num_interp_stencils;
+};
+
+// maximum number of changed target points (relative to the number of
+// stencils of the interpolations) for which the interpolations are patched
+// instead of being rebuilt
+#define DYNAMIC_MASK_MAX_PATCH_FRACTION (0.5)
+
+struct dynamic_mask_data {
+  struct dynamic_mask_grid_pair * grid_pairs;
+  size_t num_grid_pairs;
+  struct dynamic_mask_interp_grid * interp_grids;
+  size_t num_interp_grids;
+  struct dynamic_mask_weights * weights;
+  size_t num_weights;
 };
 
 static struct yac_basic_grid *
@@ -263,6 +339,21 @@ static struct coupling_field * get_coupling_field(
   return NULL;
 }
 
+static enum interp_weights_reorder_type get_reorder_type(
+  int mapping_on_source) {
+
+  YAC_ASSERT_F(
+    (mapping_on_source >= 0) && (mapping_on_source <= 2),
+    "ERROR(get_reorder_type): invalid mapping side (%d)", mapping_on_source)
+
+  switch (mapping_on_source) {
+    case (0): return MAPPING_ON_TGT;
+    default:
+    case (1): return MAPPING_ON_SRC;
+    case (2): return MAPPING_AUTO;
+  }
+}
+
 static struct src_field_config get_src_interp_config(
   struct yac_couple_config * couple_config,
   size_t couple_idx, size_t field_couple_idx) {
@@ -288,6 +379,9 @@ static struct src_field_config get_src_interp_config(
          couple_config, couple_idx, field_couple_idx))?
         yac_couple_config_get_weight_file_name(
           couple_config, couple_idx, field_couple_idx):NULL,
+    .weight_pruning_threshold =
+      yac_couple_config_get_weight_pruning_threshold(
+        couple_config, couple_idx, field_couple_idx),
     .event_data = empty_event_data,
   };
 }
@@ -402,6 +496,10 @@ compare_field_config_interp_method(const void * a, const void * b) {
   if ((a_->src_interp_config.weight_file_name != NULL) &&
       (ret = strcmp(a_->src_interp_config.weight_file_name,
                     b_->src_interp_config.weight_file_name))) return ret;
+  if ((ret = (a_->src_interp_config.weight_pruning_threshold >
+              b_->src_interp_config.weight_pruning_threshold) -
+             (a_->src_interp_config.weight_pruning_threshold <
+              b_->src_interp_config.weight_pruning_threshold))) return ret;
 
   return
     yac_interp_stack_config_compare(
@@ -431,6 +529,8 @@ int compare_field_config(const void * a, const void * b) {
              (a_->scale_factor < b_->scale_factor))) return ret;
   if ((ret = (a_->scale_summand > b_->scale_summand) -
              (a_->scale_summand < b_->scale_summand))) return ret;
+  if ((ret = a_->use_single_precision - b_->use_single_precision))
+    return ret;
 
   // use memcmp to compare frac_mask_fallback_value, because they can be nan
   return
@@ -662,9 +762,9 @@ static void get_field_configuration(
       field_configs[field_config_idx].src_interp_config.field = src_field;
       field_configs[field_config_idx].tgt_interp_config.field = tgt_field;
       field_configs[field_config_idx].reorder_type =
-        (yac_couple_config_mapping_on_source(
-           couple_config, couple_idx, field_couple_idx))?
-        (MAPPING_ON_SRC):(MAPPING_ON_TGT);
+        get_reorder_type(
+          yac_couple_config_mapping_on_source(
+            couple_config, couple_idx, field_couple_idx));
       field_configs[field_config_idx].src_interp_config.event_data =
         get_event_data(instance, couple_idx, field_couple_idx, SRC);
       field_configs[field_config_idx].tgt_interp_config.event_data =
@@ -674,6 +774,9 @@ static void get_field_configuration(
       field_configs[field_config_idx].scale_factor = scale_factor;
       field_configs[field_config_idx].scale_summand = scale_summand;
       field_configs[field_config_idx].collection_size = collection_size;
+      field_configs[field_config_idx].use_single_precision =
+        yac_couple_config_use_single_precision(
+          couple_config, couple_idx, field_couple_idx);
       field_configs[field_config_idx].src_interp_config.name = src_field_name;
       field_configs[field_config_idx].tgt_interp_config.name = tgt_field_name;
       ++field_config_idx;
@@ -809,15 +912,58 @@ int compare_field_config_ids(const void * a, const void * b) {
 
 static struct interp_weights * generate_interp_weights(
   struct src_field_config src_interp_config,
-  struct interp_grid * interp_grid) {
+  struct interp_grid * interp_grid, char const * weight_cache_dir,
+  char const * src_grid_name, char const * tgt_grid_name) {
+
+  // if the weight cache is enabled and contains matching weights, the
+  // weights are read instead of computed
+  struct yac_weight_cache_key * cache_key =
+    (weight_cache_dir != NULL)?
+      yac_weight_cache_key_new(
+        interp_grid, src_interp_config.interp_stack):NULL;
+  char * cache_file_name =
+    (cache_key != NULL)?
+      yac_weight_cache_get_file_name(weight_cache_dir, cache_key):NULL;
+  MPI_Comm comm = yac_interp_grid_get_MPI_Comm(interp_grid);
+
+  struct interp_weights * weights;
+
+  yac_setup_stats_start(YAC_SETUP_PHASE_WEIGHT_CACHE);
+  int cache_hit =
+    (cache_file_name != NULL) &&
+    yac_weight_cache_lookup(cache_file_name, cache_key, comm);
+  yac_setup_stats_stop(YAC_SETUP_PHASE_WEIGHT_CACHE);
+
+  if (cache_hit) {
+
+    yac_setup_stats_start(YAC_SETUP_PHASE_WEIGHT_CACHE);
+    weights =
+      yac_weight_cache_load(
+        cache_file_name, interp_grid, src_grid_name, tgt_grid_name);
+    yac_setup_stats_stop(YAC_SETUP_PHASE_WEIGHT_CACHE);
 
-  struct interp_method ** method_stack =
-    yac_interp_stack_config_generate(src_interp_config.interp_stack);
-  struct interp_weights * weights =
-    yac_interp_method_do_search(method_stack, interp_grid);
+  } else {
 
-  yac_interp_method_delete(method_stack);
-  free(method_stack);
+    struct interp_method ** method_stack =
+      yac_interp_stack_config_generate(src_interp_config.interp_stack);
+    yac_setup_stats_start(YAC_SETUP_PHASE_DO_SEARCH);
+    weights = yac_interp_method_do_search(method_stack, interp_grid);
+    yac_setup_stats_stop(YAC_SETUP_PHASE_DO_SEARCH);
+
+    yac_interp_method_delete(method_stack);
+    free(method_stack);
+
+    if (cache_file_name != NULL) {
+      yac_setup_stats_start(YAC_SETUP_PHASE_WEIGHT_CACHE);
+      yac_weight_cache_store(
+        cache_file_name, cache_key, weights, src_grid_name, tgt_grid_name,
+        comm);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_WEIGHT_CACHE);
+    }
+  }
+
+  free(cache_file_name);
+  yac_weight_cache_key_delete(cache_key);
 
   return weights;
 }
@@ -945,84 +1091,294 @@ static void get_interp_fields_from_coupling_field(
   *num_fields = num_fields_;
 }
 
-static void generate_interpolations(struct yac_instance * instance) {
+static int fields_have_mask(
+  struct interp_field const * src_fields, size_t num_src_fields,
+  struct interp_field const * tgt_field) {
 
-  MPI_Comm comm = instance->comm;
-  size_t num_components =
-    yac_component_config_get_num_components(instance->comp_config);
-  struct component ** components =
-    yac_component_config_get_components(instance->comp_config);
+  int has_mask = tgt_field->masks_idx != SIZE_MAX;
+  for (size_t i = 0; (i < num_src_fields) && !has_mask; ++i)
+    has_mask = src_fields[i].masks_idx != SIZE_MAX;
+  return has_mask;
+}
 
-  // get information about all fields
-  struct field_config * field_configs;
-  size_t field_count;
-  get_field_configuration(
-    instance, &field_configs, &field_count);
+static void dynamic_masks_add_grid_pair(
+  struct dynamic_mask_data * dynamic_masks,
+  struct dist_grid_pair * dist_grid_pair,
+  struct comp_grid_pair_config comp_grid_pair) {
 
-  // sort field configurations
-  qsort(field_configs, field_count, sizeof(*field_configs),
-        compare_field_config_ids);
+  size_t idx = dynamic_masks->num_grid_pairs++;
+  dynamic_masks->grid_pairs =
+    xrealloc(
+      dynamic_masks->grid_pairs,
+      dynamic_masks->num_grid_pairs * sizeof(*(dynamic_masks->grid_pairs)));
+  dynamic_masks->grid_pairs[idx].dist_grid_pair = dist_grid_pair;
+  dynamic_masks->grid_pairs[idx].comp_grid_pair = comp_grid_pair;
+}
+
+static void dynamic_masks_add_interp_grid(
+  struct dynamic_mask_data * dynamic_masks, struct interp_grid * interp_grid,
+  int src_comp_idx, struct interp_field * src_fields, size_t num_src_fields,
+  struct interp_field tgt_field) {
+
+  size_t idx = dynamic_masks->num_interp_grids++;
+  dynamic_masks->interp_grids =
+    xrealloc(
+      dynamic_masks->interp_grids,
+      dynamic_masks->num_interp_grids *
+        sizeof(*(dynamic_masks->interp_grids)));
+  dynamic_masks->interp_grids[idx].interp_grid = interp_grid;
+  dynamic_masks->interp_grids[idx].grid_pair_idx =
+    dynamic_masks->num_grid_pairs - 1;
+  dynamic_masks->interp_grids[idx].src_comp_idx = src_comp_idx;
+  dynamic_masks->interp_grids[idx].src_fields = src_fields;
+  dynamic_masks->interp_grids[idx].num_src_fields = num_src_fields;
+  dynamic_masks->interp_grids[idx].tgt_field = tgt_field;
+}
+
+static void dynamic_masks_add_weights(
+  struct dynamic_mask_data * dynamic_masks,
+  struct src_field_config src_interp_config) {
+
+  size_t idx = dynamic_masks->num_weights++;
+  dynamic_masks->weights =
+    xrealloc(
+      dynamic_masks->weights,
+      dynamic_masks->num_weights * sizeof(*(dynamic_masks->weights)));
+  dynamic_masks->weights[idx].weights = NULL;
+  dynamic_masks->weights[idx].interp_grid_idx =
+    dynamic_masks->num_interp_grids - 1;
+  dynamic_masks->weights[idx].interp_stack = src_interp_config.interp_stack;
+  dynamic_masks->weights[idx].weight_pruning_threshold =
+    src_interp_config.weight_pruning_threshold;
+  dynamic_masks->weights[idx].field_configs = NULL;
+  dynamic_masks->weights[idx].put_idx = NULL;
+  dynamic_masks->weights[idx].num_field_configs = 0;
+  dynamic_masks->weights[idx].tgt_ids = NULL;
+  dynamic_masks->weights[idx].method_idx = NULL;
+  dynamic_masks->weights[idx].num_tgt_ids = 0;
+  dynamic_masks->weights[idx].patch_tgt_ids = NULL;
+  dynamic_masks->weights[idx].num_patch_tgt_ids = 0;
+  dynamic_masks->weights[idx].num_interp_stencils = 0;
+}
+
+static void dynamic_masks_add_field_config(
+  struct dynamic_mask_data * dynamic_masks,
+  struct field_config * field_config, unsigned put_idx) {
+
+  struct dynamic_mask_weights * weights =
+    dynamic_masks->weights + dynamic_masks->num_weights - 1;
+
+  size_t idx = weights->num_field_configs++;
+  weights->field_configs =
+    xrealloc(
+      weights->field_configs,
+      weights->num_field_configs * sizeof(*(weights->field_configs)));
+  weights->put_idx =
+    xrealloc(
+      weights->put_idx,
+      weights->num_field_configs * sizeof(*(weights->put_idx)));
+  weights->field_configs[idx] = *field_config;
+  weights->put_idx[idx] = put_idx;
+}
+
+static void dynamic_masks_delete(struct dynamic_mask_data * dynamic_masks) {
+
+  if (dynamic_masks == NULL) return;
+
+  for (size_t i = 0; i < dynamic_masks->num_weights; ++i) {
+    yac_interp_weights_delete(dynamic_masks->weights[i].weights);
+    free(dynamic_masks->weights[i].field_configs);
+    free(dynamic_masks->weights[i].put_idx);
+    free(dynamic_masks->weights[i].tgt_ids);
+    free(dynamic_masks->weights[i].method_idx);
+    free(dynamic_masks->weights[i].patch_tgt_ids);
+  }
+  free(dynamic_masks->weights);
+  for (size_t i = 0; i < dynamic_masks->num_interp_grids; ++i) {
+    yac_interp_grid_delete(dynamic_masks->interp_grids[i].interp_grid);
+    free(dynamic_masks->interp_grids[i].src_fields);
+  }
+  free(dynamic_masks->interp_grids);
+  for (size_t i = 0; i < dynamic_masks->num_grid_pairs; ++i)
+    yac_dist_grid_pair_delete(dynamic_masks->grid_pairs[i].dist_grid_pair);
+  free(dynamic_masks->grid_pairs);
+  free(dynamic_masks);
+}
+
+static int compare_yac_int(const void * a, const void * b) {
+
+  yac_int a_ = *(yac_int const *)a, b_ = *(yac_int const *)b;
+  return (a_ > b_) - (a_ < b_);
+}
+
+// applies the interpolation method stack of the weights to the provided
+// local target points (see yac_interp_method_do_search_tgts)
+static struct interp_weights * search_dynamic_mask_weights(
+  struct dynamic_mask_weights * weights, struct interp_grid * interp_grid,
+  size_t * tgt_points, size_t * method_idx, size_t num_tgt_points) {
+
+  struct interp_method ** method_stack =
+    yac_interp_stack_config_generate(weights->interp_stack);
+  yac_setup_stats_start(YAC_SETUP_PHASE_DO_SEARCH);
+  struct interp_weights * interp_weights =
+    yac_interp_method_do_search_tgts(
+      method_stack, interp_grid, tgt_points, method_idx, num_tgt_points);
+  yac_setup_stats_stop(YAC_SETUP_PHASE_DO_SEARCH);
+  yac_interp_method_delete(method_stack);
+  free(method_stack);
+
+  if (weights->weight_pruning_threshold > 0.0) {
+    yac_setup_stats_start(YAC_SETUP_PHASE_PRUNE_WEIGHTS);
+    yac_interp_weights_prune(
+      interp_weights, weights->weight_pruning_threshold);
+    yac_setup_stats_stop(YAC_SETUP_PHASE_PRUNE_WEIGHTS);
+  }
+
+  return interp_weights;
+}
+
+// stores the method indices of all local unmasked target points
+static void set_dynamic_mask_method_idx(
+  struct dynamic_mask_weights * weights, struct interp_grid * interp_grid,
+  size_t * tgt_points, size_t const * method_idx, size_t num_tgt_points) {
+
+  free(weights->tgt_ids);
+  free(weights->method_idx);
+
+  weights->tgt_ids = xmalloc(num_tgt_points * sizeof(*(weights->tgt_ids)));
+  weights->method_idx =
+    xmalloc(num_tgt_points * sizeof(*(weights->method_idx)));
+  weights->num_tgt_ids = num_tgt_points;
+
+  yac_interp_grid_get_tgt_global_ids(
+    interp_grid, tgt_points, num_tgt_points, weights->tgt_ids);
+  memcpy(weights->method_idx, method_idx,
+         num_tgt_points * sizeof(*method_idx));
+  yac_quicksort_index_yac_int_size_t(
+    weights->tgt_ids, num_tgt_points, weights->method_idx);
+}
+
+// returns the index of the method that generated the stencil of a target
+// point during the last search (0 if the target point was masked)
+static size_t get_dynamic_mask_method_idx(
+  struct dynamic_mask_weights * weights, yac_int tgt_id) {
+
+  yac_int * id =
+    bsearch(
+      &tgt_id, weights->tgt_ids, weights->num_tgt_ids,
+      sizeof(*(weights->tgt_ids)), compare_yac_int);
+  return (id != NULL)?weights->method_idx[id - weights->tgt_ids]:0;
+}
+
+// resets the list of changed target points, because the interpolations
+// are (re)built from the current weights
+static void reset_dynamic_mask_patch(
+  struct dynamic_mask_weights * weights, MPI_Comm comm) {
+
+  free(weights->patch_tgt_ids);
+  weights->patch_tgt_ids = NULL;
+  weights->num_patch_tgt_ids = 0;
+
+  uint64_t interp_count =
+    (uint64_t)yac_interp_weights_get_interp_count(weights->weights);
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &interp_count, 1, MPI_UINT64_T, MPI_SUM, comm), comm);
+  weights->num_interp_stencils = (size_t)interp_count;
+}
+
+// computes the stencils of all local unmasked target points
+static void compute_dynamic_mask_weights(
+  struct dynamic_mask_weights * weights, struct interp_grid * interp_grid) {
+
+  size_t * tgt_points, num_tgt_points;
+  yac_interp_grid_get_tgt_points(interp_grid, &tgt_points, &num_tgt_points);
+  size_t * method_idx = xcalloc(num_tgt_points, sizeof(*method_idx));
+
+  yac_interp_weights_delete(weights->weights);
+  weights->weights =
+    search_dynamic_mask_weights(
+      weights, interp_grid, tgt_points, method_idx, num_tgt_points);
+  set_dynamic_mask_method_idx(
+    weights, interp_grid, tgt_points, method_idx, num_tgt_points);
+
+  free(method_idx);
+  free(tgt_points);
+
+  reset_dynamic_mask_patch(weights, yac_interp_grid_get_MPI_Comm(interp_grid));
+}
+
+static void print_auto_mapping_side(
+  struct field_config * field_config,
+  enum interp_weights_reorder_type reorder_type, MPI_Comm comm) {
+
+  int comm_rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  if (comm_rank != 0) return;
+
+  int src_comp_idx = field_config->src_comp_idx;
+  struct comp_grid_config * src_config =
+    field_config->comp_grid_pair.config + src_comp_idx;
+  struct comp_grid_config * tgt_config =
+    field_config->comp_grid_pair.config + (src_comp_idx ^ 1);
+
+  fprintf(stderr, "INFO: automatic mapping side selection for couple:\n"
+                  "  source:\n"
+                  "    component name: %s\n"
+                  "    grid name:      %s\n"
+                  "    field name:     %s\n"
+                  "  target:\n"
+                  "    component name: %s\n"
+                  "    grid name:      %s\n"
+                  "    field name:     %s\n"
+                  "  selected side: %s\n",
+          src_config->comp_name, src_config->grid_name,
+          field_config->src_interp_config.name,
+          tgt_config->comp_name, tgt_config->grid_name,
+          field_config->tgt_interp_config.name,
+          (reorder_type == MAPPING_ON_SRC)?"source":"target");
+}
+
+static void generate_comp_pair_interpolations(
+  struct yac_instance * instance, struct field_config * field_configs,
+  size_t field_count, MPI_Comm comp_pair_comm, char const * weight_cache_dir,
+  unsigned const * put_idx) {
 
   struct dist_grid_pair * dist_grid_pair = NULL;
   struct interp_grid * interp_grid = NULL;
   struct interp_weights * interp_weights = NULL;
   struct interpolation * interp = NULL;
-  struct comp_grid_pair_config * prev_comp_grid_pair = NULL;
-  MPI_Comm comp_pair_comm = MPI_COMM_NULL;
-  int is_active = 0;
 
-  // loop over all fields to build interpolations
+  // if the update of masks after the setup is enabled, the data of
+  // all couples with masks is kept
+  struct dynamic_mask_data * dynamic_masks = instance->dynamic_masks;
+  int dist_grid_pair_is_kept = 0;
+  int interp_grid_is_kept = 0;
+  int interp_weights_are_kept = 0;
+
+  // loop over all fields of the component pair to build interpolations
   for (size_t i = 0; i < field_count; ++i) {
 
     struct field_config * curr_field_config = field_configs + i;
     struct comp_grid_pair_config * curr_comp_grid_pair =
       &(curr_field_config->comp_grid_pair);
+    struct comp_grid_pair_config * prev_comp_grid_pair =
+      (i > 0)?&(curr_field_config[-1].comp_grid_pair):NULL;
 
-    int build_flag = 0;
-    // if the current comp pair is different from the previous one
-    // => generate a component pair communicator
-    if ((prev_comp_grid_pair == NULL) ||
-        (strcmp(prev_comp_grid_pair->config[0].comp_name,
-                curr_comp_grid_pair->config[0].comp_name) ||
-         strcmp(prev_comp_grid_pair->config[1].comp_name,
-                curr_comp_grid_pair->config[1].comp_name))) {
-
-      build_flag = 1;
-
-      if (comp_pair_comm != MPI_COMM_NULL)
-        yac_mpi_call(MPI_Comm_free(&comp_pair_comm), comm);
-
-      int comp_is_available[2] =
-        {contains_component(
-           components, num_components,
-           curr_comp_grid_pair->config[0].comp_name),
-         contains_component(
-           components, num_components,
-           curr_comp_grid_pair->config[1].comp_name)};
-
-      is_active = comp_is_available[0] || comp_is_available[1];
-
-      yac_mpi_call(MPI_Comm_split(comm, is_active, 0,
-                                  &comp_pair_comm), comm);
+    int build_flag = i == 0;
 
-      // determine whether both components are available in the setup
-      yac_mpi_call(MPI_Allreduce(MPI_IN_PLACE, comp_is_available, 2,
-                                 MPI_INT, MPI_LOR, comp_pair_comm), comm);
-      is_active = comp_is_available[0] && comp_is_available[1];
-    }
-
-    // if the current configuration differs from the previous one and the local
-    // process is involved in this configuration
-    if (is_active &&
-        (build_flag ||
-         strcmp(prev_comp_grid_pair->config[0].grid_name,
-                curr_comp_grid_pair->config[0].grid_name) ||
-         strcmp(prev_comp_grid_pair->config[1].grid_name,
-                curr_comp_grid_pair->config[1].grid_name))) {
+    // if the current configuration differs from the previous one
+    if (build_flag ||
+        strcmp(prev_comp_grid_pair->config[0].grid_name,
+               curr_comp_grid_pair->config[0].grid_name) ||
+        strcmp(prev_comp_grid_pair->config[1].grid_name,
+               curr_comp_grid_pair->config[1].grid_name)) {
 
       build_flag = 1;
 
-      if (dist_grid_pair != NULL) yac_dist_grid_pair_delete(dist_grid_pair);
+      if ((dist_grid_pair != NULL) && !dist_grid_pair_is_kept)
+        yac_dist_grid_pair_delete(dist_grid_pair);
+      dist_grid_pair_is_kept = 0;
 
       char const * grid_names[2] =
         {curr_comp_grid_pair->config[0].grid_name,
@@ -1040,8 +1396,10 @@ static void generate_interpolations(struct yac_instance * instance) {
            grid_names[1], component_names[1], instance->num_cpl_fields,
            instance->cpl_fields, &delete_flags[1])};
 
+      yac_setup_stats_start(YAC_SETUP_PHASE_DIST_GRID_PAIR);
       dist_grid_pair =
         yac_dist_grid_pair_new(basic_grid[0], basic_grid[1], comp_pair_comm);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_DIST_GRID_PAIR);
 
       for (int i = 0; i < 2; ++i)
         if (delete_flags[i]) yac_basic_grid_delete(basic_grid[i]);
@@ -1049,10 +1407,9 @@ static void generate_interpolations(struct yac_instance * instance) {
 
     // if the current source or target field data differes from the previous
     // one
-    if (is_active &&
-        (build_flag ||
-         compare_field_config_field_ids(
-           curr_field_config - 1, curr_field_config))) {
+    if (build_flag ||
+        compare_field_config_field_ids(
+          curr_field_config - 1, curr_field_config)) {
 
       build_flag = 1;
 
@@ -1076,116 +1433,524 @@ static void generate_interpolations(struct yac_instance * instance) {
         "ERROR(generate_interpolations): "
         "only one point set per target field supported")
 
-      if (interp_grid != NULL) yac_interp_grid_delete(interp_grid);
+      if ((interp_grid != NULL) && !interp_grid_is_kept)
+        yac_interp_grid_delete(interp_grid);
 
       int src_comp_idx = field_configs[i].src_comp_idx;
+      yac_setup_stats_start(YAC_SETUP_PHASE_INTERP_GRID);
       interp_grid = yac_interp_grid_new(
         dist_grid_pair,
         curr_comp_grid_pair->config[src_comp_idx].grid_name,
         curr_comp_grid_pair->config[src_comp_idx^1].grid_name,
         num_src_fields, src_fields, *tgt_fields);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_INTERP_GRID);
+
+      // keep the interpolation grid (and its distributed grid pair) if it
+      // contains masks that may be updated after the setup
+      interp_grid_is_kept =
+        (dynamic_masks != NULL) &&
+        fields_have_mask(src_fields, num_src_fields, tgt_fields);
+      if (interp_grid_is_kept) {
+        if (!dist_grid_pair_is_kept)
+          dynamic_masks_add_grid_pair(
+            dynamic_masks, dist_grid_pair, *curr_comp_grid_pair);
+        dist_grid_pair_is_kept = 1;
+        dynamic_masks_add_interp_grid(
+          dynamic_masks, interp_grid, src_comp_idx,
+          src_fields, num_src_fields, *tgt_fields);
+      } else {
+        free(src_fields);
+      }
 
       free(tgt_fields);
-      free(src_fields);
     }
 
     // if the current interpolation method stack differes from the previous
     // configuration
-    if (is_active &&
-        (build_flag ||
-         compare_field_config_interp_method(
-           curr_field_config - 1, curr_field_config))) {
+    if (build_flag ||
+        compare_field_config_interp_method(
+          curr_field_config - 1, curr_field_config)) {
 
       build_flag = 1;
 
-      if (interp_weights != NULL) yac_interp_weights_delete(interp_weights);
+      if (!interp_weights_are_kept) yac_interp_weights_delete(interp_weights);
+
+      int src_comp_idx = field_configs[i].src_comp_idx;
 
       // generate interp weights
-      interp_weights = generate_interp_weights(
-        curr_field_config->src_interp_config, interp_grid);
+      yac_setup_stats_start(YAC_SETUP_PHASE_INTERP_WEIGHTS);
+      interp_weights_are_kept = interp_grid_is_kept;
+      if (interp_weights_are_kept) {
+
+        // weights that may be updated after the setup are always computed
+        // (instead of being read from the weight cache), because the update
+        // requires the methods that generated the stencils
+        dynamic_masks_add_weights(
+          dynamic_masks, curr_field_config->src_interp_config);
+        struct dynamic_mask_weights * dynamic_weights =
+          dynamic_masks->weights + dynamic_masks->num_weights - 1;
+        compute_dynamic_mask_weights(dynamic_weights, interp_grid);
+        interp_weights = dynamic_weights->weights;
+
+      } else {
+
+        interp_weights = generate_interp_weights(
+          curr_field_config->src_interp_config, interp_grid, weight_cache_dir,
+          curr_comp_grid_pair->config[src_comp_idx].grid_name,
+          curr_comp_grid_pair->config[src_comp_idx^1].grid_name);
+
+        // remove small weights (if enabled for the current couple)
+        if (curr_field_config->src_interp_config.weight_pruning_threshold >
+            0.0) {
+          yac_setup_stats_start(YAC_SETUP_PHASE_PRUNE_WEIGHTS);
+          yac_interp_weights_prune(
+            interp_weights,
+            curr_field_config->src_interp_config.weight_pruning_threshold);
+          yac_setup_stats_stop(YAC_SETUP_PHASE_PRUNE_WEIGHTS);
+        }
+      }
+      yac_setup_stats_stop(YAC_SETUP_PHASE_INTERP_WEIGHTS);
     }
 
-    if (is_active &&
-        (curr_field_config->src_interp_config.weight_file_name != NULL)) {
+    if (curr_field_config->src_interp_config.weight_file_name != NULL) {
 
       int src_comp_idx = field_configs[i].src_comp_idx;
 
+      yac_setup_stats_start(YAC_SETUP_PHASE_WRITE_WEIGHTS);
       yac_interp_weights_write_to_file(
         interp_weights,
         curr_field_config->src_interp_config.weight_file_name,
         curr_comp_grid_pair->config[src_comp_idx].grid_name,
         curr_comp_grid_pair->config[src_comp_idx^1].grid_name);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_WRITE_WEIGHTS);
     }
 
     // if the current weight reorder method differs from the previous
     // configuration
     // (use memcmp to compare frac_mask_fallback_value, because they can be nan)
-    if (is_active &&
-        (build_flag ||
-         (curr_field_config[-1].reorder_type !=
-          curr_field_config->reorder_type) ||
-         (curr_field_config[-1].collection_size !=
-          curr_field_config->collection_size) ||
-         (curr_field_config[-1].scale_factor !=
-          curr_field_config->scale_factor) ||
-         (curr_field_config[-1].scale_summand !=
-          curr_field_config->scale_summand) ||
-         memcmp(
-           &(curr_field_config[-1].frac_mask_fallback_value),
-           &(curr_field_config->frac_mask_fallback_value),
-           sizeof(double)))) {
+    if (build_flag ||
+        (curr_field_config[-1].reorder_type !=
+         curr_field_config->reorder_type) ||
+        (curr_field_config[-1].collection_size !=
+         curr_field_config->collection_size) ||
+        (curr_field_config[-1].scale_factor !=
+         curr_field_config->scale_factor) ||
+        (curr_field_config[-1].scale_summand !=
+         curr_field_config->scale_summand) ||
+        (curr_field_config[-1].use_single_precision !=
+         curr_field_config->use_single_precision) ||
+        memcmp(
+          &(curr_field_config[-1].frac_mask_fallback_value),
+          &(curr_field_config->frac_mask_fallback_value),
+          sizeof(double))) {
 
       if (interp != NULL) yac_interpolation_delete(interp);
 
       // generate interpolation
+      yac_setup_stats_start(YAC_SETUP_PHASE_INTERPOLATION);
+      enum interp_weights_reorder_type reorder_type =
+        curr_field_config->reorder_type;
+      if (reorder_type == MAPPING_AUTO) {
+        reorder_type =
+          yac_interp_weights_select_mapping_side(
+            interp_weights, curr_field_config->collection_size,
+            curr_field_config->use_single_precision);
+        print_auto_mapping_side(
+          curr_field_config, reorder_type, comp_pair_comm);
+      }
       interp =
-        yac_interp_weights_get_interpolation(
-          interp_weights, curr_field_config->reorder_type,
+        yac_interp_weights_get_interpolation_prec(
+          interp_weights, reorder_type,
           curr_field_config->collection_size,
           curr_field_config->frac_mask_fallback_value,
           curr_field_config->scale_factor,
-          curr_field_config->scale_summand);
+          curr_field_config->scale_summand,
+          curr_field_config->use_single_precision);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_INTERPOLATION);
     }
 
-    if (is_active) {
-
-      int is_source = curr_field_config->src_interp_config.field != NULL;
-      int is_target = curr_field_config->tgt_interp_config.field != NULL;
+    int is_source = curr_field_config->src_interp_config.field != NULL;
+    int is_target = curr_field_config->tgt_interp_config.field != NULL;
 
-      struct interpolation * interp_copy = yac_interpolation_copy(interp);
+    struct interpolation * interp_copy = yac_interpolation_copy(interp);
 
-      if (is_source) {
+    // if the operations were already set by a lazy setup, only their
+    // interpolations are missing
+    unsigned curr_put_idx = UINT_MAX;
+    if (is_source) {
+      if (put_idx == NULL) {
         yac_set_coupling_field_put_op(
           curr_field_config->src_interp_config.field,
           generate_event(
             curr_field_config->src_interp_config.event_data),
           interp_copy);
-        yac_interpolation_inc_ref_count(interp_copy);
+        curr_put_idx =
+          yac_get_coupling_field_num_puts(
+            curr_field_config->src_interp_config.field) - 1;
+      } else {
+        curr_put_idx = put_idx[i];
+        yac_set_coupling_field_put_op_interpolation(
+          curr_field_config->src_interp_config.field, curr_put_idx,
+          interp_copy);
       }
+      yac_interpolation_inc_ref_count(interp_copy);
+    }
 
-      if (is_target) {
+    if (is_target) {
+      if (put_idx == NULL)
         yac_set_coupling_field_get_op(
           curr_field_config->tgt_interp_config.field,
           generate_event(
             curr_field_config->tgt_interp_config.event_data),
           interp_copy);
-        yac_interpolation_inc_ref_count(interp_copy);
-      }
+      else
+        yac_set_coupling_field_get_op_interpolation(
+          curr_field_config->tgt_interp_config.field, interp_copy);
+      yac_interpolation_inc_ref_count(interp_copy);
+    }
+
+    yac_interpolation_delete(interp_copy);
+
+    if (interp_weights_are_kept)
+      dynamic_masks_add_field_config(
+        dynamic_masks, curr_field_config, curr_put_idx);
+  }
+
+  yac_interpolation_delete(interp);
+  if (!interp_weights_are_kept) yac_interp_weights_delete(interp_weights);
+  if (!interp_grid_is_kept) yac_interp_grid_delete(interp_grid);
+  if (!dist_grid_pair_is_kept) yac_dist_grid_pair_delete(dist_grid_pair);
+}
+
+// couples of a component pair, whose interpolations are generated on the
+// first use of any of them (see yac_instance_enable_lazy_setup)
+struct lazy_comp_pair {
+  struct yac_instance * instance;
+  struct field_config * field_configs;
+  unsigned * put_idx;
+  size_t num_field_configs;
+  MPI_Comm comm; //!< MPI_COMM_NULL once the interpolations are generated
+  char * weight_cache_dir;
+  int idx; //!< index of the component pair (identical on all processes)
+  int * remote_ranks; //!< ranks of the other processes of the pair
+                      //!< in lazy_setup_comm of the instance
+  int num_remote_ranks;
+};
+
+static struct lazy_comp_pair * get_lazy_comp_pair(
+  struct yac_instance * instance, int idx) {
+
+  for (size_t i = 0; i < instance->num_lazy_comp_pairs; ++i)
+    if (instance->lazy_comp_pairs[i]->idx == idx)
+      return instance->lazy_comp_pairs[i];
+  return NULL;
+}
+
+// checks whether all processes of a component pair started the lazy setup of
+// the same pair
+// (each process sends the index of the pair it is setting up to all other
+// processes of this pair; if a process started the setup of a different pair,
+// which contains the local process as well, it has sent the index of that
+// pair instead and both pairs would deadlock)
+static void check_lazy_comp_pair_order(
+  struct lazy_comp_pair * lazy_comp_pair) {
+
+  int num_remote_ranks = lazy_comp_pair->num_remote_ranks;
+  if (num_remote_ranks == 0) return;
+
+  MPI_Comm comm = lazy_comp_pair->instance->lazy_setup_comm;
+  int * remote_idx = xmalloc((size_t)num_remote_ranks * sizeof(*remote_idx));
+  MPI_Request * requests =
+    xmalloc(2 * (size_t)num_remote_ranks * sizeof(*requests));
+
+  for (int i = 0; i < num_remote_ranks; ++i) {
+    yac_mpi_call(
+      MPI_Irecv(
+        remote_idx + i, 1, MPI_INT, lazy_comp_pair->remote_ranks[i], 0, comm,
+        requests + i), comm);
+    yac_mpi_call(
+      MPI_Isend(
+        &(lazy_comp_pair->idx), 1, MPI_INT, lazy_comp_pair->remote_ranks[i],
+        0, comm, requests + num_remote_ranks + i), comm);
+  }
+  yac_mpi_call(
+    MPI_Waitall(2 * num_remote_ranks, requests, MPI_STATUSES_IGNORE), comm);
+
+  for (int i = 0; i < num_remote_ranks; ++i) {
+
+    if (remote_idx[i] == lazy_comp_pair->idx) continue;
+
+    struct comp_grid_pair_config * local_pair =
+      &(lazy_comp_pair->field_configs[0].comp_grid_pair);
+    struct lazy_comp_pair * remote_lazy_comp_pair =
+      get_lazy_comp_pair(lazy_comp_pair->instance, remote_idx[i]);
+    struct comp_grid_pair_config * remote_pair =
+      (remote_lazy_comp_pair != NULL)?
+        &(remote_lazy_comp_pair->field_configs[0].comp_grid_pair):NULL;
+
+    YAC_ASSERT_F(
+      0,
+      "ERROR(check_lazy_comp_pair_order): inconsistent order of the first "
+      "exchanges of lazily set up component pairs: the local process starts "
+      "the setup of the pair (\"%s\", \"%s\") while process %d starts "
+      "the setup of the pair (\"%s\", \"%s\") (the first exchanges of "
+      "different component pairs have to occur in the same order on all "
+      "processes)",
+      local_pair->config[0].comp_name, local_pair->config[1].comp_name,
+      lazy_comp_pair->remote_ranks[i],
+      (remote_pair != NULL)?remote_pair->config[0].comp_name:"unknown",
+      (remote_pair != NULL)?remote_pair->config[1].comp_name:"unknown")
+  }
+
+  free(requests);
+  free(remote_idx);
+}
+
+static void lazy_comp_pair_setup(void * data) {
+
+  struct lazy_comp_pair * lazy_comp_pair = (struct lazy_comp_pair *)data;
 
-      yac_interpolation_delete(interp_copy);
+  // the interpolations of all couples of the component pair are generated
+  // at once, the setup routines of the other couples have nothing to do
+  if (lazy_comp_pair->comm == MPI_COMM_NULL) return;
 
+  check_lazy_comp_pair_order(lazy_comp_pair);
+
+  generate_comp_pair_interpolations(
+    lazy_comp_pair->instance, lazy_comp_pair->field_configs,
+    lazy_comp_pair->num_field_configs, lazy_comp_pair->comm,
+    lazy_comp_pair->weight_cache_dir, lazy_comp_pair->put_idx);
+
+  yac_mpi_call(
+    MPI_Comm_free(&(lazy_comp_pair->comm)), lazy_comp_pair->instance->comm);
+}
+
+static void lazy_comp_pair_delete(struct lazy_comp_pair * lazy_comp_pair) {
+
+  if (lazy_comp_pair->comm != MPI_COMM_NULL)
+    yac_mpi_call(
+      MPI_Comm_free(&(lazy_comp_pair->comm)), lazy_comp_pair->instance->comm);
+  free(lazy_comp_pair->field_configs);
+  free(lazy_comp_pair->put_idx);
+  free(lazy_comp_pair->weight_cache_dir);
+  free(lazy_comp_pair->remote_ranks);
+  free(lazy_comp_pair);
+}
+
+static int is_lazy_comp_pair(
+  struct yac_instance * instance, struct field_config * field_configs,
+  size_t field_count, MPI_Comm comp_pair_comm) {
+
+  // the setup of a component pair is eager, if lazy setup is not enabled
+  // on all processes or if any process marked one of its fields for
+  // eager setup
+  int flags[2] = {!instance->lazy_setup_enabled, 0};
+  for (size_t i = 0; (i < field_count) && !flags[1]; ++i) {
+    struct coupling_field * src_field =
+      field_configs[i].src_interp_config.field;
+    struct coupling_field * tgt_field =
+      field_configs[i].tgt_interp_config.field;
+    flags[1] =
+      ((src_field != NULL) && yac_get_coupling_field_eager_setup(src_field)) ||
+      ((tgt_field != NULL) && yac_get_coupling_field_eager_setup(tgt_field));
+  }
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, flags, 2, MPI_INT, MPI_LOR, comp_pair_comm),
+    comp_pair_comm);
+
+  return !flags[0] && !flags[1];
+}
+
+static void add_lazy_comp_pair(
+  struct yac_instance * instance, struct field_config * field_configs,
+  size_t field_count, MPI_Comm comp_pair_comm,
+  char const * weight_cache_dir, int comp_pair_idx) {
+
+  struct lazy_comp_pair * lazy_comp_pair = xmalloc(1 * sizeof(*lazy_comp_pair));
+  lazy_comp_pair->instance = instance;
+  lazy_comp_pair->field_configs =
+    xmalloc(field_count * sizeof(*(lazy_comp_pair->field_configs)));
+  memcpy(
+    lazy_comp_pair->field_configs, field_configs,
+    field_count * sizeof(*field_configs));
+  lazy_comp_pair->put_idx =
+    xmalloc(field_count * sizeof(*(lazy_comp_pair->put_idx)));
+  lazy_comp_pair->num_field_configs = field_count;
+  lazy_comp_pair->comm = comp_pair_comm;
+  lazy_comp_pair->weight_cache_dir =
+    (weight_cache_dir != NULL)?strdup(weight_cache_dir):NULL;
+  lazy_comp_pair->idx = comp_pair_idx;
+
+  // determine the ranks of the other processes of the component pair in
+  // the communicator used for checking the order of the lazy setups
+  {
+    int comp_pair_rank, comp_pair_size;
+    yac_mpi_call(
+      MPI_Comm_rank(comp_pair_comm, &comp_pair_rank), comp_pair_comm);
+    yac_mpi_call(
+      MPI_Comm_size(comp_pair_comm, &comp_pair_size), comp_pair_comm);
+    MPI_Group comp_pair_group, lazy_setup_group;
+    yac_mpi_call(
+      MPI_Comm_group(comp_pair_comm, &comp_pair_group), comp_pair_comm);
+    yac_mpi_call(
+      MPI_Comm_group(instance->lazy_setup_comm, &lazy_setup_group),
+      comp_pair_comm);
+    int * comp_pair_ranks =
+      xmalloc((size_t)comp_pair_size * sizeof(*comp_pair_ranks));
+    lazy_comp_pair->remote_ranks =
+      xmalloc((size_t)comp_pair_size * sizeof(*(lazy_comp_pair->remote_ranks)));
+    for (int i = 0, j = 0; i < comp_pair_size; ++i)
+      if (i != comp_pair_rank) comp_pair_ranks[j++] = i;
+    lazy_comp_pair->num_remote_ranks = comp_pair_size - 1;
+    yac_mpi_call(
+      MPI_Group_translate_ranks(
+        comp_pair_group, comp_pair_size - 1, comp_pair_ranks,
+        lazy_setup_group, lazy_comp_pair->remote_ranks), comp_pair_comm);
+    free(comp_pair_ranks);
+    yac_mpi_call(MPI_Group_free(&lazy_setup_group), comp_pair_comm);
+    yac_mpi_call(MPI_Group_free(&comp_pair_group), comp_pair_comm);
+  }
+
+  // the put and get operations are set up now (the events are required
+  // for the determination of the actions), their interpolations are
+  // generated on the first exchange
+  for (size_t i = 0; i < field_count; ++i) {
+
+    struct field_config * field_config = field_configs + i;
+    struct coupling_field * src_field = field_config->src_interp_config.field;
+    struct coupling_field * tgt_field = field_config->tgt_interp_config.field;
+
+    lazy_comp_pair->put_idx[i] = UINT_MAX;
+    if (src_field != NULL) {
+      yac_set_coupling_field_put_op(
+        src_field, generate_event(field_config->src_interp_config.event_data),
+        NULL);
+      lazy_comp_pair->put_idx[i] =
+        yac_get_coupling_field_num_puts(src_field) - 1;
+      yac_set_coupling_field_put_op_setup(
+        src_field, lazy_comp_pair->put_idx[i],
+        lazy_comp_pair_setup, lazy_comp_pair);
+    }
+    if (tgt_field != NULL) {
+      yac_set_coupling_field_get_op(
+        tgt_field, generate_event(field_config->tgt_interp_config.event_data),
+        NULL);
+      yac_set_coupling_field_get_op_setup(
+        tgt_field, lazy_comp_pair_setup, lazy_comp_pair);
     }
+  }
+
+  instance->lazy_comp_pairs =
+    xrealloc(
+      instance->lazy_comp_pairs,
+      (instance->num_lazy_comp_pairs + 1) *
+        sizeof(*(instance->lazy_comp_pairs)));
+  instance->lazy_comp_pairs[instance->num_lazy_comp_pairs++] = lazy_comp_pair;
+}
+
+static void generate_interpolations(struct yac_instance * instance) {
+
+  MPI_Comm comm = instance->comm;
+  size_t num_components =
+    yac_component_config_get_num_components(instance->comp_config);
+  struct component ** components =
+    yac_component_config_get_components(instance->comp_config);
 
-    prev_comp_grid_pair = curr_comp_grid_pair;
+  // get information about all fields
+  struct field_config * field_configs;
+  size_t field_count;
+  get_field_configuration(
+    instance, &field_configs, &field_count);
+
+  // sort field configurations
+  qsort(field_configs, field_count, sizeof(*field_configs),
+        compare_field_config_ids);
+
+  // get the directory of the weight cache (NULL if it is not enabled)
+  char * weight_cache_dir = yac_weight_cache_get_dir(comm);
+
+  // if the update of masks after the setup is enabled, the data of
+  // all couples with masks is kept
+  if (instance->dynamic_masks_enabled) {
+    dynamic_masks_delete(instance->dynamic_masks);
+    instance->dynamic_masks = xcalloc(1, sizeof(*(instance->dynamic_masks)));
+  }
+
+  // if any process uses the lazy setup, a separate communicator is required
+  // for checking the order in which the lazy setups are done
+  int lazy_setup_enabled = instance->lazy_setup_enabled;
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &lazy_setup_enabled, 1, MPI_INT, MPI_LOR, comm), comm);
+  if (lazy_setup_enabled && (instance->lazy_setup_comm == MPI_COMM_NULL))
+    yac_mpi_call(MPI_Comm_dup(comm, &(instance->lazy_setup_comm)), comm);
+
+  // loop over all component pairs to build interpolations
+  int comp_pair_idx = 0;
+  for (size_t i = 0, field_pair_count; i < field_count;
+       i += field_pair_count, ++comp_pair_idx) {
+
+    struct comp_grid_pair_config * curr_comp_grid_pair =
+      &(field_configs[i].comp_grid_pair);
+
+    // get the number of field configurations of the current component pair
+    for (field_pair_count = 1;
+         (i + field_pair_count < field_count) &&
+         !strcmp(field_configs[i + field_pair_count].
+                   comp_grid_pair.config[0].comp_name,
+                 curr_comp_grid_pair->config[0].comp_name) &&
+         !strcmp(field_configs[i + field_pair_count].
+                   comp_grid_pair.config[1].comp_name,
+                 curr_comp_grid_pair->config[1].comp_name);
+         ++field_pair_count);
+
+    // generate a component pair communicator
+    int comp_is_available[2] =
+      {contains_component(
+         components, num_components,
+         curr_comp_grid_pair->config[0].comp_name),
+       contains_component(
+         components, num_components,
+         curr_comp_grid_pair->config[1].comp_name)};
+
+    int is_active = comp_is_available[0] || comp_is_available[1];
+
+    MPI_Comm comp_pair_comm;
+    yac_mpi_call(MPI_Comm_split(comm, is_active, 0,
+                                &comp_pair_comm), comm);
+
+    // determine whether both components are available in the setup
+    yac_mpi_call(MPI_Allreduce(MPI_IN_PLACE, comp_is_available, 2,
+                               MPI_INT, MPI_LOR, comp_pair_comm), comm);
+    is_active = comp_is_available[0] && comp_is_available[1];
+
+    // if the local process is involved in this component pair
+    if (is_active) {
+
+      if (is_lazy_comp_pair(
+            instance, field_configs + i, field_pair_count, comp_pair_comm)) {
+
+        // the lazy setup takes over the communicator
+        add_lazy_comp_pair(
+          instance, field_configs + i, field_pair_count, comp_pair_comm,
+          weight_cache_dir, comp_pair_idx);
+        comp_pair_comm = MPI_COMM_NULL;
+
+      } else {
+
+        generate_comp_pair_interpolations(
+          instance, field_configs + i, field_pair_count, comp_pair_comm,
+          weight_cache_dir, NULL);
+      }
+    }
+
+    if (comp_pair_comm != MPI_COMM_NULL)
+      yac_mpi_call(MPI_Comm_free(&comp_pair_comm), comm);
   }
 
-  yac_interpolation_delete(interp);
-  yac_interp_weights_delete(interp_weights);
-  yac_interp_grid_delete(interp_grid);
-  yac_dist_grid_pair_delete(dist_grid_pair);
-  if (comp_pair_comm != MPI_COMM_NULL)
-    yac_mpi_call(MPI_Comm_free(&comp_pair_comm), comm);
   free(field_configs);
+  free(weight_cache_dir);
 }
 
 void yac_instance_sync_def(struct yac_instance * instance) {
@@ -1196,11 +1961,53 @@ void yac_instance_sync_def(struct yac_instance * instance) {
   yac_couple_config_sync(instance->couple_config, instance->comm);
 }
 
+static void aggregate_setup_stats(struct yac_instance * instance) {
+
+  size_t num_comps =
+    yac_couple_config_get_num_components(instance->couple_config);
+  size_t num_local_comps =
+    yac_component_config_get_num_components(instance->comp_config);
+  struct component ** local_comps =
+    yac_component_config_get_components(instance->comp_config);
+
+  // the list of components in the coupling configuration is identical
+  // on all processes after the definitions have been synced
+  char const ** comp_names = xmalloc(num_comps * sizeof(*comp_names));
+  int * local_comp_flag = xmalloc(num_comps * sizeof(*local_comp_flag));
+  for (size_t i = 0; i < num_comps; ++i) {
+    comp_names[i] =
+      yac_couple_config_get_component_name(instance->couple_config, i);
+    local_comp_flag[i] =
+      contains_component(local_comps, num_local_comps, comp_names[i]);
+  }
+
+  yac_setup_stats_delete(instance->setup_stats);
+  instance->setup_stats =
+    yac_setup_stats_aggregate(
+      comp_names, num_comps, local_comp_flag, instance->comm);
+
+  free(local_comp_flag);
+  free(comp_names);
+
+  // write statistics to file, if this was requested by the user
+  char * stats_file_name = yac_setup_stats_get_file_name(instance->comm);
+  if (stats_file_name != NULL)
+    yac_setup_stats_write_json(
+      instance->setup_stats, stats_file_name, instance->comm);
+  free(stats_file_name);
+}
+
 void yac_instance_setup(struct yac_instance * instance) {
+
+  yac_setup_stats_start(YAC_SETUP_PHASE_SETUP);
+
   // if definitions have not yet been synced
   int requires_def_sync = (instance->phase == INSTANCE_DEFINITION_COMP);
-  if (requires_def_sync)
+  if (requires_def_sync) {
+    yac_setup_stats_start(YAC_SETUP_PHASE_SYNC_DEF);
     yac_instance_sync_def(instance);
+    yac_setup_stats_stop(YAC_SETUP_PHASE_SYNC_DEF);
+  }
   CHECK_PHASE(yac_instance_setup, INSTANCE_DEFINITION_SYNC, INSTANCE_EXCHANGE);
 
   YAC_ASSERT(
@@ -1213,10 +2020,17 @@ void yac_instance_setup(struct yac_instance * instance) {
     MPI_Allreduce(
       MPI_IN_PLACE, &requires_def_sync, 1, MPI_INT, MPI_MIN, instance->comm),
       instance->comm);
-  if(requires_def_sync == 0)
+  if(requires_def_sync == 0) {
+    yac_setup_stats_start(YAC_SETUP_PHASE_SYNC_DEF);
     yac_couple_config_sync(instance->couple_config, instance->comm);
+    yac_setup_stats_stop(YAC_SETUP_PHASE_SYNC_DEF);
+  }
 
   generate_interpolations(instance);
+
+  yac_setup_stats_stop(YAC_SETUP_PHASE_SETUP);
+
+  aggregate_setup_stats(instance);
 }
 
 char * yac_instance_setup_and_emit_config(
@@ -1227,6 +2041,477 @@ char * yac_instance_setup_and_emit_config(
   return yac_yaml_emit_coupling(instance->couple_config, emit_flags);
 }
 
+// mask changes of a single field of a grid of a retained grid pair
+struct dynamic_mask_change {
+  char const * grid_name;
+  struct interp_field field;
+  yac_int * global_ids;
+  int * is_valid;
+  size_t count;
+};
+
+static struct dynamic_mask_change * get_dynamic_mask_change(
+  struct dynamic_mask_change * changes, size_t num_changes,
+  char const * grid_name, struct interp_field field) {
+
+  for (size_t i = 0; i < num_changes; ++i)
+    if (!strcmp(changes[i].grid_name, grid_name) &&
+        (changes[i].field.location == field.location) &&
+        (changes[i].field.masks_idx == field.masks_idx))
+      return changes + i;
+  return NULL;
+}
+
+static int interp_stack_requires_full_update(
+  struct yac_interp_stack_config * interp_stack) {
+
+  // some interpolation methods do not compute the stencils for a subset of
+  // the target points (spmap) or use the results of the other methods of the
+  // stack across multiple target points (creep), therefore all their
+  // stencils depend on the masks
+  size_t stack_size = yac_interp_stack_config_get_size(interp_stack);
+  for (size_t i = 0; i < stack_size; ++i) {
+    enum yac_interpolation_list type =
+      yac_interp_stack_config_entry_get_type(
+        yac_interp_stack_config_get_entry(interp_stack, i));
+    if ((type == SOURCE_TO_TARGET_MAP) || (type == CREEP)) return 1;
+  }
+  return 0;
+}
+
+// removes all stencils that are affected by the mask changes and determines
+// the global ids of all target points whose stencils have to be recomputed
+// and the local positions of all target points whose results of the current
+// interpolations have to be discarded
+static void remove_dynamic_mask_stencils(
+  struct interp_grid * interp_grid, struct interp_weights * weights,
+  struct dynamic_mask_change ** src_changes, size_t num_src_fields,
+  struct dynamic_mask_change * tgt_change,
+  yac_int ** recompute_ids_, size_t * num_recompute_ids_,
+  size_t ** discard_pos_, size_t * num_discard_pos_) {
+
+  // remove all stencils, whose target point has changed or which use
+  // a source point that became invalid
+  yac_int const * src_ids[num_src_fields];
+  size_t num_src_ids[num_src_fields];
+  for (size_t i = 0; i < num_src_fields; ++i) {
+    src_ids[i] = (src_changes[i] != NULL)?src_changes[i]->global_ids:NULL;
+    num_src_ids[i] = (src_changes[i] != NULL)?src_changes[i]->count:0;
+  }
+  yac_int * removed_tgt_ids;
+  struct remote_point_info * removed_tgt_infos;
+  size_t num_removed_tgt_infos;
+  size_t num_removed =
+    yac_interp_weights_remove_stencils(
+      weights,
+      (tgt_change != NULL)?tgt_change->global_ids:NULL,
+      (tgt_change != NULL)?tgt_change->count:0,
+      src_ids, num_src_ids, &removed_tgt_ids,
+      &removed_tgt_infos, &num_removed_tgt_infos);
+
+  // the stencils are not necessarily located on the process that owns
+  // the respective target point
+  // -> gather the targets of all removed stencils
+  MPI_Comm comm = yac_interp_grid_get_MPI_Comm(interp_grid);
+  int comm_size;
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+  int num_removed_int = (int)num_removed;
+  int * recvcounts_int =
+    xmalloc(2 * (size_t)comm_size * sizeof(*recvcounts_int));
+  int * rdispls_int = recvcounts_int + comm_size;
+  yac_mpi_call(
+    MPI_Allgather(
+      &num_removed_int, 1, MPI_INT, recvcounts_int, 1, MPI_INT, comm), comm);
+  size_t num_new_valid_tgts = 0;
+  if (tgt_change != NULL)
+    for (size_t i = 0; i < tgt_change->count; ++i)
+      if (tgt_change->is_valid[i]) ++num_new_valid_tgts;
+  size_t recv_count = 0;
+  for (int i = 0; i < comm_size; ++i) {
+    rdispls_int[i] = (int)recv_count;
+    recv_count += (size_t)(recvcounts_int[i]);
+  }
+  yac_int * recompute_ids =
+    xmalloc((recv_count + num_new_valid_tgts) * sizeof(*recompute_ids));
+  yac_mpi_call(
+    MPI_Allgatherv(
+      removed_tgt_ids, num_removed_int, yac_int_dt,
+      recompute_ids, recvcounts_int, rdispls_int, yac_int_dt, comm), comm);
+  free(recvcounts_int);
+  free(removed_tgt_ids);
+
+  // target points that became valid have to be computed as well
+  size_t num_recompute_ids = recv_count;
+  if (tgt_change != NULL)
+    for (size_t i = 0; i < tgt_change->count; ++i)
+      if (tgt_change->is_valid[i])
+        recompute_ids[num_recompute_ids++] = tgt_change->global_ids[i];
+  qsort(
+    recompute_ids, num_recompute_ids, sizeof(*recompute_ids),
+    compare_yac_int);
+  size_t num_unique_recompute_ids = 0;
+  for (size_t i = 0; i < num_recompute_ids; ++i)
+    if ((i == 0) || (recompute_ids[i] != recompute_ids[i-1]))
+      recompute_ids[num_unique_recompute_ids++] = recompute_ids[i];
+
+  // the results of the removed stencils have to be discarded by the
+  // processes owning the respective target points
+  size_t * sendcounts, * recvcounts, * sdispls, * rdispls;
+  yac_get_comm_buffers(
+    1, &sendcounts, &recvcounts, &sdispls, &rdispls, comm);
+  for (size_t i = 0; i < num_removed_tgt_infos; ++i)
+    sendcounts[removed_tgt_infos[i].rank]++;
+  yac_generate_alltoallv_args(
+    1, sendcounts, recvcounts, sdispls, rdispls, comm);
+  size_t num_discard_pos =
+    rdispls[comm_size - 1] + recvcounts[comm_size - 1];
+  uint64_t * pos_buffer =
+    xmalloc((num_removed_tgt_infos + num_discard_pos) * sizeof(*pos_buffer));
+  uint64_t * send_pos = pos_buffer + num_discard_pos;
+  uint64_t * recv_pos = pos_buffer;
+  for (size_t i = 0; i < num_removed_tgt_infos; ++i)
+    send_pos[sdispls[removed_tgt_infos[i].rank + 1]++] =
+      removed_tgt_infos[i].orig_pos;
+  yac_alltoallv_uint64_p2p(
+    send_pos, sendcounts, sdispls, recv_pos, recvcounts, rdispls, comm);
+  yac_free_comm_buffers(sendcounts, recvcounts, sdispls, rdispls);
+  free(removed_tgt_infos);
+
+  size_t * discard_pos = xmalloc(num_discard_pos * sizeof(*discard_pos));
+  for (size_t i = 0; i < num_discard_pos; ++i)
+    discard_pos[i] = (size_t)(recv_pos[i]);
+  free(pos_buffer);
+
+  *recompute_ids_ =
+    xrealloc(
+      recompute_ids, num_unique_recompute_ids * sizeof(*recompute_ids));
+  *num_recompute_ids_ = num_unique_recompute_ids;
+  *discard_pos_ = discard_pos;
+  *num_discard_pos_ = num_discard_pos;
+}
+
+// recomputes the stencils of the provided target points
+// (each target point restarts at the method of the stack that generated its
+//  previous stencil, because the previous methods failed with a superset of
+//  the currently valid source points and therefore fail again; target points
+//  that became valid start with the first method)
+static void recompute_dynamic_mask_weights(
+  struct dynamic_mask_weights * weights, struct interp_grid * interp_grid,
+  yac_int const * recompute_ids, size_t num_recompute_ids) {
+
+  size_t * tgt_points, num_tgt_points;
+  yac_interp_grid_get_tgt_points(interp_grid, &tgt_points, &num_tgt_points);
+  yac_int * tgt_ids = xmalloc(num_tgt_points * sizeof(*tgt_ids));
+  yac_interp_grid_get_tgt_global_ids(
+    interp_grid, tgt_points, num_tgt_points, tgt_ids);
+  size_t * method_idx = xmalloc(num_tgt_points * sizeof(*method_idx));
+
+  // move all target points that have to be recomputed to the front
+  size_t num_recompute_tgts = 0;
+  for (size_t i = 0; i < num_tgt_points; ++i) {
+    size_t curr_tgt_point = tgt_points[i];
+    size_t curr_method_idx = get_dynamic_mask_method_idx(weights, tgt_ids[i]);
+    if ((num_recompute_ids > 0) &&
+        (bsearch(
+           tgt_ids + i, recompute_ids, num_recompute_ids,
+           sizeof(*recompute_ids), compare_yac_int) != NULL)) {
+      tgt_points[i] = tgt_points[num_recompute_tgts];
+      method_idx[i] = method_idx[num_recompute_tgts];
+      tgt_points[num_recompute_tgts] = curr_tgt_point;
+      method_idx[num_recompute_tgts] = curr_method_idx;
+      ++num_recompute_tgts;
+    } else {
+      method_idx[i] = curr_method_idx;
+    }
+  }
+  free(tgt_ids);
+
+  yac_interp_weights_append(
+    weights->weights,
+    search_dynamic_mask_weights(
+      weights, interp_grid, tgt_points, method_idx, num_recompute_tgts));
+  set_dynamic_mask_method_idx(
+    weights, interp_grid, tgt_points, method_idx, num_tgt_points);
+
+  free(method_idx);
+  free(tgt_points);
+}
+
+// regenerates the interpolations of all couples using the weights
+static void rebuild_dynamic_mask_interpolations(
+  struct dynamic_mask_weights * weights) {
+
+  for (size_t i = 0; i < weights->num_field_configs; ++i) {
+
+    struct field_config * field_config = weights->field_configs + i;
+
+    struct interpolation * interp =
+      yac_interp_weights_get_interpolation_prec(
+        weights->weights, field_config->reorder_type,
+        field_config->collection_size,
+        field_config->frac_mask_fallback_value,
+        field_config->scale_factor, field_config->scale_summand,
+        field_config->use_single_precision);
+
+    if (field_config->src_interp_config.field != NULL) {
+      yac_set_coupling_field_put_op_interpolation(
+        field_config->src_interp_config.field, weights->put_idx[i], interp);
+      yac_interpolation_inc_ref_count(interp);
+    }
+
+    if (field_config->tgt_interp_config.field != NULL) {
+      yac_set_coupling_field_get_op_interpolation(
+        field_config->tgt_interp_config.field, interp);
+      yac_interpolation_inc_ref_count(interp);
+    }
+
+    yac_interpolation_delete(interp);
+  }
+}
+
+// patches the interpolations of all couples using the weights, such that
+// the results for all changed target points are generated from their
+// current stencils
+static void patch_dynamic_mask_interpolations(
+  struct dynamic_mask_weights * weights,
+  size_t const * discard_pos, size_t num_discard_pos) {
+
+  struct interp_weights * patch_weights =
+    yac_interp_weights_extract(
+      weights->weights, weights->patch_tgt_ids, weights->num_patch_tgt_ids);
+
+  for (size_t i = 0; i < weights->num_field_configs; ++i) {
+
+    struct field_config * field_config = weights->field_configs + i;
+
+    struct interpolation * patch =
+      yac_interp_weights_get_interpolation_prec(
+        patch_weights, field_config->reorder_type,
+        field_config->collection_size,
+        field_config->frac_mask_fallback_value,
+        field_config->scale_factor, field_config->scale_summand,
+        field_config->use_single_precision);
+
+    // put and get operation of a couple may share the same interpolation
+    struct interpolation * put_interp =
+      (field_config->src_interp_config.field != NULL)?
+        yac_get_coupling_field_put_op_interpolation(
+          field_config->src_interp_config.field, weights->put_idx[i]):NULL;
+    struct interpolation * get_interp =
+      (field_config->tgt_interp_config.field != NULL)?
+        yac_get_coupling_field_get_op_interpolation(
+          field_config->tgt_interp_config.field):NULL;
+    if (get_interp == put_interp) get_interp = NULL;
+
+    if (put_interp != NULL)
+      yac_interpolation_set_patch(
+        put_interp,
+        (get_interp != NULL)?yac_interpolation_copy(patch):patch,
+        num_discard_pos, discard_pos);
+    if (get_interp != NULL)
+      yac_interpolation_set_patch(
+        get_interp, patch, num_discard_pos, discard_pos);
+    if ((put_interp == NULL) && (get_interp == NULL))
+      yac_interpolation_delete(patch);
+  }
+
+  yac_interp_weights_delete(patch_weights);
+}
+
+// adds target points to the list of target points, whose stencils changed
+// since the interpolations were built
+static void add_dynamic_mask_patch_tgt_ids(
+  struct dynamic_mask_weights * weights,
+  yac_int const * tgt_ids, size_t num_tgt_ids) {
+
+  size_t num_patch_tgt_ids = weights->num_patch_tgt_ids + num_tgt_ids;
+  yac_int * patch_tgt_ids =
+    xrealloc(
+      weights->patch_tgt_ids, num_patch_tgt_ids * sizeof(*patch_tgt_ids));
+  memcpy(patch_tgt_ids + weights->num_patch_tgt_ids, tgt_ids,
+         num_tgt_ids * sizeof(*tgt_ids));
+  qsort(
+    patch_tgt_ids, num_patch_tgt_ids, sizeof(*patch_tgt_ids),
+    compare_yac_int);
+  size_t num_unique_patch_tgt_ids = 0;
+  for (size_t i = 0; i < num_patch_tgt_ids; ++i)
+    if ((i == 0) || (patch_tgt_ids[i] != patch_tgt_ids[i-1]))
+      patch_tgt_ids[num_unique_patch_tgt_ids++] = patch_tgt_ids[i];
+
+  weights->patch_tgt_ids = patch_tgt_ids;
+  weights->num_patch_tgt_ids = num_unique_patch_tgt_ids;
+}
+
+static void update_dynamic_mask_weights(
+  struct dynamic_mask_data * dynamic_masks,
+  struct dynamic_mask_change * changes, size_t num_changes,
+  size_t grid_pair_idx) {
+
+  struct comp_grid_pair_config * comp_grid_pair =
+    &(dynamic_masks->grid_pairs[grid_pair_idx].comp_grid_pair);
+
+  for (size_t i = 0; i < dynamic_masks->num_weights; ++i) {
+
+    struct dynamic_mask_weights * curr_weights = dynamic_masks->weights + i;
+    struct dynamic_mask_interp_grid * curr_interp_grid =
+      dynamic_masks->interp_grids + curr_weights->interp_grid_idx;
+    if (curr_interp_grid->grid_pair_idx != grid_pair_idx) continue;
+
+    char const * src_grid_name =
+      comp_grid_pair->config[curr_interp_grid->src_comp_idx].grid_name;
+    char const * tgt_grid_name =
+      comp_grid_pair->config[curr_interp_grid->src_comp_idx^1].grid_name;
+
+    // get the mask changes of all fields of the current weights
+    size_t num_src_fields = curr_interp_grid->num_src_fields;
+    struct dynamic_mask_change * src_changes[num_src_fields];
+    int has_changes = 0, src_became_valid = 0;
+    for (size_t j = 0; j < num_src_fields; ++j) {
+      src_changes[j] =
+        (curr_interp_grid->src_fields[j].masks_idx != SIZE_MAX)?
+          get_dynamic_mask_change(
+            changes, num_changes, src_grid_name,
+            curr_interp_grid->src_fields[j]):NULL;
+      if ((src_changes[j] != NULL) && (src_changes[j]->count > 0)) {
+        has_changes = 1;
+        for (size_t k = 0; k < src_changes[j]->count; ++k)
+          src_became_valid |= src_changes[j]->is_valid[k];
+      }
+    }
+    struct dynamic_mask_change * tgt_change =
+      (curr_interp_grid->tgt_field.masks_idx != SIZE_MAX)?
+        get_dynamic_mask_change(
+          changes, num_changes, tgt_grid_name,
+          curr_interp_grid->tgt_field):NULL;
+    has_changes |= (tgt_change != NULL) && (tgt_change->count > 0);
+
+    // the change lists are identical on all processes, therefore all
+    // processes take the same decisions
+    if (!has_changes) continue;
+
+    struct interp_grid * interp_grid = curr_interp_grid->interp_grid;
+
+    // a source point that became valid may be used by any stencil
+    // -> recompute all stencils
+    if (src_became_valid ||
+        interp_stack_requires_full_update(curr_weights->interp_stack)) {
+
+      compute_dynamic_mask_weights(curr_weights, interp_grid);
+      rebuild_dynamic_mask_interpolations(curr_weights);
+      continue;
+    }
+
+    yac_int * recompute_ids;
+    size_t num_recompute_ids, * discard_pos, num_discard_pos;
+    remove_dynamic_mask_stencils(
+      interp_grid, curr_weights->weights, src_changes, num_src_fields,
+      tgt_change, &recompute_ids, &num_recompute_ids,
+      &discard_pos, &num_discard_pos);
+    recompute_dynamic_mask_weights(
+      curr_weights, interp_grid, recompute_ids, num_recompute_ids);
+    add_dynamic_mask_patch_tgt_ids(
+      curr_weights, recompute_ids, num_recompute_ids);
+    free(recompute_ids);
+
+    // the existing interpolations are patched, unless the patch would
+    // replace a significant part of their stencils
+    if ((double)(curr_weights->num_patch_tgt_ids) >
+        DYNAMIC_MASK_MAX_PATCH_FRACTION *
+        (double)(curr_weights->num_interp_stencils)) {
+      reset_dynamic_mask_patch(
+        curr_weights, yac_interp_grid_get_MPI_Comm(interp_grid));
+      rebuild_dynamic_mask_interpolations(curr_weights);
+    } else {
+      patch_dynamic_mask_interpolations(
+        curr_weights, discard_pos, num_discard_pos);
+    }
+    free(discard_pos);
+  }
+}
+
+void yac_instance_enable_lazy_setup(struct yac_instance * instance) {
+  CHECK_MAX_PHASE(yac_instance_enable_lazy_setup, INSTANCE_DEFINITION_SYNC);
+  instance->lazy_setup_enabled = 1;
+}
+
+void yac_instance_enable_dynamic_masks(struct yac_instance * instance) {
+  CHECK_MAX_PHASE(
+    yac_instance_enable_dynamic_masks, INSTANCE_DEFINITION_SYNC);
+  instance->dynamic_masks_enabled = 1;
+}
+
+void yac_instance_update_masks(struct yac_instance * instance) {
+  CHECK_MIN_PHASE(yac_instance_update_masks, INSTANCE_EXCHANGE);
+  YAC_ASSERT(
+    instance->dynamic_masks_enabled,
+    "ERROR(yac_instance_update_masks): "
+    "dynamic masks were not enabled before the end of the definition phase")
+
+  // the masks cached by the coupling fields may be outdated
+  for (size_t i = 0; i < instance->num_cpl_fields; ++i)
+    yac_coupling_field_reset_masks(instance->cpl_fields[i]);
+
+  struct dynamic_mask_data * dynamic_masks = instance->dynamic_masks;
+
+  for (size_t i = 0; i < dynamic_masks->num_grid_pairs; ++i) {
+
+    struct dist_grid_pair * dist_grid_pair =
+      dynamic_masks->grid_pairs[i].dist_grid_pair;
+    struct comp_grid_pair_config * comp_grid_pair =
+      &(dynamic_masks->grid_pairs[i].comp_grid_pair);
+
+    // update each masked field of the grid pair exactly once
+    struct dynamic_mask_change * changes = NULL;
+    size_t num_changes = 0;
+    for (size_t j = 0; j < dynamic_masks->num_interp_grids; ++j) {
+
+      struct dynamic_mask_interp_grid * interp_grid =
+        dynamic_masks->interp_grids + j;
+      if (interp_grid->grid_pair_idx != i) continue;
+
+      for (size_t k = 0; k <= interp_grid->num_src_fields; ++k) {
+
+        int is_tgt = k == interp_grid->num_src_fields;
+        struct interp_field field =
+          is_tgt?interp_grid->tgt_field:interp_grid->src_fields[k];
+        int comp_idx = interp_grid->src_comp_idx ^ is_tgt;
+        char const * grid_name = comp_grid_pair->config[comp_idx].grid_name;
+
+        if ((field.masks_idx == SIZE_MAX) ||
+            (get_dynamic_mask_change(
+               changes, num_changes, grid_name, field) != NULL)) continue;
+
+        int delete_flag;
+        struct yac_basic_grid * basic_grid =
+          get_basic_grid(
+            grid_name, comp_grid_pair->config[comp_idx].comp_name,
+            instance->num_cpl_fields, instance->cpl_fields, &delete_flag);
+
+        changes =
+          xrealloc(changes, (num_changes + 1) * sizeof(*changes));
+        changes[num_changes].grid_name = grid_name;
+        changes[num_changes].field = field;
+        yac_dist_grid_pair_update_field_mask(
+          dist_grid_pair, basic_grid, field,
+          &(changes[num_changes].global_ids),
+          &(changes[num_changes].is_valid),
+          &(changes[num_changes].count));
+        ++num_changes;
+
+        if (delete_flag) yac_basic_grid_delete(basic_grid);
+      }
+    }
+
+    update_dynamic_mask_weights(dynamic_masks, changes, num_changes, i);
+
+    for (size_t j = 0; j < num_changes; ++j) {
+      free(changes[j].global_ids);
+      free(changes[j].is_valid);
+    }
+    free(changes);
+  }
+}
+
 MPI_Comm yac_instance_get_comps_comm(
   struct yac_instance * instance,
   char const ** comp_names, size_t num_comp_names) {
@@ -1251,6 +2536,16 @@ struct yac_instance * yac_instance_new(MPI_Comm comm) {
 
   instance->phase = INSTANCE_DEFINITION;
 
+  instance->setup_stats = NULL;
+
+  instance->dynamic_masks_enabled = 0;
+  instance->dynamic_masks = NULL;
+
+  instance->lazy_setup_enabled = 0;
+  instance->lazy_comp_pairs = NULL;
+  instance->num_lazy_comp_pairs = 0;
+  instance->lazy_setup_comm = MPI_COMM_NULL;
+
   return instance;
 }
 
@@ -1273,11 +2568,28 @@ void yac_instance_delete(struct yac_instance * instance) {
 
   yac_couple_config_delete(instance->couple_config);
 
+  yac_setup_stats_delete(instance->setup_stats);
+
+  dynamic_masks_delete(instance->dynamic_masks);
+
+  for (size_t i = 0; i < instance->num_lazy_comp_pairs; ++i)
+    lazy_comp_pair_delete(instance->lazy_comp_pairs[i]);
+  free(instance->lazy_comp_pairs);
+  if (instance->lazy_setup_comm != MPI_COMM_NULL)
+    yac_mpi_call(
+      MPI_Comm_free(&(instance->lazy_setup_comm)), MPI_COMM_WORLD);
+
   yac_mpi_call(MPI_Comm_free(&(instance->comm)), MPI_COMM_WORLD);
 
   free(instance);
 }
 
+struct yac_setup_stats * yac_instance_get_setup_stats(
+  struct yac_instance * instance) {
+  CHECK_MIN_PHASE(yac_instance_get_setup_stats, INSTANCE_EXCHANGE);
+  return instance->setup_stats;
+}
+
 struct yac_couple_config * yac_instance_get_couple_config(
   struct yac_instance * instance) {
 
@@ -1433,7 +2745,8 @@ void yac_instance_def_couple(
   struct yac_interp_stack_config * interp_stack_config, int src_lag, int tgt_lag,
   const char* weight_file_name, int mapping_on_source,
   double scale_factor, double scale_summand, size_t num_src_mask_names,
-  char const * const * src_mask_names, char const * tgt_mask_name) {
+  char const * const * src_mask_names, char const * tgt_mask_name,
+  int use_single_precision, double weight_pruning_threshold) {
 
   CHECK_MIN_PHASE(yac_instance_def_couple, INSTANCE_DEFINITION);
   CHECK_MAX_PHASE(yac_instance_def_couple, INSTANCE_DEFINITION_SYNC);
@@ -1443,7 +2756,8 @@ void yac_instance_def_couple(
     tgt_comp_name, tgt_grid_name, tgt_field_name, coupling_period,
     time_reduction, interp_stack_config, src_lag, tgt_lag, weight_file_name,
     mapping_on_source, scale_factor, scale_summand, num_src_mask_names,
-    src_mask_names, tgt_mask_name);
+    src_mask_names, tgt_mask_name, use_single_precision,
+    weight_pruning_threshold);
 }
 
 struct coupling_field* yac_instance_get_field(struct yac_instance * instance,
@@ -52,6 +52,7 @@
 #include "component.h"
 #include "yac_mpi.h"
 #include "couple_config.h"
+#include "setup_stats.h"
 
 /** \example test_instance_parallel1.c
  * This example show how to set up a YAC instance. It uses three
@@ -121,6 +122,15 @@ char * yac_instance_get_start_datetime(struct yac_instance * instance);
  */
 char * yac_instance_get_end_datetime(struct yac_instance * instance);
 
+/**
+ * Get the setup statistics of a yac instance, which were gathered
+ * during the last call to \ref yac_instance_setup
+ * @param[in] instance yac instance
+ * @return setup statistics
+ */
+struct yac_setup_stats * yac_instance_get_setup_stats(
+  struct yac_instance * instance);
+
 /**
  * Get the coupling configuration data from a yac instance
  * @param[in] instance yac instance
@@ -191,7 +201,8 @@ struct coupling_field * yac_instance_add_field(
  * @param[in] weight_file_name    file name for the weights file.
  *                                `NULL` to disable this feature
  * @param[in] mapping_on_source   side where the mapping is computed.
- *                                Currently only source = 1 and target = 0 are allowed
+ *                                Currently only source = 1, target = 0, and
+ *                                auto = 2 are allowed
  * @param[in] scale_factor        scale factor
  * @param[in] scale_summand       scale summand
  * @param[in] num_src_mask_names  number of source field mask names
@@ -202,6 +213,12 @@ struct coupling_field * yac_instance_add_field(
  * @param[in] tgt_mask_name       target field mask name
  *                                ("NULL" if no target field mask name is
  *                                 provided)
+ * @param[in] use_single_precision if != 0, field data of this couple is
+ *                                 exchanged in single precision
+ * @param[in] weight_pruning_threshold relative threshold for the removal
+ *                                     of small weights
+ *                                     (see \ref yac_interp_weights_prune;
+ *                                      "0.0" disables the pruning)
  */
 void yac_instance_def_couple(
   struct yac_instance * instance,
@@ -211,7 +228,8 @@ void yac_instance_def_couple(
   struct yac_interp_stack_config * interp_stack_config, int src_lag, int tgt_lag,
   const char* weight_file_name, int mapping_on_source,
   double scale_factor, double scale_summand, size_t num_src_mask_names,
-  char const * const * src_mask_names, char const * tgt_mask_name);
+  char const * const * src_mask_names, char const * tgt_mask_name,
+  int use_single_precision, double weight_pruning_threshold);
 
 /**
  * Gets a component defined in a yac instance
@@ -248,6 +266,50 @@ void yac_instance_setup(struct yac_instance * instance);
 char * yac_instance_setup_and_emit_config(
   struct yac_instance * instance, int emit_flags);
 
+/**
+ * enables the lazy setup of interpolations
+ * @param[in] instance yac instance
+ * @remark has to be called before \ref yac_instance_setup
+ * @remark the interpolations of a component pair are not generated by
+ *         \ref yac_instance_setup, but collectively by all processes of the
+ *         component pair on the first exchange of any of its couples,
+ *         unless a field of the pair was marked for eager setup
+ *         (see \ref yac_set_coupling_field_eager_setup)
+ * @remark the first exchanges of the lazy component pairs have to occur in
+ *         a consistent order on all processes; this is checked at the start
+ *         of each lazy setup
+ */
+void yac_instance_enable_lazy_setup(struct yac_instance * instance);
+
+/**
+ * enables the update of masks after the setup
+ * (see \ref yac_instance_update_masks)
+ * @param[in] instance yac instance
+ * @remark has to be called before \ref yac_instance_setup
+ * @remark for all couples that use masks, the distributed grids, the
+ *         interpolation grids, and the interpolation weights are kept after
+ *         the setup
+ */
+void yac_instance_enable_dynamic_masks(struct yac_instance * instance);
+
+/**
+ * takes changes of the mask values of the grids, which were done after
+ * the setup, into account by updating the interpolation weights and
+ * interpolations of all affected couples
+ * @param[in] instance yac instance
+ * @remark requires a previous call to
+ *         \ref yac_instance_enable_dynamic_masks
+ * @remark only the stencils of target points whose validity changed and of
+ *         stencils referencing source points that became invalid are
+ *         recomputed; if a source point became valid or the interpolation
+ *         stack contains a creep or source to target mapping method, all
+ *         weights of the couple are recomputed
+ * @remark the user has to ensure that no exchanges are pending for the
+ *         affected fields
+ * @remark this routine is collective for all processes of the instance
+ */
+void yac_instance_update_masks(struct yac_instance * instance);
+
 /**
  * returns a communicator containing all processes of the provided components
  *
@@ -564,6 +564,29 @@ void yac_interp_grid_relocate_src_tgt_pairs_orig(
     interp_grid->tgt_field.location, weights, count);
 }
 
+uint64_t yac_interp_grid_get_hash(struct interp_grid * interp_grid) {
+
+  uint64_t hashes[2] =
+    {yac_dist_grid_pair_get_hash(
+       interp_grid->grid_pair, interp_grid->src_grid_name,
+       interp_grid->src_fields, interp_grid->num_src_fields),
+     yac_dist_grid_pair_get_hash(
+       interp_grid->grid_pair, interp_grid->tgt_grid_name,
+       &(interp_grid->tgt_field), 1)};
+
+  uint64_t hash =
+    yac_hash_bytes(
+      YAC_HASH_INIT, interp_grid->src_grid_name,
+      strlen(interp_grid->src_grid_name) + 1);
+  hash =
+    yac_hash_bytes(
+      hash, interp_grid->tgt_grid_name,
+      strlen(interp_grid->tgt_grid_name) + 1);
+  hash = yac_hash_bytes(hash, hashes, sizeof(hashes));
+
+  return yac_hash_finalize(hash);
+}
+
 void yac_interp_grid_delete(struct interp_grid * interp_grid) {
 
   if (interp_grid == NULL) return;
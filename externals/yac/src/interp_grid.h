@@ -415,6 +415,17 @@ void yac_interp_grid_do_cell_search_tgt(
  */
 MPI_Comm yac_interp_grid_get_MPI_Comm(struct interp_grid * interp_grid);
 
+/**
+ * computes a hash of the interpolation grid, which is independent of the
+ * decomposition (includes the grid names, the global grid data of the source
+ * and target grid, and the masks and coordinates of all source and target
+ * fields)
+ * @param[in] interp_grid interpolation grid
+ * @return hash
+ * @remark this call is collective
+ */
+uint64_t yac_interp_grid_get_hash(struct interp_grid * interp_grid);
+
 /**
  * gets the basic grid data of the source grid
  * @param[in] interp_grid interpolation grid
@@ -50,9 +50,11 @@
 
 #include "interp_method.h"
 #include "interp_weights.h"
+#include "utils.h"
 
-struct interp_weights * yac_interp_method_do_search(
-  struct interp_method ** method, struct interp_grid * interp_grid) {
+static struct interp_weights * do_search(
+  struct interp_method ** method, struct interp_grid * interp_grid,
+  size_t * tgt_points, size_t * method_idx, size_t count) {
 
   size_t num_src_fields = yac_interp_grid_get_num_src_fields(interp_grid);
   enum yac_location src_field_locations[num_src_fields];
@@ -65,26 +67,68 @@ struct interp_weights * yac_interp_method_do_search(
       yac_interp_grid_get_tgt_field_location(interp_grid),
       src_field_locations, num_src_fields);
 
-  if (*method == NULL) return weights;
+  // sort target points by the index of the first method that is to be
+  // applied to them
+  if (method_idx != NULL)
+    yac_quicksort_index_size_t_size_t(method_idx, count, tgt_points);
 
-  size_t temp_count;
-  size_t * tgt_points;
-  yac_interp_grid_get_tgt_points(interp_grid, &tgt_points, &temp_count);
+  size_t final_count = 0, active_count = count;
+  for (size_t i = 0; method[i] != NULL; ++i) {
 
-  size_t final_count = 0;
-  while (*method != NULL) {
-    final_count +=
-      (*method)->vtable->do_search(
-        *method, interp_grid, tgt_points + final_count, temp_count - final_count,
-        weights);
-    ++method;
+    // add all target points, which start at the current method
+    if (method_idx != NULL)
+      for (active_count = final_count;
+           (active_count < count) && (method_idx[active_count] <= i);
+           ++active_count);
+
+    enum yac_setup_phase setup_phase = method[i]->vtable->setup_phase;
+    yac_setup_stats_start(setup_phase);
+    size_t curr_count =
+      method[i]->vtable->do_search(
+        method[i], interp_grid, tgt_points + final_count,
+        active_count - final_count, weights);
+    yac_setup_stats_add(YAC_SETUP_COUNTER_NUM_STENCILS, (uint64_t)curr_count);
+    yac_setup_stats_stop(setup_phase);
+
+    if (method_idx != NULL)
+      for (size_t j = 0; j < curr_count; ++j)
+        method_idx[final_count + j] = i;
+    final_count += curr_count;
+  }
+
+  // mark target points for which no method generated a stencil
+  if (method_idx != NULL) {
+    size_t stack_size = 0;
+    while (method[stack_size] != NULL) ++stack_size;
+    for (size_t i = final_count; i < count; ++i) method_idx[i] = stack_size;
   }
 
+  return weights;
+}
+
+struct interp_weights * yac_interp_method_do_search(
+  struct interp_method ** method, struct interp_grid * interp_grid) {
+
+  size_t count = 0;
+  size_t * tgt_points = NULL;
+  if (*method != NULL)
+    yac_interp_grid_get_tgt_points(interp_grid, &tgt_points, &count);
+
+  struct interp_weights * weights =
+    do_search(method, interp_grid, tgt_points, NULL, count);
+
   free(tgt_points);
 
   return weights;
 }
 
+struct interp_weights * yac_interp_method_do_search_tgts(
+  struct interp_method ** method, struct interp_grid * interp_grid,
+  size_t * tgt_points, size_t * method_idx, size_t count) {
+
+  return do_search(method, interp_grid, tgt_points, method_idx, count);
+}
+
 void yac_interp_method_delete(struct interp_method ** method) {
 
   while (*method != NULL) {
@@ -49,6 +49,7 @@
 #include "interp_weights.h"
 #include "interp_grid.h"
 #include "core/core.h"
+#include "setup_stats.h"
 
 struct interp_method;
 struct interp_method_vtable {
@@ -58,6 +59,7 @@ struct interp_method_vtable {
                        size_t * tgt_points, size_t count,
                        struct interp_weights * weights);
    void (*delete)(struct interp_method * method);
+   enum yac_setup_phase setup_phase; //!< phase used for setup statistics
 };
 
 struct interp_method {
@@ -68,6 +70,31 @@ struct interp_method {
 struct interp_weights * yac_interp_method_do_search(
   struct interp_method ** method, struct interp_grid * grid);
 
+/**
+ * applies the interpolation method stack to a subset of the local target
+ * points
+ * @param[in]     method     NULL-terminated interpolation method stack
+ * @param[in]     grid       interpolation grid
+ * @param[in,out] tgt_points local ids of unmasked target points
+ *                           (see \ref yac_interp_grid_get_tgt_points)
+ * @param[in,out] method_idx on input: index of the first method of the
+ *                           stack that is applied to the respective target
+ *                           point\n
+ *                           on output: index of the method that generated
+ *                           the stencil of the respective target point
+ *                           (size of the stack, if no method succeeded)
+ * @param[in]     count      number of entries in tgt_points and method_idx
+ * @return interpolation weights for the provided target points
+ * @remark tgt_points and method_idx are reordered by this routine
+ * @remark method_idx may be NULL, in which case the whole stack is applied
+ *         to all target points
+ * @remark this routine is collective for all processes of the
+ *         interpolation grid
+ */
+struct interp_weights * yac_interp_method_do_search_tgts(
+  struct interp_method ** method, struct interp_grid * grid,
+  size_t * tgt_points, size_t * method_idx, size_t count);
+
 void yac_interp_method_delete(struct interp_method ** method);
 
 #endif // INTERP_METHOD_H
@@ -67,7 +67,8 @@ typedef int (*func_compute_weights)(
 static struct interp_method_vtable
   interp_method_avg_vtable = {
     .do_search = do_search_avg,
-    .delete = delete_avg};
+    .delete = delete_avg,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_AVG};
 
 struct interp_method_avg {
 
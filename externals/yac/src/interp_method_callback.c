@@ -67,7 +67,8 @@ static void delete_callback(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_callback_vtable = {
     .do_search = do_search_callback,
-    .delete = delete_callback};
+    .delete = delete_callback,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_CALLBACK};
 
 struct interp_method_callback {
 
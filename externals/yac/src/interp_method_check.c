@@ -60,7 +60,8 @@ static void delete_check(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_check_vtable = {
     .do_search = do_search_check,
-    .delete = delete_check};
+    .delete = delete_check,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_CHECK};
 
 struct interp_method_check {
 
@@ -55,6 +55,9 @@
 #include "float.h"
 
 #define AREA_TOL_FACTOR (1e-6)
+// maximum number of target cells (and, unless a single target cell has more,
+// source cells) whose overlaps are computed in one batch
+#define CONSERV_BATCH_SIZE ((size_t)4096)
 
 static size_t do_search_conserv_1st_order(struct interp_method * method,
                                           struct interp_grid * interp_grid,
@@ -69,12 +72,14 @@ static void delete_conserv(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_conserv_1st_order_vtable = {
     .do_search = do_search_conserv_1st_order,
-    .delete = delete_conserv};
+    .delete = delete_conserv,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_CONSERV};
 
 static struct interp_method_vtable
   interp_method_conserv_2nd_order_vtable = {
     .do_search = do_search_conserv_2nd_order,
-    .delete = delete_conserv};
+    .delete = delete_conserv,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_CONSERV};
 
 struct interp_method_conserv {
 
@@ -124,43 +129,63 @@ static int get_max_num_vertices_per_cell(
   return max_num_vertices_per_cell;
 }
 
-static void get_cell_buffers(
-  struct interp_grid * interp_grid, size_t max_num_src_per_tgt,
-  struct grid_cell * tgt_grid_cell, struct grid_cell ** src_grid_cells) {
+struct cell_buffers {
+  struct grid_cell * grid_cells;
+  enum yac_edge_type * edge_type;
+  double (*coordinates_xyz)[3];
+};
+
+static struct cell_buffers get_cell_buffers(
+  struct interp_grid * interp_grid, size_t num_tgt_cells, size_t num_src_cells,
+  struct grid_cell ** tgt_grid_cells, struct grid_cell ** src_grid_cells) {
 
   struct const_basic_grid_data * src_basic_grid_data =
     yac_interp_grid_get_basic_grid_data_src(interp_grid);
   struct const_basic_grid_data * tgt_basic_grid_data =
     yac_interp_grid_get_basic_grid_data_tgt(interp_grid);
 
-  *src_grid_cells = xmalloc(max_num_src_per_tgt * sizeof(**src_grid_cells));
+  size_t num_cells = num_tgt_cells + num_src_cells;
+  *tgt_grid_cells = xmalloc(num_cells * sizeof(**tgt_grid_cells));
+  *src_grid_cells = *tgt_grid_cells + num_tgt_cells;
   enum yac_edge_type * edge_type_buffer;
   double (*coordinates_xyz_buffer)[3];
 
-  // prepare source grid cell buffer
+  // prepare grid cell buffer (the cells share the edge type and coordinate
+  // buffers, which are returned separately, because the number of cells may
+  // be zero)
   {
     int max_num_vertices_per_cell =
       MAX(get_max_num_vertices_per_cell(src_basic_grid_data),
           get_max_num_vertices_per_cell(tgt_basic_grid_data));
 
     edge_type_buffer =
-      xmalloc((max_num_src_per_tgt + 1) * (size_t)max_num_vertices_per_cell *
+      xmalloc(num_cells * (size_t)max_num_vertices_per_cell *
               sizeof(*edge_type_buffer));
     coordinates_xyz_buffer =
-      xmalloc((max_num_src_per_tgt + 1) * (size_t)max_num_vertices_per_cell *
+      xmalloc(num_cells * (size_t)max_num_vertices_per_cell *
               sizeof(*coordinates_xyz_buffer));
 
-    tgt_grid_cell->coordinates_xyz = coordinates_xyz_buffer;
-    tgt_grid_cell->edge_type = edge_type_buffer;
-    tgt_grid_cell->array_size = max_num_vertices_per_cell;
-    for (size_t i = 0; i < max_num_src_per_tgt; ++i) {
-      (*src_grid_cells)[i].coordinates_xyz =
-        coordinates_xyz_buffer + (i + 1) * max_num_vertices_per_cell;
-      (*src_grid_cells)[i].edge_type =
-        edge_type_buffer + (i + 1) * max_num_vertices_per_cell;
-      (*src_grid_cells)[i].array_size = max_num_vertices_per_cell;
+    for (size_t i = 0; i < num_cells; ++i) {
+      (*tgt_grid_cells)[i].coordinates_xyz =
+        coordinates_xyz_buffer + i * (size_t)max_num_vertices_per_cell;
+      (*tgt_grid_cells)[i].edge_type =
+        edge_type_buffer + i * (size_t)max_num_vertices_per_cell;
+      (*tgt_grid_cells)[i].array_size = max_num_vertices_per_cell;
     }
   }
+
+  return
+    (struct cell_buffers){
+      .grid_cells = *tgt_grid_cells,
+      .edge_type = edge_type_buffer,
+      .coordinates_xyz = coordinates_xyz_buffer};
+}
+
+static void free_cell_buffers(struct cell_buffers buffers) {
+
+  free(buffers.edge_type);
+  free(buffers.coordinates_xyz);
+  free(buffers.grid_cells);
 }
 
 static void get_cell_buffers_(
@@ -195,23 +220,13 @@ static void get_cell_buffers_(
 }
 
 static int compute_1st_order_weights(
-  struct const_basic_grid_data * tgt_basic_grid_data, size_t tgt_cell,
-  struct const_basic_grid_data * src_basic_grid_data, size_t src_count,
-  size_t * src_cells, struct grid_cell tgt_grid_cell_buffer,
-  struct grid_cell * src_grid_cell_buffer,
+  struct grid_cell tgt_grid_cell, size_t src_count, size_t * src_cells,
   double * weights, size_t * num_weights, int partial_coverage,
   enum yac_interp_method_conserv_normalisation normalisation,
   int enforced_conserv) {
 
-  yac_const_basic_grid_data_get_grid_cell(
-    tgt_basic_grid_data, tgt_cell, &tgt_grid_cell_buffer);
-  for (size_t i = 0; i < src_count; ++i)
-    yac_const_basic_grid_data_get_grid_cell(
-      src_basic_grid_data, src_cells[i], src_grid_cell_buffer + i);
-
+  // weights contains the overlap areas between the target and source cells
   double * area = weights;
-  yac_compute_overlap_areas(
-    src_count, src_grid_cell_buffer, tgt_grid_cell_buffer, area);
 
   size_t num_valid_weights = 0;
   for (size_t i = 0; i < src_count; ++i) {
@@ -227,7 +242,7 @@ static int compute_1st_order_weights(
   *num_weights = num_valid_weights;
   if (num_valid_weights == 0) return 0;
 
-  double tgt_cell_area = yac_huiliers_area(tgt_grid_cell_buffer);
+  double tgt_cell_area = yac_huiliers_area(tgt_grid_cell);
   double norm_factor;
 
   YAC_ASSERT(
@@ -332,6 +347,7 @@ static size_t do_search_conserv_1st_order (struct interp_method * method,
     free(temp_src_global_ids);
   }
 
+  size_t total_num_src = total_num_weights;
   double * w = xmalloc(total_num_weights * sizeof(*w));
   size_t result_count = 0;
   size_t * failed_tgt = xmalloc(count * sizeof(*failed_tgt));
@@ -342,46 +358,79 @@ static size_t do_search_conserv_1st_order (struct interp_method * method,
     method_conserv->normalisation;
   int enforced_conserv = method_conserv->enforced_conserv;
 
-  struct grid_cell tgt_grid_cell;
+  // the overlaps are computed in batches of target cells, the clipping of
+  // each batch is done in parallel (the batch size limits the memory
+  // required by the cell buffers)
+  size_t max_batch_src_count = MAX(CONSERV_BATCH_SIZE, max_num_src_per_tgt);
+  struct grid_cell * tgt_grid_cells;
   struct grid_cell * src_grid_cells;
-  get_cell_buffers(
-    interp_grid, max_num_src_per_tgt, &tgt_grid_cell, &src_grid_cells);
-
-  // compute overlaps
-  for (size_t i = 0, offset = 0, result_offset = 0; i < count; ++i) {
-
-    size_t curr_src_count = num_src_per_tgt[i];
-    size_t curr_tgt_point = tgt_points[i];
-    size_t num_weights;
-
-    // if weight computation was successful
-    if (compute_1st_order_weights(
-          tgt_basic_grid_data, curr_tgt_point,
-          src_basic_grid_data, curr_src_count, src_cells + offset,
-          tgt_grid_cell, src_grid_cells, w + result_offset, &num_weights,
-          partial_coverage, normalisation, enforced_conserv)) {
-
-      if (offset != result_offset) {
+  struct cell_buffers cell_buffers =
+    get_cell_buffers(
+      interp_grid, MIN(CONSERV_BATCH_SIZE, count),
+      MIN(max_batch_src_count, total_num_src),
+      &tgt_grid_cells, &src_grid_cells);
+
+  for (size_t batch_start = 0, offset = 0, result_offset = 0;
+       batch_start < count;) {
+
+    // determine the target cells of the current batch
+    size_t batch_count = 0, batch_src_count = 0;
+    while ((batch_start + batch_count < count) &&
+           (batch_count < CONSERV_BATCH_SIZE) &&
+           (batch_src_count + num_src_per_tgt[batch_start + batch_count] <=
+            max_batch_src_count))
+      batch_src_count += num_src_per_tgt[batch_start + batch_count++];
+
+    // get the cells of the current batch
+    for (size_t i = 0, k = 0; i < batch_count; ++i) {
+      yac_const_basic_grid_data_get_grid_cell(
+        tgt_basic_grid_data, tgt_points[batch_start + i], tgt_grid_cells + i);
+      for (size_t j = 0; j < num_src_per_tgt[batch_start + i]; ++j, ++k)
+        yac_const_basic_grid_data_get_grid_cell(
+          src_basic_grid_data, src_cells[offset + k], src_grid_cells + k);
+    }
 
-        memmove(
-          src_cells + result_offset, src_cells + offset,
-          num_weights * sizeof(*src_cells));
+    // compute overlap areas (the areas are stored in the weight array)
+    yac_compute_overlap_info_batch(
+      batch_count, tgt_grid_cells, num_src_per_tgt + batch_start,
+      src_grid_cells, w + offset, NULL);
+
+    for (size_t i = 0; i < batch_count; ++i) {
+
+      size_t curr_src_count = num_src_per_tgt[batch_start + i];
+      size_t curr_tgt_point = tgt_points[batch_start + i];
+      size_t num_weights;
+
+      // if weight computation was successful
+      if (compute_1st_order_weights(
+            tgt_grid_cells[i], curr_src_count, src_cells + offset,
+            w + offset, &num_weights,
+            partial_coverage, normalisation, enforced_conserv)) {
+
+        if (offset != result_offset) {
+
+          memmove(
+            src_cells + result_offset, src_cells + offset,
+            num_weights * sizeof(*src_cells));
+          memmove(
+            w + result_offset, w + offset, num_weights * sizeof(*w));
+        }
+        tgt_points[result_count] = curr_tgt_point;
+        num_src_per_tgt[result_count] = num_weights;
+        result_count++;
+        result_offset += num_weights;
+        total_num_weights += num_weights;
+      } else {
+        failed_tgt[batch_start + i - result_count] = curr_tgt_point;
       }
-      tgt_points[result_count] = curr_tgt_point;
-      num_src_per_tgt[result_count] = num_weights;
-      result_count++;
-      result_offset += num_weights;
-      total_num_weights += num_weights;
-    } else {
-      failed_tgt[i - result_count] = curr_tgt_point;
+
+      offset += curr_src_count;
     }
 
-    offset += curr_src_count;
+    batch_start += batch_count;
   }
 
-  free(tgt_grid_cell.edge_type);
-  free(tgt_grid_cell.coordinates_xyz);
-  free(src_grid_cells);
+  free_cell_buffers(cell_buffers);
 
   if (result_count != count)
     memcpy(tgt_points + result_count, failed_tgt,
@@ -67,7 +67,8 @@ static void delete_creep(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_creep_vtable = {
     .do_search = do_search_creep,
-    .delete = delete_creep};
+    .delete = delete_creep,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_CREEP};
 
 struct interp_method_creep {
 
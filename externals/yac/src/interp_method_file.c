@@ -49,6 +49,8 @@
 #include "dist_grid.h"
 #include "yac_mpi.h"
 #include "io_utils.h"
+#include "weight_file_binary.h"
+#include "ensure_array_size.h"
 
 static size_t do_search_file(struct interp_method * method,
                               struct interp_grid * interp_grid,
@@ -59,7 +61,8 @@ static void delete_file(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_file_vtable = {
     .do_search = do_search_file,
-    .delete = delete_file};
+    .delete = delete_file,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_FILE};
 
 struct interp_method_file {
 
@@ -116,56 +119,14 @@ struct temp_result {
   size_t reorder_idx;
 };
 
-static void read_weight_file(
-  char const * weight_file_name, MPI_Comm comm,
-  char const * src_grid_name, char const * tgt_grid_name,
+#ifdef YAC_NETCDF_ENABLED
+// checks the meta data of a NetCDF weight file against the data provided
+// through the interface
+static void check_weight_file(
+  int ncid, char const * src_grid_name, char const * tgt_grid_name,
   enum yac_location * src_locations, enum yac_location tgt_location,
-  size_t num_src_fields,
-  struct link_data ** links, size_t * num_links,
-  struct fixed_data ** fixed, size_t * num_fixed) {
-
-  *links = NULL;
-  *num_links = 0;
-  *fixed = NULL;
-  *num_fixed = 0;
-
-#ifndef YAC_NETCDF_ENABLED
-  UNUSED(weight_file_name);
-  UNUSED(comm);
-  UNUSED(src_grid_name);
-  UNUSED(tgt_grid_name);
-  UNUSED(src_locations);
-  UNUSED(tgt_location);
-  UNUSED(num_src_fields);
-  UNUSED(links);
-  UNUSED(num_links);
-
-  die("ERROR(read_weight_file): YAC_NETCDF_ENABLED not defined");
-#else
-
-  int rank;
-  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
-
-  // determine ranks that do input
-  int local_is_io;
-  int * io_ranks;
-  int num_io_ranks;
-  yac_get_io_ranks(comm, &local_is_io, &io_ranks, &num_io_ranks);
-
-  int io_idx = INT_MAX;
-  if (local_is_io)
-    for (int i = 0; (i < num_io_ranks) && (io_idx == INT_MAX); ++i)
-      if (io_ranks[i] == rank) io_idx = i;
-  free(io_ranks);
-
-  // if the local process does not have to read anything from the file
-  if (!local_is_io) return;
-
-  // open weight file on io processes
-  int ncid;
-  yac_nc_open(weight_file_name, NC_NOWRITE, &ncid);
-
-  //\todo use parallel netcdf if available
+  size_t num_src_fields, int * contains_links, size_t * num_links_in_file,
+  int * contains_fixed) {
 
   int dimid, var_id;
 
@@ -179,7 +140,7 @@ static void read_weight_file(
   YAC_ASSERT_F(
     (strlen(YAC_WEIGHT_FILE_VERSION_STRING) == version_len) &&
     !strncmp(version, YAC_WEIGHT_FILE_VERSION_STRING, version_len),
-    "ERROR(read_weight_file): "
+    "ERROR(check_weight_file): "
     "version string from weight file (\"%s\") does not match "
     "with YAC version \"%s\"", version, YAC_WEIGHT_FILE_VERSION_STRING)
   free(version);
@@ -193,7 +154,7 @@ static void read_weight_file(
   YAC_ASSERT_F(
     (strlen(src_grid_name) == grid_name_len) &&
     !strncmp(src_grid_name, grid_name, grid_name_len),
-    "ERROR(read_weight_file): source grid name from weight file (\"%s\") "
+    "ERROR(check_weight_file): source grid name from weight file (\"%s\") "
     "does not match with the one provided through the interface (\"%s\")",
     grid_name, src_grid_name)
 
@@ -206,16 +167,13 @@ static void read_weight_file(
   YAC_ASSERT_F(
     (strlen(tgt_grid_name) == grid_name_len) &&
     !strncmp(tgt_grid_name, grid_name, grid_name_len),
-    "ERROR(read_weight_file): target grid name from weight file (\"%s\") "
+    "ERROR(check_weight_file): target grid name from weight file (\"%s\") "
     "does not match with the one provided through the interface (\"%s\")",
     grid_name, tgt_grid_name)
 
   free(grid_name);
 
-  //---------------
-  // read link data
-  //---------------
-
+  // link data
   size_t str_link_len;
   char * str_link;
   var_id = NC_GLOBAL;
@@ -224,44 +182,44 @@ static void read_weight_file(
   str_link[str_link_len] = '\0';
   HANDLE_ERROR(nc_get_att_text(ncid, var_id, "contains_links", str_link));
 
-  int contains_links = (strlen("TRUE") == str_link_len) &&
+  *contains_links = (strlen("TRUE") == str_link_len) &&
                        !strncmp("TRUE", str_link, str_link_len);
   YAC_ASSERT(
-    contains_links ||
+    *contains_links ||
     ((strlen("FALSE") == str_link_len) &&
      !strncmp("FALSE", str_link, str_link_len)),
-    "ERROR(read_weight_file): invalid global attribute contains_links")
+    "ERROR(check_weight_file): invalid global attribute contains_links")
   free(str_link);
 
   size_t num_wgts = 0;
-  if (contains_links) {
+  if (*contains_links) {
     HANDLE_ERROR(nc_inq_dimid(ncid, "num_wgts", &dimid));
     HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &num_wgts));
     YAC_ASSERT(
-      num_wgts == 1, "ERROR(read_weight_file): YAC only supports num_wgts == 1")
+      num_wgts == 1, "ERROR(check_weight_file): YAC only supports num_wgts == 1")
   }
 
   // get number of links from file
 
-  size_t num_links_in_file = 0;
-  if (contains_links) {
+  *num_links_in_file = 0;
+  if (*contains_links) {
     HANDLE_ERROR(nc_inq_dimid(ncid, "num_links", &dimid));
-    HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &num_links_in_file));
+    HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, num_links_in_file));
     YAC_ASSERT(
-      num_links_in_file != 0, "ERROR(read_weight_file): no links defined")
+      *num_links_in_file != 0, "ERROR(check_weight_file): no links defined")
   }
 
   // get number of source fields
   size_t tmp_num_src_fields = 0;
-  if (contains_links) {
+  if (*contains_links) {
     HANDLE_ERROR(nc_inq_dimid(ncid, "num_src_fields", &dimid));
     HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &tmp_num_src_fields));
     YAC_ASSERT(
       tmp_num_src_fields != 0,
-      "ERROR(read_weight_file): no source fields in file")
+      "ERROR(check_weight_file): no source fields in file")
     YAC_ASSERT_F(
       tmp_num_src_fields == num_src_fields,
-      "ERROR(read_weight_file): number of source fields in file (%zu) does not "
+      "ERROR(check_weight_file): number of source fields in file (%zu) does not "
       "match with the number provided through the interface (%zu)",
       tmp_num_src_fields, num_src_fields)
   }
@@ -272,7 +230,7 @@ static void read_weight_file(
   HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &max_loc_str_len));
   YAC_ASSERT(
     max_loc_str_len == YAC_MAX_LOC_STR_LEN,
-    "ERROR(read_weight_file): wrong max location string length in weight file")
+    "ERROR(check_weight_file): wrong max location string length in weight file")
 
   // get source locations
   enum yac_location * tmp_src_locations =
@@ -293,7 +251,7 @@ static void read_weight_file(
 
     YAC_ASSERT_F(
       tmp_src_locations[i] == src_locations[i],
-      "ERROR(read_weight_file): source locations in file does not match with "
+      "ERROR(check_weight_file): source locations in file does not match with "
       "the locations provided through the interface\n"
       "location index:          %d\n"
       "location in weight file: %s\n"
@@ -310,11 +268,94 @@ static void read_weight_file(
     HANDLE_ERROR(nc_get_var_text(ncid, var_id, loc_str));
     YAC_ASSERT(
       tgt_location == yac_str2loc(loc_str),
-      "ERROR(read_weight_file): target locations in file does not match with "
+      "ERROR(check_weight_file): target locations in file does not match with "
       "the locations provided through the interface")
   }
 
-    if (contains_links) {
+  // fixed data
+  size_t str_fixed_len;
+  char * str_fixed;
+  var_id = NC_GLOBAL;
+  HANDLE_ERROR(
+    nc_inq_attlen(ncid, var_id, "contains_fixed_dst", &str_fixed_len));
+  str_fixed = xmalloc(str_fixed_len + 1);
+  str_fixed[str_fixed_len] = '\0';
+  HANDLE_ERROR(nc_get_att_text(ncid, var_id, "contains_fixed_dst", str_fixed));
+
+  *contains_fixed = (strlen("TRUE") == str_fixed_len) &&
+                       !strncmp("TRUE", str_fixed, str_fixed_len);
+
+  YAC_ASSERT(
+    *contains_fixed ||
+    ((strlen("FALSE") == str_fixed_len) &&
+     !strncmp("FALSE", str_fixed, str_fixed_len)),
+    "ERROR(check_weight_file): invalid global attribute contains_fixed_dst")
+  free(str_fixed);
+}
+#endif
+
+static void read_weight_file(
+  char const * weight_file_name, MPI_Comm comm,
+  char const * src_grid_name, char const * tgt_grid_name,
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  size_t num_src_fields,
+  struct link_data ** links, size_t * num_links,
+  struct fixed_data ** fixed, size_t * num_fixed) {
+
+  *links = NULL;
+  *num_links = 0;
+  *fixed = NULL;
+  *num_fixed = 0;
+
+#ifndef YAC_NETCDF_ENABLED
+  UNUSED(weight_file_name);
+  UNUSED(comm);
+  UNUSED(src_grid_name);
+  UNUSED(tgt_grid_name);
+  UNUSED(src_locations);
+  UNUSED(tgt_location);
+  UNUSED(num_src_fields);
+  UNUSED(links);
+  UNUSED(num_links);
+
+  die("ERROR(read_weight_file): YAC_NETCDF_ENABLED not defined");
+#else
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  // determine ranks that do input
+  int local_is_io;
+  int * io_ranks;
+  int num_io_ranks;
+  yac_get_io_ranks(comm, &local_is_io, &io_ranks, &num_io_ranks);
+
+  int io_idx = INT_MAX;
+  if (local_is_io)
+    for (int i = 0; (i < num_io_ranks) && (io_idx == INT_MAX); ++i)
+      if (io_ranks[i] == rank) io_idx = i;
+  free(io_ranks);
+
+  // if the local process does not have to read anything from the file
+  if (!local_is_io) return;
+
+  // open weight file on io processes
+  int ncid;
+  yac_nc_open(weight_file_name, NC_NOWRITE, &ncid);
+
+  int dimid, var_id;
+
+  int contains_links, contains_fixed;
+  size_t num_links_in_file;
+  check_weight_file(
+    ncid, src_grid_name, tgt_grid_name, src_locations, tgt_location,
+    num_src_fields, &contains_links, &num_links_in_file, &contains_fixed);
+
+  //---------------
+  // read link data
+  //---------------
+
+  if (contains_links) {
 
     // get number of links per source field
     unsigned * num_links_per_src_field =
@@ -388,26 +429,6 @@ static void read_weight_file(
   // read fixed data
   //----------------
 
-  // global attributes
-  size_t str_fixed_len;
-  char * str_fixed;
-  var_id = NC_GLOBAL;
-  HANDLE_ERROR(
-    nc_inq_attlen(ncid, var_id, "contains_fixed_dst", &str_fixed_len));
-  str_fixed = xmalloc(str_fixed_len + 1);
-  str_fixed[str_fixed_len] = '\0';
-  HANDLE_ERROR(nc_get_att_text(ncid, var_id, "contains_fixed_dst", str_fixed));
-
-  int contains_fixed = (strlen("TRUE") == str_fixed_len) &&
-                       !strncmp("TRUE", str_fixed, str_fixed_len);
-
-  YAC_ASSERT(
-    contains_fixed ||
-    ((strlen("FALSE") == str_fixed_len) &&
-     !strncmp("FALSE", str_fixed, str_fixed_len)),
-    "ERROR(read_weight_file): invalid global attribute contains_fixed_dst")
-  free(str_fixed);
-
   if (contains_fixed) {
 
     // get number of fixed values
@@ -1228,6 +1249,808 @@ static void redist_weight_file_data(
   free(tgt_global_ids);
 }
 
+static void check_binary_weight_file(
+  struct yac_binary_weight_file * file, char const * weight_file_name,
+  char const * src_grid_name, char const * tgt_grid_name,
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  size_t num_src_fields) {
+
+  struct yac_binary_weight_file_header const * header = file->header;
+
+  YAC_ASSERT_F(
+    (strlen(src_grid_name) == header->src_grid_name_len) &&
+    !strncmp(src_grid_name, file->src_grid_name, header->src_grid_name_len),
+    "ERROR(check_binary_weight_file): source grid name from weight file "
+    "\"%s\" does not match with the one provided through the interface "
+    "(\"%s\")", weight_file_name, src_grid_name)
+  YAC_ASSERT_F(
+    (strlen(tgt_grid_name) == header->tgt_grid_name_len) &&
+    !strncmp(tgt_grid_name, file->tgt_grid_name, header->tgt_grid_name_len),
+    "ERROR(check_binary_weight_file): target grid name from weight file "
+    "\"%s\" does not match with the one provided through the interface "
+    "(\"%s\")", weight_file_name, tgt_grid_name)
+  YAC_ASSERT_F(
+    header->num_src_fields == (uint64_t)num_src_fields,
+    "ERROR(check_binary_weight_file): number of source fields in file "
+    "(%zu) does not match with the number provided through the interface "
+    "(%zu)", (size_t)(header->num_src_fields), num_src_fields)
+  for (size_t i = 0; i < num_src_fields; ++i)
+    YAC_ASSERT_F(
+      file->src_locations[i] == (int32_t)(src_locations[i]),
+      "ERROR(check_binary_weight_file): source locations in file does not "
+      "match with the locations provided through the interface\n"
+      "location index:          %d\n"
+      "location in weight file: %s\n"
+      "location from interface: %s",
+      (int)i, yac_loc2str((enum yac_location)(file->src_locations[i])),
+      yac_loc2str(src_locations[i]))
+  YAC_ASSERT(
+    header->tgt_location == (int32_t)tgt_location,
+    "ERROR(check_binary_weight_file): target locations in file does not "
+    "match with the locations provided through the interface")
+}
+
+// reads the data from a binary weight file in the same distribution
+// as read_weight_file
+static void read_binary_weight_file(
+  struct yac_binary_weight_file * file, MPI_Comm comm,
+  struct link_data ** links, size_t * num_links,
+  struct fixed_data ** fixed, size_t * num_fixed) {
+
+  *links = NULL;
+  *num_links = 0;
+  *fixed = NULL;
+  *num_fixed = 0;
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  // determine ranks that do input
+  int local_is_io;
+  int * io_ranks;
+  int num_io_ranks;
+  yac_get_io_ranks(comm, &local_is_io, &io_ranks, &num_io_ranks);
+
+  int io_idx = INT_MAX;
+  if (local_is_io)
+    for (int i = 0; (i < num_io_ranks) && (io_idx == INT_MAX); ++i)
+      if (io_ranks[i] == rank) io_idx = i;
+  free(io_ranks);
+
+  // if the local process does not have to read anything from the file
+  if (!local_is_io) return;
+
+  size_t num_links_in_file = (size_t)(file->header->num_links);
+  size_t offset =
+    (size_t)(((long long)io_idx * (long long)num_links_in_file) /
+             (long long)num_io_ranks);
+  size_t count =
+    (size_t)((((long long)io_idx + 1) * (long long)num_links_in_file) /
+             (long long)num_io_ranks) - offset;
+
+  *num_links = count;
+  *links = xmalloc(count * sizeof(**links));
+  for (size_t i = 0; i < count; ++i) {
+    YAC_ASSERT(
+      file->link_src_field_idx[offset + i] < file->header->num_src_fields,
+      "ERROR(read_binary_weight_file): invalid source field index")
+    (*links)[i].src.global_id = (yac_int)(file->link_src[offset + i]);
+    (*links)[i].tgt.global_id = (yac_int)(file->link_tgt[offset + i]);
+    (*links)[i].weight = file->link_weight[offset + i];
+    (*links)[i].src_field_idx = (size_t)(file->link_src_field_idx[offset + i]);
+  }
+
+  size_t num_fixed_values = (size_t)(file->header->num_fixed_values);
+  if (num_fixed_values == 0) return;
+
+  size_t num_fixed_tgt = (size_t)(file->header->num_fixed_tgt);
+  offset =
+    (size_t)(((long long)io_idx * (long long)num_fixed_tgt) /
+             (long long)num_io_ranks);
+  count =
+    (size_t)((((long long)io_idx + 1) * (long long)num_fixed_tgt) /
+             (long long)num_io_ranks) - offset;
+
+  *fixed = xmalloc(num_fixed_values * sizeof(**fixed));
+  *num_fixed = num_fixed_values;
+
+  // group target points by fixed value
+  size_t * fixed_offsets = xcalloc(num_fixed_values, sizeof(*fixed_offsets));
+  for (size_t i = 0; i < count; ++i) {
+    size_t fixed_value_idx = (size_t)(file->fixed_value_idx[offset + i]);
+    YAC_ASSERT(
+      fixed_value_idx < num_fixed_values,
+      "ERROR(read_binary_weight_file): invalid fixed value index")
+    fixed_offsets[fixed_value_idx]++;
+  }
+  void * tgt_global_id_buffer = xmalloc(count * sizeof(*((*fixed)->tgt)));
+  for (size_t i = 0, accu = 0; i < num_fixed_values; ++i) {
+    (*fixed)[i].value = file->fixed_values[i];
+    (*fixed)[i].num_tgt = 0;
+    (*fixed)[i].tgt =
+      (void*)(((unsigned char *)tgt_global_id_buffer) +
+              accu * sizeof(*((*fixed)->tgt)));
+    accu += fixed_offsets[i];
+  }
+  for (size_t i = 0; i < count; ++i) {
+    struct fixed_data * curr_fixed =
+      *fixed + (size_t)(file->fixed_value_idx[offset + i]);
+    curr_fixed->tgt[curr_fixed->num_tgt++].global_id =
+      (yac_int)(file->fixed_tgt[offset + i]);
+  }
+  free(fixed_offsets);
+}
+
+static size_t lookup_tgt_global_id(
+  yac_int const * tgt_global_ids, size_t count, int64_t global_id) {
+
+  size_t lower = 0, upper = count;
+  while (lower < upper) {
+    size_t middle = lower + (upper - lower) / 2;
+    if ((int64_t)(tgt_global_ids[middle]) < global_id) lower = middle + 1;
+    else upper = middle;
+  }
+  return
+    ((lower < count) && ((int64_t)(tgt_global_ids[lower]) == global_id))?
+      lower:SIZE_MAX;
+}
+
+// if the decomposition of the target points did not change since the binary
+// weight file was written, each process can directly use its own slice of
+// the file, which avoids the redistribution of the data
+// (returns 0, if this is not possible for at least one process; the output
+// is the same as the one of redist_weight_file_data)
+static int get_binary_weight_file_slice(
+  struct yac_binary_weight_file * file, struct interp_grid * interp_grid,
+  size_t * tgt_points, size_t tgt_count, size_t * num_interpolated_points,
+  struct link_data ** links, size_t * num_links,
+  struct fixed_data ** fixed, size_t * num_fixed) {
+
+  MPI_Comm comm = yac_interp_grid_get_MPI_Comm(interp_grid);
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  // the number of slices is identical for all processes
+  if (file->header->num_slices != (uint64_t)comm_size) return 0;
+
+  struct yac_binary_weight_file_slice slice = file->slices[comm_rank];
+  size_t slice_num_links = (size_t)(slice.link_count);
+  size_t slice_num_fixed = (size_t)(slice.fixed_count);
+  int64_t const * link_tgt = file->link_tgt + slice.link_offset;
+  int64_t const * fixed_tgt = file->fixed_tgt + slice.fixed_offset;
+  uint64_t const * fixed_value_idx = file->fixed_value_idx + slice.fixed_offset;
+
+  // get global ids of target points that have to be interpolated
+  yac_int * tgt_global_ids = xmalloc(tgt_count * sizeof(*tgt_global_ids));
+  yac_interp_grid_get_tgt_global_ids(
+    interp_grid, tgt_points, tgt_count, tgt_global_ids);
+  yac_quicksort_index_yac_int_size_t(tgt_global_ids, tgt_count, tgt_points);
+
+  // check whether the local process holds all target points of its slice
+  // and get their positions in tgt_points
+  // (the positions of link targets are followed by the fixed ones)
+  size_t * slice_tgt_pos =
+    xmalloc((slice_num_links + slice_num_fixed) * sizeof(*slice_tgt_pos));
+  int * is_used = xcalloc(tgt_count, sizeof(*is_used));
+  size_t num_link_tgt = 0;
+  int is_valid = 1;
+  for (size_t i = 0; (i < slice_num_links) && is_valid;) {
+    int64_t curr_global_id = link_tgt[i];
+    size_t pos = lookup_tgt_global_id(tgt_global_ids, tgt_count, curr_global_id);
+    is_valid = (pos != SIZE_MAX) && !is_used[pos];
+    if (is_valid) {
+      is_used[pos] = 1;
+      slice_tgt_pos[num_link_tgt++] = pos;
+    }
+    while ((i < slice_num_links) && (link_tgt[i] == curr_global_id)) ++i;
+  }
+  for (size_t i = 0; (i < slice_num_fixed) && is_valid; ++i) {
+    size_t pos = lookup_tgt_global_id(tgt_global_ids, tgt_count, fixed_tgt[i]);
+    is_valid = (pos != SIZE_MAX) && !is_used[pos];
+    if (is_valid) {
+      is_used[pos] = 1;
+      slice_tgt_pos[num_link_tgt + i] = pos;
+    }
+  }
+  free(tgt_global_ids);
+
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &is_valid, 1, MPI_INT, MPI_MIN, comm), comm);
+
+  if (!is_valid) {
+    free(is_used);
+    free(slice_tgt_pos);
+    return 0;
+  }
+
+  // reorder target points (link targets first, followed by fixed targets
+  // and the non-interpolated ones)
+  size_t * sorted_tgt_points = xmalloc(tgt_count * sizeof(*sorted_tgt_points));
+  memcpy(sorted_tgt_points, tgt_points, tgt_count * sizeof(*tgt_points));
+  *num_interpolated_points = num_link_tgt + slice_num_fixed;
+  for (size_t i = 0; i < *num_interpolated_points; ++i)
+    tgt_points[i] = sorted_tgt_points[slice_tgt_pos[i]];
+  for (size_t i = 0, j = *num_interpolated_points; i < tgt_count; ++i)
+    if (!is_used[i]) tgt_points[j++] = sorted_tgt_points[i];
+  free(sorted_tgt_points);
+  free(is_used);
+  free(slice_tgt_pos);
+
+  // get links
+  int64_t const * link_src = file->link_src + slice.link_offset;
+  uint64_t const * link_src_field_idx =
+    file->link_src_field_idx + slice.link_offset;
+  double const * link_weight = file->link_weight + slice.link_offset;
+  *num_links = slice_num_links;
+  *links = xmalloc(slice_num_links * sizeof(**links));
+  for (size_t i = 0; i < slice_num_links; ++i) {
+    YAC_ASSERT(
+      link_src_field_idx[i] < file->header->num_src_fields,
+      "ERROR(get_binary_weight_file_slice): invalid source field index")
+    (*links)[i].src.global_id = (yac_int)(link_src[i]);
+    (*links)[i].tgt.global_id = (yac_int)(link_tgt[i]);
+    (*links)[i].weight = link_weight[i];
+    (*links)[i].src_field_idx = (size_t)(link_src_field_idx[i]);
+  }
+
+  // get fixed data (fixed targets are grouped by fixed value)
+  *fixed = NULL;
+  *num_fixed = 0;
+  if (slice_num_fixed > 0) {
+    void * tgt_global_id_buffer =
+      xmalloc(slice_num_fixed * sizeof(*((*fixed)->tgt)));
+    struct fixed_data * curr_fixed = NULL;
+    for (size_t i = 0; i < slice_num_fixed; ++i) {
+      if ((i == 0) || (fixed_value_idx[i] != fixed_value_idx[i-1])) {
+        YAC_ASSERT(
+          fixed_value_idx[i] < file->header->num_fixed_values,
+          "ERROR(get_binary_weight_file_slice): invalid fixed value index")
+        *fixed = xrealloc(*fixed, (*num_fixed + 1) * sizeof(**fixed));
+        curr_fixed = *fixed + *num_fixed;
+        ++*num_fixed;
+        curr_fixed->value = file->fixed_values[fixed_value_idx[i]];
+        curr_fixed->tgt = (void*)(((unsigned char *)tgt_global_id_buffer) +
+                                  i * sizeof(*((*fixed)->tgt)));
+        curr_fixed->num_tgt = 0;
+      }
+      curr_fixed->tgt[curr_fixed->num_tgt++].global_id =
+        (yac_int)(fixed_tgt[i]);
+    }
+  }
+
+  return 1;
+}
+
+#ifdef YAC_NETCDF_ENABLED
+
+// if the data read by all processes through the target index exceeds
+// the size of the weight file by this factor, the data is read and
+// redistributed instead (e.g. if the decomposition of the target points
+// does not match the order of the data in the file)
+#define TGT_INDEX_MAX_READ_FACTOR (4)
+
+// target index of a part of a NetCDF weight file
+// (see write_tgt_index in interp_weights.c)
+struct weight_file_tgt_index {
+  size_t num_parts;
+  size_t * part_sizes; // number of entries per part
+  size_t block_size;   // number of entries per indexed block
+  int * index;         // target address of the first entry of each block
+  size_t index_size;
+};
+
+// contiguous range of entries of a part of a NetCDF weight file
+struct weight_file_range {
+  size_t part_idx;
+  size_t offset; // offset within the variable
+  size_t count;
+};
+
+// reads the target index for a part of a weight file
+// (returns 0, if the file does not contain the respective index)
+static int read_tgt_index(
+  int ncid, char const * index_var_name, char const * index_dim_name,
+  struct weight_file_tgt_index * tgt_index) {
+
+  int var_id, dimid;
+  int status = nc_inq_varid(ncid, index_var_name, &var_id);
+  if (status == NC_ENOTVAR) return 0;
+  HANDLE_ERROR(status);
+
+  int block_size;
+  HANDLE_ERROR(nc_get_att_int(ncid, var_id, "block_size", &block_size));
+  YAC_ASSERT_F(
+    block_size > 0,
+    "ERROR(read_tgt_index): invalid block size (%d) for \"%s\"",
+    block_size, index_var_name)
+  tgt_index->block_size = (size_t)block_size;
+
+  HANDLE_ERROR(nc_inq_dimid(ncid, index_dim_name, &dimid));
+  HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &(tgt_index->index_size)));
+
+  size_t ref_index_size = 0;
+  for (size_t i = 0; i < tgt_index->num_parts; ++i)
+    ref_index_size +=
+      (tgt_index->part_sizes[i] + tgt_index->block_size - 1) /
+      tgt_index->block_size;
+  YAC_ASSERT_F(
+    ref_index_size == tgt_index->index_size,
+    "ERROR(read_tgt_index): size of \"%s\" (%zu) does not match with the "
+    "number of entries in the weight file (%zu blocks)",
+    index_var_name, tgt_index->index_size, ref_index_size)
+
+  tgt_index->index =
+    xmalloc(tgt_index->index_size * sizeof(*(tgt_index->index)));
+  HANDLE_ERROR(nc_get_var_int(ncid, var_id, tgt_index->index));
+
+  return 1;
+}
+
+static void bcast_tgt_index(
+  struct weight_file_tgt_index * tgt_index, int root, MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  size_t sizes[3] =
+    {tgt_index->num_parts, tgt_index->block_size, tgt_index->index_size};
+  yac_mpi_call(MPI_Bcast(sizes, 3, YAC_MPI_SIZE_T, root, comm), comm);
+
+  if (rank != root) {
+    tgt_index->num_parts = sizes[0];
+    tgt_index->block_size = sizes[1];
+    tgt_index->index_size = sizes[2];
+    tgt_index->part_sizes =
+      xmalloc(sizes[0] * sizeof(*(tgt_index->part_sizes)));
+    tgt_index->index = xmalloc(sizes[2] * sizeof(*(tgt_index->index)));
+  }
+
+  yac_mpi_call(
+    MPI_Bcast(tgt_index->part_sizes, (int)(tgt_index->num_parts),
+              YAC_MPI_SIZE_T, root, comm), comm);
+  yac_mpi_call(
+    MPI_Bcast(tgt_index->index, (int)(tgt_index->index_size),
+              MPI_INT, root, comm), comm);
+}
+
+static void free_tgt_index(struct weight_file_tgt_index * tgt_index) {
+  free(tgt_index->part_sizes);
+  free(tgt_index->index);
+}
+
+// returns the index of the first block whose first target id is bigger
+// than (or if inclusive is set equal to) the provided global id
+static size_t get_first_block(
+  int const * index, size_t num_blocks, yac_int global_id, int inclusive) {
+
+  size_t lower = 0, upper = num_blocks;
+  while (lower < upper) {
+    size_t middle = lower + (upper - lower) / 2;
+    int64_t curr_global_id = (int64_t)(index[middle]) - 1;
+    if ((curr_global_id < (int64_t)global_id) ||
+        (!inclusive && (curr_global_id == (int64_t)global_id)))
+      lower = middle + 1;
+    else upper = middle;
+  }
+  return lower;
+}
+
+// determines all ranges of entries in a part of a weight file, which
+// may contain data for the provided target points
+// (tgt_global_ids has to be sorted)
+static void get_tgt_index_ranges(
+  struct weight_file_tgt_index const * tgt_index,
+  yac_int const * tgt_global_ids, size_t tgt_count,
+  struct weight_file_range ** ranges, size_t * num_ranges) {
+
+  size_t const block_size = tgt_index->block_size;
+  size_t ranges_array_size = 0;
+  *ranges = NULL;
+  *num_ranges = 0;
+
+  for (size_t part_idx = 0, part_offset = 0, index_offset = 0;
+       part_idx < tgt_index->num_parts; ++part_idx) {
+
+    size_t part_size = tgt_index->part_sizes[part_idx];
+    size_t num_blocks = (part_size + block_size - 1) / block_size;
+    int const * index = tgt_index->index + index_offset;
+
+    // the entries of block i are in the range [index[i], index[i+1]]
+    // (the last block has no upper bound)
+    size_t range_begin = SIZE_MAX, range_end = SIZE_MAX;
+    for (size_t i = 0; i <= tgt_count; ++i) {
+
+      size_t begin_block = SIZE_MAX, end_block = SIZE_MAX;
+      if (i < tgt_count) {
+        begin_block =
+          get_first_block(index, num_blocks, tgt_global_ids[i], 1);
+        end_block =
+          get_first_block(index, num_blocks, tgt_global_ids[i], 0);
+        if (begin_block > 0) --begin_block;
+        if (begin_block >= end_block) continue;
+      }
+
+      // extend current range of blocks or start a new one
+      if ((range_end != SIZE_MAX) && (begin_block <= range_end)) {
+        if (end_block > range_end) range_end = end_block;
+        continue;
+      }
+
+      if (range_end != SIZE_MAX) {
+        ENSURE_ARRAY_SIZE(*ranges, ranges_array_size, *num_ranges + 1);
+        struct weight_file_range * curr_range = *ranges + *num_ranges;
+        curr_range->part_idx = part_idx;
+        curr_range->offset = part_offset + range_begin * block_size;
+        curr_range->count =
+          MIN(range_end * block_size, part_size) - range_begin * block_size;
+        ++*num_ranges;
+      }
+      range_begin = begin_block;
+      range_end = end_block;
+    }
+
+    part_offset += part_size;
+    index_offset += num_blocks;
+  }
+}
+
+// reads the meta data and the target index of a NetCDF weight file on
+// the root process and distributes it among all processes
+// (returns 0, if the file does not contain a complete target index)
+static int read_weight_file_tgt_index(
+  char const * weight_file_name, MPI_Comm comm,
+  char const * src_grid_name, char const * tgt_grid_name,
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  size_t num_src_fields,
+  struct weight_file_tgt_index * link_index,
+  struct weight_file_tgt_index * fixed_index, double ** fixed_values) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  link_index->num_parts = 0;
+  link_index->part_sizes = NULL;
+  link_index->index = NULL;
+  link_index->index_size = 0;
+  link_index->block_size = 1;
+  *fixed_index = *link_index;
+  *fixed_values = NULL;
+
+  int has_index = 1;
+
+  if (rank == 0) {
+
+    int ncid, dimid, var_id;
+    yac_nc_open(weight_file_name, NC_NOWRITE, &ncid);
+
+    int contains_links, contains_fixed;
+    size_t num_links_in_file;
+    check_weight_file(
+      ncid, src_grid_name, tgt_grid_name, src_locations, tgt_location,
+      num_src_fields, &contains_links, &num_links_in_file, &contains_fixed);
+
+    has_index = contains_links || contains_fixed;
+
+    if (has_index && contains_links) {
+
+      unsigned * num_links_per_src_field =
+        xmalloc(num_src_fields * sizeof(*num_links_per_src_field));
+      yac_nc_inq_varid(ncid, "num_links_per_src_field", &var_id);
+      HANDLE_ERROR(nc_get_var_uint(ncid, var_id, num_links_per_src_field));
+
+      link_index->num_parts = num_src_fields;
+      link_index->part_sizes =
+        xmalloc(num_src_fields * sizeof(*(link_index->part_sizes)));
+      for (size_t i = 0; i < num_src_fields; ++i)
+        link_index->part_sizes[i] = (size_t)(num_links_per_src_field[i]);
+      free(num_links_per_src_field);
+
+      has_index =
+        read_tgt_index(ncid, "dst_address_index", "num_dst_index", link_index);
+    }
+
+    if (has_index && contains_fixed) {
+
+      size_t num_fixed_values;
+      HANDLE_ERROR(nc_inq_dimid(ncid, "num_fixed_values", &dimid));
+      HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &num_fixed_values));
+
+      int * num_tgt_per_fixed_value =
+        xmalloc(num_fixed_values * sizeof(*num_tgt_per_fixed_value));
+      yac_nc_inq_varid(ncid, "num_dst_per_fixed_value", &var_id);
+      HANDLE_ERROR(nc_get_var_int(ncid, var_id, num_tgt_per_fixed_value));
+
+      fixed_index->num_parts = num_fixed_values;
+      fixed_index->part_sizes =
+        xmalloc(num_fixed_values * sizeof(*(fixed_index->part_sizes)));
+      for (size_t i = 0; i < num_fixed_values; ++i)
+        fixed_index->part_sizes[i] = (size_t)(num_tgt_per_fixed_value[i]);
+      free(num_tgt_per_fixed_value);
+
+      *fixed_values = xmalloc(num_fixed_values * sizeof(**fixed_values));
+      yac_nc_inq_varid(ncid, "fixed_values", &var_id);
+      HANDLE_ERROR(nc_get_var_double(ncid, var_id, *fixed_values));
+
+      has_index =
+        read_tgt_index(
+          ncid, "dst_address_fixed_index", "num_dst_fixed_index", fixed_index);
+    }
+
+    HANDLE_ERROR(nc_close(ncid));
+  }
+
+  yac_mpi_call(MPI_Bcast(&has_index, 1, MPI_INT, 0, comm), comm);
+
+  if (has_index) {
+    bcast_tgt_index(link_index, 0, comm);
+    bcast_tgt_index(fixed_index, 0, comm);
+    if (rank != 0)
+      *fixed_values =
+        xmalloc(fixed_index->num_parts * sizeof(**fixed_values));
+    yac_mpi_call(
+      MPI_Bcast(*fixed_values, (int)(fixed_index->num_parts), MPI_DOUBLE,
+                0, comm), comm);
+  } else {
+    free_tgt_index(link_index);
+    free_tgt_index(fixed_index);
+    free(*fixed_values);
+  }
+
+  return has_index;
+}
+#endif
+
+// if the weight file contains a target index (see write_tgt_index in
+// interp_weights.c), each process directly reads the parts of the file that
+// contain the data for its own target points, which avoids the
+// redistribution of the data
+// (returns 0, if the file does not contain a target index or if the
+// decomposition of the target points does not fit to the order of the data
+// in the file; the output is the same as the one of redist_weight_file_data)
+static int read_weight_file_direct(
+  char const * weight_file_name, struct interp_grid * interp_grid,
+  char const * src_grid_name, char const * tgt_grid_name,
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  size_t num_src_fields,
+  size_t * tgt_points, size_t tgt_count, size_t * num_interpolated_points,
+  struct link_data ** links, size_t * num_links,
+  struct fixed_data ** fixed, size_t * num_fixed) {
+
+#ifndef YAC_NETCDF_ENABLED
+  UNUSED(weight_file_name);
+  UNUSED(interp_grid);
+  UNUSED(src_grid_name);
+  UNUSED(tgt_grid_name);
+  UNUSED(src_locations);
+  UNUSED(tgt_location);
+  UNUSED(num_src_fields);
+  UNUSED(tgt_points);
+  UNUSED(tgt_count);
+  UNUSED(num_interpolated_points);
+  UNUSED(links);
+  UNUSED(num_links);
+  UNUSED(fixed);
+  UNUSED(num_fixed);
+
+  return 0;
+#else
+
+  MPI_Comm comm = yac_interp_grid_get_MPI_Comm(interp_grid);
+
+  struct weight_file_tgt_index link_index, fixed_index;
+  double * fixed_values;
+  if (!read_weight_file_tgt_index(
+         weight_file_name, comm, src_grid_name, tgt_grid_name,
+         src_locations, tgt_location, num_src_fields,
+         &link_index, &fixed_index, &fixed_values)) return 0;
+
+  // get global ids of target points that have to be interpolated
+  yac_int * tgt_global_ids = xmalloc(tgt_count * sizeof(*tgt_global_ids));
+  yac_interp_grid_get_tgt_global_ids(
+    interp_grid, tgt_points, tgt_count, tgt_global_ids);
+  yac_quicksort_index_yac_int_size_t(tgt_global_ids, tgt_count, tgt_points);
+
+  // determine the ranges of the file that have to be read
+  struct weight_file_range * link_ranges, * fixed_ranges;
+  size_t num_link_ranges, num_fixed_ranges;
+  get_tgt_index_ranges(
+    &link_index, tgt_global_ids, tgt_count, &link_ranges, &num_link_ranges);
+  get_tgt_index_ranges(
+    &fixed_index, tgt_global_ids, tgt_count, &fixed_ranges, &num_fixed_ranges);
+
+  // check the total amount of data that would be read by all processes
+  // (the index is identical on all processes, therefore the total number
+  // of entries in the file does not have to be reduced)
+  size_t read_count = 0, total_count = 0;
+  for (size_t i = 0; i < num_link_ranges; ++i)
+    read_count += link_ranges[i].count;
+  for (size_t i = 0; i < num_fixed_ranges; ++i)
+    read_count += fixed_ranges[i].count;
+  for (size_t i = 0; i < link_index.num_parts; ++i)
+    total_count += link_index.part_sizes[i];
+  for (size_t i = 0; i < fixed_index.num_parts; ++i)
+    total_count += fixed_index.part_sizes[i];
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &read_count, 1, YAC_MPI_SIZE_T, MPI_SUM, comm), comm);
+
+  if (read_count > TGT_INDEX_MAX_READ_FACTOR * total_count) {
+    free(link_ranges);
+    free(fixed_ranges);
+    free(tgt_global_ids);
+    free(fixed_values);
+    free_tgt_index(&link_index);
+    free_tgt_index(&fixed_index);
+    return 0;
+  }
+
+  int ncid;
+  if ((num_link_ranges > 0) || (num_fixed_ranges > 0))
+    yac_nc_open(weight_file_name, NC_NOWRITE, &ncid);
+
+  // positions of the link and fixed target points in tgt_points
+  // (0: not used; 1: link target; 2: fixed target)
+  int * tgt_type = xcalloc(tgt_count, sizeof(*tgt_type));
+
+  // read links
+  size_t links_array_size = 0;
+  *links = NULL;
+  *num_links = 0;
+  if (num_link_ranges > 0) {
+
+    int src_var_id, tgt_var_id, weight_var_id;
+    yac_nc_inq_varid(ncid, "src_address", &src_var_id);
+    yac_nc_inq_varid(ncid, "dst_address", &tgt_var_id);
+    yac_nc_inq_varid(ncid, "remap_matrix", &weight_var_id);
+
+    size_t max_count = 0;
+    for (size_t i = 0; i < num_link_ranges; ++i)
+      if (link_ranges[i].count > max_count) max_count = link_ranges[i].count;
+    int * tgt_address = xmalloc(max_count * sizeof(*tgt_address));
+    int * src_address = xmalloc(max_count * sizeof(*src_address));
+    double * weights = xmalloc(max_count * sizeof(*weights));
+
+    for (size_t i = 0; i < num_link_ranges; ++i) {
+
+      size_t offsets[2] = {link_ranges[i].offset, 0};
+      size_t counts[2] = {link_ranges[i].count, 1};
+
+      HANDLE_ERROR(
+        nc_get_vara_int(ncid, tgt_var_id, offsets, counts, tgt_address));
+      HANDLE_ERROR(
+        nc_get_vara_int(ncid, src_var_id, offsets, counts, src_address));
+      HANDLE_ERROR(
+        nc_get_vara_double(ncid, weight_var_id, offsets, counts, weights));
+
+      for (size_t j = 0; j < counts[0]; ++j) {
+        size_t pos =
+          lookup_tgt_global_id(
+            tgt_global_ids, tgt_count, (int64_t)(tgt_address[j]) - 1);
+        if (pos == SIZE_MAX) continue;
+        tgt_type[pos] = 1;
+        ENSURE_ARRAY_SIZE(*links, links_array_size, *num_links + 1);
+        struct link_data * curr_link = *links + *num_links;
+        curr_link->src.global_id = (yac_int)(src_address[j] - 1);
+        curr_link->tgt.global_id = (yac_int)(tgt_address[j] - 1);
+        curr_link->weight = weights[j];
+        curr_link->src_field_idx = link_ranges[i].part_idx;
+        ++*num_links;
+      }
+    }
+
+    free(weights);
+    free(src_address);
+    free(tgt_address);
+  }
+  free(link_ranges);
+
+  // read fixed data
+  size_t num_fixed_tgt = 0;
+  size_t * fixed_tgt_pos = xmalloc(tgt_count * sizeof(*fixed_tgt_pos));
+  *fixed = NULL;
+  *num_fixed = 0;
+  if (num_fixed_ranges > 0) {
+
+    int var_id;
+    yac_nc_inq_varid(ncid, "dst_address_fixed", &var_id);
+
+    size_t max_count = 0;
+    for (size_t i = 0; i < num_fixed_ranges; ++i)
+      if (fixed_ranges[i].count > max_count)
+        max_count = fixed_ranges[i].count;
+    int * tgt_address = xmalloc(max_count * sizeof(*tgt_address));
+
+    // ranges are sorted by fixed value
+    size_t * num_tgt_per_fixed_value =
+      xcalloc(fixed_index.num_parts, sizeof(*num_tgt_per_fixed_value));
+    for (size_t i = 0; i < num_fixed_ranges; ++i) {
+
+      HANDLE_ERROR(
+        nc_get_vara_int(
+          ncid, var_id, &(fixed_ranges[i].offset), &(fixed_ranges[i].count),
+          tgt_address));
+
+      for (size_t j = 0; j < fixed_ranges[i].count; ++j) {
+        size_t pos =
+          lookup_tgt_global_id(
+            tgt_global_ids, tgt_count, (int64_t)(tgt_address[j]) - 1);
+        if (pos == SIZE_MAX) continue;
+        YAC_ASSERT(
+          tgt_type[pos] != 1,
+          "ERROR(read_weight_file_direct): inconsistent data in weight file;"
+          "link and fixed data available for a target point")
+        if (tgt_type[pos] == 2) continue;
+        tgt_type[pos] = 2;
+        fixed_tgt_pos[num_fixed_tgt++] = pos;
+        num_tgt_per_fixed_value[fixed_ranges[i].part_idx]++;
+      }
+    }
+    free(tgt_address);
+
+    if (num_fixed_tgt > 0) {
+      void * tgt_global_id_buffer =
+        xmalloc(num_fixed_tgt * sizeof(*((*fixed)->tgt)));
+      *fixed = xmalloc(fixed_index.num_parts * sizeof(**fixed));
+      for (size_t i = 0, offset = 0; i < fixed_index.num_parts; ++i) {
+        if (num_tgt_per_fixed_value[i] == 0) continue;
+        struct fixed_data * curr_fixed = *fixed + *num_fixed;
+        curr_fixed->value = fixed_values[i];
+        curr_fixed->tgt =
+          (void*)(((unsigned char *)tgt_global_id_buffer) +
+                  offset * sizeof(*((*fixed)->tgt)));
+        curr_fixed->num_tgt = num_tgt_per_fixed_value[i];
+        for (size_t j = 0; j < curr_fixed->num_tgt; ++j)
+          curr_fixed->tgt[j].global_id =
+            tgt_global_ids[fixed_tgt_pos[offset + j]];
+        offset += num_tgt_per_fixed_value[i];
+        ++*num_fixed;
+      }
+    }
+    free(num_tgt_per_fixed_value);
+  }
+  free(fixed_ranges);
+
+  if ((num_link_ranges > 0) || (num_fixed_ranges > 0))
+    HANDLE_ERROR(nc_close(ncid));
+
+  // sort links by target ids
+  qsort(*links, *num_links, sizeof(**links), compare_link_data_tgt);
+
+  // reorder target points (link targets first, followed by fixed targets
+  // and the non-interpolated ones)
+  size_t * sorted_tgt_points = xmalloc(tgt_count * sizeof(*sorted_tgt_points));
+  memcpy(sorted_tgt_points, tgt_points, tgt_count * sizeof(*tgt_points));
+  size_t num_link_tgt = 0;
+  for (size_t i = 0; i < *num_links;) {
+    yac_int curr_global_id = (*links)[i].tgt.global_id;
+    tgt_points[num_link_tgt++] =
+      sorted_tgt_points[
+        lookup_tgt_global_id(
+          tgt_global_ids, tgt_count, (int64_t)curr_global_id)];
+    while ((i < *num_links) && ((*links)[i].tgt.global_id == curr_global_id))
+      ++i;
+  }
+  for (size_t i = 0; i < num_fixed_tgt; ++i)
+    tgt_points[num_link_tgt + i] = sorted_tgt_points[fixed_tgt_pos[i]];
+  *num_interpolated_points = num_link_tgt + num_fixed_tgt;
+  for (size_t i = 0, j = *num_interpolated_points; i < tgt_count; ++i)
+    if (!tgt_type[i]) tgt_points[j++] = sorted_tgt_points[i];
+
+  free(sorted_tgt_points);
+  free(fixed_tgt_pos);
+  free(tgt_type);
+  free(tgt_global_ids);
+  free(fixed_values);
+  free_tgt_index(&link_index);
+  free_tgt_index(&fixed_index);
+
+  return 1;
+#endif
+}
+
 static int compare_link_data_field_idx_src(void const *a, void const *b) {
 
   struct link_data const * link_a = (struct link_data*)a;
@@ -1307,23 +2130,60 @@ static size_t do_search_file(struct interp_method * method,
   struct fixed_data * fixed;
   size_t num_fixed;
 
-  // read data from file
-  read_weight_file(
-    method_file->weight_file_name, comm,
-    method_file->src_grid_name, method_file->tgt_grid_name,
-    src_locations, tgt_location, num_src_fields,
-    &links, &num_links, &fixed, &num_fixed);
+  size_t num_interpolated_points;
+
+  if (yac_binary_weight_file_check_magic(method_file->weight_file_name)) {
+
+    struct yac_binary_weight_file * file =
+      yac_binary_weight_file_open(method_file->weight_file_name);
+    check_binary_weight_file(
+      file, method_file->weight_file_name,
+      method_file->src_grid_name, method_file->tgt_grid_name,
+      src_locations, tgt_location, num_src_fields);
+    free(src_locations);
+
+    // if the decomposition has changed since the file was written, the data
+    // is read and redistributed like the data from NetCDF weight files
+    if (!get_binary_weight_file_slice(
+           file, interp_grid, tgt_points, count, &num_interpolated_points,
+           &links, &num_links, &fixed, &num_fixed)) {
+
+      read_binary_weight_file(
+        file, comm, &links, &num_links, &fixed, &num_fixed);
+      redist_weight_file_data(
+        interp_grid, tgt_points, count, &num_interpolated_points,
+        &links, &num_links, &fixed, &num_fixed);
+    }
 
-  free(src_locations);
+    yac_binary_weight_file_close(file);
 
-  // relocates links and fixed to the processes, which require them to
-  // interpolate their local target points
-  // (the tgt_points first contain the link-tgt_points, then the fixed-tgt_points,
-  // and followed the non-interpolated tgt_points)
-  size_t num_interpolated_points;
-  redist_weight_file_data(
-    interp_grid, tgt_points, count, &num_interpolated_points,
-    &links, &num_links, &fixed, &num_fixed);
+  } else if (!read_weight_file_direct(
+                method_file->weight_file_name, interp_grid,
+                method_file->src_grid_name, method_file->tgt_grid_name,
+                src_locations, tgt_location, num_src_fields,
+                tgt_points, count, &num_interpolated_points,
+                &links, &num_links, &fixed, &num_fixed)) {
+
+    // read data from file
+    read_weight_file(
+      method_file->weight_file_name, comm,
+      method_file->src_grid_name, method_file->tgt_grid_name,
+      src_locations, tgt_location, num_src_fields,
+      &links, &num_links, &fixed, &num_fixed);
+
+    free(src_locations);
+
+    // relocates links and fixed to the processes, which require them to
+    // interpolate their local target points
+    // (the tgt_points first contain the link-tgt_points, then the
+    // fixed-tgt_points, and followed the non-interpolated tgt_points)
+    redist_weight_file_data(
+      interp_grid, tgt_points, count, &num_interpolated_points,
+      &links, &num_links, &fixed, &num_fixed);
+
+  } else {
+    free(src_locations);
+  }
 
   size_t * tgt_points_reorder_idx =
     xmalloc(num_interpolated_points * sizeof(*tgt_points_reorder_idx));
@@ -54,6 +54,14 @@
 
 #define YAC_WEIGHT_FILE_VERSION_STRING "yac weight file 1.0"
 
+/**
+ * constructor for an interpolation method that reads the weights from file
+ * @param[in] weight_file_name name of the weight file (NetCDF or binary
+ *                             weight file; the format is detected from the
+ *                             content of the file)
+ * @param[in] src_grid_name    name of the source grid
+ * @param[in] tgt_grid_name    name of the target grid
+ */
 struct interp_method * yac_interp_method_file_new(
   char const * weight_file_name,
   char const * src_grid_name, char const * tgt_grid_name);
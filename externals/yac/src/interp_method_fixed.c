@@ -59,7 +59,8 @@ static void delete_fixed(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_fixed_vtable = {
     .do_search = do_search_fixed,
-    .delete = delete_fixed};
+    .delete = delete_fixed,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_FIXED};
 
 struct interp_method_fixed {
 
@@ -118,7 +118,8 @@ static void delete_hcsbb(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_hcsbb_vtable = {
     .do_search = do_search_hcsbb,
-    .delete = delete_hcsbb};
+    .delete = delete_hcsbb,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_HCSBB};
 
 struct interp_method_hcsbb {
 
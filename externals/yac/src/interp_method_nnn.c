@@ -50,6 +50,7 @@
 #include "string.h"
 
 #include "interp_method_nnn.h"
+#include "ensure_array_size.h"
 #include "yac_lapack_interface.h"
 
 static size_t do_search_nnn(struct interp_method * method,
@@ -65,16 +66,22 @@ static void delete_nnn(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_nnn_vtable = {
     .do_search = do_search_nnn,
-    .delete = delete_nnn},
+    .delete = delete_nnn,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_NNN},
   interp_method_1nn_vtable = {
     .do_search = do_search_1nn,
-    .delete = delete_nnn};
+    .delete = delete_nnn,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_NNN};
 
 struct interp_method_nnn {
 
   struct interp_method_vtable * vtable;
   void (*compute_weights)(
     double[3], coordinate_pointer, size_t const, double *, double const);
+  // optional: computes the weights for all target points at once
+  void (*compute_weights_batch)(
+    coordinate_pointer, size_t const *, const_coordinate_pointer,
+    size_t const *, size_t const, size_t const, double *, double const);
   size_t n;
   double scale;
 };
@@ -202,22 +209,22 @@ static void inverse(double * A, int n) {
 #endif
 }
 
-static void compute_weights_rbf(
-  double tgt_coord[3], coordinate_pointer src_coords, size_t const n,
-  double * weights, double const rbf_scale) {
-
-  double A[n][n];
-  double a[n];
+// computes the matrix A[n][n] containing the radial basis function of the
+// distances between all source points and returns the squared scaling
+// factor applied to the distances
+static double compute_rbf_matrix(
+  coordinate_pointer src_coords, size_t const n, double * A,
+  double const rbf_scale) {
 
   double sum_d = 0.0, scale_d = 1.0;
 
   // compute distance matrix for all found source points
-  for (size_t i = 0; i < n; ++i) A[i][i] = 0.0;
+  for (size_t i = 0; i < n; ++i) A[i * n + i] = 0.0;
   for (size_t i = 0; i < n - 1; ++i) {
     for (size_t j = i + 1; j < n; ++j) {
       double d = get_vector_angle(src_coords[i], src_coords[j]);
-      A[i][j] = d;
-      A[j][i] = d;
+      A[i * n + j] = d;
+      A[j * n + i] = d;
       sum_d += d;
     }
   }
@@ -232,37 +239,165 @@ static void compute_weights_rbf(
   // compute matrix A[n][n]
   // with A = rbf(A)
   //      rbf(a) => Radial basis function
-  for (size_t i = 0; i < n; ++i) {
-    for (size_t j = 0; j < n; ++j) {
-      double d = A[i][j];
-      // gauß rbf kernel
-      A[i][j] = exp(-1.0 * d * d * sq_scale_d);
-    }
+  for (size_t i = 0; i < n * n; ++i) {
+    double d = A[i];
+    // gauß rbf kernel
+    A[i] = exp(-1.0 * d * d * sq_scale_d);
+  }
+
+  return sq_scale_d;
+}
+
+// solves A * X = B for nrhs right-hand sides, B is overwritten with X
+// (A is modified)
+static void solve_rbf(double * A, size_t const n, double * B, size_t nrhs) {
+
+#ifndef YAC_LAPACK_NO_DPOTR
+  // the gauß rbf matrix is symmetric positive definite, but for (nearly)
+  // coinciding source points it can lose this property numerically, in
+  // which case we fall back to the inverse of A
+  double A_copy[n * n];
+  memcpy(A_copy, A, n * n * sizeof(*A));
+
+  if (!LAPACKE_dpotrf(
+        LAPACK_COL_MAJOR, 'L', (lapack_int) n, A, (lapack_int) n)) {
+
+    YAC_ASSERT(
+      !LAPACKE_dpotrs(
+        LAPACK_COL_MAJOR, 'L', (lapack_int) n, (lapack_int) nrhs,
+        A, (lapack_int) n, B, (lapack_int) n), "internal ERROR: dpotrs")
+    return;
   }
 
+  memcpy(A, A_copy, n * n * sizeof(*A));
+#endif
+
   // compute inverse of A
-  inverse(&A[0][0], n);
-
-  // compute a[NUM_NEIGH]
-  // with a_i = rbf(d(x_i, y))
-  //      x => vector containing the coordinates of the
-  //           n nearest neighbours of the current
-  //           target point
-  //      y => coordinates of target point
-  //      d(a, b) => great circle distance between point a and b
-  //      rbf(a) => Radial basis function
-  for (int i = 0; i < n; ++i) {
-    double d = get_vector_angle(tgt_coord, src_coords[i]);
-    // gauß rbf kernel
-    a[i] = exp(-1.0 * d * d * sq_scale_d);
+  inverse(A, n);
+
+  // compute X
+  // with x_i = SUM(A_inv[i][j]*b[j]) // j = 0..n-1
+  double x[n];
+  for (size_t k = 0; k < nrhs; ++k) {
+    double * b = B + k * n;
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = 0.0;
+      for (size_t j = 0; j < n; ++j) x[i] += A[i * n + j] * b[j];
+    }
+    memcpy(b, x, n * sizeof(*b));
   }
+}
 
-  // compute weights
-  // with w_i = SUM(A_inv[i][j]*a[j]) // j = 0..n-1
-  for (size_t i = 0; i < n; ++i) {
-    weights[i] = 0.0;
-    for (size_t j = 0; j < n; ++j) weights[i] += A[i][j] * a[j];
+struct rbf_stencil {
+  size_t const * src_points; // sorted source points of the stencil
+  size_t tgt_idx;
+  size_t n;
+};
+
+static int compare_rbf_stencils(void const * a, void const * b) {
+
+  struct rbf_stencil const * stencil_a = (struct rbf_stencil const *)a;
+  struct rbf_stencil const * stencil_b = (struct rbf_stencil const *)b;
+
+  for (size_t i = 0; i < stencil_a->n; ++i) {
+    int ret = (stencil_a->src_points[i] > stencil_b->src_points[i]) -
+              (stencil_a->src_points[i] < stencil_b->src_points[i]);
+    if (ret) return ret;
+  }
+  return (stencil_a->tgt_idx > stencil_b->tgt_idx) -
+         (stencil_a->tgt_idx < stencil_b->tgt_idx);
+}
+
+// computes the rbf weights for count target points at once
+// (target point i is located at tgt_coords[tgt_idx[i]] and is interpolated
+//  from the source points src_points[i*n..(i+1)*n-1])
+//
+// The matrix A only depends on the source points of a stencil. Therefore,
+// all target points that have the same set of source points are grouped
+// together, so that A is only built and factorised once for each distinct
+// stencil and the weights of the whole group are computed by a single solve
+// with multiple right-hand sides.
+static void compute_weights_rbf_batch(
+  coordinate_pointer tgt_coords, size_t const * tgt_idx,
+  const_coordinate_pointer src_field_coords, size_t const * src_points,
+  size_t const count, size_t const n, double * weights,
+  double const rbf_scale) {
+
+  if (count == 0) return;
+
+  // sort the source points of each stencil, pos contains the original
+  // position of each sorted source point within its stencil
+  size_t * sorted_src_points = xmalloc(2 * count * n * sizeof(*sorted_src_points));
+  size_t * pos = sorted_src_points + count * n;
+  struct rbf_stencil * stencils = xmalloc(count * sizeof(*stencils));
+  memcpy(sorted_src_points, src_points, count * n * sizeof(*src_points));
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = 0; j < n; ++j) pos[i * n + j] = j;
+    yac_quicksort_index_size_t_size_t(
+      sorted_src_points + i * n, n, pos + i * n);
+    stencils[i].src_points = sorted_src_points + i * n;
+    stencils[i].tgt_idx = i;
+    stencils[i].n = n;
   }
+
+  // group target points with identical stencils
+  qsort(stencils, count, sizeof(*stencils), compare_rbf_stencils);
+
+  double * A = xmalloc(n * n * sizeof(*A));
+  double * B = NULL;
+  size_t B_array_size = 0;
+  coordinate_pointer src_coords = xmalloc(n * sizeof(*src_coords));
+
+  for (size_t i = 0, group_size; i < count; i += group_size) {
+
+    size_t const * curr_src_points = stencils[i].src_points;
+
+    for (group_size = 1;
+         (i + group_size < count) &&
+         !memcmp(stencils[i + group_size].src_points, curr_src_points,
+                 n * sizeof(*curr_src_points)); ++group_size);
+
+    for (size_t j = 0; j < n; ++j)
+      memcpy(src_coords[j], src_field_coords[curr_src_points[j]],
+             3 * sizeof(double));
+
+    double sq_scale_d = compute_rbf_matrix(src_coords, n, A, rbf_scale);
+
+    // compute b[NUM_NEIGH] for each target point of the group
+    // with b_i = rbf(d(x_i, y))
+    //      x => vector containing the coordinates of the
+    //           n nearest neighbours of the current
+    //           target point
+    //      y => coordinates of target point
+    //      d(a, b) => great circle distance between point a and b
+    //      rbf(a) => Radial basis function
+    ENSURE_ARRAY_SIZE(B, B_array_size, group_size * n);
+    for (size_t k = 0; k < group_size; ++k) {
+      double * tgt_coord = tgt_coords[tgt_idx[stencils[i + k].tgt_idx]];
+      for (size_t j = 0; j < n; ++j) {
+        double d = get_vector_angle(tgt_coord, src_coords[j]);
+        // gauß rbf kernel
+        B[k * n + j] = exp(-1.0 * d * d * sq_scale_d);
+      }
+    }
+
+    // compute weights
+    // with A * w = b
+    solve_rbf(A, n, B, group_size);
+
+    for (size_t k = 0; k < group_size; ++k) {
+      size_t curr_tgt_idx = stencils[i + k].tgt_idx;
+      size_t const * curr_pos = pos + curr_tgt_idx * n;
+      for (size_t j = 0; j < n; ++j)
+        weights[curr_tgt_idx * n + curr_pos[j]] = B[k * n + j];
+    }
+  }
+
+  free(src_coords);
+  free(B);
+  free(A);
+  free(stencils);
+  free(sorted_src_points);
 }
 
 static size_t do_search_nnn (struct interp_method * method,
@@ -312,6 +447,10 @@ static size_t do_search_nnn (struct interp_method * method,
   void (*compute_weights)(
     double[3], coordinate_pointer, size_t, double *, double const) =
       method_nnn->compute_weights;
+  void (*compute_weights_batch)(
+    coordinate_pointer, size_t const *, const_coordinate_pointer,
+    size_t const *, size_t const, size_t const, double *, double const) =
+      method_nnn->compute_weights_batch;
   double scale = method_nnn->scale;
   double * w = xmalloc(n * result_count * sizeof(*w));
   size_t * num_weights_per_tgt =
@@ -320,21 +459,29 @@ static size_t do_search_nnn (struct interp_method * method,
   const_coordinate_pointer src_field_coordinates =
     yac_interp_grid_get_src_field_coords(interp_grid, 0);
 
-  // compute the weights
   for (size_t i = 0; i < result_count; ++i) {
     size_t curr_reorder_idx = reorder_idx[i];
-    for (size_t j = 0; j < n; ++j) {
-      size_t curr_src_point = src_points[curr_reorder_idx * n + j];
-      memcpy(src_coord_buffer[j], src_field_coordinates[curr_src_point],
-             3 * sizeof(double));
-      src_points_reorder[i * n + j] = curr_src_point;
-    }
-
-    compute_weights(
-      tgt_coords[curr_reorder_idx], src_coord_buffer, n, w + i * n, scale);
+    for (size_t j = 0; j < n; ++j)
+      src_points_reorder[i * n + j] = src_points[curr_reorder_idx * n + j];
     num_weights_per_tgt[i] = n;
   }
 
+  // compute the weights
+  if (compute_weights_batch != NULL) {
+    compute_weights_batch(
+      tgt_coords, reorder_idx, src_field_coordinates, src_points_reorder,
+      result_count, n, w, scale);
+  } else {
+    for (size_t i = 0; i < result_count; ++i) {
+      for (size_t j = 0; j < n; ++j)
+        memcpy(src_coord_buffer[j],
+               src_field_coordinates[src_points_reorder[i * n + j]],
+               3 * sizeof(double));
+      compute_weights(
+        tgt_coords[reorder_idx[i]], src_coord_buffer, n, w + i * n, scale);
+    }
+  }
+
   // move the non-interpolated target points to the end
   for (size_t i = 0; i < count; ++i) src_points[reorder_idx[i]] = i;
   yac_quicksort_index_size_t_size_t(src_points, count, tgt_points);
@@ -429,6 +576,7 @@ struct interp_method * yac_interp_method_nnn_new(struct yac_nnn_config config) {
   method->vtable = &interp_method_nnn_vtable;
 
   method->n = config.n;
+  method->compute_weights_batch = NULL;
 
   YAC_ASSERT(
     (config.type == NNN_AVG) || (config.type == NNN_DIST) ||
@@ -465,7 +613,8 @@ struct interp_method * yac_interp_method_nnn_new(struct yac_nnn_config config) {
         config.n >= 2,
         "ERROR(yac_interp_method_nnn_new): n needs to be at least 2 for RBF")
       method->scale = config.data.rbf_scale;
-      method->compute_weights = compute_weights_rbf;
+      method->compute_weights = NULL;
+      method->compute_weights_batch = compute_weights_rbf_batch;
       break;
   };
 
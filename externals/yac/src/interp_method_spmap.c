@@ -62,7 +62,8 @@ static void delete_spmap(struct interp_method * method);
 static struct interp_method_vtable
   interp_method_spmap_vtable = {
     .do_search = do_search_spmap,
-    .delete = delete_spmap
+    .delete = delete_spmap,
+    .setup_phase = YAC_SETUP_PHASE_DO_SEARCH_SPMAP
 };
 
 struct interp_method_spmap {
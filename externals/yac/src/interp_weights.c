@@ -51,6 +51,14 @@
 #include <string.h>
 
 #define WEIGHT_TOL (1e-9)
+// number of links per chunk for weight files written with parallel
+// NetCDF-4 (large enough for efficient collective writes, small enough
+// that readers of a link range do not access much data outside of it)
+#define WEIGHT_FILE_LINK_CHUNK_SIZE ((size_t)1 << 16)
+// number of links per block of the target index in weight files
+// (matches the chunk size, such that each indexed block can be read
+//  without touching more than two chunks)
+#define WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE WEIGHT_FILE_LINK_CHUNK_SIZE
 
 #include "yac_mpi.h"
 #include "interp_weights.h"
@@ -58,6 +66,8 @@
 #include "io_utils.h"
 #include "utils.h"
 #include "interp_method_file.h"
+#include "weight_file_binary.h"
+#include "setup_stats.h"
 
 enum yac_interp_weight_stencil_type {
   FIXED         = 0,
@@ -829,10 +839,16 @@ static void xt_redist_msg_free(
   free(msgs);
 }
 
+static MPI_Datatype get_interp_field_datatype(struct interpolation * interp) {
+
+  return
+    yac_interpolation_use_single_precision(interp)?MPI_FLOAT:MPI_DOUBLE;
+}
+
 static Xt_redist generate_direct_redist(
   uint64_t * src_orig_poses, size_t * sendcounts,
   struct interp_weight_stencil_direct * tgt_stencils,
-  size_t * recvcounts, MPI_Comm comm) {
+  size_t * recvcounts, MPI_Datatype field_dt, MPI_Comm comm) {
 
   int comm_size;
   yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
@@ -864,7 +880,7 @@ static Xt_redist generate_direct_redist(
       tgt_stencils += recvcounts[i];
       recv_msgs[nrecv].rank = i;
       recv_msgs[nrecv].datatype =
-        xt_mpi_generate_datatype(pos_buffer, recvcounts[i], MPI_DOUBLE, comm);
+        xt_mpi_generate_datatype(pos_buffer, recvcounts[i], field_dt, comm);
       nrecv++;
     }
     if (sendcounts[i] > 0) {
@@ -873,7 +889,7 @@ static Xt_redist generate_direct_redist(
       src_orig_poses += sendcounts[i];
       send_msgs[nsend].rank = i;
       send_msgs[nsend].datatype =
-        xt_mpi_generate_datatype(pos_buffer, sendcounts[i], MPI_DOUBLE, comm);
+        xt_mpi_generate_datatype(pos_buffer, sendcounts[i], field_dt, comm);
       nsend++;
     }
   }
@@ -930,7 +946,8 @@ static Xt_redist generate_direct_redist(
 static Xt_redist * generate_direct_mf_redists(
   uint64_t * src_orig_pos, size_t * sendcounts,
   struct interp_weight_stencil_direct_mf * tgt_stencils,
-  size_t * recvcounts, size_t num_src_fields, MPI_Comm comm) {
+  size_t * recvcounts, size_t num_src_fields, MPI_Datatype field_dt,
+  MPI_Comm comm) {
 
   int comm_size;
   yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
@@ -979,7 +996,7 @@ static Xt_redist * generate_direct_mf_redists(
         recv_msgs[recv_offsets[src_field_idx]].rank = i;
         recv_msgs[recv_offsets[src_field_idx]].datatype =
           xt_mpi_generate_datatype(
-            pos_buffer, recvcounts[idx], MPI_DOUBLE, comm);
+            pos_buffer, recvcounts[idx], field_dt, comm);
         recv_offsets[src_field_idx]++;
       }
       if (sendcounts[idx] > 0) {
@@ -989,7 +1006,7 @@ static Xt_redist * generate_direct_mf_redists(
         send_msgs[send_offsets[src_field_idx]].rank = i;
         send_msgs[send_offsets[src_field_idx]].datatype =
           xt_mpi_generate_datatype(
-            pos_buffer, sendcounts[idx], MPI_DOUBLE, comm);
+            pos_buffer, sendcounts[idx], field_dt, comm);
         send_offsets[src_field_idx]++;
       }
     }
@@ -1182,8 +1199,18 @@ static void yac_interp_weights_redist_direct(
   // generate redist
   Xt_redist redist =
     generate_direct_redist(
-      recv_orig_pos_buffer, recvcounts, recv_stencil_buffer, sendcounts, comm);
+      recv_orig_pos_buffer, recvcounts, recv_stencil_buffer, sendcounts,
+      get_interp_field_datatype(interp), comm);
   free(orig_pos_buffer);
+
+  // register the target points written by the redist
+  if (yac_interpolation_use_single_precision(interp)) {
+    size_t * tgt_pos = xmalloc(tgt_count * sizeof(*tgt_pos));
+    for (size_t i = 0; i < tgt_count; ++i)
+      tgt_pos[i] = (size_t)(recv_stencil_buffer[i].orig_pos);
+    yac_interpolation_add_tgt_pos(interp, tgt_count, tgt_pos);
+    free(tgt_pos);
+  }
   free(stencil_buffer);
 
   yac_interpolation_add_direct(interp, redist);
@@ -1391,10 +1418,19 @@ static void yac_interp_weights_redist_direct_mf(
   Xt_redist * redists =
     generate_direct_mf_redists(
       recv_orig_pos_buffer, recvcounts, recv_stencil_buffer, sendcounts,
-      (size_t)num_src_fields, comm);
+      (size_t)num_src_fields, get_interp_field_datatype(interp), comm);
 
   yac_free_comm_buffers(sendcounts, recvcounts, sdispls, rdispls);
   free(orig_pos_buffer);
+
+  // register the target points written by the redists
+  if (yac_interpolation_use_single_precision(interp)) {
+    size_t * tgt_pos = xmalloc(tgt_count * sizeof(*tgt_pos));
+    for (size_t i = 0; i < tgt_count; ++i)
+      tgt_pos[i] = (size_t)(recv_stencil_buffer[i].orig_pos);
+    yac_interpolation_add_tgt_pos(interp, tgt_count, tgt_pos);
+    free(tgt_pos);
+  }
   free(stencil_buffer);
 
   yac_interpolation_add_direct_mf(interp, redists, (size_t)num_src_fields);
@@ -3108,7 +3144,7 @@ static struct interp_weight_stencils_wsum_mf * redist_wsum_mf_stencils_tgt(
 
 static Xt_redist * generate_halo_redists(
   struct remote_point_info_reorder * halo_points, size_t count,
-  size_t num_src_fields, MPI_Comm comm) {
+  size_t num_src_fields, MPI_Datatype field_dt, MPI_Comm comm) {
 
   int comm_size;
   yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
@@ -3154,10 +3190,8 @@ static Xt_redist * generate_halo_redists(
   int * recv_buffer = exchange_buffer + 2 * count;
 
   // pack the original positions of the requested points
-  size_t num_halo_per_src_field[num_src_fields];
-  memset(
-    num_halo_per_src_field, 0,
-    num_src_fields * sizeof(num_halo_per_src_field[0]));
+  // (the reorder_idx of each halo point contains its position in the
+  //  receive buffer of the respective source field)
   for (size_t i = 0; i < count; ++i) {
     size_t curr_src_field_idx = (size_t)(halo_points[i].field_idx);
     size_t pos = sdispls[(size_t)(halo_points[i].data.rank) * num_src_fields +
@@ -3167,7 +3201,7 @@ static Xt_redist * generate_halo_redists(
       orig_pos <= INT_MAX,
       "ERROR(generate_halo_redists): offset not supported by MPI")
     send_buffer[pos] = (int)orig_pos;
-    reorder_idx[pos] = num_halo_per_src_field[curr_src_field_idx]++;
+    reorder_idx[pos] = (int)(halo_points[i].reorder_idx);
   }
 
   // exchange original positions of the requested points
@@ -3209,14 +3243,14 @@ static Xt_redist * generate_halo_redists(
         recv_msgs[nrecv].rank = rank;
         recv_msgs[nrecv].datatype =
           xt_mpi_generate_datatype(
-            reorder_idx + sdispls[idx], sendcounts[idx], MPI_DOUBLE, comm);
+            reorder_idx + sdispls[idx], sendcounts[idx], field_dt, comm);
         nrecv++;
       }
       if (recvcounts[idx] > 0) {
         send_msgs[nsend].rank = rank;
         send_msgs[nsend].datatype =
           xt_mpi_generate_datatype(
-            recv_buffer + rdispls[idx], recvcounts[idx], MPI_DOUBLE, comm);
+            recv_buffer + rdispls[idx], recvcounts[idx], field_dt, comm);
         nsend++;
       }
     }
@@ -3349,7 +3383,9 @@ static void free_remote_point(struct remote_point point) {
 
 static Xt_redist generate_redist_put_double(
   enum yac_location location, struct remote_point_infos * point_infos,
-  size_t count, MPI_Comm comm) {
+  size_t count, struct interpolation * interp, MPI_Comm comm) {
+
+  MPI_Datatype field_dt = get_interp_field_datatype(interp);
 
   int comm_size;
   yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
@@ -3420,14 +3456,14 @@ static Xt_redist generate_redist_put_double(
       send_msgs[nsend].rank = i;
       send_msgs[nsend].datatype =
         xt_mpi_generate_datatype(
-          reorder_idx + sdispls[i], sendcounts[i], MPI_DOUBLE, comm);
+          reorder_idx + sdispls[i], sendcounts[i], field_dt, comm);
       nsend++;
     }
     if (recvcounts[i] > 0) {
       recv_msgs[nrecv].rank = i;
       recv_msgs[nrecv].datatype =
         xt_mpi_generate_datatype(
-          recv_buffer + rdispls[i], recvcounts[i], MPI_DOUBLE, comm);
+          recv_buffer + rdispls[i], recvcounts[i], field_dt, comm);
       nrecv++;
     }
   }
@@ -3436,6 +3472,15 @@ static Xt_redist generate_redist_put_double(
   Xt_redist redist =
     xt_redist_single_array_base_new(nsend, nrecv, send_msgs, recv_msgs, comm);
 
+  // register the target points written by the redist
+  if (yac_interpolation_use_single_precision(interp)) {
+    size_t * tgt_pos = xmalloc(recv_count * sizeof(*tgt_pos));
+    for (size_t i = 0; i < recv_count; ++i)
+      tgt_pos[i] = (size_t)(recv_buffer[i]);
+    yac_interpolation_add_tgt_pos(interp, recv_count, tgt_pos);
+    free(tgt_pos);
+  }
+
   free(exchange_buffer);
   yac_free_comm_buffers(sendcounts, recvcounts, sdispls, rdispls);
 
@@ -3445,6 +3490,44 @@ static Xt_redist generate_redist_put_double(
   return redist;
 }
 
+static void reorder_halo_by_first_access(
+  struct remote_point_info_reorder * halo_points, size_t halo_size,
+  size_t num_src_fields, size_t * src_field_idx, size_t * src_idx,
+  size_t num_links) {
+
+  // halo points are sorted by field_idx
+  size_t field_offsets[num_src_fields + 1];
+  size_t num_halo_per_src_field[num_src_fields];
+  memset(
+    field_offsets, 0, (num_src_fields + 1) * sizeof(field_offsets[0]));
+  memset(
+    num_halo_per_src_field, 0,
+    num_src_fields * sizeof(num_halo_per_src_field[0]));
+  for (size_t i = 0; i < halo_size; ++i) {
+    field_offsets[halo_points[i].field_idx + 1]++;
+    halo_points[i].reorder_idx = SIZE_MAX;
+  }
+  for (size_t i = 0; i < num_src_fields; ++i)
+    field_offsets[i + 1] += field_offsets[i];
+
+  for (size_t i = 0; i < num_links; ++i) {
+    if (src_field_idx[i] != SIZE_MAX) continue;
+    struct remote_point_info_reorder * curr_halo_point =
+      halo_points + src_idx[i];
+    size_t curr_field_idx = curr_halo_point->field_idx;
+    if (curr_halo_point->reorder_idx == SIZE_MAX)
+      curr_halo_point->reorder_idx =
+        num_halo_per_src_field[curr_field_idx]++;
+    src_idx[i] = field_offsets[curr_field_idx] + curr_halo_point->reorder_idx;
+  }
+
+  // all halo points are referenced by at least one stencil
+  for (size_t i = 0; i < num_src_fields; ++i)
+    YAC_ASSERT(
+      num_halo_per_src_field[i] == field_offsets[i + 1] - field_offsets[i],
+      "ERROR(reorder_halo_by_first_access): unreferenced halo point")
+}
+
 static void yac_interp_weights_redist_w_sum_mf(
   MPI_Comm comm, enum yac_location tgt_location,
   struct interp_weight_stencils_wsum_mf * wsum_mf_stencils_data,
@@ -3574,10 +3657,20 @@ static void yac_interp_weights_redist_w_sum_mf(
     }
   }
 
+  // renumber the halo points in the order in which they are first
+  // accessed while evaluating the stencils (within the block of each
+  // source field), such that the gather from the halo buffer during the
+  // interpolation becomes mostly sequential; the halo redists scatter the
+  // received data directly into this order
+  reorder_halo_by_first_access(
+    remote_src_points, halo_size, num_src_fields,
+    src_field_idx, src_idx, total_num_links);
+
   // generate halo redists (one per source field
   Xt_redist * halo_redists =
     generate_halo_redists(
-      remote_src_points, halo_size, num_src_fields, comm);
+      remote_src_points, halo_size, num_src_fields,
+      get_interp_field_datatype(interp), comm);
 
   YAC_ASSERT(
     (stencil_type == WEIGHT_SUM) ||
@@ -3596,7 +3689,7 @@ static void yac_interp_weights_redist_w_sum_mf(
       tgt_infos[i] = wsum_mf_stencils[i].tgt.data;
     Xt_redist result_redist =
       generate_redist_put_double(
-        tgt_location, tgt_infos, wsum_mf_count, comm);
+        tgt_location, tgt_infos, wsum_mf_count, interp, comm);
     free(tgt_infos);
 
     switch(stencil_type) {
@@ -3674,22 +3767,219 @@ static int compare_stencils(const void * a, const void * b) {
          (int)(((struct interp_weight_stencil *)b)->type);
 }
 
-struct interpolation * yac_interp_weights_get_interpolation(
-  struct interp_weights * weights, enum interp_weights_reorder_type reorder,
-  size_t collection_size, double frac_mask_fallback_value,
-  double scaling_factor, double scaling_summand) {
+// estimated cost of an additional message, given in the number of bytes
+// that could be transfered in the same time (latency * bandwidth)
+#define MAPPING_SIDE_MSG_COST_BYTES (16384)
 
-  MPI_Comm comm = weights->comm;
+// a single field value that has to be exchanged in each interpolation step
+struct exchange_item {
+  int dst_rank, src_rank;
+  size_t field_idx; // SIZE_MAX for the result of the mapping on the source
+  uint64_t orig_pos;
+};
+
+static int compare_exchange_item(const void * a, const void * b) {
+
+  struct exchange_item const * a_ = (struct exchange_item const *)a;
+  struct exchange_item const * b_ = (struct exchange_item const *)b;
+
+  int ret = (a_->dst_rank > b_->dst_rank) - (a_->dst_rank < b_->dst_rank);
+  if (ret) return ret;
+  ret = (a_->src_rank > b_->src_rank) - (a_->src_rank < b_->src_rank);
+  if (ret) return ret;
+  ret = (a_->field_idx > b_->field_idx) - (a_->field_idx < b_->field_idx);
+  if (ret) return ret;
+  return (a_->orig_pos > b_->orig_pos) - (a_->orig_pos < b_->orig_pos);
+}
+
+// counts the unique values and the number of messages (one per
+// source field and pair of processes) required to exchange the items
+static void count_exchange_items(
+  struct exchange_item * items, size_t count,
+  uint64_t * num_values, uint64_t * num_msgs) {
+
+  qsort(items, count, sizeof(*items), compare_exchange_item);
+
+  for (size_t i = 0; i < count; ++i) {
+    if ((i == 0) || compare_exchange_item(items + i - 1, items + i))
+      ++*num_values;
+    if ((i == 0) ||
+        (items[i-1].dst_rank != items[i].dst_rank) ||
+        (items[i-1].src_rank != items[i].src_rank) ||
+        (items[i-1].field_idx != items[i].field_idx))
+      ++*num_msgs;
+  }
+}
+
+// estimates the number of values and messages that have to be exchanged
+// in each interpolation step for both mapping sides
+// (the estimate is based on the local stencils only, values and messages
+//  that are required by stencils on multiple processes are counted
+//  multiple times)
+static void estimate_w_sum_mf_exchange(
+  struct interp_weight_stencils_wsum_mf * wsum_mf_stencils_data,
+  uint64_t * num_values, uint64_t * num_msgs, uint64_t * num_multi_tgt) {
+
+  struct interp_weight_stencil_wsum_mf * wsum_mf_stencils =
+    wsum_mf_stencils_data->data;
+  size_t count = wsum_mf_stencils_data->count;
+
+  size_t max_stencil_size = 0;
+  size_t num_items[2] = {0, 0};
+  for (size_t i = 0; i < count; ++i) {
+    size_t curr_stencil_size = wsum_mf_stencils[i].count;
+    size_t curr_num_tgt = (size_t)(wsum_mf_stencils[i].tgt.data.count);
+    if (curr_stencil_size > max_stencil_size)
+      max_stencil_size = curr_stencil_size;
+    if (curr_num_tgt > 1) ++*num_multi_tgt;
+    num_items[MAPPING_ON_SRC] += curr_stencil_size + curr_num_tgt;
+    num_items[MAPPING_ON_TGT] += curr_stencil_size * curr_num_tgt;
+  }
+
+  struct exchange_item * items =
+    xmalloc(
+      MAX(num_items[MAPPING_ON_SRC], num_items[MAPPING_ON_TGT]) *
+      sizeof(*items));
+  int * src_ranks = xmalloc(max_stencil_size * sizeof(*src_ranks));
+
+  // mapping on the source: the stencil is applied by the process owning
+  // most of its source points, which requires the remaining source points
+  // and sends the result to the target processes
+  size_t k = 0;
+  for (size_t i = 0; i < count; ++i) {
+    size_t curr_stencil_size = wsum_mf_stencils[i].count;
+    struct interp_weight_stencil_wsum_mf_weight * curr_weights =
+      wsum_mf_stencils[i].data;
+    if (curr_stencil_size == 0) continue;
+    for (size_t j = 0; j < curr_stencil_size; ++j)
+      src_ranks[j] = curr_weights[j].src.rank;
+    int owner = compute_owner(src_ranks, curr_stencil_size);
+    for (size_t j = 0; j < curr_stencil_size; ++j) {
+      if (curr_weights[j].src.rank == owner) continue;
+      items[k].dst_rank = owner;
+      items[k].src_rank = curr_weights[j].src.rank;
+      items[k].field_idx = curr_weights[j].src_field_idx;
+      items[k].orig_pos = curr_weights[j].src.orig_pos;
+      ++k;
+    }
+    int curr_num_tgt = wsum_mf_stencils[i].tgt.data.count;
+    struct remote_point_info * curr_tgts =
+      (curr_num_tgt == 1)?
+        &(wsum_mf_stencils[i].tgt.data.data.single):
+        wsum_mf_stencils[i].tgt.data.data.multi;
+    for (int j = 0; j < curr_num_tgt; ++j) {
+      if (curr_tgts[j].rank == owner) continue;
+      items[k].dst_rank = curr_tgts[j].rank;
+      items[k].src_rank = owner;
+      items[k].field_idx = SIZE_MAX;
+      items[k].orig_pos = curr_tgts[j].orig_pos;
+      ++k;
+    }
+  }
+  count_exchange_items(
+    items, k, num_values + MAPPING_ON_SRC, num_msgs + MAPPING_ON_SRC);
+
+  // mapping on the target: each target process requires all source
+  // points of its stencils that are not owned by itself
+  k = 0;
+  for (size_t i = 0; i < count; ++i) {
+    size_t curr_stencil_size = wsum_mf_stencils[i].count;
+    struct interp_weight_stencil_wsum_mf_weight * curr_weights =
+      wsum_mf_stencils[i].data;
+    int curr_num_tgt = wsum_mf_stencils[i].tgt.data.count;
+    struct remote_point_info * curr_tgts =
+      (curr_num_tgt == 1)?
+        &(wsum_mf_stencils[i].tgt.data.data.single):
+        wsum_mf_stencils[i].tgt.data.data.multi;
+    for (int j = 0; j < curr_num_tgt; ++j) {
+      for (size_t l = 0; l < curr_stencil_size; ++l) {
+        if (curr_weights[l].src.rank == curr_tgts[j].rank) continue;
+        items[k].dst_rank = curr_tgts[j].rank;
+        items[k].src_rank = curr_weights[l].src.rank;
+        items[k].field_idx = curr_weights[l].src_field_idx;
+        items[k].orig_pos = curr_weights[l].src.orig_pos;
+        ++k;
+      }
+    }
+  }
+  count_exchange_items(
+    items, k, num_values + MAPPING_ON_TGT, num_msgs + MAPPING_ON_TGT);
+
+  free(src_ranks);
+  free(items);
+}
+
+static enum interp_weights_reorder_type select_mapping_side(
+  struct interp_weights * weights, uint64_t * local_stencil_counts,
+  size_t * stencils_offsets, size_t collection_size,
+  int use_single_precision) {
+
+  // [0..1] number of values for MAPPING_ON_SRC and MAPPING_ON_TGT
+  // [2..3] number of messages for MAPPING_ON_SRC and MAPPING_ON_TGT
+  // [4]    number of stencils with multiple target points
+  uint64_t counts[5] = {0, 0, 0, 0, 0};
+
+  enum yac_interp_weight_stencil_type stencil_types[] =
+    {SUM, WEIGHT_SUM, SUM_MF, WEIGHT_SUM_MF};
+  for (size_t i = 0; i < sizeof(stencil_types) / sizeof(stencil_types[0]);
+       ++i) {
+
+    enum yac_interp_weight_stencil_type type = stencil_types[i];
+    if (local_stencil_counts[type] == 0) continue;
+
+    struct interp_weight_stencils_wsum_mf * wsum_stencils =
+      generate_w_sum_mf_stencils(
+        weights->stencils + stencils_offsets[type],
+        (size_t)(local_stencil_counts[type]), type);
+    estimate_w_sum_mf_exchange(
+      wsum_stencils, counts + 0, counts + 2, counts + 4);
+    for (size_t j = 0; j < wsum_stencils->count; ++j)
+      free_remote_point(wsum_stencils->data[j].tgt);
+    free(wsum_stencils->data);
+    free(wsum_stencils);
+  }
+
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, counts, 5, MPI_UINT64_T, MPI_SUM, weights->comm),
+    weights->comm);
+
+  size_t value_size =
+    collection_size * (use_single_precision?sizeof(float):sizeof(double));
+  double cost[2];
+  for (int i = 0; i < 2; ++i)
+    cost[i] = (double)counts[i] * (double)value_size +
+              (double)counts[2 + i] * (double)MAPPING_SIDE_MSG_COST_BYTES;
+
+  // the mapping on the target does not support target points that are
+  // located on multiple processes; if both sides are equally expensive,
+  // the default (source) is used
+  enum interp_weights_reorder_type reorder =
+    ((counts[4] == 0) && (cost[MAPPING_ON_TGT] < cost[MAPPING_ON_SRC]))?
+      MAPPING_ON_TGT:MAPPING_ON_SRC;
+
+  yac_setup_stats_add(
+    (reorder == MAPPING_ON_SRC)?
+      YAC_SETUP_COUNTER_NUM_AUTO_MAPPING_SRC:
+      YAC_SETUP_COUNTER_NUM_AUTO_MAPPING_TGT, 1);
+
+  return reorder;
+}
+
+// sorts the stencils by type and determines the local number of stencils
+// per type and the offset of the first stencil of each type
+static void get_stencil_type_counts(
+  struct interp_weights * weights,
+  uint64_t local_stencil_counts[WEIGHT_STENCIL_TYPE_SIZE],
+  size_t stencils_offsets[WEIGHT_STENCIL_TYPE_SIZE]) {
 
   // sort stencils by type
   qsort(weights->stencils, weights->stencils_size, sizeof(*(weights->stencils)),
         compare_stencils);
 
-  uint64_t local_stencil_counts[WEIGHT_STENCIL_TYPE_SIZE];
-  size_t stencils_offsets[WEIGHT_STENCIL_TYPE_SIZE];
-
   // count local number of stencils per type
-  memset(&(local_stencil_counts[0]), 0, sizeof(local_stencil_counts));
+  memset(local_stencil_counts, 0,
+         WEIGHT_STENCIL_TYPE_SIZE * sizeof(*local_stencil_counts));
   for (size_t i = 0; i < weights->stencils_size; ++i)
     local_stencil_counts[(int)(weights->stencils[i].type)]++;
 
@@ -3697,6 +3987,43 @@ struct interpolation * yac_interp_weights_get_interpolation(
     stencils_offsets[i] = accu;
     accu += local_stencil_counts[i];
   }
+}
+
+enum interp_weights_reorder_type yac_interp_weights_select_mapping_side(
+  struct interp_weights * weights, size_t collection_size,
+  int use_single_precision) {
+
+  uint64_t local_stencil_counts[WEIGHT_STENCIL_TYPE_SIZE];
+  size_t stencils_offsets[WEIGHT_STENCIL_TYPE_SIZE];
+  get_stencil_type_counts(weights, local_stencil_counts, stencils_offsets);
+
+  return
+    select_mapping_side(
+      weights, local_stencil_counts, stencils_offsets, collection_size,
+      use_single_precision);
+}
+
+struct interpolation * yac_interp_weights_get_interpolation(
+  struct interp_weights * weights, enum interp_weights_reorder_type reorder,
+  size_t collection_size, double frac_mask_fallback_value,
+  double scaling_factor, double scaling_summand) {
+
+  return
+    yac_interp_weights_get_interpolation_prec(
+      weights, reorder, collection_size, frac_mask_fallback_value,
+      scaling_factor, scaling_summand, 0);
+}
+
+struct interpolation * yac_interp_weights_get_interpolation_prec(
+  struct interp_weights * weights, enum interp_weights_reorder_type reorder,
+  size_t collection_size, double frac_mask_fallback_value,
+  double scaling_factor, double scaling_summand, int use_single_precision) {
+
+  MPI_Comm comm = weights->comm;
+
+  uint64_t local_stencil_counts[WEIGHT_STENCIL_TYPE_SIZE];
+  size_t stencils_offsets[WEIGHT_STENCIL_TYPE_SIZE];
+  get_stencil_type_counts(weights, local_stencil_counts, stencils_offsets);
 
   uint64_t global_stencil_counts[WEIGHT_STENCIL_TYPE_SIZE];
 
@@ -3718,10 +4045,20 @@ struct interpolation * yac_interp_weights_get_interpolation(
       "mismatching collection sizes")
   }
 
+  YAC_ASSERT(
+    (reorder == MAPPING_ON_SRC) || (reorder == MAPPING_ON_TGT) ||
+    (reorder == MAPPING_AUTO),
+    "ERROR(yac_interp_weights_get_interpolation): invalid reorder type")
+  if (reorder == MAPPING_AUTO)
+    reorder =
+      select_mapping_side(
+        weights, local_stencil_counts, stencils_offsets, collection_size,
+        use_single_precision);
+
   struct interpolation * interp =
-    yac_interpolation_new(
+    yac_interpolation_new_prec(
       collection_size, frac_mask_fallback_value,
-      scaling_factor, scaling_summand);
+      scaling_factor, scaling_summand, use_single_precision);
 
   if (global_stencil_counts[FIXED] > 0)
     yac_interp_weights_redist_fixed(
@@ -3813,13 +4150,97 @@ struct interpolation * yac_interp_weights_get_interpolation(
   return interp;
 }
 
+// removes the weights below the threshold from a single stencil and
+// returns the number of removed weights
+static size_t prune_stencil(
+  struct remote_points * srcs, double * w, size_t * field_indices,
+  double threshold) {
+
+  size_t count = srcs->count;
+
+  double max_abs_weight = 0.0, weight_sum = 0.0;
+  for (size_t i = 0; i < count; ++i) {
+    if (fabs(w[i]) > max_abs_weight) max_abs_weight = fabs(w[i]);
+    weight_sum += w[i];
+  }
+
+  double abs_threshold = threshold * max_abs_weight;
+  double pruned_weight_sum = 0.0;
+  size_t new_count = 0;
+  for (size_t i = 0; i < count; ++i)
+    if (fabs(w[i]) >= abs_threshold) {
+      pruned_weight_sum += w[i];
+      ++new_count;
+    }
+
+  // if there is nothing to prune or the sum of the weights cannot be
+  // preserved
+  if ((new_count == count) || (fabs(pruned_weight_sum) <= WEIGHT_TOL))
+    return 0;
+
+  double scale = weight_sum / pruned_weight_sum;
+  for (size_t i = 0, j = 0; i < count; ++i) {
+    if (fabs(w[i]) < abs_threshold) continue;
+    srcs->data[j] = srcs->data[i];
+    w[j] = w[i] * scale;
+    if (field_indices != NULL) field_indices[j] = field_indices[i];
+    ++j;
+  }
+  srcs->count = new_count;
+
+  return count - new_count;
+}
+
+size_t yac_interp_weights_prune(
+  struct interp_weights * weights, double threshold) {
+
+  YAC_ASSERT_F(
+    (threshold >= 0.0) && (threshold < 1.0),
+    "ERROR(yac_interp_weights_prune): "
+    "invalid threshold (%lf; has to be in the range [0.0,1.0))", threshold)
+
+  if (threshold == 0.0) return 0;
+
+  uint64_t num_pruned_links = 0;
+  for (size_t i = 0; i < weights->stencils_size; ++i) {
+    struct interp_weight_stencil * stencil = weights->stencils + i;
+    switch (stencil->type) {
+      case (WEIGHT_SUM):
+        num_pruned_links +=
+          (uint64_t)prune_stencil(
+            stencil->data.weight_sum.srcs, stencil->data.weight_sum.weights,
+            NULL, threshold);
+        break;
+      case (WEIGHT_SUM_MF):
+        num_pruned_links +=
+          (uint64_t)prune_stencil(
+            stencil->data.weight_sum_mf.srcs,
+            stencil->data.weight_sum_mf.weights,
+            stencil->data.weight_sum_mf.field_indices, threshold);
+        break;
+      default:
+        // stencils without weights are not modified
+        break;
+    };
+  }
+
+  yac_setup_stats_add(YAC_SETUP_COUNTER_NUM_PRUNED_LINKS, num_pruned_links);
+
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &num_pruned_links, 1, MPI_UINT64_T, MPI_SUM,
+      weights->comm), weights->comm);
+
+  return (size_t)num_pruned_links;
+}
+
 static void free_remote_points(struct remote_points * points) {
 
   free(points->data);
   free(points);
 }
 
-static void yac_interp_weight_stencils_delete(
+static void yac_interp_weight_stencils_delete_data(
   struct interp_weight_stencil * stencils, size_t count) {
 
   for (size_t i = 0 ; i < count; ++i) {
@@ -3863,48 +4284,229 @@ static void yac_interp_weight_stencils_delete(
     };
     free_remote_point(stencils[i].tgt);
   }
+}
+
+static void yac_interp_weight_stencils_delete(
+  struct interp_weight_stencil * stencils, size_t count) {
+
+  yac_interp_weight_stencils_delete_data(stencils, count);
   free(stencils);
 }
 
+static int compare_yac_int(const void * a, const void * b) {
+
+  yac_int const * a_ = a, * b_ = b;
+
+  return (*a_ > *b_) - (*b_ > *a_);
+}
+
+static inline int contains_id(
+  yac_int const * ids, size_t count, yac_int id) {
+
+  return
+    (count > 0) &&
+    (bsearch(&id, ids, count, sizeof(*ids), compare_yac_int) != NULL);
+}
+
+// checks whether a stencil references one of the provided source points
+static int stencil_uses_srcs(
+  struct interp_weight_stencil * stencil,
+  yac_int const * const * src_ids, size_t const * num_src_ids) {
+
+  struct remote_points * srcs = NULL;
+  size_t * field_indices = NULL;
+
+  switch (stencil->type) {
+    case (DIRECT):
+      return
+        contains_id(
+          src_ids[0], num_src_ids[0], stencil->data.direct.src.global_id);
+    case (DIRECT_MF): {
+      size_t field_idx = stencil->data.direct_mf.field_idx;
+      return
+        contains_id(
+          src_ids[field_idx], num_src_ids[field_idx],
+          stencil->data.direct_mf.src.global_id);
+    }
+    case (SUM):
+      srcs = stencil->data.sum.srcs;
+      break;
+    case (WEIGHT_SUM):
+      srcs = stencil->data.weight_sum.srcs;
+      break;
+    case (SUM_MF):
+      srcs = stencil->data.sum_mf.srcs;
+      field_indices = stencil->data.sum_mf.field_indices;
+      break;
+    case (WEIGHT_SUM_MF):
+      srcs = stencil->data.weight_sum_mf.srcs;
+      field_indices = stencil->data.weight_sum_mf.field_indices;
+      break;
+    default:
+    case (FIXED):
+      return 0;
+  };
+
+  for (size_t i = 0; i < srcs->count; ++i) {
+    size_t field_idx = (field_indices != NULL)?field_indices[i]:0;
+    if (contains_id(
+          src_ids[field_idx], num_src_ids[field_idx],
+          srcs->data[i].global_id)) return 1;
+  }
+  return 0;
+}
+
+size_t yac_interp_weights_remove_stencils(
+  struct interp_weights * weights,
+  yac_int const * tgt_ids, size_t num_tgt_ids,
+  yac_int const * const * src_ids, size_t const * num_src_ids,
+  yac_int ** removed_tgt_ids, struct remote_point_info ** removed_tgt_infos,
+  size_t * num_removed_tgt_infos) {
+
+  struct interp_weight_stencil * stencils = weights->stencils;
+  size_t stencils_size = weights->stencils_size;
+
+  yac_int * removed_ids = xmalloc(stencils_size * sizeof(*removed_ids));
+  struct remote_point_info * removed_infos = NULL;
+  size_t removed_infos_array_size = 0;
+  size_t num_removed = 0, num_removed_infos = 0, new_stencils_size = 0;
+
+  for (size_t i = 0; i < stencils_size; ++i) {
+
+    if (contains_id(tgt_ids, num_tgt_ids, stencils[i].tgt.global_id) ||
+        stencil_uses_srcs(stencils + i, src_ids, num_src_ids)) {
+
+      int curr_count = stencils[i].tgt.data.count;
+      struct remote_point_info * curr_infos =
+        (curr_count == 1)?
+          (&(stencils[i].tgt.data.data.single)):
+          (stencils[i].tgt.data.data.multi);
+      ENSURE_ARRAY_SIZE(
+        removed_infos, removed_infos_array_size,
+        num_removed_infos + (size_t)curr_count);
+      memcpy(removed_infos + num_removed_infos, curr_infos,
+             (size_t)curr_count * sizeof(*curr_infos));
+      num_removed_infos += (size_t)curr_count;
+
+      removed_ids[num_removed++] = stencils[i].tgt.global_id;
+      yac_interp_weight_stencils_delete_data(stencils + i, 1);
+
+    } else {
+
+      if (new_stencils_size != i)
+        stencils[new_stencils_size] = stencils[i];
+      ++new_stencils_size;
+    }
+  }
+
+  weights->stencils_size = new_stencils_size;
+  *removed_tgt_ids =
+    xrealloc(removed_ids, num_removed * sizeof(*removed_ids));
+  *removed_tgt_infos = removed_infos;
+  *num_removed_tgt_infos = num_removed_infos;
+
+  return num_removed;
+}
+
+struct interp_weights * yac_interp_weights_extract(
+  struct interp_weights * weights,
+  yac_int const * tgt_ids, size_t num_tgt_ids) {
+
+  struct interp_weights * extract =
+    yac_interp_weights_new(
+      weights->comm, weights->tgt_location, weights->src_locations,
+      weights->num_src_fields);
+
+  struct interp_weight_stencil * stencils = weights->stencils;
+  size_t stencils_size = weights->stencils_size;
+
+  size_t extract_size = 0;
+  for (size_t i = 0; i < stencils_size; ++i)
+    if (contains_id(tgt_ids, num_tgt_ids, stencils[i].tgt.global_id))
+      ++extract_size;
+
+  struct interp_weight_stencil * extract_stencils =
+    xmalloc(extract_size * sizeof(*extract_stencils));
+  for (size_t i = 0, j = 0; i < stencils_size; ++i)
+    if (contains_id(tgt_ids, num_tgt_ids, stencils[i].tgt.global_id))
+      extract_stencils[j++] =
+        copy_interp_weight_stencil(stencils + i, stencils[i].tgt);
+
+  extract->stencils = extract_stencils;
+  extract->stencils_array_size = extract_size;
+  extract->stencils_size = extract_size;
+
+  return extract;
+}
+
+void yac_interp_weights_append(
+  struct interp_weights * weights, struct interp_weights * other) {
+
+  YAC_ASSERT(
+    (weights->tgt_location == other->tgt_location) &&
+    (weights->num_src_fields == other->num_src_fields) &&
+    !memcmp(
+      weights->src_locations, other->src_locations,
+      weights->num_src_fields * sizeof(*(weights->src_locations))),
+    "ERROR(yac_interp_weights_append): inconsistent fields")
+
+  struct interp_weight_stencil * stencils = weights->stencils;
+  size_t stencils_array_size = weights->stencils_array_size;
+  size_t stencils_size = weights->stencils_size;
+
+  ENSURE_ARRAY_SIZE(
+    stencils, stencils_array_size, stencils_size + other->stencils_size);
+  memcpy(stencils + stencils_size, other->stencils,
+         other->stencils_size * sizeof(*stencils));
+
+  weights->stencils = stencils;
+  weights->stencils_array_size = stencils_array_size;
+  weights->stencils_size = stencils_size + other->stencils_size;
+
+  free(other->stencils);
+  free(other->src_locations);
+  free(other);
+}
+
 static int compare_double(void const * a, void const * b) {
 
   return (*(double const *)a > *(double const *)b) -
          (*(double const *)a < *(double const *)b);
 }
 
+#ifdef YAC_NETCDF_ENABLED
+
 /**
- * create a weight file with basic meta data
+ * computes the number of entries of a target index for data that
+ * is split into multiple parts (source fields or fixed values)
  */
-static void create_weight_file(
-  char const * filename, char const * src_grid_name, char const * tgt_grid_name,
+static size_t get_tgt_index_size(size_t const * counts, size_t num_parts) {
+
+  size_t index_size = 0;
+  for (size_t i = 0; i < num_parts; ++i)
+    index_size +=
+      (counts[i] + WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE - 1) /
+      WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE;
+  return index_size;
+}
+
+/**
+ * defines dimensions, variables and attributes of a weight file and
+ * (if put_basic_data is set) writes the basic meta data
+ * @remark if link_chunk_size is non-zero, the link data is stored in chunks
+ *         of up to link_chunk_size links (requires NetCDF-4 file format)
+ * @remark if with_tgt_index is set, the variables for the target index
+ *         (see write_tgt_index) are defined as well
+ */
+static void define_weight_file(
+  int ncid, char const * filename,
+  char const * src_grid_name, char const * tgt_grid_name,
   size_t num_fixed_values, double * fixed_values,
   size_t * num_tgt_per_fixed_value, size_t num_links,
   size_t num_weights_per_link, size_t num_src_fields,
   size_t * num_links_per_src_field,
-  enum yac_location * src_locations, enum yac_location tgt_location) {
-
-#ifndef YAC_NETCDF_ENABLED
-
-  UNUSED(filename);
-  UNUSED(src_grid_name);
-  UNUSED(tgt_grid_name);
-  UNUSED(num_fixed_values);
-  UNUSED(fixed_values);
-  UNUSED(num_links);
-  UNUSED(num_weights_per_link);
-  UNUSED(num_tgt_per_fixed_value);
-  UNUSED(num_src_fields);
-  UNUSED(num_links_per_src_field);
-  UNUSED(src_locations);
-  UNUSED(tgt_location);
-  die("ERROR(create_weight_file): NETCDF not available");
-
-#else
-
-  int ncid;
-
-  // create file
-  yac_nc_create(filename, NC_CLOBBER, &ncid);
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  size_t link_chunk_size, int with_tgt_index, int put_basic_data) {
 
   int dim_weight_id[6];
 
@@ -3913,14 +4515,14 @@ static void create_weight_file(
     HANDLE_ERROR(nc_def_dim(ncid, "num_links", num_links, &dim_weight_id[0]));
     YAC_ASSERT_F(
       num_weights_per_link > 0,
-      "ERROR(create_weight_file): number of links is %zu but number of "
+      "ERROR(define_weight_file): number of links is %zu but number of "
       "weights per link is zero for weight file %s", num_links, filename)
     HANDLE_ERROR(
       nc_def_dim(ncid, "num_wgts", num_weights_per_link, &dim_weight_id[1]));
   }
   YAC_ASSERT_F(
     num_src_fields > 0,
-    "ERROR(create_weight_file): number of source fields is zero for "
+    "ERROR(define_weight_file): number of source fields is zero for "
     "weight file %s", filename)
   HANDLE_ERROR(
     nc_def_dim(ncid, "num_src_fields", num_src_fields, &dim_weight_id[2]));
@@ -3937,7 +4539,7 @@ static void create_weight_file(
       num_fixed_dst += num_tgt_per_fixed_value[i];
     YAC_ASSERT_F(
       num_fixed_dst > 0,
-      "ERROR(create_weight_file): number of fixed values is %zu but number "
+      "ERROR(define_weight_file): number of fixed values is %zu but number "
       "of fixed destination points is zero for weight file %s",
       num_fixed_dst, filename)
     HANDLE_ERROR(
@@ -3962,6 +4564,31 @@ static void create_weight_file(
     HANDLE_ERROR(
       nc_def_var(ncid, "num_links_per_src_field", NC_INT, 1,
                  &dim_weight_id[2], &var_num_links_id));
+    if (link_chunk_size > 0) {
+      size_t chunk_sizes[2] =
+        {MIN(link_chunk_size, num_links), num_weights_per_link};
+      HANDLE_ERROR(
+        nc_def_var_chunking(ncid, var_src_add_id, NC_CHUNKED, chunk_sizes));
+      HANDLE_ERROR(
+        nc_def_var_chunking(ncid, var_dst_add_id, NC_CHUNKED, chunk_sizes));
+      HANDLE_ERROR(
+        nc_def_var_chunking(ncid, var_weight_id, NC_CHUNKED, chunk_sizes));
+    }
+    if (with_tgt_index) {
+      int dim_index_id, var_index_id;
+      int block_size = (int)WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE;
+      HANDLE_ERROR(
+        nc_def_dim(
+          ncid, "num_dst_index",
+          get_tgt_index_size(num_links_per_src_field, num_src_fields),
+          &dim_index_id));
+      HANDLE_ERROR(
+        nc_def_var(
+          ncid, "dst_address_index", NC_INT, 1, &dim_index_id, &var_index_id));
+      HANDLE_ERROR(
+        nc_put_att_int(
+          ncid, var_index_id, "block_size", NC_INT, 1, &block_size));
+    }
   }
   HANDLE_ERROR(
     nc_def_var(
@@ -3979,6 +4606,31 @@ static void create_weight_file(
     HANDLE_ERROR(
       nc_def_var(ncid, "dst_address_fixed", NC_INT, 1, &dim_weight_id[5],
                  &var_dst_add_fixed_id));
+    if (link_chunk_size > 0) {
+      size_t num_fixed_dst = 0;
+      for (size_t i = 0; i < num_fixed_values; ++i)
+        num_fixed_dst += num_tgt_per_fixed_value[i];
+      size_t chunk_size = MIN(link_chunk_size, num_fixed_dst);
+      HANDLE_ERROR(
+        nc_def_var_chunking(
+          ncid, var_dst_add_fixed_id, NC_CHUNKED, &chunk_size));
+    }
+    if (with_tgt_index) {
+      int dim_index_id, var_index_id;
+      int block_size = (int)WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE;
+      HANDLE_ERROR(
+        nc_def_dim(
+          ncid, "num_dst_fixed_index",
+          get_tgt_index_size(num_tgt_per_fixed_value, num_fixed_values),
+          &dim_index_id));
+      HANDLE_ERROR(
+        nc_def_var(
+          ncid, "dst_address_fixed_index", NC_INT, 1, &dim_index_id,
+          &var_index_id));
+      HANDLE_ERROR(
+        nc_put_att_int(
+          ncid, var_index_id, "block_size", NC_INT, 1, &block_size));
+    }
   }
 
   // put attributes
@@ -4005,6 +4657,8 @@ static void create_weight_file(
   // end definition
   HANDLE_ERROR(nc_enddef(ncid));
 
+  if (!put_basic_data) return;
+
   // write some basic data
 
   if (num_links > 0) {
@@ -4013,7 +4667,7 @@ static void create_weight_file(
     for (size_t i = 0; i < num_src_fields; ++i) {
       YAC_ASSERT(
         num_links_per_src_field[i] <= INT_MAX,
-        "ERROR(create_weight_file): "
+        "ERROR(define_weight_file): "
         "number of links per source field too big (not yet supported)")
       num_links_per_src_field_int[i] = (int)num_links_per_src_field[i];
     }
@@ -4044,7 +4698,7 @@ static void create_weight_file(
     for (unsigned i = 0; i < num_fixed_values; ++i) {
       YAC_ASSERT(
         num_tgt_per_fixed_value[i] <= INT_MAX,
-        "ERROR(create_weight_file): "
+        "ERROR(define_weight_file): "
         "number of targets per fixed value is too big (not yet supported)")
       num_tgt_per_fixed_value_int[i] = (int)num_tgt_per_fixed_value[i];
     }
@@ -4053,12 +4707,187 @@ static void create_weight_file(
                                 num_tgt_per_fixed_value_int));
     free(num_tgt_per_fixed_value_int);
   }
+}
+
+/**
+ * create a weight file with basic meta data
+ */
+static void create_weight_file(
+  char const * filename, char const * src_grid_name, char const * tgt_grid_name,
+  size_t num_fixed_values, double * fixed_values,
+  size_t * num_tgt_per_fixed_value, size_t num_links,
+  size_t num_weights_per_link, size_t num_src_fields,
+  size_t * num_links_per_src_field,
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  int with_tgt_index) {
+
+  int ncid;
+
+  // create file
+  yac_nc_create(filename, NC_CLOBBER, &ncid);
+
+  define_weight_file(
+    ncid, filename, src_grid_name, tgt_grid_name,
+    num_fixed_values, fixed_values, num_tgt_per_fixed_value, num_links,
+    num_weights_per_link, num_src_fields, num_links_per_src_field,
+    src_locations, tgt_location, 0, with_tgt_index, 1);
 
   // close file
   HANDLE_ERROR(nc_close(ncid));
-#endif // YAC_NETCDF_ENABLED
 }
 
+/**
+ * collectively creates a NetCDF-4 weight file with basic meta data, which
+ * stays open for parallel writing of the link data
+ * @remark the basic meta data is written by the last process of io_comm
+ */
+static void create_weight_file_par(
+  char const * filename, char const * src_grid_name, char const * tgt_grid_name,
+  size_t num_fixed_values, double * fixed_values,
+  size_t * num_tgt_per_fixed_value, size_t num_links,
+  size_t num_weights_per_link, size_t num_src_fields,
+  size_t * num_links_per_src_field,
+  enum yac_location * src_locations, enum yac_location tgt_location,
+  int with_tgt_index, MPI_Comm io_comm, int * ncid) {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(io_comm, &comm_rank), io_comm);
+  yac_mpi_call(MPI_Comm_size(io_comm, &comm_size), io_comm);
+
+  // create file
+  yac_nc_create_par(filename, NC_CLOBBER | NC_NETCDF4, io_comm, ncid);
+
+  // all data is written explicitly, no need for pre-filling the variables
+  HANDLE_ERROR(nc_set_fill(*ncid, NC_NOFILL, NULL));
+
+  define_weight_file(
+    *ncid, filename, src_grid_name, tgt_grid_name,
+    num_fixed_values, fixed_values, num_tgt_per_fixed_value, num_links,
+    num_weights_per_link, num_src_fields, num_links_per_src_field,
+    src_locations, tgt_location, WEIGHT_FILE_LINK_CHUNK_SIZE,
+    with_tgt_index, comm_rank == comm_size - 1);
+}
+
+/**
+ * switches a variable to collective access (only relevant for files
+ * opened for parallel access)
+ */
+static void set_collective_access(int ncid, int varid) {
+
+#ifdef YAC_NETCDF_PARALLEL_ENABLED
+  HANDLE_ERROR(nc_var_par_access(ncid, varid, NC_COLLECTIVE));
+#else
+  UNUSED(ncid);
+  UNUSED(varid);
+#endif
+}
+
+/**
+ * writes the local part of a target index
+ *
+ * The data in a weight file is split into multiple parts (source fields or
+ * fixed values). Within each part, the entries are sorted by their target
+ * address. For each block of WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE entries of a
+ * part, the index contains the target address of the first entry of the
+ * block. This allows readers to determine the blocks containing the data
+ * of their target points without reading the complete target addresses.
+ * @param[in] ncid          id of the weight file
+ * @param[in] var_name      name of the index variable
+ * @param[in] num_parts     number of parts
+ * @param[in] local_counts  local number of entries per part
+ * @param[in] offsets       file offsets of the local entries per part
+ * @param[in] total_counts  global number of entries per part
+ * @param[in] tgt_address   target addresses of all local entries
+ * @param[in] collective    if set, the index is written using collective
+ *                          operations
+ */
+static void write_tgt_index(
+  int ncid, char const * var_name, size_t num_parts,
+  size_t const * local_counts, size_t const * offsets,
+  size_t const * total_counts, int const * tgt_address, int collective) {
+
+  int var_index_id;
+  yac_nc_inq_varid(ncid, var_name, &var_index_id);
+  if (collective) set_collective_access(ncid, var_index_id);
+
+  size_t const block_size = WEIGHT_FILE_TGT_INDEX_BLOCK_SIZE;
+
+  size_t max_local_count = 0;
+  for (size_t i = 0; i < num_parts; ++i)
+    if (local_counts[i] > max_local_count) max_local_count = local_counts[i];
+  int * index = xmalloc((max_local_count / block_size + 1) * sizeof(*index));
+
+  for (size_t i = 0, part_offset = 0, index_offset = 0, local_offset = 0;
+       i < num_parts; ++i) {
+
+    // range of the local entries within the current part
+    size_t begin = offsets[i] - part_offset;
+    size_t end = begin + local_counts[i];
+
+    // indexed blocks that start within the local range
+    size_t begin_block = (begin + block_size - 1) / block_size;
+    size_t end_block = (end + block_size - 1) / block_size;
+
+    for (size_t j = begin_block; j < end_block; ++j)
+      index[j - begin_block] =
+        tgt_address[local_offset + j * block_size - begin];
+
+    if ((end_block > begin_block) || (collective && (total_counts[i] > 0))) {
+      size_t start[1] = {index_offset + begin_block};
+      size_t count[1] = {end_block - begin_block};
+      HANDLE_ERROR(
+        nc_put_vara_int(ncid, var_index_id, start, count, index));
+    }
+
+    part_offset += total_counts[i];
+    index_offset += (total_counts[i] + block_size - 1) / block_size;
+    local_offset += local_counts[i];
+  }
+
+  free(index);
+}
+
+/**
+ * checks whether the target ids of the stencils of all io processes are
+ * ordered by the rank of the process in io_comm (in this case the entries
+ * of each part of the weight file are sorted by their target address, which
+ * is a requirement for the target index)
+ * @remark the local stencils have to be sorted by compare_interp_weight_stencil
+ */
+static int check_io_stencils_tgt_order(
+  struct interp_weight_stencil * stencils, size_t stencil_count,
+  MPI_Comm io_comm) {
+
+  int comm_size;
+  yac_mpi_call(MPI_Comm_size(io_comm, &comm_size), io_comm);
+
+  yac_int min_max[2] = {XT_INT_MAX, XT_INT_MIN};
+  for (size_t i = 0; i < stencil_count; ++i) {
+    yac_int curr_id = stencils[i].tgt.global_id;
+    if (curr_id < min_max[0]) min_max[0] = curr_id;
+    if (curr_id > min_max[1]) min_max[1] = curr_id;
+  }
+
+  yac_int * all_min_max =
+    xmalloc(2 * (size_t)comm_size * sizeof(*all_min_max));
+  yac_mpi_call(
+    MPI_Allgather(
+      min_max, 2, yac_int_dt, all_min_max, 2, yac_int_dt, io_comm), io_comm);
+
+  int is_ordered = 1;
+  yac_int prev_max = XT_INT_MIN;
+  for (int i = 0; (i < comm_size) && is_ordered; ++i) {
+    // skip processes without stencils
+    if (all_min_max[2*i+0] > all_min_max[2*i+1]) continue;
+    is_ordered = prev_max < all_min_max[2*i+0];
+    prev_max = all_min_max[2*i+1];
+  }
+  free(all_min_max);
+
+  return is_ordered;
+}
+#endif // YAC_NETCDF_ENABLED
+
 static int compare_interp_weight_stencil(const void * a, const void * b) {
 
   int a_is_fixed = (((struct interp_weight_stencil *)a)->type == FIXED);
@@ -4464,6 +5293,12 @@ void yac_interp_weights_write_to_file(
   struct interp_weights * weights, char const * filename,
   char const * src_grid_name, char const * tgt_grid_name) {
 
+  if (yac_binary_weight_file_check_suffix(filename)) {
+    yac_interp_weights_write_to_binary_file(
+      weights, filename, src_grid_name, tgt_grid_name, NULL, 0);
+    return;
+  }
+
 #ifndef YAC_NETCDF_ENABLED
 
   UNUSED(weights);
@@ -4559,61 +5394,86 @@ void yac_interp_weights_write_to_file(
     num_src_fields, num_links_per_src_field,
     fixed_offsets, link_offsets, io_comm);
 
-  if (comm_rank == comm_size - 1) {
+  // determine global counts
+  size_t * total_num_tgt_per_fixed_value =
+    xmalloc((num_fixed_values + num_src_fields) *
+            sizeof(*total_num_tgt_per_fixed_value));
+  size_t * total_num_links_per_src_field =
+    total_num_tgt_per_fixed_value + num_fixed_values;
+  memcpy(total_num_tgt_per_fixed_value, num_tgt_per_fixed_value,
+         num_fixed_values * sizeof(*num_tgt_per_fixed_value));
+  memcpy(total_num_links_per_src_field, num_links_per_src_field,
+         num_src_fields * sizeof(*num_links_per_src_field));
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, total_num_tgt_per_fixed_value,
+      (int)(num_fixed_values + num_src_fields), YAC_MPI_SIZE_T, MPI_SUM,
+      io_comm), comm);
+  size_t total_num_fixed_tgt = 0;
+  for (size_t i = 0; i < num_fixed_values; ++i)
+    total_num_fixed_tgt += total_num_tgt_per_fixed_value[i];
+  size_t total_num_links = 0;
+  for (size_t i = 0; i < num_src_fields; ++i)
+    total_num_links += total_num_links_per_src_field[i];
 
-    size_t * total_num_tgt_per_fixed_value =
-      xmalloc(num_fixed_values * sizeof(*total_num_tgt_per_fixed_value));
-    for (size_t i = 0, accu = 0; i < num_fixed_values; ++i) {
-      total_num_tgt_per_fixed_value[i] =
-        fixed_offsets[i] + num_tgt_per_fixed_value[i] - accu;
-      accu += total_num_tgt_per_fixed_value[i];
-    }
-    size_t total_num_links = link_offsets[num_src_fields-1] +
-                             num_links_per_src_field[num_src_fields-1];
-
-    size_t * total_num_links_per_src_field =
-      xmalloc(num_src_fields * sizeof(*total_num_links_per_src_field));
-    for (size_t i = 0, accu = 0; i < num_src_fields; ++i) {
-      total_num_links_per_src_field[i] =
-        link_offsets[i] + num_links_per_src_field[i] - accu;
-      accu += total_num_links_per_src_field[i];
-    }
+  // in parallel mode, all io processes collectively create the file and
+  // write the link data using collective operations
+  int parallel_netcdf = yac_get_io_parallel_netcdf(io_comm);
+
+  // the target index can only be generated if the data in the file will
+  // be sorted by target ids
+  int with_tgt_index =
+    check_io_stencils_tgt_order(io_stencils, io_stencil_count, io_comm);
+
+  int ncid;
 
-    create_weight_file(
+  if (parallel_netcdf) {
+
+    create_weight_file_par(
       filename, src_grid_name, tgt_grid_name,
       num_fixed_values, fixed_values, total_num_tgt_per_fixed_value,
       total_num_links, num_weights_per_link,
       num_src_fields, total_num_links_per_src_field,
-      weights->src_locations, weights->tgt_location);
+      weights->src_locations, weights->tgt_location, with_tgt_index,
+      io_comm, &ncid);
 
-    free(total_num_links_per_src_field);
-    free(total_num_tgt_per_fixed_value);
-  }
-  free(fixed_values);
+  } else {
 
-  // ensure that the basic weight file has been written
-  yac_mpi_call(MPI_Barrier(io_comm), comm);
-  yac_mpi_call(MPI_Comm_free(&io_comm), comm);
+    if (comm_rank == comm_size - 1)
+      create_weight_file(
+        filename, src_grid_name, tgt_grid_name,
+        num_fixed_values, fixed_values, total_num_tgt_per_fixed_value,
+        total_num_links, num_weights_per_link,
+        num_src_fields, total_num_links_per_src_field,
+        weights->src_locations, weights->tgt_location, with_tgt_index);
 
-  int ncid;
+    // ensure that the basic weight file has been written
+    yac_mpi_call(MPI_Barrier(io_comm), comm);
 
-  // open weight file
-  yac_nc_open(filename, NC_WRITE | NC_SHARE, &ncid);
+    // open weight file
+    yac_nc_open(filename, NC_WRITE | NC_SHARE, &ncid);
+  }
+  free(fixed_values);
 
-  if (num_fixed_tgt > 0) {
+  // in parallel mode, each io process has to take part in all write
+  // operations, even if it does not contribute any data to it
+  if ((num_fixed_tgt > 0) || (parallel_netcdf && (total_num_fixed_tgt > 0))) {
 
     int * tgt_address_fixed =
-      xmalloc(num_fixed_tgt * sizeof(*tgt_address_fixed));
+      xmalloc(MAX(num_fixed_tgt, 1) * sizeof(*tgt_address_fixed));
     stencil_get_tgt_address(io_stencils, num_fixed_tgt, tgt_address_fixed);
 
     // inquire variable ids
     int var_dst_add_fixed_id;
     yac_nc_inq_varid(ncid, "dst_address_fixed", &var_dst_add_fixed_id);
+    if (parallel_netcdf) set_collective_access(ncid, var_dst_add_fixed_id);
 
     // target ids that receive a fixed value to file
     for (size_t i = 0, offset = 0; i < num_fixed_values; ++i) {
 
-      if (num_tgt_per_fixed_value[i] == 0) continue;
+      if ((parallel_netcdf?
+             total_num_tgt_per_fixed_value[i]:
+             num_tgt_per_fixed_value[i]) == 0) continue;
 
       size_t start[1] = {fixed_offsets[i]};
       size_t count[1] = {num_tgt_per_fixed_value[i]};
@@ -4623,14 +5483,23 @@ void yac_interp_weights_write_to_file(
       offset += num_tgt_per_fixed_value[i];
     }
 
+    if (with_tgt_index)
+      write_tgt_index(
+        ncid, "dst_address_fixed_index", num_fixed_values,
+        num_tgt_per_fixed_value, fixed_offsets, total_num_tgt_per_fixed_value,
+        tgt_address_fixed, parallel_netcdf);
+
     free(tgt_address_fixed);
   }
 
-  if (num_links > 0) {
+  if ((num_links > 0) || (parallel_netcdf && (total_num_links > 0))) {
 
-    int * src_address_link = xmalloc(num_links * sizeof(*src_address_link));
-    int * tgt_address_link = xmalloc(num_links * sizeof(*tgt_address_link));
-    double * w = xmalloc(num_links * num_weights_per_link * sizeof(*w));
+    int * src_address_link =
+      xmalloc(MAX(num_links, 1) * sizeof(*src_address_link));
+    int * tgt_address_link =
+      xmalloc(MAX(num_links, 1) * sizeof(*tgt_address_link));
+    double * w =
+      xmalloc(MAX(num_links * num_weights_per_link, 1) * sizeof(*w));
     stencil_get_link_data(
       io_stencils + num_fixed_tgt, io_stencil_count - num_fixed_tgt,
       num_links_per_src_field, num_src_fields,
@@ -4640,10 +5509,17 @@ void yac_interp_weights_write_to_file(
     yac_nc_inq_varid(ncid, "src_address", &var_src_add_id);
     yac_nc_inq_varid(ncid, "dst_address", &var_dst_add_id);
     yac_nc_inq_varid(ncid, "remap_matrix", &var_weight_id);
+    if (parallel_netcdf) {
+      set_collective_access(ncid, var_src_add_id);
+      set_collective_access(ncid, var_dst_add_id);
+      set_collective_access(ncid, var_weight_id);
+    }
 
     for (size_t i = 0, offset = 0; i < num_src_fields; ++i) {
 
-      if (num_links_per_src_field[i] == 0) continue;
+      if ((parallel_netcdf?
+             total_num_links_per_src_field[i]:
+             num_links_per_src_field[i]) == 0) continue;
 
       size_t start[2] = {link_offsets[i], 0};
       size_t count[2] = {num_links_per_src_field[i], num_weights_per_link};
@@ -4662,6 +5538,12 @@ void yac_interp_weights_write_to_file(
       offset += num_links_per_src_field[i];
     }
 
+    if (with_tgt_index)
+      write_tgt_index(
+        ncid, "dst_address_index", num_src_fields,
+        num_links_per_src_field, link_offsets, total_num_links_per_src_field,
+        tgt_address_link, parallel_netcdf);
+
     free(w);
     free(tgt_address_link);
     free(src_address_link);
@@ -4669,15 +5551,360 @@ void yac_interp_weights_write_to_file(
 
   // close weight file
   HANDLE_ERROR(nc_close(ncid));
+  yac_mpi_call(MPI_Comm_free(&io_comm), comm);
 
   // ensure that the writing of the weight file is complete
   yac_mpi_call(MPI_Barrier(comm), comm);
 
+  free(total_num_tgt_per_fixed_value);
   free(size_t_buffer);
   yac_interp_weight_stencils_delete(io_stencils, io_stencil_count);
 #endif
 }
 
+struct binary_link_data {
+  int64_t src;
+  uint64_t src_field_idx;
+  double weight;
+};
+
+static int compare_binary_link_data(const void * a, const void * b) {
+
+  struct binary_link_data const * link_a = (struct binary_link_data const *)a;
+  struct binary_link_data const * link_b = (struct binary_link_data const *)b;
+
+  int ret = (link_a->src_field_idx > link_b->src_field_idx) -
+            (link_a->src_field_idx < link_b->src_field_idx);
+  if (ret) return ret;
+  return (link_a->src > link_b->src) - (link_a->src < link_b->src);
+}
+
+static size_t stencil_get_num_links(
+  struct interp_weight_stencil * stencil, size_t num_src_fields) {
+
+  size_t num_links = 0;
+  for (size_t i = 0; i < num_src_fields; ++i)
+    num_links += get_num_links_per_src_field(stencil, i);
+  return num_links;
+}
+
+// gets the links of the stencils in the order of the binary weight file
+// (sorted by target global id, source field index, and source global id;
+//  the stencils have to be sorted by target global id)
+static void stencil_get_binary_link_data(
+  struct interp_weight_stencil * stencils, size_t stencil_count,
+  size_t num_src_fields, int64_t * tgt_ids, int64_t * src_ids,
+  uint64_t * src_field_indices, double * weights) {
+
+  struct binary_link_data * links = NULL;
+  size_t links_array_size = 0;
+
+  struct interp_weight_stencil * curr_stencil = stencils;
+  for (size_t i = 0, offset = 0; i < stencil_count; ++i, ++curr_stencil) {
+
+    size_t curr_num_links =
+      stencil_get_num_links(curr_stencil, num_src_fields);
+    ENSURE_ARRAY_SIZE(links, links_array_size, curr_num_links);
+
+    YAC_ASSERT(
+      curr_stencil->type != FIXED,
+      "ERROR(stencil_get_binary_link_data): "
+      "this call is invalid for FIXED stencils")
+    YAC_ASSERT(
+      (curr_stencil->type == DIRECT) ||
+      (curr_stencil->type == SUM) ||
+      (curr_stencil->type == WEIGHT_SUM) ||
+      (curr_stencil->type == DIRECT_MF) ||
+      (curr_stencil->type == SUM_MF) ||
+      (curr_stencil->type == WEIGHT_SUM_MF),
+      "ERROR(stencil_get_binary_link_data): invalid stencil type")
+    switch (curr_stencil->type) {
+      default:
+      case(DIRECT):
+        links[0].src = (int64_t)(curr_stencil->data.direct.src.global_id);
+        links[0].src_field_idx = 0;
+        links[0].weight = 1.0;
+        break;
+      case(SUM): {
+        struct remote_point * srcs = curr_stencil->data.sum.srcs->data;
+        for (size_t k = 0; k < curr_num_links; ++k) {
+          links[k].src = (int64_t)(srcs[k].global_id);
+          links[k].src_field_idx = 0;
+          links[k].weight = 1.0;
+        }
+        break;
+      }
+      case(WEIGHT_SUM): {
+        struct remote_point * srcs = curr_stencil->data.weight_sum.srcs->data;
+        double * w = curr_stencil->data.weight_sum.weights;
+        for (size_t k = 0; k < curr_num_links; ++k) {
+          links[k].src = (int64_t)(srcs[k].global_id);
+          links[k].src_field_idx = 0;
+          links[k].weight = w[k];
+        }
+        break;
+      }
+      case(DIRECT_MF):
+        links[0].src = (int64_t)(curr_stencil->data.direct_mf.src.global_id);
+        links[0].src_field_idx =
+          (uint64_t)(curr_stencil->data.direct_mf.field_idx);
+        links[0].weight = 1.0;
+        break;
+      case(SUM_MF): {
+        struct remote_point * srcs = curr_stencil->data.sum_mf.srcs->data;
+        size_t * field_indices = curr_stencil->data.sum_mf.field_indices;
+        for (size_t k = 0; k < curr_num_links; ++k) {
+          links[k].src = (int64_t)(srcs[k].global_id);
+          links[k].src_field_idx = (uint64_t)(field_indices[k]);
+          links[k].weight = 1.0;
+        }
+        break;
+      }
+      case(WEIGHT_SUM_MF): {
+        struct remote_point * srcs =
+          curr_stencil->data.weight_sum_mf.srcs->data;
+        double * w = curr_stencil->data.weight_sum_mf.weights;
+        size_t * field_indices = curr_stencil->data.weight_sum_mf.field_indices;
+        for (size_t k = 0; k < curr_num_links; ++k) {
+          links[k].src = (int64_t)(srcs[k].global_id);
+          links[k].src_field_idx = (uint64_t)(field_indices[k]);
+          links[k].weight = w[k];
+        }
+        break;
+      }
+    };
+
+    qsort(links, curr_num_links, sizeof(*links), compare_binary_link_data);
+
+    for (size_t k = 0; k < curr_num_links; ++k, ++offset) {
+      tgt_ids[offset] = (int64_t)(curr_stencil->tgt.global_id);
+      src_ids[offset] = links[k].src;
+      src_field_indices[offset] = links[k].src_field_idx;
+      weights[offset] = links[k].weight;
+    }
+  }
+  free(links);
+}
+
+// maximum number of bytes written by a single MPI-IO call
+#define BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE ((size_t)1 << 30)
+
+// writes a section of the binary weight file (non-collective)
+static void write_binary_section(
+  MPI_File file, uint64_t offset, void const * data, size_t size,
+  MPI_Comm comm) {
+
+  unsigned char const * data_ = data;
+  for (size_t written = 0; written < size;) {
+    size_t count = size - written;
+    if (count > BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE)
+      count = BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE;
+    yac_mpi_call(
+      MPI_File_write_at(
+        file, (MPI_Offset)(offset + written), (void*)(data_ + written),
+        (int)count, MPI_BYTE, MPI_STATUS_IGNORE), comm);
+    written += count;
+  }
+}
+
+// writes a section of the binary weight file (collective; sections larger
+// than BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE are written in multiple steps,
+// all processes do the same number of steps)
+static void write_binary_section_all(
+  MPI_File file, uint64_t offset, void const * data, size_t size,
+  MPI_Comm comm) {
+
+  uint64_t num_chunks =
+    (uint64_t)((size + BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE - 1) /
+               BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE);
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &num_chunks, 1, MPI_UINT64_T, MPI_MAX, comm), comm);
+
+  unsigned char const * data_ = data;
+  size_t written = 0;
+  for (uint64_t i = 0; i < num_chunks; ++i) {
+    size_t count = size - written;
+    if (count > BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE)
+      count = BINARY_WEIGHT_FILE_WRITE_CHUNK_SIZE;
+    yac_mpi_call(
+      MPI_File_write_at_all(
+        file, (MPI_Offset)(offset + written),
+        (void*)(data_ + written), (int)count, MPI_BYTE, MPI_STATUS_IGNORE), comm);
+    written += count;
+  }
+}
+
+void yac_interp_weights_write_to_binary_file(
+  struct interp_weights * weights, char const * filename,
+  char const * src_grid_name, char const * tgt_grid_name,
+  void const * key, size_t key_size) {
+
+  MPI_Comm comm = weights->comm;
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  size_t stencil_count = weights->stencils_size;
+  size_t num_src_fields = weights->num_src_fields;
+
+  // sort a copy of the local stencils first by type (fixed first; fixed
+  // stencils are sorted by their fixed value) and second by tgt id
+  struct interp_weight_stencil * stencils =
+    xmalloc(stencil_count * sizeof(*stencils));
+  memcpy(stencils, weights->stencils, stencil_count * sizeof(*stencils));
+  qsort(stencils, stencil_count, sizeof(*stencils),
+        compare_interp_weight_stencil);
+
+  double * fixed_values = NULL;
+  size_t num_fixed_values = 0;
+  stencil_get_fixed_values(
+    stencils, stencil_count, &fixed_values, &num_fixed_values, comm);
+
+  size_t num_fixed_tgt = 0;
+  while ((num_fixed_tgt < stencil_count) &&
+         (stencils[num_fixed_tgt].type == FIXED)) ++num_fixed_tgt;
+  size_t num_links = 0;
+  for (size_t i = num_fixed_tgt; i < stencil_count; ++i)
+    num_links += stencil_get_num_links(stencils + i, num_src_fields);
+
+  // each process writes its stencils into its own slice of the file
+  uint64_t local_counts[2] = {(uint64_t)num_links, (uint64_t)num_fixed_tgt};
+  uint64_t global_counts[2], offsets[2] = {0, 0};
+  yac_mpi_call(
+    MPI_Allreduce(
+      local_counts, global_counts, 2, MPI_UINT64_T, MPI_SUM, comm), comm);
+  yac_mpi_call(
+    MPI_Exscan(local_counts, offsets, 2, MPI_UINT64_T, MPI_SUM, comm), comm);
+  if (comm_rank == 0) offsets[0] = 0, offsets[1] = 0;
+
+  struct yac_binary_weight_file_slice local_slice = {
+    .link_offset = offsets[0], .link_count = local_counts[0],
+    .fixed_offset = offsets[1], .fixed_count = local_counts[1]};
+  struct yac_binary_weight_file_slice * slices =
+    (comm_rank == 0)?xmalloc((size_t)comm_size * sizeof(*slices)):NULL;
+  yac_mpi_call(
+    MPI_Gather(
+      &local_slice, 4, MPI_UINT64_T, slices, 4, MPI_UINT64_T, 0, comm), comm);
+
+  struct yac_binary_weight_file_header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, YAC_BINARY_WEIGHT_FILE_MAGIC, sizeof(header.magic));
+  header.version = YAC_BINARY_WEIGHT_FILE_VERSION;
+  header.byte_order_mark = YAC_BINARY_WEIGHT_FILE_BYTE_ORDER_MARK;
+  header.num_slices = (uint64_t)comm_size;
+  header.num_src_fields = (uint64_t)num_src_fields;
+  header.num_fixed_values = (uint64_t)num_fixed_values;
+  header.num_links = global_counts[0];
+  header.num_fixed_tgt = global_counts[1];
+  header.src_grid_name_len = (uint64_t)strlen(src_grid_name);
+  header.tgt_grid_name_len = (uint64_t)strlen(tgt_grid_name);
+  header.key_size = (uint64_t)key_size;
+  header.tgt_location = (int32_t)(weights->tgt_location);
+
+  struct yac_binary_weight_file_layout layout;
+  YAC_ASSERT(
+    yac_binary_weight_file_get_layout(&header, &layout),
+    "ERROR(yac_interp_weights_write_to_binary_file): "
+    "binary weight file is too big")
+
+  // get local link and fixed data
+  int64_t * int64_buffer =
+    xmalloc((2 * num_links + num_fixed_tgt) * sizeof(*int64_buffer));
+  int64_t * link_tgt = int64_buffer;
+  int64_t * link_src = int64_buffer + num_links;
+  int64_t * fixed_tgt = int64_buffer + 2 * num_links;
+  uint64_t * uint64_buffer =
+    xmalloc((num_links + num_fixed_tgt) * sizeof(*uint64_buffer));
+  uint64_t * link_src_field_idx = uint64_buffer;
+  uint64_t * fixed_value_idx = uint64_buffer + num_links;
+  double * link_weight = xmalloc(num_links * sizeof(*link_weight));
+
+  stencil_get_binary_link_data(
+    stencils + num_fixed_tgt, stencil_count - num_fixed_tgt, num_src_fields,
+    link_tgt, link_src, link_src_field_idx, link_weight);
+  for (size_t i = 0, j = 0; i < num_fixed_tgt; ++i) {
+    double curr_fixed_value = stencils[i].data.fixed.value;
+    while ((j < num_fixed_values) && (fixed_values[j] != curr_fixed_value)) ++j;
+    YAC_ASSERT(
+      j < num_fixed_values,
+      "ERROR(yac_interp_weights_write_to_binary_file): invalid fixed value")
+    fixed_tgt[i] = (int64_t)(stencils[i].tgt.global_id);
+    fixed_value_idx[i] = (uint64_t)j;
+  }
+  free(stencils);
+
+  MPI_File file;
+  yac_mpi_call(
+    MPI_File_open(
+      comm, (char*)filename, MPI_MODE_CREATE | MPI_MODE_WRONLY,
+      MPI_INFO_NULL, &file), comm);
+  yac_mpi_call(MPI_File_set_size(file, (MPI_Offset)layout.file_size), comm);
+
+  // the root process writes the global data
+  if (comm_rank == 0) {
+
+    int32_t * src_locations =
+      xmalloc(num_src_fields * sizeof(*src_locations));
+    for (size_t i = 0; i < num_src_fields; ++i)
+      src_locations[i] = (int32_t)(weights->src_locations[i]);
+
+    struct {
+      uint64_t offset;
+      void const * data;
+      size_t size;
+    } sections[] =
+      {{.offset = 0, .data = &header, .size = sizeof(header)},
+       {.offset = layout.src_locations, .data = src_locations,
+        .size = num_src_fields * sizeof(*src_locations)},
+       {.offset = layout.src_grid_name, .data = src_grid_name,
+        .size = (size_t)header.src_grid_name_len},
+       {.offset = layout.tgt_grid_name, .data = tgt_grid_name,
+        .size = (size_t)header.tgt_grid_name_len},
+       {.offset = layout.key, .data = key, .size = key_size},
+       {.offset = layout.fixed_values, .data = fixed_values,
+        .size = num_fixed_values * sizeof(*fixed_values)},
+       {.offset = layout.slices, .data = slices,
+        .size = (size_t)comm_size * sizeof(*slices)}};
+    enum {NUM_SECTIONS = sizeof(sections) / sizeof(sections[0])};
+
+    for (size_t i = 0; i < NUM_SECTIONS; ++i)
+      write_binary_section(
+        file, sections[i].offset, sections[i].data, sections[i].size, comm);
+    free(src_locations);
+  }
+  free(slices);
+  free(fixed_values);
+
+  // all processes write their slice
+  write_binary_section_all(
+    file, layout.link_tgt + offsets[0] * sizeof(*link_tgt),
+    link_tgt, num_links * sizeof(*link_tgt), comm);
+  write_binary_section_all(
+    file, layout.link_src + offsets[0] * sizeof(*link_src),
+    link_src, num_links * sizeof(*link_src), comm);
+  write_binary_section_all(
+    file, layout.link_src_field_idx + offsets[0] * sizeof(*link_src_field_idx),
+    link_src_field_idx, num_links * sizeof(*link_src_field_idx), comm);
+  write_binary_section_all(
+    file, layout.link_weight + offsets[0] * sizeof(*link_weight),
+    link_weight, num_links * sizeof(*link_weight), comm);
+  write_binary_section_all(
+    file, layout.fixed_tgt + offsets[1] * sizeof(*fixed_tgt),
+    fixed_tgt, num_fixed_tgt * sizeof(*fixed_tgt), comm);
+  write_binary_section_all(
+    file, layout.fixed_value_idx + offsets[1] * sizeof(*fixed_value_idx),
+    fixed_value_idx, num_fixed_tgt * sizeof(*fixed_value_idx), comm);
+
+  // closing the file is collective and ensures that the writing of the
+  // weight file is complete
+  yac_mpi_call(MPI_File_close(&file), comm);
+
+  free(link_weight);
+  free(uint64_buffer);
+  free(int64_buffer);
+}
+
 size_t yac_interp_weights_get_interp_count(struct interp_weights * weights) {
 
   return weights->stencils_size;
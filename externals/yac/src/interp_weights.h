@@ -57,6 +57,8 @@
 enum interp_weights_reorder_type {
   MAPPING_ON_SRC, //!< weights will be appied at source processes
   MAPPING_ON_TGT, //!< weights will be applied at target processes
+  MAPPING_AUTO,   //!< side is selected based on the estimated exchange costs
+                  //!< (see \ref yac_interp_weights_get_interpolation)
 };
 
 struct interp_weights;
@@ -190,11 +192,33 @@ void yac_interp_weights_wcopy_weights(
  * @param[in] src_grid_name name of the source grid
  * @param[in] tgt_grid_name name of the target grid
  * @remark this call is collective
+ * @remark if the file name ends with \ref YAC_BINARY_WEIGHT_FILE_SUFFIX,
+ *         the weights are written in the binary format
+ *         (see \ref yac_interp_weights_write_to_binary_file)
  */
 void yac_interp_weights_write_to_file(
   struct interp_weights * weights, char const * filename,
   char const * src_grid_name, char const * tgt_grid_name);
 
+/**
+ * writes interpolation weights to a binary weight file
+ * (see \ref weight_file_binary.h), which also contains the current
+ * decomposition of the target points
+ * @param[in] weights       interpolation weights
+ * @param[in] filename      file name
+ * @param[in] src_grid_name name of the source grid
+ * @param[in] tgt_grid_name name of the target grid
+ * @param[in] key           opaque data that is stored in the file
+ *                          (may be NULL, if key_size is zero)
+ * @param[in] key_size      size of the key in bytes
+ * @remark the key has to be identical on all processes
+ * @remark this call is collective
+ */
+void yac_interp_weights_write_to_binary_file(
+  struct interp_weights * weights, char const * filename,
+  char const * src_grid_name, char const * tgt_grid_name,
+  void const * key, size_t key_size);
+
 /**
  * generates an interpolation from interpolation weights
  * @param[in] weights                  interpolation weights
@@ -213,12 +237,119 @@ void yac_interp_weights_write_to_file(
  *         the fractional mask, that receive a interpolation value, which is
  *         not a fixed value will by scaled by the following formula:\n
  *         y = scaling_factor * x + scaling_summand
+ * @remark if reorder == MAPPING_AUTO, the number of bytes and messages
+ *         exchanged in each interpolation step is estimated from the
+ *         sum and weighted sum stencils for both mapping sides and the
+ *         cheaper one is used (the decision is recorded in the setup
+ *         statistics counters "num_auto_mapping_on_source" and
+ *         "num_auto_mapping_on_target")
  */
 struct interpolation * yac_interp_weights_get_interpolation(
   struct interp_weights * weights, enum interp_weights_reorder_type reorder,
   size_t collection_size, double frac_mask_fallback_value,
   double scaling_factor, double scaling_summand);
 
+/**
+ * same as \ref yac_interp_weights_get_interpolation, but allows to select the
+ * precision of the field data
+ * @param[in] weights                  interpolation weights
+ * @param[in] reorder                  type of reordering that is to be applied
+ * @param[in] collection_size          collection size
+ * @param[in] frac_mask_fallback_value fallback value for dynamic
+ *                                     fractional masking
+ * @param[in] scaling_factor           scaling factor
+ * @param[in] scaling_summand          scaling summand
+ * @param[in] use_single_precision     if != 0, the field data is exchanged
+ *                                     and interpolated in single precision
+ *                                     (weights are still applied in double)
+ * @return interpolation
+ */
+struct interpolation * yac_interp_weights_get_interpolation_prec(
+  struct interp_weights * weights, enum interp_weights_reorder_type reorder,
+  size_t collection_size, double frac_mask_fallback_value,
+  double scaling_factor, double scaling_summand, int use_single_precision);
+
+/**
+ * selects the mapping side, which would be used by
+ * \ref yac_interp_weights_get_interpolation_prec for
+ * reorder == MAPPING_AUTO
+ * @param[in] weights              interpolation weights
+ * @param[in] collection_size      collection size
+ * @param[in] use_single_precision if != 0, the field data is exchanged in
+ *                                 single precision
+ * @return MAPPING_ON_SRC or MAPPING_ON_TGT
+ * @remark this call is collective
+ */
+enum interp_weights_reorder_type yac_interp_weights_select_mapping_side(
+  struct interp_weights * weights, size_t collection_size,
+  int use_single_precision);
+
+/**
+ * removes small weights from all weighted stencils
+ * @param[inout] weights   interpolation weights
+ * @param[in]    threshold relative threshold; weights whose absolute value
+ *                         is below threshold times the largest absolute
+ *                         weight of the respective stencil are removed
+ * @return global number of removed links
+ * @remark the remaining weights of each modified stencil are rescaled, such
+ *         that the sum of its weights is preserved (stencils whose remaining
+ *         weights sum up to zero are not modified)
+ * @remark if threshold is zero, the weights are not modified
+ * @remark this call is collective
+ */
+size_t yac_interp_weights_prune(
+  struct interp_weights * weights, double threshold);
+
+/**
+ * removes all stencils whose target point is contained in tgt_ids or which
+ * reference a source point contained in the list of the respective source
+ * field in src_ids
+ * @param[in]  weights         interpolation weights
+ * @param[in]  tgt_ids         sorted global ids of target points
+ * @param[in]  num_tgt_ids     number of entries in tgt_ids
+ * @param[in]  src_ids         sorted global ids of source points
+ *                             (one list per source field)
+ * @param[in]  num_src_ids     number of entries in each list of src_ids
+ * @param[out] removed_tgt_ids global ids of the targets of all removed
+ *                             stencils
+ * @param[out] removed_tgt_infos owners (rank and position in the local
+ *                               target field) of the targets of all
+ *                               removed stencils
+ * @param[out] num_removed_tgt_infos number of entries in removed_tgt_infos
+ * @return number of removed stencils
+ * @remark this call is not collective
+ */
+size_t yac_interp_weights_remove_stencils(
+  struct interp_weights * weights,
+  yac_int const * tgt_ids, size_t num_tgt_ids,
+  yac_int const * const * src_ids, size_t const * num_src_ids,
+  yac_int ** removed_tgt_ids, struct remote_point_info ** removed_tgt_infos,
+  size_t * num_removed_tgt_infos);
+
+/**
+ * generates a copy of all stencils whose target point is contained in
+ * tgt_ids
+ * @param[in] weights     interpolation weights
+ * @param[in] tgt_ids     sorted global ids of target points
+ * @param[in] num_tgt_ids number of entries in tgt_ids
+ * @return interpolation weights containing the selected stencils
+ * @remark this call is not collective
+ */
+struct interp_weights * yac_interp_weights_extract(
+  struct interp_weights * weights,
+  yac_int const * tgt_ids, size_t num_tgt_ids);
+
+/**
+ * moves all stencils from one set of interpolation weights to another one
+ * @param[in] weights interpolation weights to which the stencils are added
+ * @param[in] other   interpolation weights from which the stencils are taken
+ * @remark other is deleted by this call
+ * @remark both weights have to be defined for the same source and target
+ *         fields
+ */
+void yac_interp_weights_append(
+  struct interp_weights * weights, struct interp_weights * other);
+
 /**
  * returns the count of all target for which the weights contain a stencil
  * @param[in] weights interpolation weights
@@ -77,11 +77,27 @@ struct interpolation {
 
   double scale_factor;
   double scale_summand;
+
+  int use_single_precision;
+
+  // positions of all target points that are written by the interpolation
+  // (only tracked for single precision interpolations, see
+  //  yac_interpolation_execute_get_float_to_double)
+  size_t * tgt_pos;
+  size_t tgt_pos_count;
+  size_t tgt_field_size;
+
+  // interpolation that replaces the results for the target points in
+  // patch_tgt_pos (see yac_interpolation_set_patch)
+  struct interpolation * patch;
+  size_t * patch_tgt_pos;
+  size_t patch_tgt_pos_count;
+  void * patch_tgt_buffer;
 };
 
-struct interpolation * yac_interpolation_new(
+struct interpolation * yac_interpolation_new_prec(
   size_t collection_size, double frac_mask_fallback_value,
-  double scale_factor, double scale_summand) {
+  double scale_factor, double scale_summand, int use_single_precision) {
 
   struct interpolation * interp = xmalloc(1 * sizeof(*interp));
 
@@ -108,9 +124,30 @@ struct interpolation * yac_interpolation_new(
   interp->scale_factor = scale_factor;
   interp->scale_summand = scale_summand;
 
+  interp->use_single_precision = use_single_precision;
+
+  interp->tgt_pos = NULL;
+  interp->tgt_pos_count = 0;
+  interp->tgt_field_size = 0;
+
+  interp->patch = NULL;
+  interp->patch_tgt_pos = NULL;
+  interp->patch_tgt_pos_count = 0;
+  interp->patch_tgt_buffer = NULL;
+
   return interp;
 }
 
+struct interpolation * yac_interpolation_new(
+  size_t collection_size, double frac_mask_fallback_value,
+  double scale_factor, double scale_summand) {
+
+  return
+    yac_interpolation_new_prec(
+      collection_size, frac_mask_fallback_value,
+      scale_factor, scale_summand, 0);
+}
+
 static void yac_interpolation_add(
   struct interpolation * interp, struct interpolation_type * interp_type) {
 
@@ -127,19 +164,44 @@ static void yac_interpolation_add(
   interp->is_target |= interp_type->vtable->is_target(interp_type);
 }
 
+void yac_interpolation_add_tgt_pos(
+  struct interpolation * interp, size_t count, size_t const * tgt_pos) {
+
+  if (!interp->use_single_precision || (count == 0)) return;
+
+  interp->tgt_pos =
+    xrealloc(
+      interp->tgt_pos,
+      (interp->tgt_pos_count + count) * sizeof(*(interp->tgt_pos)));
+  memcpy(
+    interp->tgt_pos + interp->tgt_pos_count, tgt_pos,
+    count * sizeof(*tgt_pos));
+  interp->tgt_pos_count += count;
+
+  for (size_t i = 0; i < count; ++i)
+    if (tgt_pos[i] >= interp->tgt_field_size)
+      interp->tgt_field_size = tgt_pos[i] + 1;
+}
+
 void yac_interpolation_add_fixed(
   struct interpolation * interp, double value, size_t count, size_t * pos) {
 
+  yac_interpolation_add_tgt_pos(interp, count, pos);
+
   yac_interpolation_add(
     interp,
-    yac_interpolation_fixed_new(interp->collection_size, value, count, pos));
+    yac_interpolation_fixed_new(
+      interp->collection_size, value, count, pos,
+      interp->use_single_precision));
 }
 
 void yac_interpolation_add_direct(
   struct interpolation * interp, Xt_redist redist) {
 
   yac_interpolation_add(
-    interp, yac_interpolation_direct_new(interp->collection_size, redist));
+    interp,
+    yac_interpolation_direct_new(
+      interp->collection_size, redist, interp->use_single_precision));
 }
 
 void yac_interpolation_add_direct_mf(
@@ -148,7 +210,8 @@ void yac_interpolation_add_direct_mf(
   yac_interpolation_add(
     interp,
     yac_interpolation_direct_mf_new(
-      interp->collection_size, redists, num_src_fields));
+      interp->collection_size, redists, num_src_fields,
+      interp->use_single_precision));
 }
 
 void yac_interpolation_add_sum_at_src(
@@ -162,7 +225,8 @@ void yac_interpolation_add_sum_at_src(
     yac_interpolation_sum_mvp_at_src_new(
       interp->collection_size, halo_redists, tgt_count, num_src_per_tgt, NULL,
       src_field_idx, src_idx, num_src_fields, result_redist,
-      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE));
+      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE,
+      interp->use_single_precision));
 }
 
 void yac_interpolation_add_sum_at_tgt(
@@ -171,12 +235,15 @@ void yac_interpolation_add_sum_at_tgt(
   size_t * src_field_idx, size_t * src_idx,
   size_t num_src_fields) {
 
+  yac_interpolation_add_tgt_pos(interp, tgt_count, tgt_pos);
+
   yac_interpolation_add(
     interp,
     yac_interpolation_sum_mvp_at_tgt_new(
       interp->collection_size, src_redists, tgt_pos, tgt_count, num_src_per_tgt,
       NULL, src_field_idx, src_idx, num_src_fields,
-      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE));
+      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE,
+      interp->use_single_precision));
 }
 
 void yac_interpolation_add_weight_sum_mvp_at_src(
@@ -190,7 +257,8 @@ void yac_interpolation_add_weight_sum_mvp_at_src(
     yac_interpolation_sum_mvp_at_src_new(
       interp->collection_size, halo_redists, tgt_count, num_src_per_tgt,
       weights, src_field_idx, src_idx, num_src_fields, result_redist,
-      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE));
+      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE,
+      interp->use_single_precision));
 };
 
 void yac_interpolation_add_weight_sum_mvp_at_tgt(
@@ -199,20 +267,24 @@ void yac_interpolation_add_weight_sum_mvp_at_tgt(
   size_t * src_field_idx, size_t * src_idx,
   size_t num_src_fields) {
 
+  yac_interpolation_add_tgt_pos(interp, tgt_count, tgt_pos);
+
   yac_interpolation_add(
     interp,
     yac_interpolation_sum_mvp_at_tgt_new(
       interp->collection_size, src_redists, tgt_pos, tgt_count, num_src_per_tgt,
       weights, src_field_idx, src_idx, num_src_fields,
-      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE));
+      interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE,
+      interp->use_single_precision));
 }
 
 struct interpolation * yac_interpolation_copy(struct interpolation * interp) {
 
   struct interpolation * interp_copy =
-    yac_interpolation_new(
+    yac_interpolation_new_prec(
       interp->collection_size, interp->frac_mask_fallback_value,
-      interp->scale_factor, interp->scale_summand);
+      interp->scale_factor, interp->scale_summand,
+      interp->use_single_precision);
 
   interp_copy->interps =
     xmalloc(interp->interp_count * sizeof(*interp_copy->interps));
@@ -225,9 +297,107 @@ struct interpolation * yac_interpolation_copy(struct interpolation * interp) {
   interp_copy->is_source = interp->is_source;
   interp_copy->is_target = interp->is_target;
 
+  yac_interpolation_add_tgt_pos(
+    interp_copy, interp->tgt_pos_count, interp->tgt_pos);
+
+  if (interp->patch != NULL)
+    yac_interpolation_set_patch(
+      interp_copy, yac_interpolation_copy(interp->patch),
+      interp->patch_tgt_pos_count, interp->patch_tgt_pos);
+
   return interp_copy;
 }
 
+static int compare_size_t(const void * a, const void * b) {
+
+  size_t const * a_ = a, * b_ = b;
+
+  return (*a_ > *b_) - (*b_ > *a_);
+}
+
+void yac_interpolation_set_patch(
+  struct interpolation * interp, struct interpolation * patch,
+  size_t count, size_t const * tgt_pos) {
+
+  YAC_ASSERT(
+    (interp->collection_size == patch->collection_size) &&
+    (interp->use_single_precision == patch->use_single_precision) &&
+    !memcmp(
+      &(interp->frac_mask_fallback_value),
+      &(patch->frac_mask_fallback_value), sizeof(double)) &&
+    (interp->scale_factor == patch->scale_factor) &&
+    (interp->scale_summand == patch->scale_summand),
+    "ERROR(yac_interpolation_set_patch): "
+    "patch does not match the configuration of the interpolation")
+  YAC_ASSERT(
+    patch->patch == NULL,
+    "ERROR(yac_interpolation_set_patch): patch has a patch itself")
+
+  yac_interpolation_delete(interp->patch);
+  interp->patch = patch;
+  interp->is_source |= patch->is_source;
+  interp->is_target |= patch->is_target;
+
+  // merge the new positions into the sorted list of replaced positions
+  size_t * patch_tgt_pos =
+    xrealloc(
+      interp->patch_tgt_pos,
+      (interp->patch_tgt_pos_count + count) * sizeof(*patch_tgt_pos));
+  memcpy(patch_tgt_pos + interp->patch_tgt_pos_count, tgt_pos,
+         count * sizeof(*tgt_pos));
+  size_t patch_tgt_pos_count = interp->patch_tgt_pos_count + count;
+  qsort(patch_tgt_pos, patch_tgt_pos_count, sizeof(*patch_tgt_pos),
+        compare_size_t);
+  yac_remove_duplicates_size_t(patch_tgt_pos, &patch_tgt_pos_count);
+  interp->patch_tgt_pos = patch_tgt_pos;
+  interp->patch_tgt_pos_count = patch_tgt_pos_count;
+
+  if ((patch_tgt_pos_count > 0) &&
+      (patch_tgt_pos[patch_tgt_pos_count-1] >= interp->tgt_field_size))
+    interp->tgt_field_size = patch_tgt_pos[patch_tgt_pos_count-1] + 1;
+  if (patch->tgt_field_size > interp->tgt_field_size)
+    interp->tgt_field_size = patch->tgt_field_size;
+
+  free(interp->patch_tgt_buffer);
+  interp->patch_tgt_buffer =
+    xmalloc(
+      interp->collection_size * patch_tgt_pos_count *
+      (interp->use_single_precision?sizeof(float):sizeof(double)));
+}
+
+// saves or restores the values of all target points, whose results are
+// replaced by the patch
+static void copy_patch_tgt_points(
+  struct interpolation * interp, double ** tgt_field, int restore) {
+
+  size_t collection_size = interp->collection_size;
+  size_t * patch_tgt_pos = interp->patch_tgt_pos;
+  size_t patch_tgt_pos_count = interp->patch_tgt_pos_count;
+
+  if (interp->use_single_precision) {
+    float ** tgt_field_float = (float **)tgt_field;
+    float * buffer = interp->patch_tgt_buffer;
+    for (size_t i = 0, k = 0; i < collection_size; ++i)
+      for (size_t j = 0; j < patch_tgt_pos_count; ++j, ++k)
+        if (restore) tgt_field_float[i][patch_tgt_pos[j]] = buffer[k];
+        else buffer[k] = tgt_field_float[i][patch_tgt_pos[j]];
+  } else {
+    double * buffer = interp->patch_tgt_buffer;
+    for (size_t i = 0, k = 0; i < collection_size; ++i)
+      for (size_t j = 0; j < patch_tgt_pos_count; ++j, ++k)
+        if (restore) tgt_field[i][patch_tgt_pos[j]] = buffer[k];
+        else buffer[k] = tgt_field[i][patch_tgt_pos[j]];
+  }
+}
+
+#define CHECK_PRECISION(ROUTINE, USE_SINGLE_PRECISION) \
+  YAC_ASSERT_F( \
+    interp->use_single_precision == (USE_SINGLE_PRECISION), \
+    "ERROR(%s%s): interpolation was%s built for single precision, " \
+    "use %s%s instead", (ROUTINE), (USE_SINGLE_PRECISION)?"_float":"", \
+    (interp->use_single_precision)?"":" not", (ROUTINE), \
+    (interp->use_single_precision)?"_float":"")
+
 // src_fields dimensions [collection_idx]
 //                       [field index]
 //                       [local_idx]
@@ -236,7 +406,9 @@ struct interpolation * yac_interpolation_copy(struct interpolation * interp) {
 //                           [local_idx]
 // tgt_field dimensions [collection_idx]
 //                      [local_idx]
-void yac_interpolation_execute_frac(
+// (in case the interpolation uses single precision, all pointers refer to
+//  float arrays)
+static void yac_interpolation_execute_frac_(
   struct interpolation * interp, double *** src_fields,
   double *** src_frac_masks, double ** tgt_field) {
 
@@ -247,19 +419,22 @@ void yac_interpolation_execute_frac(
     "interpolation was not built for dynamic fractional masking, "
     "use yac_interpolation_execute instead");
 
+  if (interp->patch != NULL) copy_patch_tgt_points(interp, tgt_field, 0);
+
   for (int i = 0; i < interp->interp_count; ++i)
     interp->interps[i]->vtable->execute(
       interp->interps[i], src_fields, src_frac_masks, tgt_field,
       interp->frac_mask_fallback_value, interp->scale_factor,
       interp->scale_summand);
+
+  if (interp->patch != NULL) {
+    copy_patch_tgt_points(interp, tgt_field, 1);
+    yac_interpolation_execute_frac_(
+      interp->patch, src_fields, src_frac_masks, tgt_field);
+  }
 }
 
-// src_fields dimensions [collection_idx]
-//                       [field index]
-//                       [local_idx]
-// tgt_field dimensions [collection_idx]
-//                      [local_idx]
-void yac_interpolation_execute(
+static void yac_interpolation_execute_(
   struct interpolation * interp, double *** src_fields, double ** tgt_field) {
 
   YAC_ASSERT(
@@ -268,18 +443,12 @@ void yac_interpolation_execute(
     "interpolation was built for dynamic fractional masking, "
     "use yac_interpolation_execute_frac instead");
 
-  yac_interpolation_execute_frac(interp, src_fields, NULL, tgt_field);
+  yac_interpolation_execute_frac_(interp, src_fields, NULL, tgt_field);
 }
 
-// src_fields dimensions [collection_idx]
-//                       [field index]
-//                       [local_idx]
-// src_frac_masks dimensions [collection_idx]
-//                           [field index]
-//                           [local_idx]
-void yac_interpolation_execute_put_frac(
+static void yac_interpolation_execute_put_frac_(
   struct interpolation * interp, double *** src_fields,
-  double *** src_frac_masks) {
+  double *** src_frac_masks, int zero_copy) {
 
   YAC_ASSERT(
     (interp->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE) ||
@@ -293,15 +462,16 @@ void yac_interpolation_execute_put_frac(
   for (int i = 0; i < interp->interp_count; ++i)
     interp->interps[i]->vtable->execute_put(
       interp->interps[i], src_fields, src_frac_masks,
-      interp->is_target, interp->frac_mask_fallback_value,
+      interp->is_target, zero_copy, interp->frac_mask_fallback_value,
       interp->scale_factor, interp->scale_summand);
+
+  if (interp->patch != NULL)
+    yac_interpolation_execute_put_frac_(
+      interp->patch, src_fields, src_frac_masks, zero_copy);
 }
 
-// src_fields dimensions [collection_idx]
-//                       [field index]
-//                       [local_idx]
-void yac_interpolation_execute_put(
-  struct interpolation * interp, double *** src_fields) {
+static void yac_interpolation_execute_put_(
+  struct interpolation * interp, double *** src_fields, int zero_copy) {
 
   YAC_ASSERT(
     interp->frac_mask_fallback_value == YAC_FRAC_MASK_NO_VALUE,
@@ -309,22 +479,163 @@ void yac_interpolation_execute_put(
     "interpolation was built for dynamic fractional masking, "
     "use yac_interpolation_execute_put_frac instead");
 
-  yac_interpolation_execute_put_frac(interp, src_fields, NULL);
+  yac_interpolation_execute_put_frac_(interp, src_fields, NULL, zero_copy);
 }
 
-// tgt_field dimensions [collection_idx]
-//                      [local_idx]
-void yac_interpolation_execute_get(
+static void yac_interpolation_execute_get_(
   struct interpolation * interp, double ** tgt_field) {
 
   if (!interp->is_target) return;
 
+  if (interp->patch != NULL) copy_patch_tgt_points(interp, tgt_field, 0);
+
   for (int i = 0; i < interp->interp_count; ++i)
     interp->interps[i]->vtable->execute_get(
       interp->interps[i], tgt_field, interp->frac_mask_fallback_value,
       interp->scale_factor, interp->scale_summand);
+
+  if (interp->patch != NULL) {
+    copy_patch_tgt_points(interp, tgt_field, 1);
+    yac_interpolation_execute_get_(interp->patch, tgt_field);
+  }
+}
+
+void yac_interpolation_execute_frac(
+  struct interpolation * interp, double *** src_fields,
+  double *** src_frac_masks, double ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute_frac", 0)
+  yac_interpolation_execute_frac_(
+    interp, src_fields, src_frac_masks, tgt_field);
+}
+
+void yac_interpolation_execute(
+  struct interpolation * interp, double *** src_fields, double ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute", 0)
+  yac_interpolation_execute_(interp, src_fields, tgt_field);
+}
+
+void yac_interpolation_execute_put_frac(
+  struct interpolation * interp, double *** src_fields,
+  double *** src_frac_masks) {
+
+  CHECK_PRECISION("yac_interpolation_execute_put_frac", 0)
+  yac_interpolation_execute_put_frac_(interp, src_fields, src_frac_masks, 0);
+}
+
+void yac_interpolation_execute_put(
+  struct interpolation * interp, double *** src_fields) {
+
+  CHECK_PRECISION("yac_interpolation_execute_put", 0)
+  yac_interpolation_execute_put_(interp, src_fields, 0);
+}
+
+void yac_interpolation_execute_put_zero_copy(
+  struct interpolation * interp, double *** src_fields) {
+
+  CHECK_PRECISION("yac_interpolation_execute_put_zero_copy", 0)
+  yac_interpolation_execute_put_(interp, src_fields, 1);
+}
+
+void yac_interpolation_execute_get(
+  struct interpolation * interp, double ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute_get", 0)
+  yac_interpolation_execute_get_(interp, tgt_field);
+}
+
+void yac_interpolation_execute_frac_float(
+  struct interpolation * interp, float *** src_fields,
+  float *** src_frac_masks, float ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute_frac", 1)
+  yac_interpolation_execute_frac_(
+    interp, (double ***)src_fields, (double ***)src_frac_masks,
+    (double **)tgt_field);
+}
+
+void yac_interpolation_execute_float(
+  struct interpolation * interp, float *** src_fields, float ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute", 1)
+  yac_interpolation_execute_(
+    interp, (double ***)src_fields, (double **)tgt_field);
+}
+
+void yac_interpolation_execute_put_frac_float(
+  struct interpolation * interp, float *** src_fields,
+  float *** src_frac_masks) {
+
+  CHECK_PRECISION("yac_interpolation_execute_put_frac", 1)
+  yac_interpolation_execute_put_frac_(
+    interp, (double ***)src_fields, (double ***)src_frac_masks, 0);
+}
+
+void yac_interpolation_execute_put_float(
+  struct interpolation * interp, float *** src_fields) {
+
+  CHECK_PRECISION("yac_interpolation_execute_put", 1)
+  yac_interpolation_execute_put_(interp, (double ***)src_fields, 0);
+}
+
+void yac_interpolation_execute_put_zero_copy_float(
+  struct interpolation * interp, float *** src_fields) {
+
+  CHECK_PRECISION("yac_interpolation_execute_put_zero_copy", 1)
+  yac_interpolation_execute_put_(interp, (double ***)src_fields, 1);
+}
+
+void yac_interpolation_execute_get_float(
+  struct interpolation * interp, float ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute_get", 1)
+  yac_interpolation_execute_get_(interp, (double **)tgt_field);
+}
+
+void yac_interpolation_execute_get_float_to_double(
+  struct interpolation * interp, double ** tgt_field) {
+
+  CHECK_PRECISION("yac_interpolation_execute_get_float_to_double", 1)
+
+  if (!interp->is_target) return;
+
+  size_t collection_size = interp->collection_size;
+  size_t tgt_field_size = interp->tgt_field_size;
+  size_t * tgt_pos = interp->tgt_pos;
+  size_t tgt_pos_count = interp->tgt_pos_count;
+
+  float ** tgt_field_float =
+    xmalloc(collection_size * sizeof(*tgt_field_float));
+  tgt_field_float[0] =
+    xmalloc(collection_size * tgt_field_size * sizeof(**tgt_field_float));
+  for (size_t i = 1; i < collection_size; ++i)
+    tgt_field_float[i] = tgt_field_float[0] + i * tgt_field_size;
+
+  yac_interpolation_execute_get_(interp, (double **)tgt_field_float);
+
+  // only the target points written by the interpolation are converted, all
+  // other points keep their original value
+  size_t * patch_tgt_pos = interp->patch_tgt_pos;
+  size_t patch_tgt_pos_count = interp->patch_tgt_pos_count;
+  for (size_t i = 0; i < collection_size; ++i)
+    for (size_t j = 0; j < tgt_pos_count; ++j)
+      if ((patch_tgt_pos_count == 0) ||
+          (bsearch(tgt_pos + j, patch_tgt_pos, patch_tgt_pos_count,
+                   sizeof(*patch_tgt_pos), compare_size_t) == NULL))
+        tgt_field[i][tgt_pos[j]] = (double)(tgt_field_float[i][tgt_pos[j]]);
+  if (interp->patch != NULL)
+    for (size_t i = 0; i < collection_size; ++i)
+      for (size_t j = 0; j < interp->patch->tgt_pos_count; ++j)
+        tgt_field[i][interp->patch->tgt_pos[j]] =
+          (double)(tgt_field_float[i][interp->patch->tgt_pos[j]]);
+
+  free(tgt_field_float[0]);
+  free(tgt_field_float);
 }
 
+#undef CHECK_PRECISION
+
 int yac_interpolation_execute_test(struct interpolation * interp) {
 
   int test = 0;
@@ -334,6 +645,9 @@ int yac_interpolation_execute_test(struct interpolation * interp) {
       interp->interps[i]->vtable->execute_test(
         interp->interps[i]);
 
+  if ((interp->patch != NULL) && !test)
+    test = yac_interpolation_execute_test(interp->patch);
+
   return test;
 }
 
@@ -347,6 +661,12 @@ int yac_interpolation_with_frac_mask(struct interpolation * interpolation) {
   return interpolation->frac_mask_fallback_value != YAC_FRAC_MASK_NO_VALUE;
 }
 
+int yac_interpolation_use_single_precision(
+  struct interpolation * interpolation) {
+
+  return interpolation->use_single_precision;
+}
+
 void yac_interpolation_delete(struct interpolation * interp) {
 
   if (interp == NULL) return;
@@ -356,5 +676,9 @@ void yac_interpolation_delete(struct interpolation * interp) {
   for (int i = 0; i < interp->interp_count; ++i)
     interp->interps[i]->vtable->delete(interp->interps[i]);
   free(interp->interps);
+  free(interp->tgt_pos);
+  yac_interpolation_delete(interp->patch);
+  free(interp->patch_tgt_pos);
+  free(interp->patch_tgt_buffer);
   free(interp);
 }
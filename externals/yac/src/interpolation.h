@@ -76,6 +76,11 @@ extern double const YAC_FRAC_MASK_NO_VALUE;
 extern double const YAC_FRAC_MASK_UNDEF;
 
 struct interpolation_type;
+/*
+ * In case an interpolation uses single precision (see
+ * \ref yac_interpolation_new_prec), the field pointers passed to the
+ * routines of the vtable refer to float instead of double arrays.
+ */
 struct interpolation_type_vtable {
   int (*is_source)(struct interpolation_type * interp);
   int (*is_target)(struct interpolation_type * interp);
@@ -85,7 +90,8 @@ struct interpolation_type_vtable {
                   double scale_factor, double scale_summand);
   void (*execute_put)(struct interpolation_type * interp,
                       double *** src_fields, double *** src_frac_masks,
-                      int is_target, double frac_mask_fallback_value,
+                      int is_target, int zero_copy,
+                      double frac_mask_fallback_value,
                       double scale_factor, double scale_summand);
   void (*execute_get)(struct interpolation_type * interp, double ** tgt_field,
                       double frac_mask_fallback_value, double scale_factor,
@@ -104,10 +110,34 @@ struct interpolation * yac_interpolation_new(
   size_t collection_size, double frac_mask_fallback_value,
   double scale_factor, double scale_summand);
 
+/*
+ * If use_single_precision is set, all field data is stored in the internal
+ * buffers and exchanged in single precision. Weights are always applied in
+ * double precision. Such interpolations can only be executed with the
+ * *_float variants of the execute routines.
+ */
+struct interpolation * yac_interpolation_new_prec(
+  size_t collection_size, double frac_mask_fallback_value,
+  double scale_factor, double scale_summand, int use_single_precision);
+
 void yac_interpolation_inc_ref_count(struct interpolation * interpolation);
 
 int yac_interpolation_with_frac_mask(struct interpolation * interpolation);
 
+int yac_interpolation_use_single_precision(
+  struct interpolation * interpolation);
+
+/*
+ * Registers the positions of target points that are written by an
+ * interpolation type, which receives its results through a redist (direct,
+ * direct_mf, and the *_at_src types). The positions of the fixed and *_at_tgt
+ * types are registered automatically. This information is only used by
+ * \ref yac_interpolation_execute_get_float_to_double and is ignored for
+ * double precision interpolations.
+ */
+void yac_interpolation_add_tgt_pos(
+  struct interpolation * interp, size_t count, size_t const * tgt_pos);
+
 void yac_interpolation_add_fixed(
   struct interpolation * interp, double value, size_t count, size_t * pos);
 
@@ -152,6 +182,20 @@ void yac_interpolation_add_weight_sum_mvp_at_tgt(
 
 struct interpolation * yac_interpolation_copy(struct interpolation * interp);
 
+/*
+ * Replaces the results of an interpolation for a subset of its target points
+ * by the results of another interpolation (the patch). On the target
+ * processes, the results of the interpolation for the points in tgt_pos are
+ * discarded and the patch is applied afterwards. The patch has to be built
+ * with the same configuration (collection size, precision, fractional mask
+ * fallback value, and scaling) as the interpolation. The interpolation takes
+ * ownership of the patch and replaces a previously set one, while tgt_pos is
+ * added to the positions of earlier calls.
+ */
+void yac_interpolation_set_patch(
+  struct interpolation * interp, struct interpolation * patch,
+  size_t count, size_t const * tgt_pos);
+
 // src_fields dimensions [collection_idx]
 //                       [field index]
 //                       [local_idx]
@@ -172,11 +216,47 @@ void yac_interpolation_execute_put_frac(
   struct interpolation * interp, double *** src_fields,
   double *** src_frac_masks);
 
+/*
+ * Same as yac_interpolation_execute_put, except that the caller guarantees
+ * that the source fields are neither modified nor freed until the put has
+ * been completed (see yac_interpolation_execute_test). This allows the
+ * interpolation to send the source fields without copying them into its
+ * internal buffers first. (Interpolations that have to modify the data
+ * before sending it still do so in their own buffers.)
+ */
+void yac_interpolation_execute_put_zero_copy(
+  struct interpolation * interp, double *** src_fields);
+
 // tgt_field dimensions [collection_idx]
 //                      [local_idx]
 void yac_interpolation_execute_get(
   struct interpolation * interp, double ** tgt_field);
 
+// single precision variants of the above routines
+void yac_interpolation_execute_float(
+  struct interpolation * interp, float *** src_fields, float ** tgt_field);
+void yac_interpolation_execute_frac_float(
+  struct interpolation * interp, float *** src_fields,
+  float *** src_frac_masks, float ** tgt_field);
+void yac_interpolation_execute_put_float(
+  struct interpolation * interp, float *** src_fields);
+void yac_interpolation_execute_put_zero_copy_float(
+  struct interpolation * interp, float *** src_fields);
+void yac_interpolation_execute_put_frac_float(
+  struct interpolation * interp, float *** src_fields,
+  float *** src_frac_masks);
+void yac_interpolation_execute_get_float(
+  struct interpolation * interp, float ** tgt_field);
+
+/*
+ * Receives the target field of a single precision interpolation into a double
+ * precision array. Only the points written by the interpolation (see
+ * \ref yac_interpolation_add_tgt_pos) are updated, all other points keep
+ * their original value.
+ */
+void yac_interpolation_execute_get_float_to_double(
+  struct interpolation * interp, double ** tgt_field);
+
 int yac_interpolation_execute_test(struct interpolation * interp);
 
 void yac_interpolation_delete(struct interpolation * interp);
@@ -62,7 +62,7 @@ static void yac_interpolation_direct_execute(
 static void yac_interpolation_direct_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks,
-  int is_target, double frac_mask_fallback_value,
+  int is_target, int zero_copy, double frac_mask_fallback_value,
   double scale_factor, double scale_summand);
 static void yac_interpolation_direct_execute_get(
   struct interpolation_type * interp, double ** tgt_field,
@@ -97,11 +97,13 @@ struct interpolation_direct {
   double ** src_field_buffer;
   int is_source;
   int is_target;
+
+  int use_single_precision;
 };
 
 static struct interpolation_type * yac_interpolation_direct_new_(
   size_t collection_size, struct yac_interpolation_exchange * src2tgt,
-  struct yac_interpolation_buffer src_data) {
+  struct yac_interpolation_buffer src_data, int use_single_precision) {
 
   struct interpolation_direct * direct = xmalloc(1 * sizeof(*direct));
 
@@ -113,12 +115,13 @@ static struct interpolation_type * yac_interpolation_direct_new_(
     xcalloc(collection_size, sizeof(*(direct->src_field_buffer)));
   direct->is_source = yac_interpolation_exchange_is_source(direct->src2tgt);
   direct->is_target = yac_interpolation_exchange_is_target(direct->src2tgt);
+  direct->use_single_precision = use_single_precision;
 
   return (struct interpolation_type *)direct;
 }
 
 struct interpolation_type * yac_interpolation_direct_new(
-  size_t collection_size, Xt_redist redist_) {
+  size_t collection_size, Xt_redist redist_, int use_single_precision) {
 
   return
     yac_interpolation_direct_new_(
@@ -126,7 +129,7 @@ struct interpolation_type * yac_interpolation_direct_new(
       yac_interpolation_exchange_new(
         &redist_, 1, collection_size, 0, "source to target"),
       yac_interpolation_buffer_init(
-        &redist_, 1, collection_size, SEND_BUFFER));
+        &redist_, 1, collection_size, SEND_BUFFER), use_single_precision);
 }
 
 static int yac_interpolation_direct_is_source(
@@ -165,7 +168,8 @@ static void yac_interpolation_direct_execute(
 
       src_send_buffer = direct->src_data.buffer;
 
-      compute_tgt_field(
+      compute_tgt_field_prec(
+        direct->use_single_precision,
         (double const * restrict **)src_fields,
         (double const * restrict **)src_frac_masks, src_send_buffer,
         direct->src_data.buffer_sizes, 1,
@@ -188,7 +192,8 @@ static void yac_interpolation_direct_execute(
 static void yac_interpolation_direct_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks, int is_target,
-  double frac_mask_fallback_value, double scale_factor, double scale_summand) {
+  int zero_copy, double frac_mask_fallback_value, double scale_factor,
+  double scale_summand) {
 
   struct interpolation_direct * direct =
     (struct interpolation_direct *)interp;
@@ -201,14 +206,28 @@ static void yac_interpolation_direct_execute_put(
     yac_interpolation_exchange_wait(
       direct->src2tgt, "yac_interpolation_direct_execute");
 
-    src_send_buffer = direct->src_data.buffer;
+    // if the source field is stable until the put is completed and
+    // does not have to be modified, it can be sent directly
+    if (zero_copy &&
+        (frac_mask_fallback_value == YAC_FRAC_MASK_NO_VALUE) &&
+        (scale_factor == 1.0) && (scale_summand == 0.0)) {
+
+      src_send_buffer = direct->src_field_buffer;
+      for (size_t i = 0; i < direct->collection_size; ++i)
+        src_send_buffer[i] = src_fields[i][0];
+
+    } else {
+
+      src_send_buffer = direct->src_data.buffer;
 
-    compute_tgt_field(
-      (double const * restrict **)src_fields,
-      (double const * restrict **)src_frac_masks, src_send_buffer,
-      direct->src_data.buffer_sizes, 1,
-      direct->collection_size, frac_mask_fallback_value,
-      scale_factor, scale_summand);
+      compute_tgt_field_prec(
+        direct->use_single_precision,
+        (double const * restrict **)src_fields,
+        (double const * restrict **)src_frac_masks, src_send_buffer,
+        direct->src_data.buffer_sizes, 1,
+        direct->collection_size, frac_mask_fallback_value,
+        scale_factor, scale_summand);
+    }
   }
 
   yac_interpolation_exchange_execute_put(
@@ -236,7 +255,8 @@ static struct interpolation_type * yac_interpolation_direct_copy(
       direct->collection_size,
       yac_interpolation_exchange_copy(direct->src2tgt),
       yac_interpolation_buffer_copy(
-        direct->src_data, 1, direct->collection_size));
+        direct->src_data, 1, direct->collection_size),
+      direct->use_single_precision);
 }
 
 static int yac_interpolation_direct_execute_test(
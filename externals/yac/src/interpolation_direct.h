@@ -49,6 +49,6 @@
 #include "interpolation.h"
 
 struct interpolation_type * yac_interpolation_direct_new(
-  size_t collection_size, Xt_redist redist);
+  size_t collection_size, Xt_redist redist, int use_single_precision);
 
 #endif // INTERPOLATION_DIRECT_H
@@ -62,7 +62,7 @@ static void yac_interpolation_direct_mf_execute(
 static void yac_interpolation_direct_mf_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks,
-  int is_target, double frac_mask_fallback_value,
+  int is_target, int zero_copy, double frac_mask_fallback_value,
   double scale_factor, double scale_summand);
 static void yac_interpolation_direct_mf_execute_get(
   struct interpolation_type * interp, double ** tgt_field,
@@ -99,11 +99,14 @@ struct interpolation_direct_mf {
   size_t num_src_fields;
   int is_source;
   int is_target;
+
+  int use_single_precision;
 };
 
 static struct interpolation_type * yac_interpolation_direct_mf_new_(
   size_t collection_size, struct yac_interpolation_exchange * src2tgt,
-  struct yac_interpolation_buffer src_data, size_t num_src_fields) {
+  struct yac_interpolation_buffer src_data, size_t num_src_fields,
+  int use_single_precision) {
 
   struct interpolation_direct_mf * direct_mf = xmalloc(1 * sizeof(*direct_mf));
 
@@ -120,12 +123,14 @@ static struct interpolation_type * yac_interpolation_direct_mf_new_(
   direct_mf->num_src_fields = num_src_fields;
   direct_mf->is_source = yac_interpolation_exchange_is_source(direct_mf->src2tgt);
   direct_mf->is_target = yac_interpolation_exchange_is_target(direct_mf->src2tgt);
+  direct_mf->use_single_precision = use_single_precision;
 
   return (struct interpolation_type *)direct_mf;
 }
 
 struct interpolation_type * yac_interpolation_direct_mf_new(
-  size_t collection_size, Xt_redist * redists, size_t num_src_fields) {
+  size_t collection_size, Xt_redist * redists, size_t num_src_fields,
+  int use_single_precision) {
 
   return
     yac_interpolation_direct_mf_new_(
@@ -133,7 +138,8 @@ struct interpolation_type * yac_interpolation_direct_mf_new(
       yac_interpolation_exchange_new(
         redists, num_src_fields, collection_size, 0, "source to target"),
       yac_interpolation_buffer_init(
-        redists, num_src_fields, collection_size, SEND_BUFFER), num_src_fields);
+        redists, num_src_fields, collection_size, SEND_BUFFER),
+      num_src_fields, use_single_precision);
 }
 
 static int yac_interpolation_direct_mf_is_source(
@@ -175,7 +181,8 @@ static void yac_interpolation_direct_mf_execute(
 
       src_send_buffer = direct_mf->src_data.buffer;
 
-      compute_tgt_field(
+      compute_tgt_field_prec(
+        direct_mf->use_single_precision,
         (double const * restrict **)src_fields,
         (double const * restrict **)src_frac_masks, src_send_buffer,
         direct_mf->src_data.buffer_sizes, num_src_fields,
@@ -206,7 +213,8 @@ static void yac_interpolation_direct_mf_execute(
 static void yac_interpolation_direct_mf_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks, int is_target,
-  double frac_mask_fallback_value, double scale_factor, double scale_summand) {
+  int zero_copy, double frac_mask_fallback_value, double scale_factor,
+  double scale_summand) {
 
   struct interpolation_direct_mf * direct_mf =
     (struct interpolation_direct_mf *)interp;
@@ -218,14 +226,32 @@ static void yac_interpolation_direct_mf_execute_put(
     yac_interpolation_exchange_wait(
       direct_mf->src2tgt, "yac_interpolation_direct_mf_execute_put");
 
-    src_send_buffer = direct_mf->src_data.buffer;
+    size_t collection_size = direct_mf->collection_size;
+    size_t num_src_fields = direct_mf->num_src_fields;
+
+    // if the source fields are stable until the put is completed and
+    // do not have to be modified, they can be sent directly
+    if (zero_copy &&
+        (frac_mask_fallback_value == YAC_FRAC_MASK_NO_VALUE) &&
+        (scale_factor == 1.0) && (scale_summand == 0.0)) {
+
+      src_send_buffer = direct_mf->src_field_buffer;
+      for (size_t i = 0; i < collection_size; ++i)
+        for (size_t j = 0; j < num_src_fields; ++j)
+          src_send_buffer[i * num_src_fields + j] = src_fields[i][j];
+
+    } else {
 
-    compute_tgt_field(
-      (double const * restrict **)src_fields,
-      (double const * restrict **)src_frac_masks, src_send_buffer,
-      direct_mf->src_data.buffer_sizes, direct_mf->num_src_fields,
-      direct_mf->collection_size, frac_mask_fallback_value,
-      scale_factor, scale_summand);
+      src_send_buffer = direct_mf->src_data.buffer;
+
+      compute_tgt_field_prec(
+        direct_mf->use_single_precision,
+        (double const * restrict **)src_fields,
+        (double const * restrict **)src_frac_masks, src_send_buffer,
+        direct_mf->src_data.buffer_sizes, num_src_fields,
+        collection_size, frac_mask_fallback_value,
+        scale_factor, scale_summand);
+    }
   }
 
   yac_interpolation_exchange_execute_put(
@@ -280,7 +306,7 @@ static struct interpolation_type * yac_interpolation_direct_mf_copy(
       yac_interpolation_buffer_copy(
         direct_mf->src_data, direct_mf->num_src_fields,
         direct_mf->collection_size),
-      direct_mf->num_src_fields);
+      direct_mf->num_src_fields, direct_mf->use_single_precision);
 }
 
 static void yac_interpolation_direct_mf_delete(
@@ -49,6 +49,7 @@
 #include "interpolation.h"
 
 struct interpolation_type * yac_interpolation_direct_mf_new(
-  size_t collection_size, Xt_redist * redists, size_t num_src_fields);
+  size_t collection_size, Xt_redist * redists, size_t num_src_fields,
+  int use_single_precision);
 
 #endif // INTERPOLATION_DIRECT_MF_H
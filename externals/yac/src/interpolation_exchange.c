@@ -47,6 +47,7 @@
 
 #include "utils.h"
 #include "interpolation_exchange.h"
+#include "progress.h"
 
 enum exchange_state {
   EXCHANGE_IDLE,   //! exchange is currently not in use
@@ -77,6 +78,10 @@ struct yac_interpolation_exchange {
   int is_source, is_target;
   void const ** temp_send_buffer;
   void ** dummy_buffer;
+
+  // called once the asynchronous get has been completed
+  yac_interpolation_exchange_complete_func complete;
+  void * complete_data;
 };
 
 static Xt_redist combine_redists(
@@ -138,6 +143,43 @@ static void do_empty_exchange(
       (void **)(exchange->dummy_buffer));
 }
 
+// calls the completion routine of an asynchronous get (if there is one)
+static void call_complete(struct yac_interpolation_exchange * exchange) {
+
+  yac_interpolation_exchange_complete_func complete = exchange->complete;
+  if (complete == NULL) return;
+  exchange->complete = NULL;
+  complete(exchange->complete_data);
+}
+
+// test routine called by the progress engine (lock is held)
+static int progress_test(void * exchange_) {
+
+  struct yac_interpolation_exchange * exchange =
+    (struct yac_interpolation_exchange *)exchange_;
+
+  int flag;
+  xt_request_test(&(exchange->request), &flag);
+  if (flag) {
+    exchange->state = EXCHANGE_IDLE;
+    call_complete(exchange);
+  }
+  return flag;
+}
+
+static void set_active(struct yac_interpolation_exchange * exchange) {
+
+  exchange->state = EXCHANGE_ACTIVE;
+  yac_progress_add(exchange, progress_test);
+}
+
+static void set_idle(struct yac_interpolation_exchange * exchange) {
+
+  if (exchange->state == EXCHANGE_ACTIVE) yac_progress_remove(exchange);
+  exchange->state = EXCHANGE_IDLE;
+  call_complete(exchange);
+}
+
 static struct yac_interpolation_exchange * yac_interpolation_exchange_new_(
   Xt_redist redist, size_t count, char const * name) {
 
@@ -156,6 +198,8 @@ static struct yac_interpolation_exchange * yac_interpolation_exchange_new_(
     (redist != NULL) && (xt_redist_get_num_recv_msg(redist) > 0);
   exchange->dummy_buffer =
     xcalloc(exchange->count, sizeof(*(exchange->dummy_buffer)));
+  exchange->complete = NULL;
+  exchange->complete_data = NULL;
 
   exchange->empty_state =
     (exchange->is_source || exchange->is_target)?
@@ -198,7 +242,7 @@ int yac_interpolation_exchange_is_target(
   return exchange->is_target;
 }
 
-void yac_interpolation_exchange_wait(
+static void interpolation_exchange_wait(
   struct yac_interpolation_exchange * exchange, char const * routine_name) {
 
   // ensure that the exchange is not in waiting state
@@ -210,11 +254,19 @@ void yac_interpolation_exchange_wait(
   // if a previous put hat not yet been completed
   if (exchange->state == EXCHANGE_ACTIVE) {
     xt_request_wait(&(exchange->request));
-    exchange->state = EXCHANGE_IDLE;
+    set_idle(exchange);
   }
 }
 
-int yac_interpolation_exchange_test(
+void yac_interpolation_exchange_wait(
+  struct yac_interpolation_exchange * exchange, char const * routine_name) {
+
+  yac_progress_lock();
+  interpolation_exchange_wait(exchange, routine_name);
+  yac_progress_unlock();
+}
+
+static int interpolation_exchange_test(
   struct yac_interpolation_exchange * exchange, char const * routine_name) {
 
   YAC_ASSERT_F(
@@ -232,12 +284,21 @@ int yac_interpolation_exchange_test(
     case (EXCHANGE_ACTIVE): {
       int flag;
       xt_request_test(&(exchange->request), &flag);
-      if (flag) exchange->state = EXCHANGE_IDLE;
+      if (flag) set_idle(exchange);
       return flag;
     }
   }
 }
 
+int yac_interpolation_exchange_test(
+  struct yac_interpolation_exchange * exchange, char const * routine_name) {
+
+  yac_progress_lock();
+  int flag = interpolation_exchange_test(exchange, routine_name);
+  yac_progress_unlock();
+  return flag;
+}
+
 void yac_interpolation_exchange_execute_put(
   struct yac_interpolation_exchange * exchange, double const ** send_data_,
   char const * routine_name) {
@@ -245,9 +306,13 @@ void yac_interpolation_exchange_execute_put(
   // if we have to do an exchange
   if (exchange->redist != NULL) {
 
+    yac_progress_lock();
+
     // if a previous put has not yet been completed
-    if (exchange->is_source && (exchange->state == EXCHANGE_ACTIVE))
+    if (exchange->is_source && (exchange->state == EXCHANGE_ACTIVE)) {
       xt_request_wait(&(exchange->request));
+      set_idle(exchange);
+    }
 
     // ensure that we are in idle state
     YAC_ASSERT_F(
@@ -275,11 +340,13 @@ void yac_interpolation_exchange_execute_put(
           exchange->redist, exchange->count,
           (void const **)send_data, exchange->dummy_buffer,
           &(exchange->request));
-        exchange->state = EXCHANGE_ACTIVE;
+        set_active(exchange);
       } else {
         do_empty_exchange(exchange, 1, routine_name);
       }
     }
+
+    yac_progress_unlock();
   }
 }
 
@@ -293,6 +360,8 @@ void yac_interpolation_exchange_execute_get(
     // if we are source but not target -> there is nothing to be done
     if (exchange->is_source && !exchange->is_target) return;
 
+    yac_progress_lock();
+
     // if we are target, the active state should be impossible
     YAC_ASSERT_F(
       (!exchange->is_target) ||
@@ -325,6 +394,62 @@ void yac_interpolation_exchange_execute_get(
       do_empty_exchange(exchange, 0, routine_name);
     }
     exchange->state = EXCHANGE_IDLE;
+
+    yac_progress_unlock();
+  }
+}
+
+void yac_interpolation_exchange_execute_get_async(
+  struct yac_interpolation_exchange * exchange, double ** recv_data,
+  yac_interpolation_exchange_complete_func complete, void * complete_data,
+  char const * routine_name) {
+
+  // if we have to do an exchange
+  if (exchange->redist != NULL) {
+
+    // if we are source but not target -> there is nothing to be done
+    if (exchange->is_source && !exchange->is_target) return;
+
+    yac_progress_lock();
+
+    // if we are target, the active state should be impossible
+    YAC_ASSERT_F(
+      (!exchange->is_target) ||
+      (exchange->state != EXCHANGE_ACTIVE),
+      "ERROR(%s): state of exchange \"%s\" is inconsistent",
+      routine_name, exchange->name);
+
+    // if we are source, we should be in waiting state
+    YAC_ASSERT_F(
+      (!exchange->is_source) ||
+      (exchange->state == EXCHANGE_WAIT),
+      "ERROR(%s): send buffer has not yet been set for \"%s\" exchange",
+      routine_name, exchange->name);
+
+    // if we are either source or target
+    if (exchange->is_source || exchange->is_target) {
+
+      void const ** send_data;
+
+      // if we have to send data
+      send_data =
+        (exchange->is_source)?
+          exchange->temp_send_buffer:
+          (void const **)(exchange->dummy_buffer);
+
+      // start the actual exchange
+      xt_redist_a_exchange(
+        exchange->redist, exchange->count, send_data, (void **)recv_data,
+        &(exchange->request));
+      exchange->complete = complete;
+      exchange->complete_data = complete_data;
+      set_active(exchange);
+    } else {
+      do_empty_exchange(exchange, 0, routine_name);
+      exchange->state = EXCHANGE_IDLE;
+    }
+
+    yac_progress_unlock();
   }
 }
 
@@ -333,6 +458,8 @@ void yac_interpolation_exchange_execute(
   double const ** send_data_, double ** recv_data_,
   char const * routine_name) {
 
+  yac_progress_lock();
+
   // ensure that the exchange is in idle state
   YAC_ASSERT_F(
     exchange->state == EXCHANGE_IDLE, "ERROR(%s): "
@@ -357,13 +484,17 @@ void yac_interpolation_exchange_execute(
 
     exchange->state = EXCHANGE_IDLE;
   }
+
+  yac_progress_unlock();
 }
 
 void yac_interpolation_exchange_delete(
   struct yac_interpolation_exchange * exchange, char const * routine_name) {
 
+  yac_progress_lock();
+
   if (exchange->state != EXCHANGE_IDLE)
-    yac_interpolation_exchange_wait(exchange, routine_name);
+    interpolation_exchange_wait(exchange, routine_name);
 
   free(exchange->name);
 
@@ -371,6 +502,9 @@ void yac_interpolation_exchange_delete(
     xt_request_wait(&(exchange->request));
     xt_redist_delete(exchange->redist);
   }
+
+  yac_progress_unlock();
+
   free(exchange->dummy_buffer);
   free(exchange);
 }
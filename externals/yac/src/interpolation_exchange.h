@@ -54,6 +54,8 @@
 
 struct yac_interpolation_exchange;
 
+typedef void (*yac_interpolation_exchange_complete_func)(void * data);
+
 struct yac_interpolation_exchange * yac_interpolation_exchange_new(
   Xt_redist * redists, size_t num_fields, size_t collection_size,
   int with_frac_mask, char const * name);
@@ -78,6 +80,16 @@ int yac_interpolation_exchange_test(
 void yac_interpolation_exchange_execute_get(
   struct yac_interpolation_exchange * exchange, double ** recv_data,
   char const * routine_name);
+// starts the get without waiting for its completion, recv_data may only be
+// accessed after a call to yac_interpolation_exchange_wait or once complete
+// has been called; complete (may be NULL) is called exactly once by whoever
+// detects the completion of the get (yac_interpolation_exchange_test,
+// yac_interpolation_exchange_wait, or the progress thread), while the
+// progress lock is held
+void yac_interpolation_exchange_execute_get_async(
+  struct yac_interpolation_exchange * exchange, double ** recv_data,
+  yac_interpolation_exchange_complete_func complete, void * complete_data,
+  char const * routine_name);
 
 void yac_interpolation_exchange_delete(
   struct yac_interpolation_exchange * exchange, char const * routine_name);
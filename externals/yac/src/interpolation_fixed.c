@@ -60,7 +60,7 @@ static void yac_interpolation_fixed_execute(
 static void yac_interpolation_fixed_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks,
-  int is_target, double frac_mask_fallback_value,
+  int is_target, int zero_copy, double frac_mask_fallback_value,
   double scale_factor, double scale_summand);
 static void yac_interpolation_fixed_execute_get(
   struct interpolation_type * interp, double ** tgt_field,
@@ -93,11 +93,14 @@ struct interpolation_fixed {
   size_t * pos;
   size_t count;
 
+  int use_single_precision;
+
   int ref_count;
 };
 
 struct interpolation_type * yac_interpolation_fixed_new(
-  size_t collection_size, double value, size_t count, size_t const * pos) {
+  size_t collection_size, double value, size_t count, size_t const * pos,
+  int use_single_precision) {
 
   struct interpolation_fixed * fixed = xmalloc(1 * sizeof(*fixed));
 
@@ -106,6 +109,7 @@ struct interpolation_type * yac_interpolation_fixed_new(
   fixed->value = value;
   fixed->count = count;
   fixed->pos = COPY_DATA(pos, count);
+  fixed->use_single_precision = use_single_precision;
   fixed->ref_count = 1;
 
   return (struct interpolation_type *)fixed;
@@ -133,9 +137,16 @@ static void yac_interpolation_fixed_execute_get_(
   size_t const count           = fixed->count;
   size_t const collection_size = fixed->collection_size;
 
-  for (size_t l = 0; l < collection_size; ++l)
-    for (size_t j = 0; j < count; ++j)
-      tgt_field[l][pos[j]] = value;
+  if (fixed->use_single_precision) {
+    float ** tgt_field_float = (float **)tgt_field;
+    for (size_t l = 0; l < collection_size; ++l)
+      for (size_t j = 0; j < count; ++j)
+        tgt_field_float[l][pos[j]] = (float)value;
+  } else {
+    for (size_t l = 0; l < collection_size; ++l)
+      for (size_t j = 0; j < count; ++j)
+        tgt_field[l][pos[j]] = value;
+  }
 }
 
 static void yac_interpolation_fixed_execute_get(
@@ -166,13 +177,14 @@ static void yac_interpolation_fixed_execute(
 static void yac_interpolation_fixed_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks,
-  int is_target, double frac_mask_fallback_value,
+  int is_target, int zero_copy, double frac_mask_fallback_value,
   double scale_factor, double scale_summand) {
 
   UNUSED(interp);
   UNUSED(src_fields);
   UNUSED(src_frac_masks);
   UNUSED(is_target);
+  UNUSED(zero_copy);
   UNUSED(frac_mask_fallback_value);
   UNUSED(scale_factor);
   UNUSED(scale_summand);
@@ -49,6 +49,7 @@
 #include "interpolation.h"
 
 struct interpolation_type * yac_interpolation_fixed_new(
-  size_t collection_size, double value, size_t count, size_t const * pos);
+  size_t collection_size, double value, size_t count, size_t const * pos,
+  int use_single_precision);
 
 #endif // INTERPOLATION_FIXED_H
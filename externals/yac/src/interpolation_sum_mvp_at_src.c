@@ -62,7 +62,7 @@ static void yac_interpolation_sum_mvp_at_src_execute(
 static void yac_interpolation_sum_mvp_at_src_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks,
-  int is_target, double frac_mask_fallback_value,
+  int is_target, int zero_copy, double frac_mask_fallback_value,
   double scale_factor, double scale_summand);
 static void yac_interpolation_sum_mvp_at_src_execute_get(
   struct interpolation_type * interp, double ** tgt_field,
@@ -131,6 +131,8 @@ struct interpolation_sum_mvp_at_src {
   int is_source;
   int is_target;
 
+  int use_single_precision;
+
   int * ref_count;
 };
 
@@ -142,7 +144,7 @@ static struct interpolation_type * yac_interpolation_sum_mvp_at_src_new_(
   struct yac_interpolation_exchange * result2tgt,
   size_t tgt_count, size_t * num_src_per_tgt, double * weights,
   size_t * src_field_idx, size_t * src_idx, size_t num_src_fields,
-  int with_frac_mask, int * ref_count) {
+  int with_frac_mask, int use_single_precision, int * ref_count) {
 
   struct interpolation_sum_mvp_at_src * mvp_at_src =
     xmalloc(1 * sizeof(*mvp_at_src));
@@ -170,6 +172,7 @@ static struct interpolation_type * yac_interpolation_sum_mvp_at_src_new_(
     yac_interpolation_exchange_is_source(mvp_at_src->result2tgt);
   mvp_at_src->is_target =
     yac_interpolation_exchange_is_target(mvp_at_src->result2tgt);
+  mvp_at_src->use_single_precision = use_single_precision;
 
   mvp_at_src->ref_count =
     (ref_count == NULL)?xcalloc(1, sizeof(*mvp_at_src->ref_count)):ref_count;
@@ -182,7 +185,8 @@ struct interpolation_type * yac_interpolation_sum_mvp_at_src_new(
   size_t collection_size, Xt_redist * halo_redists,
   size_t tgt_count, size_t * num_src_per_tgt, double * weights,
   size_t * src_field_idx, size_t * src_idx,
-  size_t num_src_fields, Xt_redist result_redist_, int with_frac_mask) {
+  size_t num_src_fields, Xt_redist result_redist_, int with_frac_mask,
+  int use_single_precision) {
 
   size_t total_num_src = 0;
   for (size_t i = 0; i < tgt_count; ++i) total_num_src += num_src_per_tgt[i];
@@ -205,7 +209,7 @@ struct interpolation_type * yac_interpolation_sum_mvp_at_src_new(
       (weights != NULL)?COPY_DATA(weights, total_num_src):NULL,
       COPY_DATA(src_field_idx, total_num_src),
       COPY_DATA(src_idx, total_num_src),
-      num_src_fields, with_frac_mask, NULL);
+      num_src_fields, with_frac_mask, use_single_precision, NULL);
 }
 
 static int yac_interpolation_sum_mvp_at_src_is_source(
@@ -260,7 +264,8 @@ static void yac_interpolation_sum_mvp_at_src_execute(
       sum_mvp_at_src->src2halo, (double const **)temp_src_fields,
       halo_buffers, "yac_interpolation_sum_mvp_at_src_execute");
 
-    compute_tgt_field_wgt(
+    compute_tgt_field_wgt_prec(
+      sum_mvp_at_src->use_single_precision,
       (double const * restrict **)src_fields,
       (double const * restrict **)(with_frac_mask?src_frac_masks:NULL),
       (double const * restrict *)halo_buffers,
@@ -285,11 +290,16 @@ static void yac_interpolation_sum_mvp_at_src_execute(
 static void yac_interpolation_sum_mvp_at_src_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks, int is_target,
-  double frac_mask_fallback_value, double scale_factor, double scale_summand) {
+  int zero_copy, double frac_mask_fallback_value, double scale_factor,
+  double scale_summand) {
 
   struct interpolation_sum_mvp_at_src * sum_mvp_at_src =
     (struct interpolation_sum_mvp_at_src *)interp;
 
+  // only the results of the weighted sums are sent, the source fields
+  // themselves are never passed to the exchange
+  UNUSED(zero_copy);
+
   // wait until previous put is completed
   yac_interpolation_exchange_wait(
     sum_mvp_at_src->result2tgt,
@@ -320,7 +330,8 @@ static void yac_interpolation_sum_mvp_at_src_execute_put(
 
   double ** results = sum_mvp_at_src->result_data.buffer;
 
-  compute_tgt_field_wgt(
+  compute_tgt_field_wgt_prec(
+    sum_mvp_at_src->use_single_precision,
     (double const * restrict **)src_fields,
     (double const * restrict **)(with_frac_mask?src_frac_masks:NULL),
     (double const * restrict *)halo_buffers,
@@ -381,7 +392,8 @@ static struct interpolation_type * yac_interpolation_sum_mvp_at_src_copy(
       sum_mvp_at_src->num_src_per_tgt, sum_mvp_at_src->weights,
       sum_mvp_at_src->src_field_idx, sum_mvp_at_src->src_idx,
       sum_mvp_at_src->num_src_fields,
-      sum_mvp_at_src->with_frac_mask, sum_mvp_at_src->ref_count);
+      sum_mvp_at_src->with_frac_mask, sum_mvp_at_src->use_single_precision,
+      sum_mvp_at_src->ref_count);
 }
 
 static void yac_interpolation_sum_mvp_at_src_delete(
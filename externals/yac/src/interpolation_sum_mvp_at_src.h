@@ -52,6 +52,7 @@ struct interpolation_type * yac_interpolation_sum_mvp_at_src_new(
   size_t collection_size, Xt_redist * halo_redists,
   size_t tgt_count, size_t * num_src_per_tgt, double * weights,
   size_t * src_field_idx, size_t * src_idx,
-  size_t num_src_fields, Xt_redist result_redist, int with_frac_mask);
+  size_t num_src_fields, Xt_redist result_redist, int with_frac_mask,
+  int use_single_precision);
 
 #endif // INTERPOLATION_SUM_MVP_AT_SRC_H
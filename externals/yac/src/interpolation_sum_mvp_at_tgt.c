@@ -62,7 +62,7 @@ static void yac_interpolation_sum_mvp_at_tgt_execute(
 static void yac_interpolation_sum_mvp_at_tgt_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks,
-  int is_target, double frac_mask_fallback_value,
+  int is_target, int zero_copy, double frac_mask_fallback_value,
   double scale_factor, double scale_summand);
 static void yac_interpolation_sum_mvp_at_tgt_execute_get(
   struct interpolation_type * interp, double ** tgt_field,
@@ -85,6 +85,39 @@ static struct interpolation_type_vtable const interpolation_sum_mvp_at_tgt_vtabl
   .delete           = yac_interpolation_sum_mvp_at_tgt_delete,
 };
 
+// maximum number of groups into which the source processes are split, the
+// data of each group is received by a separate exchange, such that the
+// target points depending on it can be computed as soon as it is available
+#define MAX_NUM_SRC_GROUPS (8)
+
+/* compressed sparse row (CSR) representation of the source indices, which
+ * is generated once at setup and used by the get operation (the weights are
+ * already stored in the required order)
+ *
+ * The source offsets are relative to the start of the data of a collection
+ * member in the receive buffer (remote source points) or the send buffer
+ * (local source points). Offsets of local source points are shifted by
+ * remote_block_size.
+ *
+ * The rows are sorted into buckets:
+ *   - bucket 0: targets that only depend on local source points
+ *   - bucket 1 + g: targets whose remote source points are all received from
+ *                   source group g
+ *   - bucket 1 + num_src_groups: all remaining targets
+ */
+struct sum_mvp_at_tgt_csr {
+  size_t * row_ptr;    // [tgt_count + 1]
+  size_t * src_offset; // [total_num_src]
+  size_t remote_block_size;
+  size_t * bucket_ptr; // [num_src_groups + 3]
+};
+
+// argument of the completion routine of the get of a source group exchange
+struct src_group_get {
+  struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt;
+  size_t bucket;
+};
+
 struct interpolation_sum_mvp_at_tgt {
 
   struct interpolation_type_vtable const * vtable;
@@ -102,45 +135,406 @@ struct interpolation_sum_mvp_at_tgt {
    *         that each target process can compute its own target field
    *         - send buffer: src_send_buffer
    *         - recv buffer: src_recv_buffer
-   *         - exchange: src2tgt
+   *         - exchange: src2tgt[g] of the group g of the source process
    *  get:
-   *      I. target processes receive source data from source processes
+   *      I. target processes start receiving source data from all source
+   *         groups
    *         - send buffer: src_send_buffer
    *         - recv buffer: src_recv_buffer
-   *         - exchange: src2tgt
-   *     II. target process comput their target field
-   *         - from buffer: src_recv_buffer
+   *         - exchanges: src2tgt
+   *     II. target processes compute all target points that only depend
+   *         on local source points, while the exchanges are in progress
+   *         - from buffer: src_send_buffer
+   *         - to buffer: tgt_field provied by the user
+   *    III. target processes compute the target points of each source
+   *         group, as soon as its exchange is completed (this is done by
+   *         the completion routine of the exchange, which may also be
+   *         called by the progress thread)
+   *         - from buffer: src_recv_buffer and src_send_buffer
+   *         - to buffer: tgt_field provied by the user
+   *     IV. target processes compute the target points that depend on
+   *         multiple source groups
+   *         - from buffer: src_recv_buffer and src_send_buffer
    *         - to buffer: tgt_field provied by the user
    */
 
   struct yac_interpolation_buffer src_send_data;
   struct yac_interpolation_buffer src_recv_data;
-  struct yac_interpolation_exchange * src2tgt;
+  struct yac_interpolation_exchange ** src2tgt; // [num_src_groups]
+  size_t num_src_groups;
+  struct src_group_get * src_group_get; // [num_src_groups]
+
+  // arguments of the current get (required by the completion routines of
+  // the source group exchanges)
+  double ** get_tgt_field;
+  double get_frac_mask_fallback_value;
+  double get_scale_factor;
+  double get_scale_summand;
 
-  double *** src_fields;
-  double *** src_frac_masks;
   double ** src_fields_buffer;
   size_t * tgt_pos;
   size_t tgt_count;
-  size_t * num_src_per_tgt;
   double * weights;
-  size_t * src_field_idx;
-  size_t * src_idx;
   size_t num_src_fields;
   int is_source;
   int is_target;
 
+  struct sum_mvp_at_tgt_csr csr;
+
+  // pointers to the start of the data of each collection member
+  // (required by the CSR kernel)
+  double ** local_src_fields;     // [collection_size]
+  double ** local_src_frac_masks; // [collection_size]
+  double ** remote_src_fields;     // [collection_size]
+  double ** remote_src_frac_masks; // [collection_size]
+
+  int use_single_precision;
+
   int * ref_count;
 };
 
+static struct sum_mvp_at_tgt_csr generate_csr(
+  struct yac_interpolation_buffer src_send_data, size_t tgt_count,
+  size_t const * num_src_per_tgt, size_t const * src_field_idx, size_t const * src_idx,
+  size_t num_src_fields, size_t element_size) {
+
+  struct sum_mvp_at_tgt_csr csr;
+
+  csr.row_ptr = xmalloc((tgt_count + 1) * sizeof(*csr.row_ptr));
+  csr.row_ptr[0] = 0;
+  for (size_t i = 0; i < tgt_count; ++i)
+    csr.row_ptr[i+1] = csr.row_ptr[i] + num_src_per_tgt[i];
+  size_t total_num_src = csr.row_ptr[tgt_count];
+
+  // the data of all remote source points is stored consecutively in the
+  // receive buffer of each collection member
+  size_t remote_block_size = 0;
+  for (size_t i = 0; i < total_num_src; ++i)
+    if ((src_field_idx[i] == SIZE_MAX) && (src_idx[i] >= remote_block_size))
+      remote_block_size = src_idx[i] + 1;
+  csr.remote_block_size = remote_block_size;
+
+  // the data of all local source fields of a collection member is stored
+  // consecutively in the send buffer, the layout is identical for all
+  // collection members
+  size_t * local_field_offsets =
+    xmalloc(num_src_fields * sizeof(*local_field_offsets));
+  for (size_t j = 0; j < num_src_fields; ++j)
+    local_field_offsets[j] =
+      (size_t)((char*)(src_send_data.buffer[j]) -
+               (char*)(src_send_data.buffer[0])) / element_size;
+
+  csr.src_offset = xmalloc(total_num_src * sizeof(*csr.src_offset));
+  for (size_t i = 0; i < total_num_src; ++i)
+    csr.src_offset[i] =
+      (src_field_idx[i] == SIZE_MAX)?
+        src_idx[i]:
+        (remote_block_size + local_field_offsets[src_field_idx[i]] +
+         src_idx[i]);
+  free(local_field_offsets);
+
+  return csr;
+}
+
+// marks all elements of the receive buffer, which are received through the
+// given datatype, with the provided value
+static void mark_recv_elements(
+  void * recv_buffer, MPI_Datatype recv_dt, double value,
+  int use_single_precision, MPI_Comm comm) {
+
+  MPI_Datatype element_dt = use_single_precision?MPI_FLOAT:MPI_DOUBLE;
+  size_t element_size = use_single_precision?sizeof(float):sizeof(double);
+
+  int type_size;
+  yac_mpi_call(MPI_Type_size(recv_dt, &type_size), comm);
+  int count = (int)((size_t)type_size / element_size);
+
+  void * values = xmalloc((size_t)count * element_size);
+  for (int i = 0; i < count; ++i) {
+    if (use_single_precision) ((float*)values)[i] = (float)value;
+    else                      ((double*)values)[i] = value;
+  }
+
+  int pack_size, position = 0;
+  yac_mpi_call(
+    MPI_Pack_size(count, element_dt, comm, &pack_size), comm);
+  void * pack_buffer = xmalloc((size_t)pack_size);
+  yac_mpi_call(
+    MPI_Pack(
+      values, count, element_dt, pack_buffer, pack_size, &position, comm),
+    comm);
+  position = 0;
+  yac_mpi_call(
+    MPI_Unpack(
+      pack_buffer, pack_size, &position, recv_buffer, 1, recv_dt, comm),
+    comm);
+
+  free(pack_buffer);
+  free(values);
+}
+
+// splits the source processes into groups of consecutive ranks and generates
+// one exchange per group, each group exchange only contains the messages
+// sent by the processes of the respective group; in addition, the source
+// group of each element in the receive buffer of a collection member is
+// determined (the receive buffer is used as scratch buffer)
+static struct yac_interpolation_exchange ** generate_src2tgt(
+  Xt_redist * src_redists, size_t num_src_fields, size_t collection_size,
+  int with_frac_mask, int use_single_precision,
+  struct yac_interpolation_buffer src_recv_data, size_t * num_src_groups_,
+  size_t ** recv_src_group) {
+
+  struct yac_interpolation_exchange ** src2tgt;
+
+  // if there is no exchange at all
+  if ((src_redists == NULL) || (src_redists[0] == NULL)) {
+    src2tgt = xmalloc(1 * sizeof(*src2tgt));
+    src2tgt[0] =
+      yac_interpolation_exchange_new(
+        src_redists, num_src_fields, collection_size, with_frac_mask,
+        "source to target");
+    *num_src_groups_ = 1;
+    *recv_src_group = NULL;
+    return src2tgt;
+  }
+
+  MPI_Comm comm = xt_redist_get_MPI_Comm(src_redists[0]);
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  size_t num_src_groups = MIN((size_t)comm_size, MAX_NUM_SRC_GROUPS);
+#define GET_SRC_GROUP(RANK) \
+  (((size_t)(RANK) * num_src_groups) / (size_t)comm_size)
+  size_t local_src_group = GET_SRC_GROUP(comm_rank);
+
+  size_t element_size =
+    use_single_precision?sizeof(float):sizeof(double);
+  size_t num_recv_elements = 0;
+  for (size_t j = 0; j < num_src_fields; ++j)
+    num_recv_elements += src_recv_data.buffer_sizes[j] / element_size;
+  for (size_t i = 0; i < num_recv_elements; ++i) {
+    if (use_single_precision)
+      ((float*)(src_recv_data.buffer[0]))[i] = -1.0f;
+    else
+      ((double*)(src_recv_data.buffer[0]))[i] = -1.0;
+  }
+
+  Xt_redist * group_redists =
+    xmalloc(num_src_groups * num_src_fields * sizeof(*group_redists));
+  struct Xt_redist_msg * msgs = xmalloc(2 * (size_t)comm_size * sizeof(*msgs));
+  struct Xt_redist_msg * send_msgs = msgs;
+  struct Xt_redist_msg * recv_msgs = msgs + comm_size;
+  int * group_nrecv = xmalloc(num_src_groups * sizeof(*group_nrecv));
+
+  for (size_t j = 0; j < num_src_fields; ++j) {
+
+    int nsend = 0, nrecv = 0;
+    for (size_t g = 0; g < num_src_groups; ++g) group_nrecv[g] = 0;
+
+    for (int rank = 0; rank < comm_size; ++rank) {
+      MPI_Datatype send_dt =
+        xt_redist_get_send_MPI_Datatype(src_redists[j], rank);
+      if (send_dt != MPI_DATATYPE_NULL) {
+        send_msgs[nsend].rank = rank;
+        send_msgs[nsend].datatype = send_dt;
+        ++nsend;
+      }
+      MPI_Datatype recv_dt =
+        xt_redist_get_recv_MPI_Datatype(src_redists[j], rank);
+      if (recv_dt != MPI_DATATYPE_NULL) {
+        size_t src_group = GET_SRC_GROUP(rank);
+        mark_recv_elements(
+          src_recv_data.buffer[j], recv_dt, (double)src_group,
+          use_single_precision, comm);
+        recv_msgs[nrecv].rank = rank;
+        recv_msgs[nrecv].datatype = recv_dt;
+        ++nrecv;
+        group_nrecv[src_group]++;
+      }
+    }
+
+    // the receive messages are sorted by rank and therefore by source group
+    for (size_t g = 0, recv_offset = 0; g < num_src_groups;
+         recv_offset += (size_t)(group_nrecv[g++])) {
+      group_redists[g * num_src_fields + j] =
+        xt_redist_single_array_base_new(
+          (g == local_src_group)?nsend:0, group_nrecv[g],
+          send_msgs, recv_msgs + recv_offset, comm);
+    }
+
+    for (int i = 0; i < nsend; ++i)
+      yac_mpi_call(MPI_Type_free(&(send_msgs[i].datatype)), comm);
+    for (int i = 0; i < nrecv; ++i)
+      yac_mpi_call(MPI_Type_free(&(recv_msgs[i].datatype)), comm);
+  }
+#undef GET_SRC_GROUP
+
+  free(group_nrecv);
+  free(msgs);
+
+  src2tgt = xmalloc(num_src_groups * sizeof(*src2tgt));
+  for (size_t g = 0; g < num_src_groups; ++g) {
+    src2tgt[g] =
+      yac_interpolation_exchange_new(
+        group_redists + g * num_src_fields, num_src_fields,
+        collection_size, with_frac_mask, "source to target");
+    for (size_t j = 0; j < num_src_fields; ++j)
+      xt_redist_delete(group_redists[g * num_src_fields + j]);
+  }
+  free(group_redists);
+
+  *recv_src_group = xmalloc(num_recv_elements * sizeof(**recv_src_group));
+  for (size_t i = 0; i < num_recv_elements; ++i) {
+    double value =
+      use_single_precision?
+        (double)(((float*)(src_recv_data.buffer[0]))[i]):
+        ((double*)(src_recv_data.buffer[0]))[i];
+    (*recv_src_group)[i] = (value < 0.0)?SIZE_MAX:(size_t)value;
+  }
+
+  *num_src_groups_ = num_src_groups;
+  return src2tgt;
+}
+
+// determines for each target the CSR bucket, in which it is evaluated
+static size_t * get_tgt_buckets(
+  size_t tgt_count, size_t const * num_src_per_tgt,
+  size_t const * src_field_idx, size_t const * src_idx,
+  size_t const * recv_src_group, size_t num_src_groups) {
+
+  size_t * tgt_bucket = xmalloc(tgt_count * sizeof(*tgt_bucket));
+  size_t mixed_bucket = num_src_groups + 1;
+
+  for (size_t i = 0, offset = 0; i < tgt_count; ++i) {
+    size_t curr_num_src = num_src_per_tgt[i];
+    size_t bucket = 0;
+    for (size_t j = 0; j < curr_num_src; ++j, ++offset) {
+      if (src_field_idx[offset] != SIZE_MAX) continue;
+      size_t src_group = recv_src_group[src_idx[offset]];
+      YAC_ASSERT(
+        src_group < num_src_groups,
+        "ERROR(get_tgt_buckets): remote source point is not received")
+      if (bucket == 0) bucket = src_group + 1;
+      else if (bucket != src_group + 1) bucket = mixed_bucket;
+    }
+    tgt_bucket[i] = bucket;
+  }
+  return tgt_bucket;
+}
+
+// sorts the targets by their bucket (the relative order of the targets within
+// a bucket is kept); returns the start of each bucket
+static size_t * sort_tgts_by_bucket(
+  size_t * tgt_pos, size_t tgt_count, size_t * num_src_per_tgt,
+  double * weights, size_t * src_field_idx, size_t * src_idx,
+  size_t const * tgt_bucket, size_t num_buckets) {
+
+  size_t * bucket_ptr = xcalloc(num_buckets + 1, sizeof(*bucket_ptr));
+  size_t * src_bucket_ptr = xcalloc(num_buckets + 1, sizeof(*src_bucket_ptr));
+  size_t total_num_src = 0;
+  for (size_t i = 0; i < tgt_count; ++i) {
+    bucket_ptr[tgt_bucket[i] + 1]++;
+    src_bucket_ptr[tgt_bucket[i] + 1] += num_src_per_tgt[i];
+    total_num_src += num_src_per_tgt[i];
+  }
+  for (size_t i = 0; i < num_buckets; ++i) {
+    bucket_ptr[i + 1] += bucket_ptr[i];
+    src_bucket_ptr[i + 1] += src_bucket_ptr[i];
+  }
+
+  // nothing to be done, if all targets are in the same bucket
+  int is_sorted = 0;
+  for (size_t i = 0; (i < num_buckets) && !is_sorted; ++i)
+    is_sorted = bucket_ptr[i + 1] - bucket_ptr[i] == tgt_count;
+  if (is_sorted || (tgt_count == 0)) {
+    free(src_bucket_ptr);
+    return bucket_ptr;
+  }
+
+  size_t * size_t_buffer =
+    xmalloc((2 * tgt_count + 2 * total_num_src + num_buckets) *
+            sizeof(*size_t_buffer));
+  size_t * new_tgt_pos = size_t_buffer;
+  size_t * new_num_src_per_tgt = size_t_buffer + tgt_count;
+  size_t * new_src_field_idx = size_t_buffer + 2 * tgt_count;
+  size_t * new_src_idx = size_t_buffer + 2 * tgt_count + total_num_src;
+  size_t * tgt_offsets =
+    size_t_buffer + 2 * tgt_count + 2 * total_num_src;
+  double * new_weights =
+    (weights != NULL)?xmalloc(total_num_src * sizeof(*new_weights)):NULL;
+  memcpy(tgt_offsets, bucket_ptr, num_buckets * sizeof(*tgt_offsets));
+
+  for (size_t i = 0, offset = 0; i < tgt_count; ++i) {
+    size_t bucket = tgt_bucket[i];
+    size_t curr_num_src = num_src_per_tgt[i];
+    size_t new_tgt_idx = tgt_offsets[bucket]++;
+    size_t new_offset = src_bucket_ptr[bucket];
+    src_bucket_ptr[bucket] += curr_num_src;
+    new_tgt_pos[new_tgt_idx] = tgt_pos[i];
+    new_num_src_per_tgt[new_tgt_idx] = curr_num_src;
+    memcpy(new_src_field_idx + new_offset, src_field_idx + offset,
+           curr_num_src * sizeof(*src_field_idx));
+    memcpy(new_src_idx + new_offset, src_idx + offset,
+           curr_num_src * sizeof(*src_idx));
+    if (weights != NULL)
+      memcpy(new_weights + new_offset, weights + offset,
+             curr_num_src * sizeof(*weights));
+    offset += curr_num_src;
+  }
+
+  memcpy(tgt_pos, new_tgt_pos, tgt_count * sizeof(*tgt_pos));
+  memcpy(num_src_per_tgt, new_num_src_per_tgt,
+         tgt_count * sizeof(*num_src_per_tgt));
+  memcpy(src_field_idx, new_src_field_idx,
+         total_num_src * sizeof(*src_field_idx));
+  memcpy(src_idx, new_src_idx, total_num_src * sizeof(*src_idx));
+  if (weights != NULL)
+    memcpy(weights, new_weights, total_num_src * sizeof(*weights));
+
+  free(new_weights);
+  free(size_t_buffer);
+  free(src_bucket_ptr);
+
+  return bucket_ptr;
+}
+
+static void set_collection_pointers(
+  struct interpolation_sum_mvp_at_tgt * mvp_at_tgt) {
+
+  size_t collection_size = mvp_at_tgt->collection_size;
+  size_t num_src_fields = mvp_at_tgt->num_src_fields;
+  size_t num_ptrs =
+    (mvp_at_tgt->with_frac_mask?2:1) * collection_size;
+  double ** send_buffer = mvp_at_tgt->src_send_data.buffer;
+  double ** recv_buffer = mvp_at_tgt->src_recv_data.buffer;
+
+  mvp_at_tgt->local_src_fields =
+    xmalloc(2 * num_ptrs * sizeof(*(mvp_at_tgt->local_src_fields)));
+  mvp_at_tgt->remote_src_fields = mvp_at_tgt->local_src_fields + num_ptrs;
+  for (size_t i = 0; i < num_ptrs; ++i) {
+    mvp_at_tgt->local_src_fields[i] = send_buffer[i * num_src_fields];
+    mvp_at_tgt->remote_src_fields[i] = recv_buffer[i * num_src_fields];
+  }
+  if (mvp_at_tgt->with_frac_mask) {
+    mvp_at_tgt->local_src_frac_masks =
+      mvp_at_tgt->local_src_fields + collection_size;
+    mvp_at_tgt->remote_src_frac_masks =
+      mvp_at_tgt->remote_src_fields + collection_size;
+  } else {
+    mvp_at_tgt->local_src_frac_masks = NULL;
+    mvp_at_tgt->remote_src_frac_masks = NULL;
+  }
+}
+
 static struct interpolation_type * yac_interpolation_sum_mvp_at_tgt_new_(
   size_t collection_size,
   struct yac_interpolation_buffer src_send_data,
   struct yac_interpolation_buffer src_recv_data,
-  struct yac_interpolation_exchange * src2tgt,
-  size_t * tgt_pos,  size_t tgt_count, size_t * num_src_per_tgt,
-  double * weights, size_t * src_field_idx, size_t * src_idx,
-  size_t num_src_fields, int with_frac_mask, int * ref_count) {
+  struct yac_interpolation_exchange ** src2tgt, size_t num_src_groups,
+  size_t * tgt_pos,  size_t tgt_count, double * weights,
+  size_t num_src_fields, struct sum_mvp_at_tgt_csr csr,
+  int with_frac_mask, int use_single_precision, int * ref_count) {
 
   struct interpolation_sum_mvp_at_tgt * mvp_at_tgt =
     xmalloc(1 * sizeof(*mvp_at_tgt));
@@ -151,32 +545,34 @@ static struct interpolation_type * yac_interpolation_sum_mvp_at_tgt_new_(
   mvp_at_tgt->src_send_data = src_send_data;
   mvp_at_tgt->src_recv_data = src_recv_data;
   mvp_at_tgt->src2tgt = src2tgt;
-  mvp_at_tgt->src_fields =
-    xmalloc(collection_size * sizeof(*(mvp_at_tgt->src_fields)));
-  for (size_t i = 0; i < collection_size; ++i)
-    mvp_at_tgt->src_fields[i] = mvp_at_tgt->src_send_data.buffer + i * num_src_fields;
-  if (with_frac_mask) {
-    mvp_at_tgt->src_frac_masks =
-      xmalloc(collection_size * sizeof(*(mvp_at_tgt->src_frac_masks)));
-    for (size_t i = 0; i < collection_size; ++i)
-      mvp_at_tgt->src_frac_masks[i] =
-        mvp_at_tgt->src_send_data.buffer + (collection_size + i) * num_src_fields;
-  } else {
-    mvp_at_tgt->src_frac_masks = NULL;
+  mvp_at_tgt->num_src_groups = num_src_groups;
+  mvp_at_tgt->src_group_get =
+    xmalloc(num_src_groups * sizeof(*(mvp_at_tgt->src_group_get)));
+  for (size_t g = 0; g < num_src_groups; ++g) {
+    mvp_at_tgt->src_group_get[g].sum_mvp_at_tgt = mvp_at_tgt;
+    mvp_at_tgt->src_group_get[g].bucket = g + 1;
   }
+  mvp_at_tgt->get_tgt_field = NULL;
   mvp_at_tgt->src_fields_buffer =
     xcalloc((with_frac_mask?2*collection_size:collection_size) *
             num_src_fields, sizeof(*(mvp_at_tgt->src_fields_buffer)));
   mvp_at_tgt->tgt_pos = tgt_pos;
   mvp_at_tgt->tgt_count = tgt_count;
-  mvp_at_tgt->num_src_per_tgt = num_src_per_tgt;
   mvp_at_tgt->weights = weights;
-  mvp_at_tgt->src_field_idx = src_field_idx;
-  mvp_at_tgt->src_idx = src_idx;
   mvp_at_tgt->num_src_fields = num_src_fields;
-  mvp_at_tgt->is_source =
-    yac_interpolation_exchange_is_source(mvp_at_tgt->src2tgt);
+  // processes that use local source points also have to provide their
+  // source fields, even if they do not send any data to other processes
+  int has_local_src = 0;
+  for (size_t i = 0; (i < csr.row_ptr[tgt_count]) && !has_local_src; ++i)
+    has_local_src = csr.src_offset[i] >= csr.remote_block_size;
+  int is_exchange_source = 0;
+  for (size_t g = 0; (g < num_src_groups) && !is_exchange_source; ++g)
+    is_exchange_source = yac_interpolation_exchange_is_source(src2tgt[g]);
+  mvp_at_tgt->is_source = is_exchange_source || has_local_src;
   mvp_at_tgt->is_target = tgt_count > 0;
+  mvp_at_tgt->csr = csr;
+  mvp_at_tgt->use_single_precision = use_single_precision;
+  set_collection_pointers(mvp_at_tgt);
 
   mvp_at_tgt->ref_count =
     (ref_count == NULL)?xcalloc(1, sizeof(*mvp_at_tgt->ref_count)):ref_count;
@@ -189,7 +585,10 @@ struct interpolation_type * yac_interpolation_sum_mvp_at_tgt_new(
   size_t collection_size, Xt_redist * src_redists, size_t * tgt_pos,
   size_t tgt_count, size_t * num_src_per_tgt, double * weights,
   size_t * src_field_idx, size_t * src_idx,
-  size_t num_src_fields, int with_frac_mask) {
+  size_t num_src_fields, int with_frac_mask, int use_single_precision) {
+
+  size_t element_size =
+    use_single_precision?sizeof(float):sizeof(double);
 
   size_t total_num_src = 0;
   for (size_t i = 0; i < tgt_count; ++i) total_num_src += num_src_per_tgt[i];
@@ -205,30 +604,63 @@ struct interpolation_type * yac_interpolation_sum_mvp_at_tgt_new(
     for (size_t j = 0; j < curr_num_src; ++j, ++offset) {
       size_t curr_src_field_idx = src_field_idx[offset];
       if (curr_src_field_idx == SIZE_MAX) continue;
-      size_t curr_src_extent = (src_idx[offset] + 1) * sizeof(double);
+      size_t curr_src_extent = (src_idx[offset] + 1) * element_size;
       if (min_buffer_sizes[curr_src_field_idx] < curr_src_extent)
         min_buffer_sizes[curr_src_field_idx] = curr_src_extent;
     }
   }
 
+  struct yac_interpolation_buffer src_send_data =
+    yac_interpolation_buffer_init_2(
+      src_redists, min_buffer_sizes, num_src_fields,
+      with_frac_mask?2*collection_size:collection_size, SEND_BUFFER);
+
+  tgt_pos = COPY_DATA(tgt_pos, tgt_count);
+  num_src_per_tgt = COPY_DATA(num_src_per_tgt, tgt_count);
+  weights = (weights != NULL)?COPY_DATA(weights, total_num_src):NULL;
+  src_field_idx = COPY_DATA(src_field_idx, total_num_src);
+  src_idx = COPY_DATA(src_idx, total_num_src);
+
+  struct yac_interpolation_buffer src_recv_data =
+    yac_interpolation_buffer_init(
+      src_redists, num_src_fields,
+      with_frac_mask?2*collection_size:collection_size, RECV_BUFFER);
+
+  size_t num_src_groups;
+  size_t * recv_src_group;
+  struct yac_interpolation_exchange ** src2tgt =
+    generate_src2tgt(
+      src_redists, num_src_fields, collection_size, with_frac_mask,
+      use_single_precision, src_recv_data, &num_src_groups, &recv_src_group);
+
+  // sort the targets, such that they can be evaluated depending on the
+  // availability of their source data
+  size_t * tgt_bucket =
+    get_tgt_buckets(
+      tgt_count, num_src_per_tgt, src_field_idx, src_idx,
+      recv_src_group, num_src_groups);
+  size_t * bucket_ptr =
+    sort_tgts_by_bucket(
+      tgt_pos, tgt_count, num_src_per_tgt, weights, src_field_idx, src_idx,
+      tgt_bucket, num_src_groups + 2);
+  free(tgt_bucket);
+  free(recv_src_group);
+
+  // the stencils are only kept in their CSR representation
+  struct sum_mvp_at_tgt_csr csr =
+    generate_csr(
+      src_send_data, tgt_count, num_src_per_tgt, src_field_idx, src_idx,
+      num_src_fields, element_size);
+  csr.bucket_ptr = bucket_ptr;
+  free(src_idx);
+  free(src_field_idx);
+  free(num_src_per_tgt);
+
   struct interpolation_type * interp =
     yac_interpolation_sum_mvp_at_tgt_new_(
-      collection_size,
-      yac_interpolation_buffer_init_2(
-        src_redists, min_buffer_sizes, num_src_fields,
-        with_frac_mask?2*collection_size:collection_size, SEND_BUFFER),
-      yac_interpolation_buffer_init(
-        src_redists, num_src_fields,
-        with_frac_mask?2*collection_size:collection_size, RECV_BUFFER),
-      yac_interpolation_exchange_new(
-        src_redists, num_src_fields,
-        collection_size, with_frac_mask, "source to target"),
-      COPY_DATA(tgt_pos, tgt_count), tgt_count,
-      COPY_DATA(num_src_per_tgt, tgt_count),
-      (weights != NULL)?COPY_DATA(weights, total_num_src):NULL,
-      COPY_DATA(src_field_idx, total_num_src),
-      COPY_DATA(src_idx, total_num_src),
-      num_src_fields, with_frac_mask, NULL);
+      collection_size, src_send_data, src_recv_data,
+      src2tgt, num_src_groups, tgt_pos, tgt_count, weights,
+      num_src_fields, csr, with_frac_mask, use_single_precision, NULL);
 
   free(min_buffer_sizes);
   return interp;
@@ -260,89 +692,119 @@ static void yac_interpolation_sum_mvp_at_tgt_execute(
   struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt =
     (struct interpolation_sum_mvp_at_tgt *)interp;
 
-  int with_frac_mask = sum_mvp_at_tgt->with_frac_mask;
-  CHECK_WITH_FRAC_MASK("yac_interpolation_sum_mvp_at_tgt_execute")
-
-  size_t collection_size = sum_mvp_at_tgt->collection_size;
-  size_t num_src_fields = sum_mvp_at_tgt->num_src_fields;
-  double ** temp_src_fields = sum_mvp_at_tgt->src_fields_buffer;
-  double ** src_recv_buffer = sum_mvp_at_tgt->src_recv_data.buffer;
-  if (sum_mvp_at_tgt->is_source) {
-    for (size_t i = 0; i < collection_size; ++i)
-      for (size_t j = 0; j < num_src_fields; ++j)
-        temp_src_fields[i * num_src_fields + j] = src_fields[i][j];
-    if (with_frac_mask)
-      for (size_t i = 0; i < collection_size; ++i)
-        for (size_t j = 0; j < num_src_fields; ++j)
-          temp_src_fields
-            [i * num_src_fields + j + collection_size * num_src_fields] =
-            src_frac_masks[i][j];
-  }
-
-  yac_interpolation_exchange_wait(
-    sum_mvp_at_tgt->src2tgt,
-    "yac_interpolation_sum_mvp_at_tgt_execute");
-
-  // send source points to targets
-  yac_interpolation_exchange_execute(
-    sum_mvp_at_tgt->src2tgt, (double const **)temp_src_fields,
-    src_recv_buffer, "yac_interpolation_sum_mvp_at_tgt_execute");
-
-  compute_tgt_field_wgt(
-    (double const * restrict **)src_fields,
-    (double const * restrict **)(with_frac_mask?src_frac_masks:NULL),
-    (double const * restrict *)src_recv_buffer,
-    (double const * restrict *)(
-      with_frac_mask?(src_recv_buffer + collection_size * num_src_fields):NULL),
-    tgt_field, sum_mvp_at_tgt->tgt_pos, sum_mvp_at_tgt->tgt_count,
-    sum_mvp_at_tgt->num_src_per_tgt, sum_mvp_at_tgt->weights,
-    sum_mvp_at_tgt->src_field_idx, sum_mvp_at_tgt->src_idx,
-    num_src_fields, collection_size, frac_mask_fallback_value,
-    scale_factor, scale_summand);
+  // the source data is copied into the send buffer, such that the target
+  // points can be computed while the remaining data is being exchanged
+  yac_interpolation_sum_mvp_at_tgt_execute_put(
+    interp, src_fields, src_frac_masks, sum_mvp_at_tgt->is_target, 0,
+    frac_mask_fallback_value, scale_factor, scale_summand);
+  yac_interpolation_sum_mvp_at_tgt_execute_get(
+    interp, tgt_field, frac_mask_fallback_value, scale_factor, scale_summand);
 }
 
 static void yac_interpolation_sum_mvp_at_tgt_execute_put(
   struct interpolation_type * interp,
   double *** src_fields, double *** src_frac_masks, int is_target,
-  double frac_mask_fallback_value, double scale_factor, double scale_summand) {
+  int zero_copy, double frac_mask_fallback_value, double scale_factor,
+  double scale_summand) {
 
   struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt =
     (struct interpolation_sum_mvp_at_tgt *)interp;
 
+  size_t num_src_groups = sum_mvp_at_tgt->num_src_groups;
   double ** src_send_buffer = NULL;
 
   if (sum_mvp_at_tgt->is_source) {
 
     // wait until previous put is completed
-    yac_interpolation_exchange_wait(
-      sum_mvp_at_tgt->src2tgt,
-      "yac_interpolation_sum_mvp_at_tgt_execute_put");
+    for (size_t g = 0; g < num_src_groups; ++g)
+      yac_interpolation_exchange_wait(
+        sum_mvp_at_tgt->src2tgt[g],
+        "yac_interpolation_sum_mvp_at_tgt_execute_put");
 
     int with_frac_mask = sum_mvp_at_tgt->with_frac_mask;
     CHECK_WITH_FRAC_MASK("yac_interpolation_sum_mvp_at_tgt_execute_put")
 
     size_t collection_size = sum_mvp_at_tgt->collection_size;
     size_t num_src_fields = sum_mvp_at_tgt->num_src_fields;
-    size_t * src_send_buffer_sizes = sum_mvp_at_tgt->src_send_data.buffer_sizes;
-    src_send_buffer = sum_mvp_at_tgt->src_send_data.buffer;
-    if (sum_mvp_at_tgt->is_source)
+
+    // if the source fields are stable until the put is completed, the
+    // exchange can directly work on them (target processes still require
+    // the copy, because the local contributions are read from it at get)
+    if (zero_copy && !sum_mvp_at_tgt->is_target) {
+
+      src_send_buffer = sum_mvp_at_tgt->src_fields_buffer;
       for (size_t i = 0; i < collection_size; ++i)
         for (size_t j = 0; j < num_src_fields; ++j)
-          memcpy(src_send_buffer[i * num_src_fields + j], src_fields[i][j],
-                 src_send_buffer_sizes[j]);
-    if (with_frac_mask) {
+          src_send_buffer[i * num_src_fields + j] = src_fields[i][j];
+      if (with_frac_mask)
         for (size_t i = 0; i < collection_size; ++i)
           for (size_t j = 0; j < num_src_fields; ++j)
-            memcpy(
-              src_send_buffer
-                [i * num_src_fields + j + collection_size * num_src_fields],
-                src_frac_masks[i][j], src_send_buffer_sizes[j]);
+            src_send_buffer
+              [i * num_src_fields + j + collection_size * num_src_fields] =
+              src_frac_masks[i][j];
+
+    } else {
+
+      size_t * src_send_buffer_sizes =
+        sum_mvp_at_tgt->src_send_data.buffer_sizes;
+      src_send_buffer = sum_mvp_at_tgt->src_send_data.buffer;
+      for (size_t i = 0; i < collection_size; ++i)
+        for (size_t j = 0; j < num_src_fields; ++j)
+          memcpy(src_send_buffer[i * num_src_fields + j], src_fields[i][j],
+                 src_send_buffer_sizes[j]);
+      if (with_frac_mask) {
+          for (size_t i = 0; i < collection_size; ++i)
+            for (size_t j = 0; j < num_src_fields; ++j)
+              memcpy(
+                src_send_buffer
+                  [i * num_src_fields + j + collection_size * num_src_fields],
+                  src_frac_masks[i][j], src_send_buffer_sizes[j]);
+      }
     }
   }
 
-  yac_interpolation_exchange_execute_put(
-    sum_mvp_at_tgt->src2tgt, (double const **)src_send_buffer,
-    "yac_interpolation_sum_mvp_at_tgt_execute_put");
+  for (size_t g = 0; g < num_src_groups; ++g)
+    yac_interpolation_exchange_execute_put(
+      sum_mvp_at_tgt->src2tgt[g], (double const **)src_send_buffer,
+      "yac_interpolation_sum_mvp_at_tgt_execute_put");
+}
+
+// computes all target points of the given CSR bucket
+static void compute_tgt_bucket(
+  struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt, size_t bucket,
+  double ** tgt_field, double frac_mask_fallback_value,
+  double scale_factor, double scale_summand) {
+
+  size_t tgt_offset = sum_mvp_at_tgt->csr.bucket_ptr[bucket];
+  size_t tgt_count = sum_mvp_at_tgt->csr.bucket_ptr[bucket + 1] - tgt_offset;
+
+  if (tgt_count == 0) return;
+
+  compute_tgt_field_wgt_csr_prec(
+    sum_mvp_at_tgt->use_single_precision,
+    (double const * restrict *)(sum_mvp_at_tgt->local_src_fields),
+    (double const * restrict *)(sum_mvp_at_tgt->local_src_frac_masks),
+    (double const * restrict *)(sum_mvp_at_tgt->remote_src_fields),
+    (double const * restrict *)(sum_mvp_at_tgt->remote_src_frac_masks),
+    tgt_field, sum_mvp_at_tgt->tgt_pos + tgt_offset, tgt_count,
+    sum_mvp_at_tgt->csr.row_ptr + tgt_offset, sum_mvp_at_tgt->csr.src_offset,
+    sum_mvp_at_tgt->weights, sum_mvp_at_tgt->csr.remote_block_size,
+    sum_mvp_at_tgt->collection_size, frac_mask_fallback_value,
+    scale_factor, scale_summand);
+}
+
+// completion routine of the get of a source group exchange, computes all
+// target points that depend on the data of the respective source group
+static void compute_src_group_bucket(void * data) {
+
+  struct src_group_get * group_get = (struct src_group_get *)data;
+  struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt =
+    group_get->sum_mvp_at_tgt;
+
+  compute_tgt_bucket(
+    sum_mvp_at_tgt, group_get->bucket, sum_mvp_at_tgt->get_tgt_field,
+    sum_mvp_at_tgt->get_frac_mask_fallback_value,
+    sum_mvp_at_tgt->get_scale_factor, sum_mvp_at_tgt->get_scale_summand);
 }
 
 static void yac_interpolation_sum_mvp_at_tgt_execute_get(
@@ -355,27 +817,70 @@ static void yac_interpolation_sum_mvp_at_tgt_execute_get(
   int with_frac_mask = sum_mvp_at_tgt->with_frac_mask;
   CHECK_WITH_FRAC_MASK("yac_interpolation_sum_mvp_at_tgt_execute_get")
 
-  size_t collection_size = sum_mvp_at_tgt->collection_size;
-  size_t num_src_fields = sum_mvp_at_tgt->num_src_fields;
   double ** src_recv_buffer = sum_mvp_at_tgt->src_recv_data.buffer;
+  size_t num_src_groups = sum_mvp_at_tgt->num_src_groups;
+  struct yac_interpolation_exchange ** src2tgt = sum_mvp_at_tgt->src2tgt;
+
+  sum_mvp_at_tgt->get_tgt_field = tgt_field;
+  sum_mvp_at_tgt->get_frac_mask_fallback_value = frac_mask_fallback_value;
+  sum_mvp_at_tgt->get_scale_factor = scale_factor;
+  sum_mvp_at_tgt->get_scale_summand = scale_summand;
+
+  // start receiving source field data from all source groups, the target
+  // points of each group are computed by the completion routine of its
+  // exchange, which is called as soon as the completion is detected (if
+  // the progress thread is running, this can happen while the target points
+  // that only depend on local source points are computed)
+  for (size_t g = 0; g < num_src_groups; ++g)
+    yac_interpolation_exchange_execute_get_async(
+      src2tgt[g], src_recv_buffer, compute_src_group_bucket,
+      sum_mvp_at_tgt->src_group_get + g,
+      "yac_interpolation_sum_mvp_at_tgt_execute_get");
+
+  // compute target points that only depend on local source points, while
+  // the remote source data is being received
+  compute_tgt_bucket(
+    sum_mvp_at_tgt, 0, tgt_field, frac_mask_fallback_value,
+    scale_factor, scale_summand);
 
-  // receive source field data
-  yac_interpolation_exchange_execute_get(
-    sum_mvp_at_tgt->src2tgt, src_recv_buffer,
-    "yac_interpolation_sum_mvp_at_tgt_execute_get");
-
-  compute_tgt_field_wgt(
-    (double const * restrict **)(sum_mvp_at_tgt->src_fields),
-    (double const * restrict **)(
-      with_frac_mask?sum_mvp_at_tgt->src_frac_masks:NULL),
-    (double const * restrict *)src_recv_buffer,
-    (double const * restrict *)(
-      with_frac_mask?(src_recv_buffer + collection_size * num_src_fields):NULL),
-    tgt_field, sum_mvp_at_tgt->tgt_pos, sum_mvp_at_tgt->tgt_count,
-    sum_mvp_at_tgt->num_src_per_tgt,
-    sum_mvp_at_tgt->weights, sum_mvp_at_tgt->src_field_idx,
-    sum_mvp_at_tgt->src_idx, num_src_fields, collection_size,
-    frac_mask_fallback_value, scale_factor, scale_summand);
+  // wait until the target points of all source groups have been computed
+  // (a pending put of a process that does not receive any data from a group
+  // is not affected)
+  int is_pending[num_src_groups];
+  size_t num_pending = 0;
+  for (size_t g = 0; g < num_src_groups; ++g) {
+    is_pending[g] = yac_interpolation_exchange_is_target(src2tgt[g]);
+    if (is_pending[g]) ++num_pending;
+  }
+  while (num_pending > 0) {
+
+    size_t num_completed = 0;
+    for (size_t g = 0; g < num_src_groups; ++g) {
+      if (is_pending[g] &&
+          yac_interpolation_exchange_test(
+            src2tgt[g], "yac_interpolation_sum_mvp_at_tgt_execute_get")) {
+        is_pending[g] = 0;
+        ++num_completed;
+      }
+    }
+    num_pending -= num_completed;
+
+    // if no exchange has been completed, wait for the first pending one
+    if ((num_completed == 0) && (num_pending > 0)) {
+      size_t g = 0;
+      while (!is_pending[g]) ++g;
+      yac_interpolation_exchange_wait(
+        src2tgt[g], "yac_interpolation_sum_mvp_at_tgt_execute_get");
+      is_pending[g] = 0;
+      --num_pending;
+    }
+  }
+  sum_mvp_at_tgt->get_tgt_field = NULL;
+
+  // compute target points that depend on multiple source groups
+  compute_tgt_bucket(
+    sum_mvp_at_tgt, num_src_groups + 1, tgt_field, frac_mask_fallback_value,
+    scale_factor, scale_summand);
 }
 
 static int yac_interpolation_sum_mvp_at_tgt_execute_test(
@@ -384,10 +889,13 @@ static int yac_interpolation_sum_mvp_at_tgt_execute_test(
   struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt =
     (struct interpolation_sum_mvp_at_tgt*)interp;
 
-  return
-    yac_interpolation_exchange_test(
-      sum_mvp_at_tgt->src2tgt,
-      "yac_interpolation_sum_mvp_at_tgt_execute_test");
+  int flag = 1;
+  for (size_t g = 0; g < sum_mvp_at_tgt->num_src_groups; ++g)
+    flag &=
+      yac_interpolation_exchange_test(
+        sum_mvp_at_tgt->src2tgt[g],
+        "yac_interpolation_sum_mvp_at_tgt_execute_test");
+  return flag;
 }
 
 static struct interpolation_type * yac_interpolation_sum_mvp_at_tgt_copy(
@@ -396,20 +904,30 @@ static struct interpolation_type * yac_interpolation_sum_mvp_at_tgt_copy(
   struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt =
     (struct interpolation_sum_mvp_at_tgt*)interp;
 
+  // the buffers also contain the fractional masks
+  size_t buffer_collection_size =
+    sum_mvp_at_tgt->with_frac_mask?
+      2*sum_mvp_at_tgt->collection_size:sum_mvp_at_tgt->collection_size;
+
+  size_t num_src_groups = sum_mvp_at_tgt->num_src_groups;
+  struct yac_interpolation_exchange ** src2tgt =
+    xmalloc(num_src_groups * sizeof(*src2tgt));
+  for (size_t g = 0; g < num_src_groups; ++g)
+    src2tgt[g] = yac_interpolation_exchange_copy(sum_mvp_at_tgt->src2tgt[g]);
+
   return
     yac_interpolation_sum_mvp_at_tgt_new_(
       sum_mvp_at_tgt->collection_size,
       yac_interpolation_buffer_copy(
         sum_mvp_at_tgt->src_send_data, sum_mvp_at_tgt->num_src_fields,
-        sum_mvp_at_tgt->collection_size),
+        buffer_collection_size),
       yac_interpolation_buffer_copy(
         sum_mvp_at_tgt->src_recv_data, sum_mvp_at_tgt->num_src_fields,
-        sum_mvp_at_tgt->collection_size),
-      yac_interpolation_exchange_copy(sum_mvp_at_tgt->src2tgt),
-      sum_mvp_at_tgt->tgt_pos,  sum_mvp_at_tgt->tgt_count,
-      sum_mvp_at_tgt->num_src_per_tgt, sum_mvp_at_tgt->weights,
-      sum_mvp_at_tgt->src_field_idx, sum_mvp_at_tgt->src_idx,
-      sum_mvp_at_tgt->num_src_fields, sum_mvp_at_tgt->with_frac_mask,
+        buffer_collection_size),
+      src2tgt, num_src_groups, sum_mvp_at_tgt->tgt_pos,
+      sum_mvp_at_tgt->tgt_count, sum_mvp_at_tgt->weights,
+      sum_mvp_at_tgt->num_src_fields, sum_mvp_at_tgt->csr,
+      sum_mvp_at_tgt->with_frac_mask, sum_mvp_at_tgt->use_single_precision,
       sum_mvp_at_tgt->ref_count);
 }
 
@@ -421,21 +939,22 @@ static void yac_interpolation_sum_mvp_at_tgt_delete(
   struct interpolation_sum_mvp_at_tgt * sum_mvp_at_tgt =
     (struct interpolation_sum_mvp_at_tgt*)interp;
 
-  free(sum_mvp_at_tgt->src_fields);
-  if (sum_mvp_at_tgt->src_frac_masks != NULL)
-    free(sum_mvp_at_tgt->src_frac_masks);
-  yac_interpolation_exchange_delete(
-    sum_mvp_at_tgt->src2tgt, "yac_interpolation_sum_mvp_at_tgt_delete");
+  for (size_t g = 0; g < sum_mvp_at_tgt->num_src_groups; ++g)
+    yac_interpolation_exchange_delete(
+      sum_mvp_at_tgt->src2tgt[g], "yac_interpolation_sum_mvp_at_tgt_delete");
+  free(sum_mvp_at_tgt->src2tgt);
+  free(sum_mvp_at_tgt->src_group_get);
   yac_interpolation_buffer_free(&(sum_mvp_at_tgt->src_send_data));
   yac_interpolation_buffer_free(&(sum_mvp_at_tgt->src_recv_data));
   free(sum_mvp_at_tgt->src_fields_buffer);
+  free(sum_mvp_at_tgt->local_src_fields);
 
   if (!--(*(sum_mvp_at_tgt->ref_count))) {
+    free(sum_mvp_at_tgt->csr.row_ptr);
+    free(sum_mvp_at_tgt->csr.src_offset);
+    free(sum_mvp_at_tgt->csr.bucket_ptr);
     free(sum_mvp_at_tgt->tgt_pos);
-    free(sum_mvp_at_tgt->src_idx);
-    free(sum_mvp_at_tgt->src_field_idx);
     free(sum_mvp_at_tgt->weights);
-    free(sum_mvp_at_tgt->num_src_per_tgt);
     free(sum_mvp_at_tgt->ref_count);
   }
   free(sum_mvp_at_tgt);
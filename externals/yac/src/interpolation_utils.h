@@ -51,106 +51,8 @@
 #include "core/ppm_xfuncs.h"
 #include "yac_mpi.h"
 
-static inline void compute_tgt_field_wgt(
-  double const * restrict ** src_fields,
-  double const * restrict ** src_frac_masks,
-  double const * restrict * remote_src_fields,
-  double const * restrict * remote_src_frac_masks,
-  double * restrict * tgt_field,
-  size_t const * restrict tgt_pos,
-  size_t tgt_count, size_t const * restrict num_src_per_tgt,
-  double const * restrict weights,
-  size_t const * restrict src_field_idx,
-  size_t const * restrict src_idx,
-  size_t num_src_fields, size_t collection_size,
-  double frac_mask_fallback_value,
-  double scale_factor, double scale_summand) {
-
-  // return if there is nothing to do
-  if (tgt_count == 0) return;
-
 #define FRAC_MASK_TOL (1e-12)
 
-#define COMPUTE_TGT_FIELD_WGT_FRAC_(TGT_POS, WEIGHT, SCALE) \
-  { \
-    for (size_t l = 0; l < collection_size; ++l) { \
-      double const * restrict * curr_local_field_data = \
-        src_fields?src_fields[l]:NULL; \
-      double const * restrict * curr_local_frac_mask_data = \
-        src_frac_masks?src_frac_masks[l]:NULL; \
-      double const * restrict curr_remote_field_data = \
-        remote_src_fields[l * num_src_fields]; \
-      double const * restrict curr_remote_frac_mask_data = \
-        remote_src_frac_masks[l * num_src_fields]; \
-      double * restrict curr_tgt_field = tgt_field[l]; \
-      for (size_t i = 0, k = 0; i < tgt_count; ++i) { \
-        size_t curr_num_src_per_tgt = num_src_per_tgt[i]; \
-        double result = 0.0; \
-        double frac_weight_sum = 0.0; \
-        for (size_t j = 0; j < curr_num_src_per_tgt; ++j, ++k) { \
-          double const * restrict frac_mask_data; \
-          double const * restrict src_field_data; \
-          if (src_field_idx[k] == SIZE_MAX) { \
-            frac_mask_data = curr_remote_frac_mask_data; \
-            src_field_data = curr_remote_field_data; \
-          } else { \
-            frac_mask_data = \
-              curr_local_frac_mask_data[src_field_idx[k]]; \
-            src_field_data = curr_local_field_data[src_field_idx[k]]; \
-          } \
-          result += src_field_data[src_idx[k]] * (WEIGHT); \
-          frac_weight_sum += frac_mask_data[src_idx[k]] * (WEIGHT); \
-        } \
-        curr_tgt_field[(TGT_POS)] = \
-          (fabs(frac_weight_sum) > FRAC_MASK_TOL)? \
-            (SCALE(result / frac_weight_sum)): \
-            frac_mask_fallback_value; \
-      } \
-    } \
-  }
-
-#define COMPUTE_TGT_FIELD_WGT_NOFRAC_(TGT_POS, WEIGHT, SCALE) \
-  { \
-    for (size_t l = 0; l < collection_size; ++l) { \
-      double const * restrict * curr_local_field_data = \
-        src_fields?src_fields[l]:NULL; \
-      double const * restrict curr_remote_field_data = \
-        remote_src_fields[l * num_src_fields]; \
-      double * restrict curr_tgt_field = tgt_field[l]; \
-      for (size_t i = 0, k = 0; i < tgt_count; ++i) { \
-        size_t curr_num_src_per_tgt = num_src_per_tgt[i]; \
-        double result = 0.0; \
-        for (size_t j = 0; j < curr_num_src_per_tgt; ++j, ++k) { \
-          double const * restrict src_field_data; \
-          if (src_field_idx[k] == SIZE_MAX) { \
-            src_field_data = curr_remote_field_data; \
-          } else { \
-            src_field_data = curr_local_field_data[src_field_idx[k]]; \
-          } \
-          result += src_field_data[src_idx[k]] * (WEIGHT); \
-        } \
-        curr_tgt_field[(TGT_POS)] = SCALE(result); \
-      } \
-    } \
-  }
-
-#define COMPUTE_TGT_FIELD_WGT(COMPUTE, SCALE) \
-  { \
-    if (weights != NULL) { \
-      if (tgt_pos != NULL) COMPUTE(tgt_pos[i], weights[k], SCALE) \
-      else                 COMPUTE(i, weights[k], SCALE) \
-    } else { \
-      if (tgt_pos != NULL) COMPUTE(tgt_pos[i], 1.0, SCALE) \
-      else                 COMPUTE(i, 1.0, SCALE) \
-    } \
-  }
-
-#define COMPUTE_TGT_FIELD_WGT_FRAC(SCALE) \
-  COMPUTE_TGT_FIELD_WGT(COMPUTE_TGT_FIELD_WGT_FRAC_, SCALE)
-
-#define COMPUTE_TGT_FIELD_WGT_NOFRAC(SCALE) \
-  COMPUTE_TGT_FIELD_WGT(COMPUTE_TGT_FIELD_WGT_NOFRAC_, SCALE)
-
 #define NO_SCALING(RESULT) (RESULT)
 #define MULT(RESULT) ((RESULT) * scale_factor)
 #define ADD(RESULT) ((RESULT) + scale_summand)
@@ -177,16 +79,64 @@ static inline void compute_tgt_field_wgt(
     } \
   }
 
-  COMPUTE_FIELD(COMPUTE_TGT_FIELD_WGT_FRAC, COMPUTE_TGT_FIELD_WGT_NOFRAC)
+// minimum number of targets per call for which the evaluation of the
+// compressed sparse row (CSR) representation is distributed among threads
+#define CSR_MIN_TGT_COUNT_PARALLEL (1024)
+
+// routines for double precision field data
+#define YAC_INTERP_FIELD_TYPE double
+#define YAC_INTERP_NAME(NAME) NAME
+#include "interpolation_utils_template.h"
+#undef YAC_INTERP_NAME
+#undef YAC_INTERP_FIELD_TYPE
+
+// routines for single precision field data (used by interpolations that
+// exchange their data in single precision)
+#define YAC_INTERP_FIELD_TYPE float
+#define YAC_INTERP_NAME(NAME) NAME ## _float
+#include "interpolation_utils_template.h"
+#undef YAC_INTERP_NAME
+#undef YAC_INTERP_FIELD_TYPE
+
+// The following routines call the double or single precision version of the
+// respective routine. In case of single precision, all field pointers refer
+// to float arrays (weights are always double).
+
+static inline void compute_tgt_field_wgt_prec(
+  int use_single_precision,
+  double const * restrict ** src_fields,
+  double const * restrict ** src_frac_masks,
+  double const * restrict * remote_src_fields,
+  double const * restrict * remote_src_frac_masks,
+  double * restrict * tgt_field,
+  size_t const * restrict tgt_pos,
+  size_t tgt_count, size_t const * restrict num_src_per_tgt,
+  double const * restrict weights,
+  size_t const * restrict src_field_idx,
+  size_t const * restrict src_idx,
+  size_t num_src_fields, size_t collection_size,
+  double frac_mask_fallback_value,
+  double scale_factor, double scale_summand) {
 
-#undef COMPUTE_TGT_FIELD_WGT
-#undef COMPUTE_TGT_FIELD_WGT_FRAC
-#undef COMPUTE_TGT_FIELD_WGT_NOFRAC
-#undef COMPUTE_TGT_FIELD_WGT_FRAC_
-#undef COMPUTE_TGT_FIELD_WGT_NOFRAC_
+  if (use_single_precision)
+    compute_tgt_field_wgt_float(
+      (float const * restrict **)src_fields,
+      (float const * restrict **)src_frac_masks,
+      (float const * restrict *)remote_src_fields,
+      (float const * restrict *)remote_src_frac_masks,
+      (float * restrict *)tgt_field, tgt_pos, tgt_count, num_src_per_tgt,
+      weights, src_field_idx, src_idx, num_src_fields, collection_size,
+      frac_mask_fallback_value, scale_factor, scale_summand);
+  else
+    compute_tgt_field_wgt(
+      src_fields, src_frac_masks, remote_src_fields, remote_src_frac_masks,
+      tgt_field, tgt_pos, tgt_count, num_src_per_tgt,
+      weights, src_field_idx, src_idx, num_src_fields, collection_size,
+      frac_mask_fallback_value, scale_factor, scale_summand);
 }
 
-static inline void compute_tgt_field(
+static inline void compute_tgt_field_prec(
+  int use_single_precision,
   double const * restrict ** src_fields,
   double const * restrict ** src_frac_masks,
   double * restrict * tgt_field,
@@ -195,47 +145,54 @@ static inline void compute_tgt_field(
   double frac_mask_fallback_value,
   double scale_factor, double scale_summand)  {
 
-#define COMPUTE_TGT_FIELD_FRAC(SCALE) \
-  { \
-    for (size_t i = 0; i < collection_size; ++i) { \
-      for (size_t j = 0; j < num_src_fields; ++j) { \
-        memcpy(tgt_field[i * num_src_fields + j],  \
-                src_fields[i][j], tgt_buffer_sizes[j]); \
-        for (size_t k = 0, offset = 0; offset < tgt_buffer_sizes[j]; \
-            ++k, offset += sizeof(***src_fields)) { \
-          if (src_frac_masks[i][j][k] != 0.0) \
-            tgt_field[i * num_src_fields + j][k] = \
-              SCALE( \
-                tgt_field[i * num_src_fields + j][k] / \
-                src_frac_masks[i][j][k]); \
-          else \
-            tgt_field[i * num_src_fields + j][k] = \
-              frac_mask_fallback_value; \
-        } \
-      } \
-    } \
-  }
-
-#define COMPUTE_TGT_FIELD_NOFRAC(SCALE) \
-  { \
-    for (size_t i = 0; i < collection_size; ++i) { \
-      for (size_t j = 0; j < num_src_fields; ++j) { \
-        memcpy(tgt_field[i * num_src_fields + j],  \
-                src_fields[i][j], tgt_buffer_sizes[j]); \
-        for (size_t k = 0, offset = 0; offset < tgt_buffer_sizes[j]; \
-            ++k, offset += sizeof(***src_fields)) \
-          tgt_field[i * num_src_fields + j][k] = \
-            SCALE(tgt_field[i * num_src_fields + j][k]); \
-      } \
-    } \
-  }
+  if (use_single_precision)
+    compute_tgt_field_float(
+      (float const * restrict **)src_fields,
+      (float const * restrict **)src_frac_masks,
+      (float * restrict *)tgt_field, tgt_buffer_sizes,
+      num_src_fields, collection_size, frac_mask_fallback_value,
+      scale_factor, scale_summand);
+  else
+    compute_tgt_field(
+      src_fields, src_frac_masks, tgt_field, tgt_buffer_sizes,
+      num_src_fields, collection_size, frac_mask_fallback_value,
+      scale_factor, scale_summand);
+}
 
-  COMPUTE_FIELD(COMPUTE_TGT_FIELD_FRAC, COMPUTE_TGT_FIELD_NOFRAC)
+static inline void compute_tgt_field_wgt_csr_prec(
+  int use_single_precision,
+  double const * restrict * local_src_fields,
+  double const * restrict * local_src_frac_masks,
+  double const * restrict * remote_src_fields,
+  double const * restrict * remote_src_frac_masks,
+  double * restrict * tgt_field,
+  size_t const * restrict tgt_pos, size_t tgt_count,
+  size_t const * restrict csr_row_ptr,
+  size_t const * restrict csr_src_offset,
+  double const * restrict csr_weights,
+  size_t remote_block_size, size_t collection_size,
+  double frac_mask_fallback_value,
+  double scale_factor, double scale_summand) {
 
-#undef COMPUTE_TGT_FIELD_NOFRAC
-#undef COMPUTE_TGT_FIELD_FRAC
+  if (use_single_precision)
+    compute_tgt_field_wgt_csr_float(
+      (float const * restrict *)local_src_fields,
+      (float const * restrict *)local_src_frac_masks,
+      (float const * restrict *)remote_src_fields,
+      (float const * restrict *)remote_src_frac_masks,
+      (float * restrict *)tgt_field, tgt_pos, tgt_count,
+      csr_row_ptr, csr_src_offset, csr_weights, remote_block_size,
+      collection_size, frac_mask_fallback_value, scale_factor, scale_summand);
+  else
+    compute_tgt_field_wgt_csr(
+      local_src_fields, local_src_frac_masks,
+      remote_src_fields, remote_src_frac_masks,
+      tgt_field, tgt_pos, tgt_count,
+      csr_row_ptr, csr_src_offset, csr_weights, remote_block_size,
+      collection_size, frac_mask_fallback_value, scale_factor, scale_summand);
 }
 
+#undef CSR_MIN_TGT_COUNT_PARALLEL
 #undef MULT_ADD
 #undef ADD
 #undef MULT
@@ -0,0 +1,331 @@
+/**
+ * @file interpolation_utils_template.h
+ *
+ * @copyright Copyright  (C)  2019 Moritz Hanke <hanke@dkrz.de>
+ *                                 Thomas Jahns <jahns@dkrz.de>
+ *
+ * @version 1.0
+ * @author Moritz Hanke <hanke@dkrz.de>
+ *         Thomas Jahns <jahns@dkrz.de>
+ */
+/*
+ * Keywords:
+ * Maintainer: Moritz Hanke <hanke@dkrz.de>
+ * URL: https://dkrz-sw.gitlab-pages.dkrz.de/yac/
+ *
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file is included by interpolation_utils.h once per supported field
+ * data type. The following macros have to be defined before it is included:
+ *   YAC_INTERP_FIELD_TYPE  element type of the source and target field data
+ *                          (weights and intermediate sums are always double)
+ *   YAC_INTERP_NAME(NAME)  generates the name of the respective routine
+ */
+
+static inline void YAC_INTERP_NAME(compute_tgt_field_wgt)(
+  YAC_INTERP_FIELD_TYPE const * restrict ** src_fields,
+  YAC_INTERP_FIELD_TYPE const * restrict ** src_frac_masks,
+  YAC_INTERP_FIELD_TYPE const * restrict * remote_src_fields,
+  YAC_INTERP_FIELD_TYPE const * restrict * remote_src_frac_masks,
+  YAC_INTERP_FIELD_TYPE * restrict * tgt_field,
+  size_t const * restrict tgt_pos,
+  size_t tgt_count, size_t const * restrict num_src_per_tgt,
+  double const * restrict weights,
+  size_t const * restrict src_field_idx,
+  size_t const * restrict src_idx,
+  size_t num_src_fields, size_t collection_size,
+  double frac_mask_fallback_value,
+  double scale_factor, double scale_summand) {
+
+  // return if there is nothing to do
+  if (tgt_count == 0) return;
+
+#define COMPUTE_TGT_FIELD_WGT_FRAC_(TGT_POS, WEIGHT, SCALE) \
+  { \
+    for (size_t l = 0; l < collection_size; ++l) { \
+      YAC_INTERP_FIELD_TYPE const * restrict * curr_local_field_data = \
+        src_fields?src_fields[l]:NULL; \
+      YAC_INTERP_FIELD_TYPE const * restrict * curr_local_frac_mask_data = \
+        src_frac_masks?src_frac_masks[l]:NULL; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_remote_field_data = \
+        remote_src_fields[l * num_src_fields]; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_remote_frac_mask_data = \
+        remote_src_frac_masks[l * num_src_fields]; \
+      YAC_INTERP_FIELD_TYPE * restrict curr_tgt_field = tgt_field[l]; \
+      for (size_t i = 0, k = 0; i < tgt_count; ++i) { \
+        size_t curr_num_src_per_tgt = num_src_per_tgt[i]; \
+        double result = 0.0; \
+        double frac_weight_sum = 0.0; \
+        for (size_t j = 0; j < curr_num_src_per_tgt; ++j, ++k) { \
+          YAC_INTERP_FIELD_TYPE const * restrict frac_mask_data; \
+          YAC_INTERP_FIELD_TYPE const * restrict src_field_data; \
+          if (src_field_idx[k] == SIZE_MAX) { \
+            frac_mask_data = curr_remote_frac_mask_data; \
+            src_field_data = curr_remote_field_data; \
+          } else { \
+            frac_mask_data = \
+              curr_local_frac_mask_data[src_field_idx[k]]; \
+            src_field_data = curr_local_field_data[src_field_idx[k]]; \
+          } \
+          result += src_field_data[src_idx[k]] * (WEIGHT); \
+          frac_weight_sum += frac_mask_data[src_idx[k]] * (WEIGHT); \
+        } \
+        curr_tgt_field[(TGT_POS)] = \
+          (fabs(frac_weight_sum) > FRAC_MASK_TOL)? \
+            (SCALE(result / frac_weight_sum)): \
+            frac_mask_fallback_value; \
+      } \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_WGT_NOFRAC_(TGT_POS, WEIGHT, SCALE) \
+  { \
+    for (size_t l = 0; l < collection_size; ++l) { \
+      YAC_INTERP_FIELD_TYPE const * restrict * curr_local_field_data = \
+        src_fields?src_fields[l]:NULL; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_remote_field_data = \
+        remote_src_fields[l * num_src_fields]; \
+      YAC_INTERP_FIELD_TYPE * restrict curr_tgt_field = tgt_field[l]; \
+      for (size_t i = 0, k = 0; i < tgt_count; ++i) { \
+        size_t curr_num_src_per_tgt = num_src_per_tgt[i]; \
+        double result = 0.0; \
+        for (size_t j = 0; j < curr_num_src_per_tgt; ++j, ++k) { \
+          YAC_INTERP_FIELD_TYPE const * restrict src_field_data; \
+          if (src_field_idx[k] == SIZE_MAX) { \
+            src_field_data = curr_remote_field_data; \
+          } else { \
+            src_field_data = curr_local_field_data[src_field_idx[k]]; \
+          } \
+          result += src_field_data[src_idx[k]] * (WEIGHT); \
+        } \
+        curr_tgt_field[(TGT_POS)] = SCALE(result); \
+      } \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_WGT(COMPUTE, SCALE) \
+  { \
+    if (weights != NULL) { \
+      if (tgt_pos != NULL) COMPUTE(tgt_pos[i], weights[k], SCALE) \
+      else                 COMPUTE(i, weights[k], SCALE) \
+    } else { \
+      if (tgt_pos != NULL) COMPUTE(tgt_pos[i], 1.0, SCALE) \
+      else                 COMPUTE(i, 1.0, SCALE) \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_WGT_FRAC(SCALE) \
+  COMPUTE_TGT_FIELD_WGT(COMPUTE_TGT_FIELD_WGT_FRAC_, SCALE)
+
+#define COMPUTE_TGT_FIELD_WGT_NOFRAC(SCALE) \
+  COMPUTE_TGT_FIELD_WGT(COMPUTE_TGT_FIELD_WGT_NOFRAC_, SCALE)
+
+  COMPUTE_FIELD(COMPUTE_TGT_FIELD_WGT_FRAC, COMPUTE_TGT_FIELD_WGT_NOFRAC)
+
+#undef COMPUTE_TGT_FIELD_WGT
+#undef COMPUTE_TGT_FIELD_WGT_FRAC
+#undef COMPUTE_TGT_FIELD_WGT_NOFRAC
+#undef COMPUTE_TGT_FIELD_WGT_FRAC_
+#undef COMPUTE_TGT_FIELD_WGT_NOFRAC_
+}
+
+static inline void YAC_INTERP_NAME(compute_tgt_field)(
+  YAC_INTERP_FIELD_TYPE const * restrict ** src_fields,
+  YAC_INTERP_FIELD_TYPE const * restrict ** src_frac_masks,
+  YAC_INTERP_FIELD_TYPE * restrict * tgt_field,
+  size_t * restrict tgt_buffer_sizes,
+  size_t num_src_fields, size_t collection_size,
+  double frac_mask_fallback_value,
+  double scale_factor, double scale_summand)  {
+
+#define COMPUTE_TGT_FIELD_FRAC(SCALE) \
+  { \
+    for (size_t i = 0; i < collection_size; ++i) { \
+      for (size_t j = 0; j < num_src_fields; ++j) { \
+        memcpy(tgt_field[i * num_src_fields + j],  \
+                src_fields[i][j], tgt_buffer_sizes[j]); \
+        for (size_t k = 0, offset = 0; offset < tgt_buffer_sizes[j]; \
+            ++k, offset += sizeof(***src_fields)) { \
+          if (src_frac_masks[i][j][k] != 0.0) \
+            tgt_field[i * num_src_fields + j][k] = \
+              SCALE( \
+                tgt_field[i * num_src_fields + j][k] / \
+                src_frac_masks[i][j][k]); \
+          else \
+            tgt_field[i * num_src_fields + j][k] = \
+              frac_mask_fallback_value; \
+        } \
+      } \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_NOFRAC(SCALE) \
+  { \
+    for (size_t i = 0; i < collection_size; ++i) { \
+      for (size_t j = 0; j < num_src_fields; ++j) { \
+        memcpy(tgt_field[i * num_src_fields + j],  \
+                src_fields[i][j], tgt_buffer_sizes[j]); \
+        for (size_t k = 0, offset = 0; offset < tgt_buffer_sizes[j]; \
+            ++k, offset += sizeof(***src_fields)) \
+          tgt_field[i * num_src_fields + j][k] = \
+            SCALE(tgt_field[i * num_src_fields + j][k]); \
+      } \
+    } \
+  }
+
+  COMPUTE_FIELD(COMPUTE_TGT_FIELD_FRAC, COMPUTE_TGT_FIELD_NOFRAC)
+
+#undef COMPUTE_TGT_FIELD_NOFRAC
+#undef COMPUTE_TGT_FIELD_FRAC
+}
+
+/**
+ * computes the weighted sum for all targets from a compressed sparse row
+ * (CSR) representation of the weights
+ *
+ * The source offsets are relative to the start of the data of the respective
+ * collection member. Offsets smaller than remote_block_size refer to the
+ * remote source data, the other ones refer to the local source data (shifted
+ * by remote_block_size).
+ *
+ * The targets are distributed among the available OpenMP threads (if YAC
+ * was compiled with OpenMP support). Since the order in which the
+ * contributions of each target are summed up is the same as in
+ * \ref compute_tgt_field_wgt, results are bitwise identical to it.
+ */
+static inline void YAC_INTERP_NAME(compute_tgt_field_wgt_csr)(
+  YAC_INTERP_FIELD_TYPE const * restrict * local_src_fields,
+  YAC_INTERP_FIELD_TYPE const * restrict * local_src_frac_masks,
+  YAC_INTERP_FIELD_TYPE const * restrict * remote_src_fields,
+  YAC_INTERP_FIELD_TYPE const * restrict * remote_src_frac_masks,
+  YAC_INTERP_FIELD_TYPE * restrict * tgt_field,
+  size_t const * restrict tgt_pos, size_t tgt_count,
+  size_t const * restrict csr_row_ptr,
+  size_t const * restrict csr_src_offset,
+  double const * restrict csr_weights,
+  size_t remote_block_size, size_t collection_size,
+  double frac_mask_fallback_value,
+  double scale_factor, double scale_summand) {
+
+  // return if there is nothing to do
+  if (tgt_count == 0) return;
+
+#define GET_SRC_VALUE(LOCAL, REMOTE, OFFSET) \
+  (((OFFSET) < remote_block_size)? \
+     (REMOTE)[(OFFSET)]:(LOCAL)[(OFFSET) - remote_block_size])
+
+#define COMPUTE_TGT_FIELD_WGT_CSR_FRAC_(TGT_POS, WEIGHT, SCALE) \
+  { \
+    YAC_OMP(parallel if(tgt_count >= CSR_MIN_TGT_COUNT_PARALLEL)) \
+    for (size_t l = 0; l < collection_size; ++l) { \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_local_field_data = \
+        local_src_fields[l]; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_local_frac_mask_data = \
+        local_src_frac_masks[l]; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_remote_field_data = \
+        remote_src_fields[l]; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_remote_frac_mask_data = \
+        remote_src_frac_masks[l]; \
+      YAC_INTERP_FIELD_TYPE * restrict curr_tgt_field = tgt_field[l]; \
+      YAC_OMP(for simd schedule(static) nowait) \
+      for (size_t i = 0; i < tgt_count; ++i) { \
+        double result = 0.0; \
+        double frac_weight_sum = 0.0; \
+        for (size_t k = csr_row_ptr[i]; k < csr_row_ptr[i+1]; ++k) { \
+          size_t src_offset = csr_src_offset[k]; \
+          result += \
+            GET_SRC_VALUE( \
+              curr_local_field_data, curr_remote_field_data, \
+              src_offset) * (WEIGHT); \
+          frac_weight_sum += \
+            GET_SRC_VALUE( \
+              curr_local_frac_mask_data, curr_remote_frac_mask_data, \
+              src_offset) * (WEIGHT); \
+        } \
+        curr_tgt_field[(TGT_POS)] = \
+          (fabs(frac_weight_sum) > FRAC_MASK_TOL)? \
+            (SCALE(result / frac_weight_sum)): \
+            frac_mask_fallback_value; \
+      } \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_WGT_CSR_NOFRAC_(TGT_POS, WEIGHT, SCALE) \
+  { \
+    YAC_OMP(parallel if(tgt_count >= CSR_MIN_TGT_COUNT_PARALLEL)) \
+    for (size_t l = 0; l < collection_size; ++l) { \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_local_field_data = \
+        local_src_fields[l]; \
+      YAC_INTERP_FIELD_TYPE const * restrict curr_remote_field_data = \
+        remote_src_fields[l]; \
+      YAC_INTERP_FIELD_TYPE * restrict curr_tgt_field = tgt_field[l]; \
+      YAC_OMP(for simd schedule(static) nowait) \
+      for (size_t i = 0; i < tgt_count; ++i) { \
+        double result = 0.0; \
+        for (size_t k = csr_row_ptr[i]; k < csr_row_ptr[i+1]; ++k) { \
+          size_t src_offset = csr_src_offset[k]; \
+          result += \
+            GET_SRC_VALUE( \
+              curr_local_field_data, curr_remote_field_data, \
+              src_offset) * (WEIGHT); \
+        } \
+        curr_tgt_field[(TGT_POS)] = SCALE(result); \
+      } \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_WGT_CSR(COMPUTE, SCALE) \
+  { \
+    if (csr_weights != NULL) { \
+      if (tgt_pos != NULL) COMPUTE(tgt_pos[i], csr_weights[k], SCALE) \
+      else                 COMPUTE(i, csr_weights[k], SCALE) \
+    } else { \
+      if (tgt_pos != NULL) COMPUTE(tgt_pos[i], 1.0, SCALE) \
+      else                 COMPUTE(i, 1.0, SCALE) \
+    } \
+  }
+
+#define COMPUTE_TGT_FIELD_WGT_CSR_FRAC(SCALE) \
+  COMPUTE_TGT_FIELD_WGT_CSR(COMPUTE_TGT_FIELD_WGT_CSR_FRAC_, SCALE)
+
+#define COMPUTE_TGT_FIELD_WGT_CSR_NOFRAC(SCALE) \
+  COMPUTE_TGT_FIELD_WGT_CSR(COMPUTE_TGT_FIELD_WGT_CSR_NOFRAC_, SCALE)
+
+  COMPUTE_FIELD(COMPUTE_TGT_FIELD_WGT_CSR_FRAC, COMPUTE_TGT_FIELD_WGT_CSR_NOFRAC)
+
+#undef COMPUTE_TGT_FIELD_WGT_CSR
+#undef COMPUTE_TGT_FIELD_WGT_CSR_FRAC
+#undef COMPUTE_TGT_FIELD_WGT_CSR_NOFRAC
+#undef COMPUTE_TGT_FIELD_WGT_CSR_FRAC_
+#undef COMPUTE_TGT_FIELD_WGT_CSR_NOFRAC_
+#undef GET_SRC_VALUE
+}
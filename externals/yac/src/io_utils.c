@@ -43,6 +43,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdio.h>
 #include <string.h>
 #include "io_utils.h"
 #include "math.h"
@@ -51,6 +52,7 @@
 #define IO_MAX_NUM_RANKS_STR "YAC_IO_MAX_NUM_RANKS"
 #define IO_RANK_EXCLUDE_LIST_STR "YAC_IO_RANK_EXCLUDE_LIST"
 #define IO_MAX_NUM_RANKS_PER_NODE "YAC_IO_MAX_NUM_RANKS_PER_NODE"
+#define IO_PARALLEL_NETCDF_STR "YAC_IO_PARALLEL_NETCDF"
 int const default_max_num_io_rank_per_node = 1;
 
 static inline int compare_int(const void * a, const void * b) {
@@ -381,6 +383,41 @@ void yac_get_io_ranks(
   *num_io_ranks_ = (int)num_io_ranks;
 }
 
+int yac_get_io_parallel_netcdf(MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  int parallel_netcdf = 0;
+
+  // environment is only checked on rank 0, results are broadcasted
+  // to other processes
+  if (rank == 0) {
+
+    // check whether the user requested parallel NetCDF-4 output
+    char * parallel_netcdf_str = getenv(IO_PARALLEL_NETCDF_STR);
+    if ((parallel_netcdf_str != NULL) && (parallel_netcdf_str[0] != '\0')) {
+      YAC_ASSERT_F(
+        !strcmp(parallel_netcdf_str, "0") || !strcmp(parallel_netcdf_str, "1"),
+        "ERROR(yac_get_io_parallel_netcdf): "
+        "\"%s\" is not a valid value for %s (valid values: 0, 1)",
+        parallel_netcdf_str, IO_PARALLEL_NETCDF_STR);
+      parallel_netcdf = parallel_netcdf_str[0] == '1';
+    }
+#ifndef YAC_NETCDF_PARALLEL_ENABLED
+    if (parallel_netcdf) {
+      fputs("WARNING: YAC was built without parallel NetCDF support, "
+            IO_PARALLEL_NETCDF_STR " is ignored\n", stderr);
+      parallel_netcdf = 0;
+    }
+#endif
+  }
+
+  yac_mpi_call(MPI_Bcast(&parallel_netcdf, 1, MPI_INT, 0, comm), comm);
+
+  return parallel_netcdf;
+}
+
 void yac_nc_open(const char * path, int omode, int * ncidp) {
 
   YAC_ASSERT_F(
@@ -412,6 +449,25 @@ void yac_nc_create(const char * path, int cmode, int * ncidp) {
 #endif
 }
 
+void yac_nc_create_par(
+  const char * path, int cmode, MPI_Comm comm, int * ncidp) {
+
+#ifdef YAC_NETCDF_PARALLEL_ENABLED
+  int status = nc_create_par(path, cmode, comm, MPI_INFO_NULL, ncidp);
+  YAC_ASSERT_F(
+    status == NC_NOERR,
+    "ERROR(yac_nc_create_par): failed to create file \"%s\" "
+    "(NetCDF error message: \"%s\")", path, nc_strerror(status));
+#else
+  UNUSED(path);
+  UNUSED(cmode);
+  UNUSED(comm);
+  UNUSED(ncidp);
+  die("ERROR(yac_nc_create_par): "
+      "YAC was compiled without support for parallel NETCDF");
+#endif
+}
+
 void yac_nc_inq_varid(int ncid, char const * name, int * varidp) {
 
 #ifdef YAC_NETCDF_ENABLED
@@ -53,14 +53,29 @@
 #ifdef YAC_NETCDF_ENABLED
 #include <netcdf.h>
 #endif
+#ifdef YAC_NETCDF_PARALLEL_ENABLED
+#include <netcdf_par.h>
+#endif
 
 #include "yac_mpi.h"
 
 void yac_get_io_ranks(
   MPI_Comm comm, int * local_is_io, int ** io_ranks, int * num_io_ranks);
 
+/**
+ * checks the environment variable YAC_IO_PARALLEL_NETCDF on rank 0 of the
+ * provided communicator
+ * @param[in] comm communicator (collective call)
+ * @return 1 if files are to be written collectively using parallel NetCDF-4,
+ *         0 otherwise
+ * @remark returns 0, if YAC was compiled without parallel NetCDF support
+ */
+int yac_get_io_parallel_netcdf(MPI_Comm comm);
+
 void yac_nc_open(const char * path, int omode, int * ncidp);
 void yac_nc_create(const char * path, int cmode, int * ncidp);
+void yac_nc_create_par(
+  const char * path, int cmode, MPI_Comm comm, int * ncidp);
 void yac_nc_inq_varid(int ncid, char const * name, int * varidp);
 
 #ifdef YAC_NETCDF_ENABLED
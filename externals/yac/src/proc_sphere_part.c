@@ -43,6 +43,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdlib.h>
 #include "string.h"
 #include "proc_sphere_part.h"
 #include "yac_mpi.h"
@@ -55,6 +56,15 @@ enum splicomm_tags {
   DATA_TAG,
 };
 
+enum redist_mode {
+  REDIST_RECURSIVE,
+  REDIST_SINGLE_PASS,
+};
+
+// number of cells per process that are used to build the coarse partition
+// tree of the single pass redistribution
+enum {SINGLE_PASS_SAMPLES_PER_RANK = 32};
+
 struct proc_sphere_part_node;
 
 struct proc_sphere_part_node_data {
@@ -366,55 +376,9 @@ static void remove_duplicated_cells(
   *num_cells = (size_t)(last_new_cell - cells) + 1;
 }
 
-static struct proc_sphere_part_node * redistribute_cells_recursive(
-  struct dist_cell ** cells, size_t * num_cells,
-  struct yac_group_comm group_comm, double prev_gc_norm_vector[3],
-  MPI_Datatype dist_cell_dt) {
-
-#ifdef SCOREP_USER_ENABLE
-SCOREP_USER_REGION_DEFINE( local_balance_point_region )
-SCOREP_USER_REGION_DEFINE( global_balance_point_region )
-SCOREP_USER_REGION_DEFINE( splitting_region )
-SCOREP_USER_REGION_DEFINE( comm_split_region )
-SCOREP_USER_REGION_DEFINE( redist_data_region )
-#endif
-
-  int group_rank = yac_group_comm_get_rank(group_comm);
-  int group_size = yac_group_comm_get_size(group_comm);
-
-  remove_duplicated_cells(*cells, num_cells);
-
-  //--------------------
-  // compute split plane
-  //--------------------
-#ifdef SCOREP_USER_ENABLE
-SCOREP_USER_REGION_BEGIN(
-  local_balance_point_region, "local balance point",
-  SCOREP_USER_REGION_TYPE_COMMON )
-#endif
-  // compute local balance point
-  double balance_point[3] = {0.0, 0.0, 0.0};
-  for (size_t i = 0; i < *num_cells; ++i) {
-    double * cell_coord = (*cells)[i].coord;
-    for (int j = 0; j < 3; ++j) balance_point[j] += cell_coord[j];
-  }
-#ifdef SCOREP_USER_ENABLE
-SCOREP_USER_REGION_END( local_balance_point_region )
-SCOREP_USER_REGION_BEGIN(
-  global_balance_point_region, "global balance point",
-  SCOREP_USER_REGION_TYPE_COMMON )
-#endif
-
-  // in case *num_cells is zero or something else happens where the coordinates
-  // of the balance point are zero, the normalisation would generate NaN's
-  if ((balance_point[0] != 0.0) ||
-      (balance_point[1] != 0.0) ||
-      (balance_point[2] != 0.0))
-    normalise_vector(balance_point);
-
-  // compute global balance point (make sure that the allreduce operation
-  // generates bit-identical results on all processes)
-  yac_allreduce_sum_dble(&(balance_point[0]), 3, group_comm);
+static void compute_gc_norm_vector(
+  double balance_point[3], double prev_gc_norm_vector[3],
+  double gc_norm_vector[3]) {
 
   if ((fabs(balance_point[0]) > 1e-9) ||
       (fabs(balance_point[1]) > 1e-9) ||
@@ -426,7 +390,6 @@ SCOREP_USER_REGION_BEGIN(
      balance_point[2] = prev_gc_norm_vector[1];
   }
 
-  double gc_norm_vector[3];
   crossproduct_kahan(balance_point, prev_gc_norm_vector, gc_norm_vector);
 
   if ((fabs(gc_norm_vector[0]) > 1e-9) ||
@@ -438,18 +401,13 @@ SCOREP_USER_REGION_BEGIN(
      gc_norm_vector[1] = prev_gc_norm_vector[0];
      gc_norm_vector[2] = prev_gc_norm_vector[1];
   }
+}
 
-#ifdef SCOREP_USER_ENABLE
-SCOREP_USER_REGION_END( global_balance_point_region )
-#endif
-
-  //-----------------
-  // split local data
-  //-----------------
+// returns the number of cells in the U list
+static size_t split_cells(
+  struct dist_cell * cells, size_t num_cells, double gc_norm_vector[3]) {
 
-#ifdef SCOREP_USER_ENABLE
-SCOREP_USER_REGION_BEGIN( splitting_region, "splitting data", SCOREP_USER_REGION_TYPE_COMMON )
-#endif
+  if (num_cells == 0) return 0;
 
   // angle between a cell coord and the great circle plane:
   // acos(dot(gc_norm_vector, cell_coord)) = angle(gc_norm_vector, cell_coord)
@@ -457,7 +415,7 @@ SCOREP_USER_REGION_BEGIN( splitting_region, "splitting data", SCOREP_USER_REGION
   // dot <= 0.0    -> U list
   // dot >  0.0    -> T list
 
-  struct dist_cell * left = *cells, * right = *cells + *num_cells - 1;
+  struct dist_cell * left = cells, * right = cells + num_cells - 1;
 
   // sort such that all cells for the U list come first, followed by the
   // cells of the T list
@@ -497,8 +455,89 @@ SCOREP_USER_REGION_BEGIN( splitting_region, "splitting data", SCOREP_USER_REGION
     }
   }
 
+  return (size_t)(left - cells);
+}
+
+static int compute_split_rank(
+  uint64_t U_size, uint64_t num_cells, int group_size) {
+
+  // if there are no cells, the processes are split evenly
+  if (num_cells == 0) return group_size / 2;
+
+  return
+    MIN(
+      (int)MAX(
+        ((U_size * (uint64_t)group_size + num_cells/2) / num_cells), 1),
+      group_size - 1);
+}
+
+static struct proc_sphere_part_node * redistribute_cells_recursive(
+  struct dist_cell ** cells, size_t * num_cells,
+  struct yac_group_comm group_comm, double prev_gc_norm_vector[3],
+  MPI_Datatype dist_cell_dt) {
+
+#ifdef SCOREP_USER_ENABLE
+SCOREP_USER_REGION_DEFINE( local_balance_point_region )
+SCOREP_USER_REGION_DEFINE( global_balance_point_region )
+SCOREP_USER_REGION_DEFINE( splitting_region )
+SCOREP_USER_REGION_DEFINE( comm_split_region )
+SCOREP_USER_REGION_DEFINE( redist_data_region )
+#endif
+
+  int group_rank = yac_group_comm_get_rank(group_comm);
+  int group_size = yac_group_comm_get_size(group_comm);
+
+  remove_duplicated_cells(*cells, num_cells);
 
-  uint64_t U_size = (uint64_t)(left - *cells);
+  //--------------------
+  // compute split plane
+  //--------------------
+#ifdef SCOREP_USER_ENABLE
+SCOREP_USER_REGION_BEGIN(
+  local_balance_point_region, "local balance point",
+  SCOREP_USER_REGION_TYPE_COMMON )
+#endif
+  // compute local balance point
+  double balance_point[3] = {0.0, 0.0, 0.0};
+  for (size_t i = 0; i < *num_cells; ++i) {
+    double * cell_coord = (*cells)[i].coord;
+    for (int j = 0; j < 3; ++j) balance_point[j] += cell_coord[j];
+  }
+#ifdef SCOREP_USER_ENABLE
+SCOREP_USER_REGION_END( local_balance_point_region )
+SCOREP_USER_REGION_BEGIN(
+  global_balance_point_region, "global balance point",
+  SCOREP_USER_REGION_TYPE_COMMON )
+#endif
+
+  // in case *num_cells is zero or something else happens where the coordinates
+  // of the balance point are zero, the normalisation would generate NaN's
+  if ((balance_point[0] != 0.0) ||
+      (balance_point[1] != 0.0) ||
+      (balance_point[2] != 0.0))
+    normalise_vector(balance_point);
+
+  // compute global balance point (make sure that the allreduce operation
+  // generates bit-identical results on all processes)
+  yac_allreduce_sum_dble(&(balance_point[0]), 3, group_comm);
+
+  double gc_norm_vector[3];
+  compute_gc_norm_vector(balance_point, prev_gc_norm_vector, gc_norm_vector);
+
+#ifdef SCOREP_USER_ENABLE
+SCOREP_USER_REGION_END( global_balance_point_region )
+#endif
+
+  //-----------------
+  // split local data
+  //-----------------
+
+#ifdef SCOREP_USER_ENABLE
+SCOREP_USER_REGION_BEGIN( splitting_region, "splitting data", SCOREP_USER_REGION_TYPE_COMMON )
+#endif
+
+  uint64_t U_size =
+    (uint64_t)split_cells(*cells, *num_cells, gc_norm_vector);
   uint64_t T_size = (uint64_t)(*num_cells) - U_size;
 
 #ifdef SCOREP_USER_ENABLE
@@ -530,11 +569,7 @@ SCOREP_USER_REGION_BEGIN(
 #endif
   // determine processor groups
   int split_rank =
-    MIN(
-      (int)MAX(
-        ((global_bucket_sizes[0] * (uint64_t)group_size + global_num_cells/2) /
-         global_num_cells), 1),
-      group_size - 1);
+    compute_split_rank(global_bucket_sizes[0], global_num_cells, group_size);
 
   // generate processor groups
   struct yac_group_comm local_group_comm, remote_group_comm;
@@ -627,6 +662,245 @@ static MPI_Datatype yac_get_dist_cell_mpi_datatype(MPI_Comm comm) {
   return yac_create_resized(coord_dt, sizeof(struct dist_cell), comm);
 }
 
+static struct proc_sphere_part_node * build_coarse_tree(
+  struct dist_cell * samples, size_t num_samples, int rank_offset,
+  int num_ranks, double prev_gc_norm_vector[3]);
+
+static struct proc_sphere_part_node_data get_coarse_tree_node_data(
+  struct dist_cell * samples, size_t num_samples, int rank_offset,
+  int num_ranks, double prev_gc_norm_vector[3]) {
+
+  struct proc_sphere_part_node_data node_data;
+  if (num_ranks == 1) {
+    node_data.data.rank = rank_offset;
+    node_data.is_leaf = 1;
+  } else {
+    node_data.data.node =
+      build_coarse_tree(
+        samples, num_samples, rank_offset, num_ranks, prev_gc_norm_vector);
+    node_data.is_leaf = 0;
+  }
+  return node_data;
+}
+
+// serial version of the splitting done in redistribute_cells_recursive,
+// which is applied to a set of sample cells
+// (if all processes use the same samples, they generate identical trees)
+static struct proc_sphere_part_node * build_coarse_tree(
+  struct dist_cell * samples, size_t num_samples, int rank_offset,
+  int num_ranks, double prev_gc_norm_vector[3]) {
+
+  double balance_point[3] = {0.0, 0.0, 0.0};
+  for (size_t i = 0; i < num_samples; ++i)
+    for (int j = 0; j < 3; ++j) balance_point[j] += samples[i].coord[j];
+
+  double gc_norm_vector[3];
+  compute_gc_norm_vector(balance_point, prev_gc_norm_vector, gc_norm_vector);
+
+  size_t U_size = split_cells(samples, num_samples, gc_norm_vector);
+  int split_rank =
+    compute_split_rank((uint64_t)U_size, (uint64_t)num_samples, num_ranks);
+
+  struct proc_sphere_part_node * node = xmalloc(1 * sizeof(*node));
+  node->U =
+    get_coarse_tree_node_data(
+      samples, U_size, rank_offset, split_rank, gc_norm_vector);
+  node->T =
+    get_coarse_tree_node_data(
+      samples + U_size, num_samples - U_size, rank_offset + split_rank,
+      num_ranks - split_rank, gc_norm_vector);
+  for (int i = 0; i < 3; ++i) node->gc_norm_vector[i] = gc_norm_vector[i];
+
+  return node;
+}
+
+// uses the same criterion as split_cells
+static int get_cell_rank(
+  struct proc_sphere_part_node * node, double coord[3]) {
+
+  while (1) {
+
+    double dot = coord[0] * node->gc_norm_vector[0] +
+                 coord[1] * node->gc_norm_vector[1] +
+                 coord[2] * node->gc_norm_vector[2];
+
+    struct proc_sphere_part_node_data * node_data =
+      (dot > 0.0)?&(node->T):&(node->U);
+
+    if (node_data->is_leaf) return node_data->data.rank;
+    node = node_data->data.node;
+  }
+}
+
+static struct proc_sphere_part_node * redistribute_cells_single_pass(
+  struct dist_cell ** cells, size_t * num_cells, uint64_t global_num_cells,
+  MPI_Comm comm, double base_gc_norm_vector[3], MPI_Datatype dist_cell_dt) {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  remove_duplicated_cells(*cells, num_cells);
+
+  //-----------------------------------------------------------
+  // build coarse partition tree, which is replicated on all
+  // processes, from a sample of the cells
+  //-----------------------------------------------------------
+
+  // the number of samples per process is proportional to its number of cells
+  uint64_t max_num_samples =
+    (uint64_t)comm_size * (uint64_t)SINGLE_PASS_SAMPLES_PER_RANK;
+  size_t sample_stride =
+    (size_t)MAX((global_num_cells + max_num_samples - 1) / max_num_samples, 1);
+  size_t num_local_samples = *num_cells / sample_stride;
+
+  int * int_buffer = xmalloc(8 * (size_t)comm_size * sizeof(*int_buffer));
+  int * sendcounts = int_buffer + 0 * comm_size;
+  int * recvcounts = int_buffer + 1 * comm_size;
+  int * sdispls =    int_buffer + 2 * comm_size;
+  int * rdispls =    int_buffer + 3 * comm_size;
+  int * neigh_sendcounts = int_buffer + 4 * comm_size;
+  int * neigh_recvcounts = int_buffer + 5 * comm_size;
+  int * neigh_sdispls =    int_buffer + 6 * comm_size;
+  int * neigh_rdispls =    int_buffer + 7 * comm_size;
+
+  YAC_ASSERT(
+    num_local_samples <= INT_MAX,
+    "ERROR(redistribute_cells_single_pass): too many samples")
+  int int_num_local_samples = (int)num_local_samples;
+  yac_mpi_call(
+    MPI_Allgather(
+      &int_num_local_samples, 1, MPI_INT, recvcounts, 1, MPI_INT, comm), comm);
+  size_t num_samples = 0;
+  for (int i = 0; i < comm_size; ++i) {
+    YAC_ASSERT(
+      num_samples <= INT_MAX,
+      "ERROR(redistribute_cells_single_pass): too many samples")
+    rdispls[i] = (int)num_samples;
+    num_samples += (size_t)(recvcounts[i]);
+  }
+
+  struct dist_cell * samples =
+    xmalloc((num_samples + num_local_samples) * sizeof(*samples));
+  struct dist_cell * local_samples = samples + num_samples;
+  for (size_t i = 0; i < num_local_samples; ++i)
+    local_samples[i] = (*cells)[i * sample_stride + sample_stride / 2];
+  yac_mpi_call(
+    MPI_Allgatherv(
+      local_samples, int_num_local_samples, dist_cell_dt,
+      samples, recvcounts, rdispls, dist_cell_dt, comm), comm);
+
+  struct proc_sphere_part_node * proc_sphere_part =
+    build_coarse_tree(
+      samples, num_samples, 0, comm_size, base_gc_norm_vector);
+  free(samples);
+
+  //----------------------------------------------------------
+  // determine the new owner of all local cells and move them
+  // with a single neighbourhood collective
+  //----------------------------------------------------------
+
+  int * cell_ranks = xmalloc(*num_cells * sizeof(*cell_ranks));
+  memset(sendcounts, 0, (size_t)comm_size * sizeof(*sendcounts));
+  for (size_t i = 0; i < *num_cells; ++i) {
+    int rank = get_cell_rank(proc_sphere_part, (*cells)[i].coord);
+    cell_ranks[i] = rank;
+    sendcounts[rank]++;
+  }
+  yac_mpi_call(
+    MPI_Alltoall(sendcounts, 1, MPI_INT, recvcounts, 1, MPI_INT, comm), comm);
+
+  // the neighbourhood graph only contains processes that actually
+  // exchange cells
+  int * neigh_ranks = xmalloc(2 * (size_t)comm_size * sizeof(*neigh_ranks));
+  int * sources = neigh_ranks;
+  int * destinations = neigh_ranks + comm_size;
+  int num_sources = 0, num_destinations = 0;
+  size_t send_count = 0, recv_count = 0;
+  for (int i = 0; i < comm_size; ++i) {
+    YAC_ASSERT(
+      (send_count <= INT_MAX) && (recv_count <= INT_MAX),
+      "ERROR(redistribute_cells_single_pass): too many cells")
+    sdispls[i] = (int)send_count;
+    if (sendcounts[i] > 0) {
+      destinations[num_destinations] = i;
+      neigh_sendcounts[num_destinations] = sendcounts[i];
+      neigh_sdispls[num_destinations] = (int)send_count;
+      ++num_destinations;
+    }
+    if (recvcounts[i] > 0) {
+      sources[num_sources] = i;
+      neigh_recvcounts[num_sources] = recvcounts[i];
+      neigh_rdispls[num_sources] = (int)recv_count;
+      ++num_sources;
+    }
+    send_count += (size_t)(sendcounts[i]);
+    recv_count += (size_t)(recvcounts[i]);
+  }
+
+  struct dist_cell * send_cells = xmalloc(send_count * sizeof(*send_cells));
+  for (size_t i = 0; i < *num_cells; ++i)
+    send_cells[sdispls[cell_ranks[i]]++] = (*cells)[i];
+  free(cell_ranks);
+
+  // the number of exchanged cells is used as edge weight
+  MPI_Comm neigh_comm;
+  yac_mpi_call(
+    MPI_Dist_graph_create_adjacent(
+      comm, num_sources, sources, neigh_recvcounts,
+      num_destinations, destinations, neigh_sendcounts,
+      MPI_INFO_NULL, 0, &neigh_comm), comm);
+
+  struct dist_cell * new_cells = xmalloc(recv_count * sizeof(*new_cells));
+  yac_mpi_call(
+    MPI_Neighbor_alltoallv(
+      send_cells, neigh_sendcounts, neigh_sdispls, dist_cell_dt,
+      new_cells, neigh_recvcounts, neigh_rdispls, dist_cell_dt, neigh_comm),
+    comm);
+
+  yac_mpi_call(MPI_Comm_free(&neigh_comm), comm);
+  free(neigh_ranks);
+  free(send_cells);
+  free(int_buffer);
+
+  free(*cells);
+  *cells = new_cells;
+  *num_cells = recv_count;
+
+  remove_duplicated_cells(*cells, num_cells);
+
+  return proc_sphere_part;
+}
+
+static enum redist_mode get_redist_mode(MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  int mode = REDIST_RECURSIVE;
+
+  // environment is only checked on rank 0, result is broadcasted
+  // to other processes
+  if (rank == 0) {
+    char const * mode_str = getenv(YAC_PROC_SPHERE_PART_REDIST_ENV);
+    if ((mode_str != NULL) && (mode_str[0] != '\0')) {
+      if (!strcmp(mode_str, "recursive")) {
+        mode = REDIST_RECURSIVE;
+      } else {
+        YAC_ASSERT_F(
+          !strcmp(mode_str, "single_pass"),
+          "ERROR(get_redist_mode): \"%s\" is not a valid value for %s "
+          "(valid values: \"recursive\", \"single_pass\")",
+          mode_str, YAC_PROC_SPHERE_PART_REDIST_ENV)
+        mode = REDIST_SINGLE_PASS;
+      }
+    }
+  }
+  yac_mpi_call(MPI_Bcast(&mode, 1, MPI_INT, 0, comm), comm);
+
+  return (enum redist_mode)mode;
+}
+
 struct proc_sphere_part_node * yac_redistribute_cells(
   struct dist_cell ** cells, size_t * num_cells, MPI_Comm comm) {
 
@@ -646,11 +920,18 @@ struct proc_sphere_part_node * yac_redistribute_cells(
   if ((comm_size > 1) && (global_num_cells > 0)) {
 
     MPI_Datatype dist_cell_dt = yac_get_dist_cell_mpi_datatype(comm);
-    struct yac_group_comm group_comm = yac_group_comm_new(comm);
-    proc_sphere_part =
-      redistribute_cells_recursive(cells, num_cells, group_comm,
-                                   base_gc_norm_vector, dist_cell_dt);
-    yac_group_comm_delete(group_comm);
+    if (get_redist_mode(comm) == REDIST_SINGLE_PASS) {
+      proc_sphere_part =
+        redistribute_cells_single_pass(
+          cells, num_cells, global_num_cells, comm, base_gc_norm_vector,
+          dist_cell_dt);
+    } else {
+      struct yac_group_comm group_comm = yac_group_comm_new(comm);
+      proc_sphere_part =
+        redistribute_cells_recursive(cells, num_cells, group_comm,
+                                     base_gc_norm_vector, dist_cell_dt);
+      yac_group_comm_delete(group_comm);
+    }
 
     yac_mpi_call(MPI_Type_free(&dist_cell_dt), comm);
   } else {
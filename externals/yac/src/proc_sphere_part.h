@@ -70,6 +70,32 @@ struct dist_cell {
 
 struct proc_sphere_part_node;
 
+/**
+ * name of the environment variable through which the algorithm used by
+ * \ref yac_redistribute_cells can be selected:
+ *   - "recursive" (default):\n
+ *     the processes are recursively split into two groups and the cells are
+ *     redistributed between the groups at each level (yields an exactly
+ *     balanced distribution, but requires log2(comm_size) rounds of
+ *     collective communication)
+ *   - "single_pass":\n
+ *     all processes build the same coarse partition tree from a sample of
+ *     the cells, the cells are then moved to their final owner with a single
+ *     neighbourhood collective (the distribution is only balanced up to the
+ *     accuracy of the sample)
+ */
+#define YAC_PROC_SPHERE_PART_REDIST_ENV "YAC_PROC_SPHERE_PART_REDIST"
+
+/**
+ * redistributes the cells among all processes of the communicator and
+ * generates a partition tree that maps coordinates to processes
+ * @param[in,out] cells     cells (duplicated coordinates are removed)
+ * @param[in,out] num_cells number of cells
+ * @param[in]     comm      communicator
+ * @return partition tree
+ * @remark the algorithm can be selected through
+ *         \ref YAC_PROC_SPHERE_PART_REDIST_ENV
+ */
 struct proc_sphere_part_node * yac_redistribute_cells(
   struct dist_cell ** cells, size_t * num_cells, MPI_Comm comm);
 void yac_proc_sphere_part_node_delete(struct proc_sphere_part_node * node);
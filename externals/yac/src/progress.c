@@ -0,0 +1,223 @@
+/**
+ * @file progress.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef YAC_PTHREAD_ENABLED
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef YAC_PTHREAD_ENABLED
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "progress.h"
+#include "ensure_array_size.h"
+#include "utils.h"
+#include "yac_mpi.h"
+
+struct progress_entry {
+  void * data;
+  yac_progress_test_func test;
+};
+
+static struct progress_entry * progress_entries = NULL;
+static size_t progress_entries_count = 0;
+static size_t progress_entries_array_size = 0;
+
+#ifdef YAC_PTHREAD_ENABLED
+
+static pthread_mutex_t progress_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t progress_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t progress_thread;
+
+// only read and written by the main thread
+static int progress_thread_active = 0;
+
+// protected by progress_mutex
+static int progress_thread_stop = 0;
+static long progress_interval_usec = 0;
+
+static void progress_test_all(void) {
+
+  for (size_t i = 0; i < progress_entries_count;) {
+    if (progress_entries[i].test(progress_entries[i].data))
+      progress_entries[i] = progress_entries[--progress_entries_count];
+    else
+      ++i;
+  }
+}
+
+static void * progress_thread_main(void * arg) {
+
+  (void)arg;
+
+  pthread_mutex_lock(&progress_mutex);
+
+  while (!progress_thread_stop) {
+
+    progress_test_all();
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += progress_interval_usec / 1000000L;
+    deadline.tv_nsec += (progress_interval_usec % 1000000L) * 1000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec += 1;
+      deadline.tv_nsec -= 1000000000L;
+    }
+
+    // releases the lock while sleeping
+    pthread_cond_timedwait(&progress_cond, &progress_mutex, &deadline);
+  }
+
+  pthread_mutex_unlock(&progress_mutex);
+
+  return NULL;
+}
+
+#endif // YAC_PTHREAD_ENABLED
+
+void yac_progress_start(int interval_usec) {
+
+  YAC_ASSERT_F(
+    interval_usec > 0,
+    "ERROR(yac_progress_start): invalid polling interval (%d), "
+    "has to be positive", interval_usec);
+
+#ifdef YAC_PTHREAD_ENABLED
+
+  if (progress_thread_active) {
+    pthread_mutex_lock(&progress_mutex);
+    progress_interval_usec = (long)interval_usec;
+    pthread_mutex_unlock(&progress_mutex);
+    return;
+  }
+
+  int provided;
+  yac_mpi_call(MPI_Query_thread(&provided), MPI_COMM_WORLD);
+  YAC_ASSERT(
+    provided == MPI_THREAD_MULTIPLE,
+    "ERROR(yac_progress_start): the progress thread requires MPI to be "
+    "initialised with MPI_THREAD_MULTIPLE")
+
+  progress_thread_stop = 0;
+  progress_interval_usec = (long)interval_usec;
+
+  YAC_ASSERT(
+    !pthread_create(&progress_thread, NULL, progress_thread_main, NULL),
+    "ERROR(yac_progress_start): failed to create progress thread")
+
+  progress_thread_active = 1;
+#else
+  fputs("WARNING: YAC was built without pthread support, "
+        "the progress thread is not available\n", stderr);
+#endif
+}
+
+void yac_progress_stop(void) {
+
+#ifdef YAC_PTHREAD_ENABLED
+  if (!progress_thread_active) return;
+
+  pthread_mutex_lock(&progress_mutex);
+  progress_thread_stop = 1;
+  pthread_cond_signal(&progress_cond);
+  pthread_mutex_unlock(&progress_mutex);
+
+  YAC_ASSERT(
+    !pthread_join(progress_thread, NULL),
+    "ERROR(yac_progress_stop): failed to join progress thread")
+
+  progress_thread_active = 0;
+#endif
+
+  if (progress_entries_count == 0) {
+    free(progress_entries);
+    progress_entries = NULL;
+    progress_entries_array_size = 0;
+  }
+}
+
+int yac_progress_is_active(void) {
+
+#ifdef YAC_PTHREAD_ENABLED
+  return progress_thread_active;
+#else
+  return 0;
+#endif
+}
+
+void yac_progress_lock(void) {
+
+#ifdef YAC_PTHREAD_ENABLED
+  if (progress_thread_active) pthread_mutex_lock(&progress_mutex);
+#endif
+}
+
+void yac_progress_unlock(void) {
+
+#ifdef YAC_PTHREAD_ENABLED
+  if (progress_thread_active) pthread_mutex_unlock(&progress_mutex);
+#endif
+}
+
+void yac_progress_add(void * data, yac_progress_test_func test) {
+
+  ENSURE_ARRAY_SIZE(
+    progress_entries, progress_entries_array_size,
+    progress_entries_count + 1);
+  progress_entries[progress_entries_count].data = data;
+  progress_entries[progress_entries_count].test = test;
+  ++progress_entries_count;
+}
+
+void yac_progress_remove(void * data) {
+
+  for (size_t i = 0; i < progress_entries_count; ++i) {
+    if (progress_entries[i].data == data) {
+      progress_entries[i] = progress_entries[--progress_entries_count];
+      return;
+    }
+  }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file progress.h
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+/*
+ * The progress engine drives the completion of outstanding nonblocking
+ * exchanges while the model is busy with its own computations. Users of
+ * the engine register each outstanding request together with a test
+ * routine. If the progress thread is running, it periodically calls the
+ * test routines of all registered requests and drops each request, whose
+ * test routine reports completion.
+ *
+ * All accesses to registered requests have to be enclosed by
+ * \ref yac_progress_lock and \ref yac_progress_unlock. The test routines
+ * are always called while the lock is held.
+ */
+
+/**
+ * test routine for a registered request
+ * @param[in] data data pointer provided to \ref yac_progress_add
+ * @return 1 if the request has been completed, 0 otherwise
+ */
+typedef int (*yac_progress_test_func)(void * data);
+
+/**
+ * starts the progress thread (or updates the polling interval if it is
+ * already running)
+ * @param[in] interval_usec polling interval in microseconds
+ * @remark requires MPI to be initialised with MPI_THREAD_MULTIPLE
+ * @remark if YAC was built without pthread support, a warning is printed
+ *         and no thread is started
+ */
+void yac_progress_start(int interval_usec);
+
+/**
+ * stops the progress thread, if it is running\n
+ * registered requests remain registered and can be completed through their
+ * owners
+ */
+void yac_progress_stop(void);
+
+/**
+ * @return 1 if the progress thread is running, 0 otherwise
+ */
+int yac_progress_is_active(void);
+
+void yac_progress_lock(void);
+void yac_progress_unlock(void);
+
+/**
+ * registers an outstanding request
+ * @param[in] data data pointer passed to the test routine
+ * @param[in] test test routine
+ * @remark has to be called while the lock is held
+ */
+void yac_progress_add(void * data, yac_progress_test_func test);
+
+/**
+ * unregisters a request (does nothing if the request is not registered)
+ * @param[in] data data pointer that was passed to \ref yac_progress_add
+ * @remark has to be called while the lock is held
+ */
+void yac_progress_remove(void * data);
+
+#endif // PROGRESS_H
@@ -0,0 +1,449 @@
+/**
+ * @file setup_stats.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <float.h>
+#include <inttypes.h>
+#include <sys/resource.h>
+
+#include "setup_stats.h"
+#include "utils.h"
+
+static char const * phase_names[YAC_SETUP_NUM_PHASES] = {
+  [YAC_SETUP_PHASE_SETUP] = "setup",
+  [YAC_SETUP_PHASE_SYNC_DEF] = "setup/sync_def",
+  [YAC_SETUP_PHASE_DIST_GRID_PAIR] = "setup/dist_grid_pair",
+  [YAC_SETUP_PHASE_REDISTRIBUTE_CELLS] =
+    "setup/dist_grid_pair/redistribute_cells",
+  [YAC_SETUP_PHASE_GENERATE_DIST_GRID] =
+    "setup/dist_grid_pair/generate_dist_grid",
+  [YAC_SETUP_PHASE_SEARCH_DATA] = "setup/dist_grid_pair/search_data",
+  [YAC_SETUP_PHASE_INTERP_GRID] = "setup/interp_grid",
+  [YAC_SETUP_PHASE_INTERP_WEIGHTS] = "setup/interp_weights",
+  [YAC_SETUP_PHASE_WEIGHT_CACHE] = "setup/interp_weights/weight_cache",
+  [YAC_SETUP_PHASE_DO_SEARCH] = "setup/interp_weights/do_search",
+  [YAC_SETUP_PHASE_DO_SEARCH_AVG] = "setup/interp_weights/do_search/avg",
+  [YAC_SETUP_PHASE_DO_SEARCH_NNN] = "setup/interp_weights/do_search/nnn",
+  [YAC_SETUP_PHASE_DO_SEARCH_CONSERV] =
+    "setup/interp_weights/do_search/conserv",
+  [YAC_SETUP_PHASE_DO_SEARCH_SPMAP] = "setup/interp_weights/do_search/spmap",
+  [YAC_SETUP_PHASE_DO_SEARCH_HCSBB] = "setup/interp_weights/do_search/hcsbb",
+  [YAC_SETUP_PHASE_DO_SEARCH_FILE] = "setup/interp_weights/do_search/file",
+  [YAC_SETUP_PHASE_DO_SEARCH_FIXED] = "setup/interp_weights/do_search/fixed",
+  [YAC_SETUP_PHASE_DO_SEARCH_CHECK] = "setup/interp_weights/do_search/check",
+  [YAC_SETUP_PHASE_DO_SEARCH_CREEP] = "setup/interp_weights/do_search/creep",
+  [YAC_SETUP_PHASE_DO_SEARCH_CALLBACK] =
+    "setup/interp_weights/do_search/callback",
+  [YAC_SETUP_PHASE_PRUNE_WEIGHTS] = "setup/interp_weights/prune_weights",
+  [YAC_SETUP_PHASE_WRITE_WEIGHTS] = "setup/write_weights",
+  [YAC_SETUP_PHASE_INTERPOLATION] = "setup/interpolation",
+};
+
+static char const * counter_names[YAC_SETUP_NUM_COUNTERS] = {
+  [YAC_SETUP_COUNTER_BYTES_EXCHANGED] = "bytes_exchanged",
+  [YAC_SETUP_COUNTER_NUM_STENCILS] = "num_stencils",
+  [YAC_SETUP_COUNTER_PEAK_MEMORY] = "peak_memory",
+  [YAC_SETUP_COUNTER_NUM_PRUNED_LINKS] = "num_pruned_links",
+  [YAC_SETUP_COUNTER_NUM_AUTO_MAPPING_SRC] = "num_auto_mapping_on_source",
+  [YAC_SETUP_COUNTER_NUM_AUTO_MAPPING_TGT] = "num_auto_mapping_on_target",
+};
+
+// statistics of the local process
+static struct {
+  double time[YAC_SETUP_NUM_PHASES];
+  double start_time[YAC_SETUP_NUM_PHASES];
+  uint64_t start_peak_memory[YAC_SETUP_NUM_PHASES];
+  int active_count[YAC_SETUP_NUM_PHASES];
+  uint64_t num_calls[YAC_SETUP_NUM_PHASES];
+  uint64_t counters[YAC_SETUP_NUM_PHASES][YAC_SETUP_NUM_COUNTERS];
+} local_stats;
+
+struct yac_setup_stats {
+  size_t num_comps;
+  char ** comp_names;
+  double * num_procs;                // [num_comps]
+  double (*times)[3];                // [num_comps][num_phases][min,max,sum]
+  double * num_calls;                // [num_comps][num_phases]
+  int64_t (*counters)[3];            // [num_comps][num_phases][num_counters]
+                                     //   [min,max,sum]
+};
+
+static uint64_t get_peak_memory() {
+
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage)) return 0;
+
+  // ru_maxrss is given in kilobytes
+  return (uint64_t)usage.ru_maxrss * 1024;
+}
+
+void yac_setup_stats_start(enum yac_setup_phase phase) {
+
+  YAC_ASSERT(
+    (phase >= 0) && (phase < YAC_SETUP_NUM_PHASES),
+    "ERROR(yac_setup_stats_start): invalid phase")
+
+  if (local_stats.active_count[phase]++ > 0) return;
+
+  local_stats.num_calls[phase]++;
+  local_stats.start_peak_memory[phase] = get_peak_memory();
+  local_stats.start_time[phase] = MPI_Wtime();
+}
+
+void yac_setup_stats_stop(enum yac_setup_phase phase) {
+
+  double end_time = MPI_Wtime();
+
+  YAC_ASSERT(
+    (phase >= 0) && (phase < YAC_SETUP_NUM_PHASES),
+    "ERROR(yac_setup_stats_stop): invalid phase")
+  YAC_ASSERT_F(
+    local_stats.active_count[phase] > 0,
+    "ERROR(yac_setup_stats_stop): phase \"%s\" is not active",
+    phase_names[phase])
+
+  if (--local_stats.active_count[phase] > 0) return;
+
+  local_stats.time[phase] += end_time - local_stats.start_time[phase];
+
+  uint64_t peak_memory =
+    get_peak_memory() - local_stats.start_peak_memory[phase];
+  uint64_t * counter =
+    &(local_stats.counters[phase][YAC_SETUP_COUNTER_PEAK_MEMORY]);
+  if (peak_memory > *counter) *counter = peak_memory;
+}
+
+void yac_setup_stats_add(enum yac_setup_counter counter, uint64_t value) {
+
+  for (int i = 0; i < YAC_SETUP_NUM_PHASES; ++i)
+    if (local_stats.active_count[i] > 0)
+      local_stats.counters[i][counter] += value;
+}
+
+struct yac_setup_stats * yac_setup_stats_aggregate(
+  char const ** comp_names, size_t num_comps, int const * local_comp_flag,
+  MPI_Comm comm) {
+
+  YAC_ASSERT(
+    num_comps <= INT_MAX / (3 * YAC_SETUP_NUM_PHASES * YAC_SETUP_NUM_COUNTERS),
+    "ERROR(yac_setup_stats_aggregate): too many components")
+
+  size_t num_phases = YAC_SETUP_NUM_PHASES;
+  size_t num_counters = YAC_SETUP_NUM_COUNTERS;
+
+  struct yac_setup_stats * stats = xmalloc(1 * sizeof(*stats));
+  stats->num_comps = num_comps;
+  stats->comp_names = xmalloc(num_comps * sizeof(*(stats->comp_names)));
+  for (size_t i = 0; i < num_comps; ++i)
+    stats->comp_names[i] = strdup(comp_names[i]);
+
+  // the minimum values are reduced as negated maximum values, which
+  // allows to do all reductions with two MPI_Allreduce calls per data type
+  size_t dble_count = num_comps * (1 + 4 * num_phases);
+  size_t int64_count = num_comps * num_phases * num_counters;
+  double * dble_buffer = xmalloc(dble_count * sizeof(*dble_buffer));
+  int64_t * int64_buffer = xmalloc(3 * int64_count * sizeof(*int64_buffer));
+  double * dble_sum = dble_buffer;        // [num_procs, time, num_calls]
+  double * dble_max = dble_buffer + num_comps * (1 + 2 * num_phases);
+                                          // [max time, -min time]
+  int64_t * int64_sum = int64_buffer;
+  int64_t * int64_max = int64_buffer + int64_count;
+                                          // [max value, -min value]
+
+  for (size_t i = 0; i < num_comps; ++i) {
+
+    int is_local = local_comp_flag[i];
+
+    dble_sum[i] = (double)(is_local != 0);
+    for (size_t j = 0; j < num_phases; ++j) {
+
+      double time = local_stats.time[j];
+
+      dble_sum[num_comps + i * num_phases + j] = is_local?time:0.0;
+      dble_sum[num_comps * (1 + num_phases) + i * num_phases + j] =
+        is_local?(double)local_stats.num_calls[j]:0.0;
+      dble_max[i * num_phases + j] = is_local?time:-DBL_MAX;
+      dble_max[num_comps * num_phases + i * num_phases + j] =
+        is_local?-time:-DBL_MAX;
+
+      for (size_t k = 0; k < num_counters; ++k) {
+
+        size_t idx = (i * num_phases + j) * num_counters + k;
+        int64_t value = (int64_t)local_stats.counters[j][k];
+
+        int64_sum[idx] = is_local?value:0;
+        int64_max[idx] = is_local?value:-INT64_MAX;
+        int64_max[int64_count + idx] = is_local?-value:-INT64_MAX;
+      }
+    }
+  }
+
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, dble_sum, (int)(num_comps * (1 + 2 * num_phases)),
+      MPI_DOUBLE, MPI_SUM, comm), comm);
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, dble_max, (int)(num_comps * 2 * num_phases),
+      MPI_DOUBLE, MPI_MAX, comm), comm);
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, int64_sum, (int)int64_count,
+      MPI_INT64_T, MPI_SUM, comm), comm);
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, int64_max, (int)(2 * int64_count),
+      MPI_INT64_T, MPI_MAX, comm), comm);
+
+  stats->num_procs = xmalloc(num_comps * sizeof(*(stats->num_procs)));
+  stats->times = xmalloc(num_comps * num_phases * sizeof(*(stats->times)));
+  stats->num_calls =
+    xmalloc(num_comps * num_phases * sizeof(*(stats->num_calls)));
+  stats->counters = xmalloc(int64_count * sizeof(*(stats->counters)));
+
+  for (size_t i = 0; i < num_comps; ++i) {
+    stats->num_procs[i] = dble_sum[i];
+    for (size_t j = 0; j < num_phases; ++j) {
+      size_t idx = i * num_phases + j;
+      stats->times[idx][0] = -dble_max[num_comps * num_phases + idx];
+      stats->times[idx][1] = dble_max[idx];
+      stats->times[idx][2] = dble_sum[num_comps + idx];
+      stats->num_calls[idx] = dble_sum[num_comps * (1 + num_phases) + idx];
+    }
+  }
+  for (size_t i = 0; i < int64_count; ++i) {
+    stats->counters[i][0] = -int64_max[int64_count + i];
+    stats->counters[i][1] = int64_max[i];
+    stats->counters[i][2] = int64_sum[i];
+  }
+
+  // components without any process have no statistics
+  for (size_t i = 0; i < num_comps; ++i) {
+    if (stats->num_procs[i] > 0.0) continue;
+    memset(
+      stats->times + i * num_phases, 0, num_phases * sizeof(*(stats->times)));
+    memset(
+      stats->counters + i * num_phases * num_counters, 0,
+      num_phases * num_counters * sizeof(*(stats->counters)));
+  }
+
+  free(int64_buffer);
+  free(dble_buffer);
+
+  // reset local statistics (timers that are still active keep running)
+  memset(local_stats.time, 0, sizeof(local_stats.time));
+  memset(local_stats.num_calls, 0, sizeof(local_stats.num_calls));
+  memset(local_stats.counters, 0, sizeof(local_stats.counters));
+
+  return stats;
+}
+
+static double get_avg_time(struct yac_setup_stats * stats, size_t idx) {
+
+  double num_procs = stats->num_procs[idx / YAC_SETUP_NUM_PHASES];
+  return (num_procs > 0.0)?(stats->times[idx][2] / num_procs):0.0;
+}
+
+static size_t get_comp_idx(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * routine) {
+
+  YAC_ASSERT_F(
+    stats != NULL, "ERROR(%s): no setup statistics available", routine)
+  YAC_ASSERT_F(
+    comp_name != NULL, "ERROR(%s): invalid component name (NULL)", routine)
+
+  for (size_t i = 0; i < stats->num_comps; ++i)
+    if (!strcmp(stats->comp_names[i], comp_name)) return i;
+
+  YAC_ASSERT_F(
+    0, "ERROR(%s): unknown component \"%s\"", routine, comp_name)
+  return SIZE_MAX;
+}
+
+static size_t get_phase_idx(char const * phase_name, char const * routine) {
+
+  YAC_ASSERT_F(
+    phase_name != NULL, "ERROR(%s): invalid phase name (NULL)", routine)
+
+  for (size_t i = 0; i < YAC_SETUP_NUM_PHASES; ++i)
+    if (!strcmp(phase_names[i], phase_name)) return i;
+
+  YAC_ASSERT_F(0, "ERROR(%s): unknown phase \"%s\"", routine, phase_name)
+  return SIZE_MAX;
+}
+
+static size_t get_counter_idx(char const * counter_name, char const * routine) {
+
+  YAC_ASSERT_F(
+    counter_name != NULL, "ERROR(%s): invalid counter name (NULL)", routine)
+
+  for (size_t i = 0; i < YAC_SETUP_NUM_COUNTERS; ++i)
+    if (!strcmp(counter_names[i], counter_name)) return i;
+
+  YAC_ASSERT_F(
+    0, "ERROR(%s): unknown counter \"%s\"", routine, counter_name)
+  return SIZE_MAX;
+}
+
+void yac_setup_stats_get_timer(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, double * min_time, double * max_time,
+  double * avg_time) {
+
+  size_t idx =
+    get_comp_idx(stats, comp_name, "yac_setup_stats_get_timer") *
+      YAC_SETUP_NUM_PHASES +
+    get_phase_idx(phase_name, "yac_setup_stats_get_timer");
+
+  *min_time = stats->times[idx][0];
+  *max_time = stats->times[idx][1];
+  *avg_time = get_avg_time(stats, idx);
+}
+
+void yac_setup_stats_get_counter(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, char const * counter_name,
+  int64_t * min_value, int64_t * max_value, int64_t * sum_value) {
+
+  size_t idx =
+    (get_comp_idx(stats, comp_name, "yac_setup_stats_get_counter") *
+       YAC_SETUP_NUM_PHASES +
+     get_phase_idx(phase_name, "yac_setup_stats_get_counter")) *
+      YAC_SETUP_NUM_COUNTERS +
+    get_counter_idx(counter_name, "yac_setup_stats_get_counter");
+
+  *min_value = stats->counters[idx][0];
+  *max_value = stats->counters[idx][1];
+  *sum_value = stats->counters[idx][2];
+}
+
+void yac_setup_stats_write_json(
+  struct yac_setup_stats * stats, char const * file_name, MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  if (rank != 0) return;
+
+  FILE * file = fopen(file_name, "w");
+  YAC_ASSERT_F(
+    file != NULL,
+    "ERROR(yac_setup_stats_write_json): could not open file \"%s\"",
+    file_name)
+
+  fputs("{\n  \"components\": [", file);
+  for (size_t i = 0; i < stats->num_comps; ++i) {
+
+    fprintf(
+      file, "%s\n    {\n      \"name\": \"%s\",\n"
+      "      \"num_procs\": %.0f,\n      \"phases\": [",
+      (i > 0)?",":"", stats->comp_names[i], stats->num_procs[i]);
+
+    int first_phase = 1;
+    for (size_t j = 0; j < YAC_SETUP_NUM_PHASES; ++j) {
+
+      size_t idx = i * YAC_SETUP_NUM_PHASES + j;
+
+      // skip phases no process of the component has passed through
+      if (stats->num_calls[idx] == 0.0) continue;
+
+      fprintf(
+        file, "%s\n        {\n          \"name\": \"%s\",\n"
+        "          \"calls\": %.0f,\n"
+        "          \"time\": {\"min\": %.6e, \"max\": %.6e, \"avg\": %.6e}",
+        first_phase?"":",", phase_names[j], stats->num_calls[idx],
+        stats->times[idx][0], stats->times[idx][1],
+        get_avg_time(stats, idx));
+      first_phase = 0;
+
+      for (size_t k = 0; k < YAC_SETUP_NUM_COUNTERS; ++k) {
+        int64_t * counter =
+          stats->counters[idx * YAC_SETUP_NUM_COUNTERS + k];
+        fprintf(
+          file, ",\n          \"%s\": "
+          "{\"min\": %" PRId64 ", \"max\": %" PRId64 ", \"sum\": %" PRId64 "}",
+          counter_names[k], counter[0], counter[1], counter[2]);
+      }
+      fputs("\n        }", file);
+    }
+    fputs("\n      ]\n    }", file);
+  }
+  fputs("\n  ]\n}\n", file);
+
+  YAC_ASSERT_F(
+    !fclose(file),
+    "ERROR(yac_setup_stats_write_json): could not close file \"%s\"",
+    file_name)
+}
+
+char * yac_setup_stats_get_file_name(MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  char * file_name = NULL;
+
+  // environment is only checked on rank 0, results are broadcasted
+  // to other processes
+  if (rank == 0) {
+    char const * file_name_env = getenv(YAC_SETUP_STATS_FILE_ENV);
+    if ((file_name_env != NULL) && (file_name_env[0] != '\0'))
+      file_name = strdup(file_name_env);
+  }
+
+  yac_bcast_string(&file_name, comm);
+
+  return file_name;
+}
+
+void yac_setup_stats_delete(struct yac_setup_stats * stats) {
+
+  if (stats == NULL) return;
+
+  for (size_t i = 0; i < stats->num_comps; ++i) free(stats->comp_names[i]);
+  free(stats->comp_names);
+  free(stats->num_procs);
+  free(stats->times);
+  free(stats->num_calls);
+  free(stats->counters);
+  free(stats);
+}
@@ -0,0 +1,220 @@
+/**
+ * @file setup_stats.h
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SETUP_STATS_H
+#define SETUP_STATS_H
+
+#include <stdint.h>
+
+#include "yac_mpi.h"
+
+/** \example test_setup_stats_parallel.c
+ * A test for the setup statistics.
+ */
+
+/*
+ * The setup statistics measure the time spent in the different phases of
+ * \ref yac_instance_setup and collect some counters for each phase. The
+ * phases are hierarchical (e.g. the time of "setup/interp_weights" includes
+ * the one of "setup/interp_weights/do_search"). Counters are accounted to
+ * all phases that are active when the counter is increased.
+ *
+ * The processes collect their statistics locally. At the end of
+ * \ref yac_instance_setup the statistics are aggregated for each component
+ * across all processes of the respective component
+ * (see \ref yac_setup_stats_aggregate).
+ *
+ * The collection of the local statistics is not thread-safe and has to be
+ * done by the main thread.
+ */
+
+/**
+ * name of the environment variable through which a file name can be
+ * provided, the aggregated statistics are written in JSON format to this
+ * file after the setup
+ */
+#define YAC_SETUP_STATS_FILE_ENV "YAC_SETUP_STATS_FILE"
+
+enum yac_setup_phase {
+  YAC_SETUP_PHASE_SETUP = 0,               //!< "setup"
+  YAC_SETUP_PHASE_SYNC_DEF,                //!< "setup/sync_def"
+  YAC_SETUP_PHASE_DIST_GRID_PAIR,          //!< "setup/dist_grid_pair"
+  YAC_SETUP_PHASE_REDISTRIBUTE_CELLS,      //!< ".../redistribute_cells"
+  YAC_SETUP_PHASE_GENERATE_DIST_GRID,      //!< ".../generate_dist_grid"
+  YAC_SETUP_PHASE_SEARCH_DATA,             //!< ".../search_data"
+  YAC_SETUP_PHASE_INTERP_GRID,             //!< "setup/interp_grid"
+  YAC_SETUP_PHASE_INTERP_WEIGHTS,          //!< "setup/interp_weights"
+  YAC_SETUP_PHASE_WEIGHT_CACHE,            //!< ".../weight_cache"
+  YAC_SETUP_PHASE_DO_SEARCH,               //!< ".../do_search"
+  YAC_SETUP_PHASE_DO_SEARCH_AVG,           //!< ".../do_search/avg"
+  YAC_SETUP_PHASE_DO_SEARCH_NNN,           //!< ".../do_search/nnn"
+  YAC_SETUP_PHASE_DO_SEARCH_CONSERV,       //!< ".../do_search/conserv"
+  YAC_SETUP_PHASE_DO_SEARCH_SPMAP,         //!< ".../do_search/spmap"
+  YAC_SETUP_PHASE_DO_SEARCH_HCSBB,         //!< ".../do_search/hcsbb"
+  YAC_SETUP_PHASE_DO_SEARCH_FILE,          //!< ".../do_search/file"
+  YAC_SETUP_PHASE_DO_SEARCH_FIXED,         //!< ".../do_search/fixed"
+  YAC_SETUP_PHASE_DO_SEARCH_CHECK,         //!< ".../do_search/check"
+  YAC_SETUP_PHASE_DO_SEARCH_CREEP,         //!< ".../do_search/creep"
+  YAC_SETUP_PHASE_DO_SEARCH_CALLBACK,      //!< ".../do_search/callback"
+  YAC_SETUP_PHASE_PRUNE_WEIGHTS,           //!< ".../prune_weights"
+  YAC_SETUP_PHASE_WRITE_WEIGHTS,           //!< "setup/write_weights"
+  YAC_SETUP_PHASE_INTERPOLATION,           //!< "setup/interpolation"
+  YAC_SETUP_NUM_PHASES,
+};
+
+enum yac_setup_counter {
+  YAC_SETUP_COUNTER_BYTES_EXCHANGED = 0, //!< "bytes_exchanged"
+                                         //!< (bytes sent to other processes
+                                         //!<  by \ref yac_alltoallv_p2p)
+  YAC_SETUP_COUNTER_NUM_STENCILS,        //!< "num_stencils"
+                                         //!< (number of target points for
+                                         //!<  which a stencil was computed)
+  YAC_SETUP_COUNTER_PEAK_MEMORY,         //!< "peak_memory"
+                                         //!< (increase of the peak resident
+                                         //!<  set size of the process during
+                                         //!<  the phase in bytes)
+  YAC_SETUP_COUNTER_NUM_PRUNED_LINKS,    //!< "num_pruned_links"
+                                         //!< (number of links removed by
+                                         //!<  \ref yac_interp_weights_prune)
+  YAC_SETUP_COUNTER_NUM_AUTO_MAPPING_SRC, //!< "num_auto_mapping_on_source"
+                                          //!< (number of interpolations for
+                                          //!<  which the automatic mapping
+                                          //!<  side selection chose the
+                                          //!<  source side)
+  YAC_SETUP_COUNTER_NUM_AUTO_MAPPING_TGT, //!< "num_auto_mapping_on_target"
+                                          //!< (same for the target side)
+  YAC_SETUP_NUM_COUNTERS,
+};
+
+struct yac_setup_stats;
+
+/**
+ * starts the timer of a phase
+ * @param[in] phase phase
+ * @remark phases may be nested, the timer of a phase that is already
+ *         active is not restarted
+ */
+void yac_setup_stats_start(enum yac_setup_phase phase);
+
+/**
+ * stops the timer of a phase
+ * @param[in] phase phase
+ */
+void yac_setup_stats_stop(enum yac_setup_phase phase);
+
+/**
+ * adds a value to a counter of all currently active phases
+ * @param[in] counter counter
+ * @param[in] value   value to be added
+ */
+void yac_setup_stats_add(enum yac_setup_counter counter, uint64_t value);
+
+/**
+ * aggregates the local statistics of all processes for each component
+ * and resets the local statistics afterwards
+ * @param[in] comp_names      names of all components
+ * @param[in] num_comps       number of components
+ * @param[in] local_comp_flag flag for each component, indicating whether
+ *                            the local process is part of the component
+ * @param[in] comm            communicator containing all processes
+ * @return aggregated statistics
+ * @remark this call is collective for all processes in comm and all
+ *         processes have to provide the same components in the same order
+ */
+struct yac_setup_stats * yac_setup_stats_aggregate(
+  char const ** comp_names, size_t num_comps, int const * local_comp_flag,
+  MPI_Comm comm);
+
+/**
+ * returns the aggregated timer of a phase for a component
+ * @param[in]  stats      aggregated statistics
+ * @param[in]  comp_name  name of the component
+ * @param[in]  phase_name name of the phase (e.g. "setup/interp_weights")
+ * @param[out] min_time   minimum time (in seconds) across all processes
+ *                        of the component
+ * @param[out] max_time   maximum time (in seconds) across all processes
+ *                        of the component
+ * @param[out] avg_time   average time (in seconds) across all processes
+ *                        of the component
+ * @remark processes that did not pass through a phase contribute a time of
+ *         zero
+ */
+void yac_setup_stats_get_timer(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, double * min_time, double * max_time,
+  double * avg_time);
+
+/**
+ * returns an aggregated counter of a phase for a component
+ * @param[in]  stats        aggregated statistics
+ * @param[in]  comp_name    name of the component
+ * @param[in]  phase_name   name of the phase (e.g. "setup/interp_weights")
+ * @param[in]  counter_name name of the counter (e.g. "num_stencils")
+ * @param[out] min_value    minimum value across all processes of the
+ *                          component
+ * @param[out] max_value    maximum value across all processes of the
+ *                          component
+ * @param[out] sum_value    sum of all values across all processes of the
+ *                          component
+ */
+void yac_setup_stats_get_counter(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, char const * counter_name,
+  int64_t * min_value, int64_t * max_value, int64_t * sum_value);
+
+/**
+ * writes the aggregated statistics in JSON format to a file
+ * @param[in] stats     aggregated statistics
+ * @param[in] file_name name of the file
+ * @param[in] comm      communicator that was passed to
+ *                      \ref yac_setup_stats_aggregate
+ * @remark this call is collective, only the root process writes the file
+ */
+void yac_setup_stats_write_json(
+  struct yac_setup_stats * stats, char const * file_name, MPI_Comm comm);
+
+/**
+ * gets the name of the JSON output file from the environment
+ * (\ref YAC_SETUP_STATS_FILE_ENV)
+ * @param[in] comm communicator
+ * @return name of the file (NULL if no file is to be written)
+ * @remark this call is collective, the environment is only evaluated on
+ *         the root process
+ * @remark the user has to free the returned string
+ */
+char * yac_setup_stats_get_file_name(MPI_Comm comm);
+
+void yac_setup_stats_delete(struct yac_setup_stats * stats);
+
+#endif // SETUP_STATS_H
@@ -75,6 +75,11 @@ enum {
    I_list_tree_min_size = 2, //!< make I list into tree when list is
                              //!<  larger than this
 };
+
+// minimum number of elements in a subtree for which its construction is
+// done in parallel to the rest of the tree (if OpenMP is available); this
+// does not affect the resulting tree
+#define SPHERE_PART_PARALLEL_MIN_SIZE ((size_t)8192)
 enum {
   U_FLAG = 1,
   T_FLAG = 2,
@@ -133,20 +138,38 @@ struct point_sphere_part_node {
 
    int flags;
 
-   void * U, * T;
+   // if the respective branch is a leaf, U/T contain the offset of its first
+   // point in point_sphere_part_search::points, otherwise they contain the
+   // index of the child node in point_sphere_part_search::nodes
+   size_t U, T;
 
    size_t U_size, T_size;
 
    double gc_norm_vector[3];
 };
 
+// points stored as structure of arrays, the points of each leaf are
+// contiguous (sorted by idx)
+struct point_sphere_part_points {
+   double * x, * y, * z;
+   size_t * idx; // index of the point in the coordinates array passed to
+                 // the constructor
+};
+
 struct point_sphere_part_search {
 
-   struct point_sphere_part_node base_node;
-   struct point_id_xyz * points;
+   // all nodes of the tree in breadth-first order (root is the first entry)
+   struct point_sphere_part_node * nodes;
+   struct point_sphere_part_points points;
    size_t max_tree_depth;
 };
 
+// range of points covered by a node during the construction of the tree
+struct point_sphere_part_range {
+   size_t offset, count;
+   size_t parent_idx, tree_depth;
+};
+
 struct point_id_xyz_int32 {
   size_t idx;
   int32_t coordinate_xyz[3];
@@ -459,9 +482,16 @@ static void partition_data (
 
    } else {
 
-      parent_node->U = get_sphere_part_node();
+      // the U and T subtrees are generated from disjoint parts of
+      // local_cell_ids and part_data, therefore they can be generated
+      // independently of each other
+      struct sphere_part_node * U_node = get_sphere_part_node();
+      parent_node->U = U_node;
+YAC_OMP(task if(U_size >= SPHERE_PART_PARALLEL_MIN_SIZE) \
+        firstprivate(local_cell_ids, part_data, U_size, threshold, U_node, \
+                     parent_node))
       partition_data(local_cell_ids, part_data, U_size, threshold,
-                     parent_node->U, parent_node->gc_norm_vector);
+                     U_node, parent_node->gc_norm_vector);
    }
    local_cell_ids += U_size;
    part_data += U_size;
@@ -487,18 +517,10 @@ static int compare_point_idx_xyz(void const * a, void const * b) {
          (((struct point_id_xyz *)a)->idx < ((struct point_id_xyz *)b)->idx);
 }
 
-static struct point_sphere_part_node * partition_point_data (
-  struct point_id_xyz * points, size_t num_points, size_t threshold,
-  double prev_gc_norm_vector[], size_t curr_tree_depth,
-  size_t * max_tree_depth) {
-
-  if (curr_tree_depth > *max_tree_depth) *max_tree_depth = curr_tree_depth;
-
-  struct point_sphere_part_node * node = xmalloc(1 * sizeof(*node));
-  double * gc_norm_vector = &(node->gc_norm_vector[0]);
-
-  compute_gc_norm_vector(
-    points, sizeof(*points), num_points, prev_gc_norm_vector, gc_norm_vector);
+// sorts the points such that all points for the U list come first, followed
+// by the elements of the T list; returns the size of the U list
+static size_t split_points(
+  struct point_id_xyz * points, size_t num_points, double gc_norm_vector[3]) {
 
   // angle between a point and the great circle plane
   // acos(dot(gc_norm_vector, point_xyz)) = angle(gc_norm_vector, point_xyz)
@@ -506,10 +528,10 @@ static struct point_sphere_part_node * partition_point_data (
   // dot <= 0.0    -> U list
   // dot >  0.0    -> T list
 
+  if (num_points == 0) return 0;
+
   struct point_id_xyz * left = points, * right = points + num_points - 1;
 
-  // sort such that all points for the U list come first, followed by the
-  // elements of the T list
   while (1) {
     // find element that does not belong into U-list
     while (left <= right) {
@@ -546,40 +568,151 @@ static struct point_sphere_part_node * partition_point_data (
     }
   }
 
-  size_t U_size = left - points;
-  size_t T_size = num_points - U_size;
+  return (size_t)(left - points);
+}
+
+// generates the node for the provided range of points (the range of the
+// points of each child branch is stored in the respective U/T entry)
+static void partition_point_range(
+  struct point_id_xyz * points, struct point_sphere_part_node * node,
+  struct point_sphere_part_range range, double prev_gc_norm_vector[3],
+  size_t threshold) {
+
+  struct point_id_xyz * curr_points = points + range.offset;
+  double * gc_norm_vector = &(node->gc_norm_vector[0]);
+
+  compute_gc_norm_vector(
+    curr_points, sizeof(*curr_points), range.count, prev_gc_norm_vector,
+    gc_norm_vector);
+
+  size_t U_size = split_points(curr_points, range.count, gc_norm_vector);
+  size_t T_size = range.count - U_size;
 
+  node->U = range.offset;
+  node->T = range.offset + U_size;
   node->U_size = U_size;
   node->T_size = T_size;
   node->flags = 0;
 
   // check whether the lists are small enough (if not -> partition again)
-  if ((U_size <= threshold) || (U_size == num_points)) {
-
-    node->U = points;
+  if ((U_size <= threshold) || (U_size == range.count)) {
     node->flags |= U_IS_LEAF;
-    qsort(points, U_size, sizeof(*points), compare_point_idx_xyz);
-
-  } else {
+    qsort(curr_points, U_size, sizeof(*curr_points), compare_point_idx_xyz);
+  }
+  if ((T_size <= threshold) || (T_size == range.count)) {
+    node->flags |= T_IS_LEAF;
+    qsort(curr_points + U_size, T_size, sizeof(*curr_points),
+          compare_point_idx_xyz);
+  }
+}
 
-    node->U = partition_point_data(points, U_size, threshold, gc_norm_vector,
-                                   curr_tree_depth + 1, max_tree_depth);
+// generates the tree for the provided points, the nodes are stored in
+// breadth-first order in a single array (the points are reordered such that
+// the points of each leaf are contiguous)
+static struct point_sphere_part_node * partition_point_data (
+  struct point_id_xyz * points, size_t num_points, size_t threshold,
+  double root_gc_norm_vector[], size_t * max_tree_depth) {
+
+  struct point_sphere_part_node * nodes = NULL;
+  size_t nodes_array_size = 0;
+  struct point_sphere_part_range * ranges = NULL;
+  size_t ranges_array_size = 0;
+
+  ENSURE_ARRAY_SIZE(nodes, nodes_array_size, 1);
+  ENSURE_ARRAY_SIZE(ranges, ranges_array_size, 1);
+  ranges[0].offset = 0;
+  ranges[0].count = num_points;
+  ranges[0].parent_idx = SIZE_MAX;
+  ranges[0].tree_depth = 1;
+  size_t num_nodes = 1;
+
+  // the tree is generated level by level; all nodes of a level cover
+  // disjoint ranges of points and only depend on their parent node, therefore
+  // they can be partitioned in parallel. The children are numbered
+  // afterwards in the order of their parents, which results in a
+  // breadth-first ordering of the node array that is independent of the
+  // number of threads.
+  for (size_t level_begin = 0, level_end = 1; level_begin < level_end;
+       level_begin = level_end, level_end = num_nodes) {
+
+    *max_tree_depth = ranges[level_begin].tree_depth;
+
+    size_t level_num_points = 0;
+    for (size_t i = level_begin; i < level_end; ++i)
+      level_num_points += ranges[i].count;
+
+YAC_OMP(parallel for schedule(dynamic, 1) \
+        if((level_end - level_begin > 1) && \
+           (level_num_points >= SPHERE_PART_PARALLEL_MIN_SIZE)))
+    for (size_t i = level_begin; i < level_end; ++i)
+      partition_point_range(
+        points, nodes + i, ranges[i],
+        (ranges[i].parent_idx == SIZE_MAX)?
+          root_gc_norm_vector:nodes[ranges[i].parent_idx].gc_norm_vector,
+        threshold);
+
+    // each node adds at most two new nodes
+    size_t max_num_nodes = level_end + 2 * (level_end - level_begin);
+    ENSURE_ARRAY_SIZE(nodes, nodes_array_size, max_num_nodes);
+    ENSURE_ARRAY_SIZE(ranges, ranges_array_size, max_num_nodes);
+
+    for (size_t i = level_begin; i < level_end; ++i) {
+
+      struct point_sphere_part_node * node = nodes + i;
+
+      if (!(node->flags & U_IS_LEAF)) {
+        ranges[num_nodes].offset = node->U;
+        ranges[num_nodes].count = node->U_size;
+        ranges[num_nodes].parent_idx = i;
+        ranges[num_nodes].tree_depth = ranges[i].tree_depth + 1;
+        node->U = num_nodes++;
+      }
+      if (!(node->flags & T_IS_LEAF)) {
+        ranges[num_nodes].offset = node->T;
+        ranges[num_nodes].count = node->T_size;
+        ranges[num_nodes].parent_idx = i;
+        ranges[num_nodes].tree_depth = ranges[i].tree_depth + 1;
+        node->T = num_nodes++;
+      }
+    }
   }
 
-  if ((T_size <= threshold) || (T_size == num_points)) {
+  free(ranges);
 
-    node->T = points + U_size;
-    node->flags |= T_IS_LEAF;
-    qsort(points + U_size, T_size, sizeof(*points), compare_point_idx_xyz);
+  return xrealloc(nodes, num_nodes * sizeof(*nodes));
+}
 
-  } else {
+// converts the points into a structure of arrays
+static struct point_sphere_part_points get_point_sphere_part_points(
+  struct point_id_xyz * points, size_t num_points) {
 
-    node->T =
-      partition_point_data(points + U_size, T_size, threshold, gc_norm_vector,
-                           curr_tree_depth + 1, max_tree_depth);
+  double * coordinates_xyz =
+    xmalloc(3 * MAX(num_points, 1) * sizeof(*coordinates_xyz));
+  size_t * idx = xmalloc(MAX(num_points, 1) * sizeof(*idx));
+
+  struct point_sphere_part_points soa_points =
+    {.x = coordinates_xyz,
+     .y = coordinates_xyz + num_points,
+     .z = coordinates_xyz + 2 * num_points,
+     .idx = idx};
+
+  for (size_t i = 0; i < num_points; ++i) {
+    soa_points.x[i] = points[i].coordinates_xyz[0];
+    soa_points.y[i] = points[i].coordinates_xyz[1];
+    soa_points.z[i] = points[i].coordinates_xyz[2];
+    soa_points.idx[i] = points[i].idx;
   }
 
-  return node;
+  return soa_points;
+}
+
+static inline struct point_id_xyz get_point_id_xyz(
+  struct point_sphere_part_points const * points, size_t i) {
+
+  return
+    (struct point_id_xyz){
+      .coordinates_xyz = {points->x[i], points->y[i], points->z[i]},
+      .idx = points->idx[i]};
 }
 
 struct bnd_sphere_part_search * yac_bnd_sphere_part_search_new(
@@ -601,6 +734,10 @@ struct bnd_sphere_part_search * yac_bnd_sphere_part_search_new(
       part_data[i].local_id = i;
    }
 
+   // subtrees are generated by OpenMP tasks, the implicit barrier at the end
+   // of the parallel region waits for all of them
+YAC_OMP(parallel if(num_circles >= SPHERE_PART_PARALLEL_MIN_SIZE))
+YAC_OMP(single)
    partition_data(ids, part_data, num_circles, I_list_tree_min_size,
                   &(search->base_node), gc_norm_vector);
 
@@ -698,54 +835,49 @@ static struct point_id_xyz *
   return points;
 }
 
-struct point_sphere_part_search * yac_point_sphere_part_search_new (
-  size_t num_points, coordinate_pointer coordinates_xyz, yac_int const * ids) {
-
-  if (num_points == 0) return NULL;
+static struct point_sphere_part_search * point_sphere_part_search_new(
+  struct point_id_xyz * points, size_t num_points) {
 
   struct point_sphere_part_search * search = xmalloc(1 * sizeof(*search));
-  struct point_id_xyz * points =
-    get_unique_points(&num_points, coordinates_xyz, ids, NULL);
-  search->points = points;
 
   size_t max_tree_depth = 0;
 
   // emperical measurements have given a threshold for the leaf size of 2
-  struct point_sphere_part_node * tmp_node =
+  search->nodes =
     partition_point_data(
       points, num_points, I_list_tree_min_size, (double[3]){0.0,0.0,1.0},
-      1, &max_tree_depth);
-
-  search->base_node = *tmp_node;
+      &max_tree_depth);
+  search->points = get_point_sphere_part_points(points, num_points);
   search->max_tree_depth = max_tree_depth;
-  free(tmp_node);
 
   return search;
 }
 
-struct point_sphere_part_search * yac_point_sphere_part_search_mask_new (
-  size_t num_points, coordinate_pointer coordinates_xyz,
-  yac_int const * ids, int const * mask) {
+struct point_sphere_part_search * yac_point_sphere_part_search_new (
+  size_t num_points, coordinate_pointer coordinates_xyz, yac_int const * ids) {
 
   if (num_points == 0) return NULL;
 
   struct point_id_xyz * points =
-    get_unique_points(&num_points, coordinates_xyz, ids, mask);
+    get_unique_points(&num_points, coordinates_xyz, ids, NULL);
+  struct point_sphere_part_search * search =
+    point_sphere_part_search_new(points, num_points);
+  free(points);
 
-  struct point_sphere_part_search * search = xmalloc(1 * sizeof(*search));
-  search->points = xrealloc(points, num_points * sizeof(*points));
+  return search;
+}
 
-  size_t max_tree_depth = 0;
+struct point_sphere_part_search * yac_point_sphere_part_search_mask_new (
+  size_t num_points, coordinate_pointer coordinates_xyz,
+  yac_int const * ids, int const * mask) {
 
-  // emperical measurements have given a threshold for the leaf size of 2
-  struct point_sphere_part_node * tmp_node =
-    partition_point_data(
-      search->points, num_points, I_list_tree_min_size,
-      (double[3]){0.0,0.0,1.0}, 1, &max_tree_depth);
+  if (num_points == 0) return NULL;
 
-  search->base_node = *tmp_node;
-  search->max_tree_depth = max_tree_depth;
-  free(tmp_node);
+  struct point_id_xyz * points =
+    get_unique_points(&num_points, coordinates_xyz, ids, mask);
+  struct point_sphere_part_search * search =
+    point_sphere_part_search_new(points, num_points);
+  free(points);
 
   return search;
 }
@@ -963,7 +1095,8 @@ static void search_bnd_circle(struct sphere_part_node * node,
 }
 
 static inline void check_leaf_NN(
-  struct point_id_xyz * points, size_t num_points,
+  struct point_sphere_part_points const * points, size_t offset,
+  size_t num_points,
   double * point_coordinates_xyz, struct sin_cos_angle * best_angle,
   double (**result_coordinates_xyz)[3],
   size_t * result_coordinates_xyz_array_size, size_t ** local_point_ids,
@@ -994,12 +1127,17 @@ static inline void check_leaf_NN(
   local_point_ids_ += total_num_local_point_ids;
 
 
+  double const * x = points->x + offset;
+  double const * y = points->y + offset;
+  double const * z = points->z + offset;
+  size_t const * idx = points->idx + offset;
+
   // check leaf for results
   for (size_t i = 0; i < num_points; ++i) {
 
+    double curr_coordinates_xyz[3] = {x[i], y[i], z[i]};
     struct sin_cos_angle curr_angle =
-      get_vector_angle_2(
-        points[i].coordinates_xyz, point_coordinates_xyz);
+      get_vector_angle_2(curr_coordinates_xyz, point_coordinates_xyz);
     int compare = compare_angles(curr_angle, *best_angle);
 
     // if the point is worse than the currently best point
@@ -1011,23 +1149,20 @@ static inline void check_leaf_NN(
       *best_angle = curr_angle;
       num_local_point_ids_ = 1;
       if (result_coordinates_xyz != NULL) {
-        result_coordinates_xyz_[0][0] = points[i].coordinates_xyz[0];
-        result_coordinates_xyz_[0][1] = points[i].coordinates_xyz[1];
-        result_coordinates_xyz_[0][2] = points[i].coordinates_xyz[2];
+        result_coordinates_xyz_[0][0] = x[i];
+        result_coordinates_xyz_[0][1] = y[i];
+        result_coordinates_xyz_[0][2] = z[i];
       }
-      local_point_ids_[0] = points[i].idx;
+      local_point_ids_[0] = idx[i];
 
     } else {
 
       if (result_coordinates_xyz != NULL) {
-        result_coordinates_xyz_[num_local_point_ids_][0] =
-          points[i].coordinates_xyz[0];
-        result_coordinates_xyz_[num_local_point_ids_][1] =
-          points[i].coordinates_xyz[1];
-        result_coordinates_xyz_[num_local_point_ids_][2] =
-          points[i].coordinates_xyz[2];
+        result_coordinates_xyz_[num_local_point_ids_][0] = x[i];
+        result_coordinates_xyz_[num_local_point_ids_][1] = y[i];
+        result_coordinates_xyz_[num_local_point_ids_][2] = z[i];
       }
-      local_point_ids_[num_local_point_ids_] = points[i].idx;
+      local_point_ids_[num_local_point_ids_] = idx[i];
       num_local_point_ids_++;
     }
   }
@@ -1036,6 +1171,7 @@ static inline void check_leaf_NN(
 }
 
 static void point_search_NN(
+  struct point_sphere_part_search * search,
   struct bounding_circle * bnd_circle, double (**result_coordinates_xyz)[3],
   size_t * result_coordinates_xyz_array_size, size_t ** local_point_ids,
   size_t * local_point_ids_array_size, size_t total_num_local_point_ids,
@@ -1063,7 +1199,7 @@ static void point_search_NN(
         if (node->flags & U_IS_LEAF) {
 
           check_leaf_NN(
-            (struct point_id_xyz *)(node->U), node->U_size,
+            &(search->points), node->U, node->U_size,
             point_coordinates_xyz, &best_angle, result_coordinates_xyz,
             result_coordinates_xyz_array_size, local_point_ids,
             local_point_ids_array_size, total_num_local_point_ids,
@@ -1073,7 +1209,7 @@ static void point_search_NN(
 
           // traverse down one level
           ++curr_tree_depth;
-          node = (struct point_sphere_part_node *)(node->U);
+          node = search->nodes + node->U;
           dot = node->gc_norm_vector[0] * point_coordinates_xyz[0] +
                 node->gc_norm_vector[1] * point_coordinates_xyz[1] +
                 node->gc_norm_vector[2] * point_coordinates_xyz[2];
@@ -1097,7 +1233,7 @@ static void point_search_NN(
         if (node->flags & T_IS_LEAF) {
 
            check_leaf_NN(
-             (struct point_id_xyz *)(node->T), node->T_size,
+             &(search->points), node->T, node->T_size,
              point_coordinates_xyz, &best_angle, result_coordinates_xyz,
              result_coordinates_xyz_array_size, local_point_ids,
              local_point_ids_array_size, total_num_local_point_ids,
@@ -1107,7 +1243,7 @@ static void point_search_NN(
 
            // traverse down one level
            ++curr_tree_depth;
-           node = (struct point_sphere_part_node *)(node->T);
+           node = search->nodes + node->T;
            dot = node->gc_norm_vector[0] * point_coordinates_xyz[0] +
                  node->gc_norm_vector[1] * point_coordinates_xyz[1] +
                  node->gc_norm_vector[2] * point_coordinates_xyz[2];
@@ -1136,7 +1272,25 @@ static void point_search_NN(
   bnd_circle->inc_angle = best_angle;
 }
 
+static inline int point_check_bnd_circle_leaf(
+   struct point_sphere_part_points const * points, size_t offset,
+   size_t num_points, struct bounding_circle bnd_circle) {
+
+   double const * x = points->x + offset;
+   double const * y = points->y + offset;
+   double const * z = points->z + offset;
+
+   for (size_t i = 0; i < num_points; ++i) {
+      double cos_angle = x[i] * bnd_circle.base_vector[0] +
+                         y[i] * bnd_circle.base_vector[1] +
+                         z[i] * bnd_circle.base_vector[2];
+      if (cos_angle > bnd_circle.inc_angle.cos) return 1;
+   }
+   return 0;
+}
+
 static int point_check_bnd_circle(
+   struct point_sphere_part_search * search,
    struct point_sphere_part_node * node, struct bounding_circle bnd_circle) {
 
    double dot = node->gc_norm_vector[0]*bnd_circle.base_vector[0] +
@@ -1149,19 +1303,12 @@ static int point_check_bnd_circle(
    if (dot <= bnd_circle.inc_angle.sin) {
 
       if (node->flags & U_IS_LEAF) {
-
-         struct point_id_xyz * U = (struct point_id_xyz *)(node->U);
-         size_t U_size = node->U_size;
-         for (size_t i = 0; i < U_size; ++i) {
-            double cos_angle =
-               U[i].coordinates_xyz[0] * bnd_circle.base_vector[0] +
-               U[i].coordinates_xyz[1] * bnd_circle.base_vector[1] +
-               U[i].coordinates_xyz[2] * bnd_circle.base_vector[2];
-            if (cos_angle > bnd_circle.inc_angle.cos) return 1;
-         }
-
+         if (point_check_bnd_circle_leaf(
+               &(search->points), node->U, node->U_size, bnd_circle))
+            return 1;
       } else {
-         ret = point_check_bnd_circle(node->U, bnd_circle);
+         ret = point_check_bnd_circle(
+            search, search->nodes + node->U, bnd_circle);
       }
    }
 
@@ -1169,19 +1316,12 @@ static int point_check_bnd_circle(
    if ((!ret) && (dot > - bnd_circle.inc_angle.sin)) {
 
       if (node->flags & T_IS_LEAF) {
-
-         struct point_id_xyz * T = (struct point_id_xyz *)(node->T);
-         size_t T_size = node->T_size;
-         for (size_t i = 0; i < T_size; ++i) {
-            double cos_angle =
-               T[i].coordinates_xyz[0] * bnd_circle.base_vector[0] +
-               T[i].coordinates_xyz[1] * bnd_circle.base_vector[1] +
-               T[i].coordinates_xyz[2] * bnd_circle.base_vector[2];
-            if (cos_angle > bnd_circle.inc_angle.cos) return 1;
-         }
-
+         if (point_check_bnd_circle_leaf(
+               &(search->points), node->T, node->T_size, bnd_circle))
+            return 1;
       } else {
-         ret = point_check_bnd_circle(node->T, bnd_circle);
+         ret = point_check_bnd_circle(
+            search, search->nodes + node->T, bnd_circle);
       }
    }
 
@@ -1189,26 +1329,29 @@ static int point_check_bnd_circle(
 }
 
 static inline int leaf_contains_matching_point(
-  struct point_id_xyz * points, size_t num_points, double coordinate_xyz[3],
+  struct point_sphere_part_points const * points, size_t offset,
+  size_t num_points, double coordinate_xyz[3],
   size_t ** local_point_ids, size_t * local_point_ids_array_size,
   double (**result_coordinates_xyz)[3],
   size_t * result_coordinates_xyz_array_size,
   size_t total_num_local_point_ids, size_t * num_local_point_ids) {
 
-  for (size_t i = 0; i < num_points; ++i) {
+  for (size_t i = offset; i < offset + num_points; ++i) {
+
+    double curr_coordinates_xyz[3] = {points->x[i], points->y[i], points->z[i]};
 
     // if the points are nearly identical
-    if (points_are_identically(points[i].coordinates_xyz, coordinate_xyz)) {
+    if (points_are_identically(curr_coordinates_xyz, coordinate_xyz)) {
 
       ENSURE_ARRAY_SIZE(*local_point_ids, *local_point_ids_array_size,
                         total_num_local_point_ids + 1);
-      (*local_point_ids)[total_num_local_point_ids] = points[i].idx;
+      (*local_point_ids)[total_num_local_point_ids] = points->idx[i];
       if (result_coordinates_xyz != NULL) {
         ENSURE_ARRAY_SIZE(*result_coordinates_xyz,
                           *result_coordinates_xyz_array_size,
                           total_num_local_point_ids + 1);
         memcpy((*result_coordinates_xyz) + total_num_local_point_ids,
-               points[i].coordinates_xyz, 3 * sizeof(double));
+               curr_coordinates_xyz, 3 * sizeof(double));
       }
       *num_local_point_ids = 1;
       return 1;
@@ -1232,7 +1375,7 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
 
   if (search == NULL) return;
 
-  struct point_sphere_part_node * base_node = &(search->base_node);
+  struct point_sphere_part_node * base_node = search->nodes;
 
   size_t total_num_local_point_ids = 0;
 
@@ -1248,7 +1391,7 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
     double * curr_coordinates_xyz = coordinates_xyz[i];
 
     size_t curr_tree_depth = 0;
-    struct point_id_xyz * points = NULL;
+    size_t points_offset = 0;
     size_t curr_num_points = 0;
 
     // get the matching leaf for the current point
@@ -1269,7 +1412,7 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
 
         if (curr_node->flags & U_IS_LEAF) {
           if (curr_node->U_size > 0) {
-            points = (struct point_id_xyz*)(curr_node->U);
+            points_offset = curr_node->U;
             curr_num_points = curr_node->U_size;
             break;
           } else {
@@ -1278,11 +1421,11 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
               curr_node->flags & T_IS_LEAF,
               "ERROR(yac_point_sphere_part_search_NN): "
               "if one branch is empty, the other has to be a leaf");
-            points = (struct point_id_xyz*)(curr_node->T);
+            points_offset = curr_node->T;
             curr_num_points = curr_node->T_size;
             break;
           }
-        } else curr_node = curr_node->U;
+        } else curr_node = search->nodes + curr_node->U;
 
       // angle < M_PI_2
       } else if (dot > -yac_angle_tol) {
@@ -1291,7 +1434,7 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
 
         if (curr_node->flags & T_IS_LEAF) {
           if (curr_node->T_size > 0) {
-            points = (struct point_id_xyz*)(curr_node->T);
+            points_offset = curr_node->T;
             curr_num_points = curr_node->T_size;
             break;
           } else {
@@ -1300,11 +1443,11 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
               curr_node->flags & U_IS_LEAF,
               "ERROR(yac_point_sphere_part_search_NN): "
               "if one branch is empty, the other has to be a leaf");
-            points = (struct point_id_xyz*)(curr_node->U);
+            points_offset = curr_node->U;
             curr_num_points = curr_node->U_size;
             break;
           }
-        } else curr_node = curr_node->T;
+        } else curr_node = search->nodes + curr_node->T;
       }
 
       curr_tree_depth++;
@@ -1312,10 +1455,10 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
 
     // if we do not have to do a finer search
     if (leaf_contains_matching_point(
-          points, curr_num_points, curr_coordinates_xyz, local_point_ids,
-          local_point_ids_array_size, result_coordinates_xyz,
-          result_coordinates_xyz_array_size, total_num_local_point_ids,
-          num_local_point_ids + i)) {
+          &(search->points), points_offset, curr_num_points,
+          curr_coordinates_xyz, local_point_ids, local_point_ids_array_size,
+          result_coordinates_xyz, result_coordinates_xyz_array_size,
+          total_num_local_point_ids, num_local_point_ids + i)) {
 
       if (cos_angles != NULL) cos_angles[i] = 1.0;
 
@@ -1329,15 +1472,17 @@ void yac_point_sphere_part_search_NN(struct point_sphere_part_search * search,
       bnd_circle.sq_crd = DBL_MAX;
 
       check_leaf_NN(
-        points, curr_num_points, curr_coordinates_xyz, &bnd_circle.inc_angle,
+        &(search->points), points_offset, curr_num_points,
+        curr_coordinates_xyz, &bnd_circle.inc_angle,
         result_coordinates_xyz, result_coordinates_xyz_array_size,
         local_point_ids, local_point_ids_array_size, total_num_local_point_ids,
         num_local_point_ids + i);
 
       // get best result points
       point_search_NN(
-        &bnd_circle, result_coordinates_xyz, result_coordinates_xyz_array_size,
-        local_point_ids, local_point_ids_array_size, total_num_local_point_ids,
+        search, &bnd_circle, result_coordinates_xyz,
+        result_coordinates_xyz_array_size, local_point_ids,
+        local_point_ids_array_size, total_num_local_point_ids,
         num_local_point_ids + i, dot_stack, node_stack, flags, curr_tree_depth);
 
       if (cos_angles != NULL) cos_angles[i] = bnd_circle.inc_angle.cos;
@@ -1365,7 +1510,8 @@ static inline int compare_point_id_xyz_angle(const void * a, const void * b) {
 }
 
 static size_t initial_point_bnd_search_NNN(
-  size_t n, struct point_id_xyz * points, size_t num_points,
+  size_t n, struct point_sphere_part_points const * points, size_t offset,
+  size_t num_points,
   double * point_coordinates_xyz, struct point_id_xyz_angle ** results,
   size_t * results_array_size) {
 
@@ -1386,11 +1532,11 @@ static size_t initial_point_bnd_search_NNN(
 #endif
   for (size_t i = 0; i < num_points; ++i) {
 
-    results_[i].point = points[i];
+    results_[i].point = get_point_id_xyz(points, offset + i);
     results_[i].cos_angle = clamp_abs_one(
-      points[i].coordinates_xyz[0] * point_coordinates_xyz[0] +
-      points[i].coordinates_xyz[1] * point_coordinates_xyz[1] +
-      points[i].coordinates_xyz[2] * point_coordinates_xyz[2]);
+      points->x[offset + i] * point_coordinates_xyz[0] +
+      points->y[offset + i] * point_coordinates_xyz[1] +
+      points->z[offset + i] * point_coordinates_xyz[2]);
   }
 
   qsort(results_, num_points, sizeof(*results_), compare_point_id_xyz_angle);
@@ -1410,8 +1556,8 @@ static size_t initial_point_bnd_search_NNN(
 
 static inline struct sin_cos_angle check_leaf_NNN(
   size_t n, double * point_coordinates_xyz,
-  struct point_id_xyz * points, size_t num_points,
-  struct point_id_xyz_angle ** results, size_t * results_array_size,
+  struct point_sphere_part_points const * points, size_t offset,
+  size_t num_points, struct point_id_xyz_angle ** results, size_t * results_array_size,
   size_t * num_results, struct sin_cos_angle curr_angle) {
 
   size_t num_results_ = *num_results;
@@ -1422,19 +1568,24 @@ static inline struct sin_cos_angle check_leaf_NNN(
 
   double min_cos_angle = results_[num_results_-1].cos_angle;
 
+  double const * x = points->x + offset;
+  double const * y = points->y + offset;
+  double const * z = points->z + offset;
+
   // check leaf for results
   for (size_t i = 0; i < num_points; ++i) {
 
     double curr_cos_angle =
-      points[i].coordinates_xyz[0] * point_coordinates_xyz[0] +
-      points[i].coordinates_xyz[1] * point_coordinates_xyz[1] +
-      points[i].coordinates_xyz[2] * point_coordinates_xyz[2];
+      x[i] * point_coordinates_xyz[0] +
+      y[i] * point_coordinates_xyz[1] +
+      z[i] * point_coordinates_xyz[2];
 
     // if the point is worse than the currently best point
     if (curr_cos_angle < min_cos_angle) continue;
 
     struct point_id_xyz_angle point =
-      {.point = points[i], .cos_angle = curr_cos_angle};
+      {.point = get_point_id_xyz(points, offset + i),
+       .cos_angle = curr_cos_angle};
 
     // insert point
     size_t j;
@@ -1475,6 +1626,7 @@ static inline struct sin_cos_angle check_leaf_NNN(
 }
 
 static void point_search_NNN(
+  struct point_sphere_part_search * search,
   size_t n, double * point_coordinates_xyz,
   struct point_id_xyz_angle ** results, size_t * results_array_size,
   size_t * num_results, double * dot_stack,
@@ -1506,14 +1658,14 @@ static void point_search_NNN(
         if (node->flags & U_IS_LEAF) {
 
           angle = check_leaf_NNN(
-            n, point_coordinates_xyz, (struct point_id_xyz *)(node->U),
+            n, point_coordinates_xyz, &(search->points), node->U,
             node->U_size, results, results_array_size, num_results, angle);
 
         } else {
 
           // traverse down one level
           ++curr_tree_depth;
-          node = (struct point_sphere_part_node *)(node->U);
+          node = search->nodes + node->U;
           dot = node->gc_norm_vector[0] * point_coordinates_xyz[0] +
                 node->gc_norm_vector[1] * point_coordinates_xyz[1] +
                 node->gc_norm_vector[2] * point_coordinates_xyz[2];
@@ -1537,14 +1689,14 @@ static void point_search_NNN(
         if (node->flags & T_IS_LEAF) {
 
           angle = check_leaf_NNN(
-            n, point_coordinates_xyz, (struct point_id_xyz *)(node->T),
+            n, point_coordinates_xyz, &(search->points), node->T,
             node->T_size, results, results_array_size, num_results, angle);
 
         } else {
 
           // traverse down one level
           ++curr_tree_depth;
-          node = (struct point_sphere_part_node *)(node->T);
+          node = search->nodes + node->T;
           dot = node->gc_norm_vector[0] * point_coordinates_xyz[0] +
                 node->gc_norm_vector[1] * point_coordinates_xyz[1] +
                 node->gc_norm_vector[2] * point_coordinates_xyz[2];
@@ -1618,7 +1770,7 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
     return;
   }
 
-  struct point_sphere_part_node * base_node = &(search->base_node);
+  struct point_sphere_part_node * base_node = search->nodes;
 
   size_t total_num_local_point_ids = 0;
 
@@ -1637,7 +1789,7 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
     double * curr_coordinates_xyz = coordinates_xyz[i];
 
     size_t curr_tree_depth = 0;
-    struct point_id_xyz * points = search->points;
+    size_t points_offset = 0;
     size_t curr_num_points = 0;
 
     // get the matching leaf for the current point
@@ -1667,7 +1819,7 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
         } else {
 
           flags[curr_tree_depth] = U_FLAG;
-          curr_node = curr_node->U;
+          curr_node = search->nodes + curr_node->U;
         }
 
       } else {
@@ -1679,15 +1831,15 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
           break;
         } else if (curr_node->flags & T_IS_LEAF) {
 
-          points += curr_node->U_size;
+          points_offset += curr_node->U_size;
           flags[curr_tree_depth] = T_FLAG;
           curr_num_points = curr_node->T_size;
           break;
         } else {
 
-          points += curr_node->U_size;
+          points_offset += curr_node->U_size;
           flags[curr_tree_depth] = T_FLAG;
-          curr_node = curr_node->T;
+          curr_node = search->nodes + curr_node->T;
         }
       }
 
@@ -1698,12 +1850,12 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
 
     size_t num_results =
       initial_point_bnd_search_NNN(
-        n, points, curr_num_points, curr_coordinates_xyz,
-        &results, &results_array_size);
+        n, &(search->points), points_offset, curr_num_points,
+        curr_coordinates_xyz, &results, &results_array_size);
 
     // do a detailed search
     point_search_NNN(
-      n, curr_coordinates_xyz, &results, &results_array_size, &num_results,
+      search, n, curr_coordinates_xyz, &results, &results_array_size, &num_results,
       dot_stack, node_stack, flags, curr_tree_depth);
 
     // extract the results
@@ -1751,12 +1903,196 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
   free(dot_stack);
 }
 
+// number of search points processed at once by
+// yac_point_sphere_part_search_NNN_batch
+#define NNN_BATCH_CHUNK_SIZE ((size_t)256)
+
+struct point_sphere_part_query {
+  size_t leaf_offset; // offset of the first point of the leaf in which the
+                      // search point is located
+  size_t idx;
+};
+
+struct point_sphere_part_chunk_results {
+  double * cos_angles;
+  size_t cos_angles_array_size;
+  double (*coordinates_xyz)[3];
+  size_t coordinates_xyz_array_size;
+  size_t * local_point_ids;
+  size_t local_point_ids_array_size;
+};
+
+static int compare_point_sphere_part_query(void const * a, void const * b) {
+
+  struct point_sphere_part_query const * query_a =
+    (struct point_sphere_part_query const *)a;
+  struct point_sphere_part_query const * query_b =
+    (struct point_sphere_part_query const *)b;
+
+  int ret = (query_a->leaf_offset > query_b->leaf_offset) -
+            (query_a->leaf_offset < query_b->leaf_offset);
+  if (ret) return ret;
+  return (query_a->idx > query_b->idx) - (query_a->idx < query_b->idx);
+}
+
+static size_t get_leaf_offset(
+  struct point_sphere_part_search * search, double coordinates_xyz[3]) {
+
+  struct point_sphere_part_node * node = search->nodes;
+
+  while (1) {
+
+    double dot = node->gc_norm_vector[0]*coordinates_xyz[0] +
+                 node->gc_norm_vector[1]*coordinates_xyz[1] +
+                 node->gc_norm_vector[2]*coordinates_xyz[2];
+
+    if (dot <= 0.0) {
+      if (node->flags & U_IS_LEAF) return node->U;
+      node = search->nodes + node->U;
+    } else {
+      if (node->flags & T_IS_LEAF) return node->T;
+      node = search->nodes + node->T;
+    }
+  }
+}
+
+void yac_point_sphere_part_search_NNN_batch(
+  struct point_sphere_part_search * search, size_t num_points,
+  double (*coordinates_xyz)[3], size_t n,
+  double ** cos_angles, size_t * cos_angles_array_size,
+  double (**result_coordinates_xyz)[3],
+  size_t * result_coordinates_xyz_array_size,
+  size_t ** local_point_ids, size_t * local_point_ids_array_size,
+  size_t * num_local_point_ids) {
+
+  size_t num_chunks =
+    (num_points + NNN_BATCH_CHUNK_SIZE - 1) / NNN_BATCH_CHUNK_SIZE;
+
+  if ((search == NULL) || (num_chunks <= 1)) {
+    yac_point_sphere_part_search_NNN(
+      search, num_points, coordinates_xyz, n, cos_angles,
+      cos_angles_array_size, result_coordinates_xyz,
+      result_coordinates_xyz_array_size, local_point_ids,
+      local_point_ids_array_size, num_local_point_ids);
+    return;
+  }
+
+  // sort the search points by the leaf they are located in, this way
+  // search points processed one after another traverse mostly the same
+  // nodes and leaves of the tree (the leaves are ordered by their
+  // position in the tree, which makes this order similar to a
+  // space-filling curve)
+  struct point_sphere_part_query * queries =
+    xmalloc(num_points * sizeof(*queries));
+YAC_OMP(parallel for schedule(static))
+  for (size_t i = 0; i < num_points; ++i) {
+    queries[i].leaf_offset = get_leaf_offset(search, coordinates_xyz[i]);
+    queries[i].idx = i;
+  }
+  qsort(queries, num_points, sizeof(*queries),
+        compare_point_sphere_part_query);
+
+  double (*sorted_coordinates_xyz)[3] =
+    xmalloc(num_points * sizeof(*sorted_coordinates_xyz));
+  size_t * sorted_num_results =
+    xmalloc(num_points * sizeof(*sorted_num_results));
+  for (size_t i = 0; i < num_points; ++i)
+    memcpy(sorted_coordinates_xyz[i], coordinates_xyz[queries[i].idx],
+           3 * sizeof(double));
+
+  struct point_sphere_part_chunk_results * chunk_results =
+    xcalloc(num_chunks, sizeof(*chunk_results));
+
+  // the chunks are independent of each other, each one has its own result
+  // buffers
+YAC_OMP(parallel for schedule(dynamic, 1))
+  for (size_t i = 0; i < num_chunks; ++i) {
+
+    size_t offset = i * NNN_BATCH_CHUNK_SIZE;
+    size_t count = MIN(NNN_BATCH_CHUNK_SIZE, num_points - offset);
+    struct point_sphere_part_chunk_results * curr_results =
+      chunk_results + i;
+
+    yac_point_sphere_part_search_NNN(
+      search, count, sorted_coordinates_xyz + offset, n,
+      (cos_angles != NULL)?&(curr_results->cos_angles):NULL,
+      &(curr_results->cos_angles_array_size),
+      (result_coordinates_xyz != NULL)?
+        &(curr_results->coordinates_xyz):NULL,
+      &(curr_results->coordinates_xyz_array_size),
+      &(curr_results->local_point_ids),
+      &(curr_results->local_point_ids_array_size),
+      sorted_num_results + offset);
+  }
+
+  free(sorted_coordinates_xyz);
+
+  // determine the position of the results of each search point within the
+  // buffer of its chunk and within the final result arrays
+  size_t * offsets = xmalloc(2 * num_points * sizeof(*offsets));
+  size_t * chunk_offsets = offsets;
+  size_t * result_offsets = offsets + num_points;
+  for (size_t i = 0, accu = 0; i < num_points; ++i) {
+    if ((i % NNN_BATCH_CHUNK_SIZE) == 0) accu = 0;
+    chunk_offsets[i] = accu;
+    accu += sorted_num_results[i];
+    num_local_point_ids[queries[i].idx] = sorted_num_results[i];
+  }
+  size_t total_num_results = 0;
+  for (size_t i = 0; i < num_points; ++i) {
+    result_offsets[i] = total_num_results;
+    total_num_results += num_local_point_ids[i];
+  }
+
+  ENSURE_ARRAY_SIZE(
+    *local_point_ids, *local_point_ids_array_size, total_num_results);
+  if (cos_angles != NULL)
+    ENSURE_ARRAY_SIZE(*cos_angles, *cos_angles_array_size, total_num_results);
+  if (result_coordinates_xyz != NULL)
+    ENSURE_ARRAY_SIZE(
+      *result_coordinates_xyz, *result_coordinates_xyz_array_size,
+      total_num_results);
+
+  // copy results into the original order of the search points
+YAC_OMP(parallel for schedule(static))
+  for (size_t i = 0; i < num_points; ++i) {
+
+    struct point_sphere_part_chunk_results * curr_results =
+      chunk_results + i / NNN_BATCH_CHUNK_SIZE;
+    size_t src_offset = chunk_offsets[i];
+    size_t dst_offset = result_offsets[queries[i].idx];
+    size_t count = sorted_num_results[i];
+
+    memcpy(*local_point_ids + dst_offset,
+           curr_results->local_point_ids + src_offset,
+           count * sizeof(**local_point_ids));
+    if (cos_angles != NULL)
+      memcpy(*cos_angles + dst_offset,
+             curr_results->cos_angles + src_offset,
+             count * sizeof(**cos_angles));
+    if (result_coordinates_xyz != NULL)
+      memcpy(*result_coordinates_xyz + dst_offset,
+             curr_results->coordinates_xyz + src_offset,
+             count * sizeof(**result_coordinates_xyz));
+  }
+
+  for (size_t i = 0; i < num_chunks; ++i) {
+    free(chunk_results[i].cos_angles);
+    free(chunk_results[i].coordinates_xyz);
+    free(chunk_results[i].local_point_ids);
+  }
+  free(chunk_results);
+  free(offsets);
+  free(sorted_num_results);
+  free(queries);
+}
+
 int yac_point_sphere_part_search_bnd_circle_contains_points(
   struct point_sphere_part_search * search, struct bounding_circle circle) {
 
   if (search == NULL) return 0;
 
-  return point_check_bnd_circle(&(search->base_node), circle);
+  return point_check_bnd_circle(search, search->nodes, circle);
 }
 
 static void search_point(struct sphere_part_node * node,
@@ -1968,26 +2304,14 @@ static void free_sphere_part_tree (struct sphere_part_node tree) {
    }
 }
 
-static void free_point_sphere_part_tree (struct point_sphere_part_node * tree) {
-
-   if ((tree->flags & U_IS_LEAF) == 0) {
-      free_point_sphere_part_tree(tree->U);
-      free(tree->U);
-   }
-
-   if ((tree->flags & T_IS_LEAF) == 0) {
-      free_point_sphere_part_tree(tree->T);
-      free(tree->T);
-   }
-}
-
 void yac_delete_point_sphere_part_search(
    struct point_sphere_part_search * search) {
 
    if (search == NULL) return;
 
-   free_point_sphere_part_tree(&(search->base_node));
-   free(search->points);
+   free(search->nodes);
+   free(search->points.x);
+   free(search->points.idx);
    free(search);
 }
 
@@ -153,6 +153,22 @@ void yac_point_sphere_part_search_NNN(struct point_sphere_part_search * search,
                                       size_t * local_point_ids_array_size,
                                       size_t * num_local_point_ids);
 
+/**
+ * Same as \ref yac_point_sphere_part_search_NNN, but intended for large numbers
+ * of search points. The search points are sorted by their location in the
+ * search tree and processed in chunks, which are distributed among OpenMP
+ * threads (if available). The results are returned in the same order and
+ * layout as by \ref yac_point_sphere_part_search_NNN.
+ */
+void yac_point_sphere_part_search_NNN_batch(
+  struct point_sphere_part_search * search, size_t num_points,
+  double (*coordinates_xyz)[3], size_t n,
+  double ** cos_angles, size_t * cos_angles_array_size,
+  double (**result_coordinates_xyz)[3],
+  size_t * result_coordinates_xyz_array_size,
+  size_t ** local_point_ids, size_t * local_point_ids_array_size,
+  size_t * num_local_point_ids);
+
 /**
  * This routine returns true if the provided point_sphere_part_search contains
  * a point that is within the provided bounding circle.
@@ -56,6 +56,26 @@ int yac_file_exists(const char * filename) {
   return !stat(filename,&buffer);
 }
 
+uint64_t yac_hash_bytes(uint64_t hash, void const * data, size_t size) {
+
+  unsigned char const * bytes = data;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= (uint64_t)(bytes[i]);
+    hash *= (uint64_t)0x100000001b3ULL;
+  }
+  return hash;
+}
+
+uint64_t yac_hash_finalize(uint64_t hash) {
+
+  hash ^= hash >> 30;
+  hash *= (uint64_t)0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= (uint64_t)0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
 char const * yac_name_type_pair_get_name(
   struct yac_name_type_pair const * pairs, size_t count, int type) {
 
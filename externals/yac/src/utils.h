@@ -78,6 +78,25 @@ typedef double const (* const const_coordinate_pointer)[3] ;
 
 int yac_file_exists(const char * filename);
 
+#define YAC_HASH_INIT ((uint64_t)0xcbf29ce484222325ULL)
+
+/**
+ * updates a hash with the provided data (FNV-1a)
+ * @param[in] hash hash to be updated (start with \ref YAC_HASH_INIT)
+ * @param[in] data data to be hashed
+ * @param[in] size size of data in bytes
+ * @return updated hash
+ */
+uint64_t yac_hash_bytes(uint64_t hash, void const * data, size_t size);
+
+/**
+ * finalises a hash, such that all bits of the result depend on all bits of
+ * the input (allows to combine hashes of unordered data through summation)
+ * @param[in] hash hash
+ * @return finalised hash
+ */
+uint64_t yac_hash_finalize(uint64_t hash);
+
 /** \example test_abort_c.c
  * This contains an example of how to use yac_abort_message.
  */
@@ -325,6 +344,15 @@ if (!(c)) {\
    abort ();\
 }
 
+/* OpenMP directives, which are only active if YAC was compiled with OpenMP
+   support (e.g. CFLAGS="-fopenmp") */
+#ifdef _OPENMP
+#define YAC_OMP_PRAGMA_(...) _Pragma(#__VA_ARGS__)
+#define YAC_OMP(...) YAC_OMP_PRAGMA_(omp __VA_ARGS__)
+#else
+#define YAC_OMP(...)
+#endif
+
 #define COPY_DATA(data, count) \
   (memcpy( \
     xmalloc((size_t)(count) * sizeof(*(data))), \
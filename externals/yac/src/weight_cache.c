@@ -0,0 +1,248 @@
+/**
+ * @file weight_cache.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+
+#include "weight_cache.h"
+#include "weight_file_binary.h"
+#include "interp_method.h"
+#include "interp_method_file.h"
+#include "utils.h"
+#include "yac_mpi.h"
+
+char * yac_weight_cache_get_dir(MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  char * cache_dir = NULL;
+
+  // environment is only checked on rank 0, results are broadcasted
+  // to other processes
+  if (rank == 0) {
+    char const * cache_dir_env = getenv(YAC_WEIGHT_CACHE_DIR_ENV);
+    if ((cache_dir_env != NULL) && (cache_dir_env[0] != '\0'))
+      cache_dir = strdup(cache_dir_env);
+  }
+
+  yac_bcast_string(&cache_dir, comm);
+
+  return cache_dir;
+}
+
+static int interp_stack_is_cacheable(
+  struct yac_interp_stack_config * interp_stack) {
+
+  size_t stack_size = yac_interp_stack_config_get_size(interp_stack);
+
+  // the results of these methods do not only depend on the configuration
+  for (size_t i = 0; i < stack_size; ++i) {
+    switch (
+      yac_interp_stack_config_entry_get_type(
+        yac_interp_stack_config_get_entry(interp_stack, i))) {
+      case (USER_FILE):
+      case (CHECK):
+      case (USER_CALLBACK):
+        return 0;
+      default:
+        break;
+    };
+  }
+  return 1;
+}
+
+struct yac_weight_cache_key {
+  unsigned char * data;
+  size_t size;
+};
+
+static void key_append(
+  struct yac_weight_cache_key * key, void const * data, size_t size) {
+
+  key->data = xrealloc(key->data, key->size + size);
+  memcpy(key->data + key->size, data, size);
+  key->size += size;
+}
+
+struct yac_weight_cache_key * yac_weight_cache_key_new(
+  struct interp_grid * interp_grid,
+  struct yac_interp_stack_config * interp_stack) {
+
+  if (!interp_stack_is_cacheable(interp_stack)) return NULL;
+
+  struct yac_weight_cache_key * key = xmalloc(1 * sizeof(*key));
+  key->data = NULL;
+  key->size = 0;
+
+  uint32_t versions[2] =
+    {YAC_WEIGHT_CACHE_REVISION, YAC_BINARY_WEIGHT_FILE_VERSION};
+  key_append(key, versions, sizeof(versions));
+
+  // field locations
+  uint64_t num_src_fields =
+    (uint64_t)yac_interp_grid_get_num_src_fields(interp_grid);
+  key_append(key, &num_src_fields, sizeof(num_src_fields));
+  for (size_t i = 0; i < (size_t)num_src_fields; ++i) {
+    int32_t location =
+      (int32_t)yac_interp_grid_get_src_field_location(interp_grid, i);
+    key_append(key, &location, sizeof(location));
+  }
+  int32_t tgt_location =
+    (int32_t)yac_interp_grid_get_tgt_field_location(interp_grid);
+  key_append(key, &tgt_location, sizeof(tgt_location));
+
+  // the grid data is too large to be stored, therefore only its hash is used
+  uint64_t grid_hash = yac_interp_grid_get_hash(interp_grid);
+  key_append(key, &grid_hash, sizeof(grid_hash));
+
+  // the packed configuration is identical for identical interpolation stacks
+  MPI_Comm comm = MPI_COMM_SELF;
+  size_t pack_size =
+    yac_interp_stack_config_get_pack_size(interp_stack, comm);
+  YAC_ASSERT(
+    pack_size <= INT_MAX,
+    "ERROR(yac_weight_cache_key_new): pack size too big")
+  void * pack_buffer = xmalloc(pack_size);
+  int position = 0;
+  yac_interp_stack_config_pack(
+    interp_stack, pack_buffer, (int)pack_size, &position, comm);
+  uint64_t stack_size = (uint64_t)position;
+  key_append(key, &stack_size, sizeof(stack_size));
+  key_append(key, pack_buffer, (size_t)position);
+  free(pack_buffer);
+
+  return key;
+}
+
+void yac_weight_cache_key_delete(struct yac_weight_cache_key * key) {
+
+  if (key == NULL) return;
+
+  free(key->data);
+  free(key);
+}
+
+char * yac_weight_cache_get_file_name(
+  char const * cache_dir, struct yac_weight_cache_key * key) {
+
+  uint64_t hash =
+    yac_hash_finalize(yac_hash_bytes(YAC_HASH_INIT, key->data, key->size));
+
+  char const * format = "%s/%016" PRIx64 YAC_BINARY_WEIGHT_FILE_SUFFIX;
+  int file_name_len = snprintf(NULL, 0, format, cache_dir, hash);
+  char * file_name = xmalloc((size_t)file_name_len + 1);
+  snprintf(file_name, (size_t)file_name_len + 1, format, cache_dir, hash);
+
+  return file_name;
+}
+
+int yac_weight_cache_lookup(
+  char const * file_name, struct yac_weight_cache_key * key, MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  // the file name is only a hash of the key, therefore the key stored in
+  // the file has to be checked as well
+  int file_matches =
+    (rank == 0) &&
+    yac_file_exists(file_name) &&
+    yac_binary_weight_file_check_key(file_name, key->data, key->size);
+  yac_mpi_call(MPI_Bcast(&file_matches, 1, MPI_INT, 0, comm), comm);
+
+  return file_matches;
+}
+
+struct interp_weights * yac_weight_cache_load(
+  char const * file_name, struct interp_grid * interp_grid,
+  char const * src_grid_name, char const * tgt_grid_name) {
+
+  struct interp_method * method_stack[] =
+    {yac_interp_method_file_new(file_name, src_grid_name, tgt_grid_name),
+     NULL};
+  struct interp_weights * weights =
+    yac_interp_method_do_search(method_stack, interp_grid);
+  yac_interp_method_delete(method_stack);
+
+  return weights;
+}
+
+void yac_weight_cache_store(
+  char const * file_name, struct yac_weight_cache_key * key,
+  struct interp_weights * weights, char const * src_grid_name,
+  char const * tgt_grid_name, MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  // generate a unique temporary file in the cache directory
+  char * tmp_file_name = NULL;
+  if (rank == 0) {
+    char const * suffix = ".XXXXXX";
+    tmp_file_name = xmalloc(strlen(file_name) + strlen(suffix) + 1);
+    strcpy(tmp_file_name, file_name);
+    strcat(tmp_file_name, suffix);
+    int fd = mkstemp(tmp_file_name);
+    YAC_ASSERT_F(
+      fd != -1, "ERROR(yac_weight_cache_store): "
+      "could not create temporary file \"%s\" (%s)",
+      tmp_file_name, strerror(errno))
+    close(fd);
+  }
+  yac_bcast_string(&tmp_file_name, comm);
+
+  yac_interp_weights_write_to_binary_file(
+    weights, tmp_file_name, src_grid_name, tgt_grid_name,
+    key->data, key->size);
+
+  // renaming is atomic, therefore other processes reading the cache
+  // concurrently will either see the complete file or no file at all
+  if (rank == 0)
+    YAC_ASSERT_F(
+      rename(tmp_file_name, file_name) == 0,
+      "ERROR(yac_weight_cache_store): could not rename \"%s\" to \"%s\" (%s)",
+      tmp_file_name, file_name, strerror(errno))
+  free(tmp_file_name);
+
+  // ensure that the cache file is available
+  yac_mpi_call(MPI_Barrier(comm), comm);
+}
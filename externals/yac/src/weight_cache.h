@@ -0,0 +1,170 @@
+/**
+ * @file weight_cache.h
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WEIGHT_CACHE_H
+#define WEIGHT_CACHE_H
+
+#include "interp_grid.h"
+#include "interp_weights.h"
+#include "interp_stack_config.h"
+
+/** \example test_weight_cache_parallel.c
+ * A test for the weight cache.
+ */
+
+/*
+ * The weight cache stores interpolation weights in binary weight files
+ * (see \ref weight_file_binary.h) in a user-provided directory. For each
+ * interpolation a key is generated, which contains all inputs that
+ * determine the weights:
+ *  - the revision of the cache (\ref YAC_WEIGHT_CACHE_REVISION) and the
+ *    version of the binary weight file format
+ *  - the locations of the source and target fields
+ *  - a hash of the interpolation grid (global grid data, masks, and field
+ *    coordinates; see \ref yac_interp_grid_get_hash)
+ *  - the packed interpolation stack
+ *
+ * The name of a cache file is generated from a hash of the key. In
+ * addition, the key itself is stored in the cache file. A cache file is only
+ * used if its key matches the one of the interpolation. Otherwise (for
+ * example, in case of a collision of the hash used for the file name), the
+ * weights are computed and the file is overwritten.\n
+ * Interpolation stacks that contain methods whose results depend on user
+ * code or external files (user file, check, and user callback) are not
+ * cached.
+ */
+
+/**
+ * revision of the weight cache\n
+ * It has to be increased whenever a change in an interpolation method
+ * changes the weights computed for an unchanged configuration. This
+ * invalidates all existing cache files.
+ */
+#define YAC_WEIGHT_CACHE_REVISION (1)
+
+/**
+ * name of the environment variable through which the cache directory can be
+ * provided (the cache is only used if this variable is set)
+ */
+#define YAC_WEIGHT_CACHE_DIR_ENV "YAC_WEIGHT_CACHE_DIR"
+
+struct yac_weight_cache_key;
+
+/**
+ * gets the weight cache directory from the environment
+ * (\ref YAC_WEIGHT_CACHE_DIR_ENV)
+ * @param[in] comm communicator
+ * @return name of the cache directory (NULL if the weight cache is not
+ *         enabled)
+ * @remark this call is collective, the environment is only evaluated on
+ *         the root process
+ * @remark the user has to free the returned string
+ */
+char * yac_weight_cache_get_dir(MPI_Comm comm);
+
+/**
+ * generates the cache key for an interpolation
+ * @param[in] interp_grid  interpolation grid
+ * @param[in] interp_stack interpolation stack
+ * @return cache key (NULL if the interpolation stack cannot be cached)
+ * @remark this call is collective for all processes of the interpolation
+ *         grid
+ * @remark the key is identical on all processes
+ */
+struct yac_weight_cache_key * yac_weight_cache_key_new(
+  struct interp_grid * interp_grid,
+  struct yac_interp_stack_config * interp_stack);
+
+/**
+ * deletes a cache key
+ * @param[in] key cache key
+ */
+void yac_weight_cache_key_delete(struct yac_weight_cache_key * key);
+
+/**
+ * generates the name of the cache file for a cache key
+ * @param[in] cache_dir cache directory
+ * @param[in] key       cache key
+ * @return name of the cache file
+ * @remark the user has to free the returned string
+ */
+char * yac_weight_cache_get_file_name(
+  char const * cache_dir, struct yac_weight_cache_key * key);
+
+/**
+ * checks whether the cache file exists and whether it was generated for
+ * the provided key
+ * @param[in] file_name name of the cache file
+ * @param[in] key       cache key
+ * @param[in] comm      communicator
+ * @return 1 if the file exists and matches the key, 0 otherwise
+ * @remark this call is collective, the file is only checked by the root
+ *         process
+ */
+int yac_weight_cache_lookup(
+  char const * file_name, struct yac_weight_cache_key * key, MPI_Comm comm);
+
+/**
+ * reads interpolation weights from a cache file
+ * @param[in] file_name     name of the cache file
+ * @param[in] interp_grid   interpolation grid
+ * @param[in] src_grid_name name of the source grid
+ * @param[in] tgt_grid_name name of the target grid
+ * @return interpolation weights
+ * @remark this call is collective for all processes of the interpolation
+ *         grid
+ */
+struct interp_weights * yac_weight_cache_load(
+  char const * file_name, struct interp_grid * interp_grid,
+  char const * src_grid_name, char const * tgt_grid_name);
+
+/**
+ * writes interpolation weights to a cache file
+ * @param[in] file_name     name of the cache file
+ * @param[in] key           cache key (is stored in the file)
+ * @param[in] weights       interpolation weights
+ * @param[in] src_grid_name name of the source grid
+ * @param[in] tgt_grid_name name of the target grid
+ * @param[in] comm          communicator of the interpolation weights
+ * @remark this call is collective for all processes of the interpolation
+ *         weights
+ * @remark the file is first written under a temporary name and then
+ *         renamed, such that concurrent runs never read an incomplete file
+ */
+void yac_weight_cache_store(
+  char const * file_name, struct yac_weight_cache_key * key,
+  struct interp_weights * weights, char const * src_grid_name,
+  char const * tgt_grid_name, MPI_Comm comm);
+
+#endif // WEIGHT_CACHE_H
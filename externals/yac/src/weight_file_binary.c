@@ -0,0 +1,278 @@
+/**
+ * @file weight_file_binary.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <limits.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "weight_file_binary.h"
+#include "utils.h"
+
+// places a section of count elements at the current offset (which is
+// aligned first, if required) and advances the offset to the end of the
+// section (returns 0 in case of an overflow)
+static int add_section(
+  uint64_t * offset, uint64_t * section_offset, int align,
+  uint64_t count, uint64_t elem_size) {
+
+  if (align) {
+    if (*offset > UINT64_MAX - (YAC_BINARY_WEIGHT_FILE_ALIGNMENT - 1))
+      return 0;
+    *offset =
+      ((*offset + YAC_BINARY_WEIGHT_FILE_ALIGNMENT - 1) /
+       YAC_BINARY_WEIGHT_FILE_ALIGNMENT) * YAC_BINARY_WEIGHT_FILE_ALIGNMENT;
+  }
+  *section_offset = *offset;
+  if (count > (UINT64_MAX - *offset) / elem_size) return 0;
+  *offset += count * elem_size;
+  return 1;
+}
+
+int yac_binary_weight_file_get_layout(
+  struct yac_binary_weight_file_header const * header,
+  struct yac_binary_weight_file_layout * layout) {
+
+  uint64_t offset = sizeof(*header);
+
+  if (!(add_section(
+          &offset, &(layout->src_locations), 1,
+          header->num_src_fields, sizeof(int32_t)) &&
+        add_section(
+          &offset, &(layout->src_grid_name), 0,
+          header->src_grid_name_len, sizeof(char)) &&
+        add_section(
+          &offset, &(layout->tgt_grid_name), 0,
+          header->tgt_grid_name_len, sizeof(char)) &&
+        add_section(
+          &offset, &(layout->key), 0, header->key_size, sizeof(char)) &&
+        add_section(
+          &offset, &(layout->fixed_values), 1,
+          header->num_fixed_values, sizeof(double)) &&
+        add_section(
+          &offset, &(layout->slices), 1, header->num_slices,
+          sizeof(struct yac_binary_weight_file_slice)) &&
+        add_section(
+          &offset, &(layout->link_tgt), 1,
+          header->num_links, sizeof(int64_t)) &&
+        add_section(
+          &offset, &(layout->link_src), 1,
+          header->num_links, sizeof(int64_t)) &&
+        add_section(
+          &offset, &(layout->link_src_field_idx), 1,
+          header->num_links, sizeof(uint64_t)) &&
+        add_section(
+          &offset, &(layout->link_weight), 1,
+          header->num_links, sizeof(double)) &&
+        add_section(
+          &offset, &(layout->fixed_tgt), 1,
+          header->num_fixed_tgt, sizeof(int64_t)) &&
+        add_section(
+          &offset, &(layout->fixed_value_idx), 1,
+          header->num_fixed_tgt, sizeof(uint64_t)))) return 0;
+
+  layout->file_size = offset;
+  return 1;
+}
+
+int yac_binary_weight_file_check_suffix(char const * filename) {
+
+  if (filename == NULL) return 0;
+
+  size_t filename_len = strlen(filename);
+  size_t suffix_len = strlen(YAC_BINARY_WEIGHT_FILE_SUFFIX);
+
+  return (filename_len >= suffix_len) &&
+         !strcmp(filename + filename_len - suffix_len,
+                 YAC_BINARY_WEIGHT_FILE_SUFFIX);
+}
+
+int yac_binary_weight_file_check_magic(char const * filename) {
+
+  FILE * file = fopen(filename, "rb");
+  if (file == NULL) return 0;
+
+  char magic[sizeof(YAC_BINARY_WEIGHT_FILE_MAGIC)];
+  int is_binary =
+    (fread(magic, sizeof(magic), 1, file) == 1) &&
+    !memcmp(magic, YAC_BINARY_WEIGHT_FILE_MAGIC, sizeof(magic));
+  fclose(file);
+
+  return is_binary;
+}
+
+int yac_binary_weight_file_check_key(
+  char const * filename, void const * key, size_t key_size) {
+
+  FILE * file = fopen(filename, "rb");
+  if (file == NULL) return 0;
+
+  struct yac_binary_weight_file_header header;
+  int match =
+    (fread(&header, sizeof(header), 1, file) == 1) &&
+    !memcmp(header.magic, YAC_BINARY_WEIGHT_FILE_MAGIC,
+            sizeof(YAC_BINARY_WEIGHT_FILE_MAGIC)) &&
+    (header.byte_order_mark == YAC_BINARY_WEIGHT_FILE_BYTE_ORDER_MARK) &&
+    (header.version == YAC_BINARY_WEIGHT_FILE_VERSION) &&
+    (header.key_size == (uint64_t)key_size);
+
+  if (match) {
+    struct yac_binary_weight_file_layout layout;
+    unsigned char * file_key = xmalloc(key_size);
+    match =
+      yac_binary_weight_file_get_layout(&header, &layout) &&
+      (layout.key <= (uint64_t)LONG_MAX) &&
+      !fseek(file, (long)(layout.key), SEEK_SET) &&
+      (fread(file_key, 1, key_size, file) == key_size) &&
+      !memcmp(file_key, key, key_size);
+    free(file_key);
+  }
+  fclose(file);
+
+  return match;
+}
+
+struct yac_binary_weight_file * yac_binary_weight_file_open(
+  char const * filename) {
+
+  int fd = open(filename, O_RDONLY);
+  YAC_ASSERT_F(
+    fd != -1, "ERROR(yac_binary_weight_file_open): "
+    "could not open file \"%s\" (%s)", filename, strerror(errno))
+
+  struct stat file_stat;
+  YAC_ASSERT_F(
+    fstat(fd, &file_stat) == 0, "ERROR(yac_binary_weight_file_open): "
+    "could not stat file \"%s\" (%s)", filename, strerror(errno))
+
+  size_t file_size = (size_t)(file_stat.st_size);
+  YAC_ASSERT_F(
+    file_size >= sizeof(struct yac_binary_weight_file_header),
+    "ERROR(yac_binary_weight_file_open): "
+    "file \"%s\" is too small to be a binary weight file", filename)
+
+  // the data is only accessed on demand, therefore mapping the whole file
+  // only reads the pages that are actually required by the local process
+  void * data = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  YAC_ASSERT_F(
+    data != MAP_FAILED, "ERROR(yac_binary_weight_file_open): "
+    "could not map file \"%s\" (%s)", filename, strerror(errno))
+  close(fd);
+
+  struct yac_binary_weight_file_header const * header = data;
+
+  YAC_ASSERT_F(
+    !memcmp(header->magic, YAC_BINARY_WEIGHT_FILE_MAGIC,
+            sizeof(YAC_BINARY_WEIGHT_FILE_MAGIC)),
+    "ERROR(yac_binary_weight_file_open): "
+    "file \"%s\" is not a binary weight file", filename)
+  YAC_ASSERT_F(
+    header->byte_order_mark == YAC_BINARY_WEIGHT_FILE_BYTE_ORDER_MARK,
+    "ERROR(yac_binary_weight_file_open): "
+    "byte order of file \"%s\" does not match with the one of this machine",
+    filename)
+  YAC_ASSERT_F(
+    header->version == YAC_BINARY_WEIGHT_FILE_VERSION,
+    "ERROR(yac_binary_weight_file_open): "
+    "version of file \"%s\" (%u) does not match with YAC version (%d)",
+    filename, (unsigned)(header->version), YAC_BINARY_WEIGHT_FILE_VERSION)
+
+  // all counts in the header are checked against the size of the file
+  // before any section is accessed
+  struct yac_binary_weight_file_layout layout;
+  YAC_ASSERT_F(
+    yac_binary_weight_file_get_layout(header, &layout),
+    "ERROR(yac_binary_weight_file_open): "
+    "header of file \"%s\" contains invalid section sizes", filename)
+  YAC_ASSERT_F(
+    (uint64_t)file_size >= layout.file_size,
+    "ERROR(yac_binary_weight_file_open): "
+    "file \"%s\" is truncated", filename)
+  YAC_ASSERT_F(
+    (header->num_links <= SIZE_MAX) && (header->num_fixed_tgt <= SIZE_MAX) &&
+    (header->num_fixed_values <= SIZE_MAX) &&
+    (header->num_src_fields <= SIZE_MAX) && (header->num_slices <= INT_MAX),
+    "ERROR(yac_binary_weight_file_open): "
+    "header of file \"%s\" contains invalid counts", filename)
+
+  struct yac_binary_weight_file * file = xmalloc(1 * sizeof(*file));
+  unsigned char const * base = data;
+
+  file->data = data;
+  file->size = file_size;
+  file->header = header;
+  file->src_locations = (void const *)(base + layout.src_locations);
+  file->src_grid_name = (void const *)(base + layout.src_grid_name);
+  file->tgt_grid_name = (void const *)(base + layout.tgt_grid_name);
+  file->key = (void const *)(base + layout.key);
+  file->fixed_values = (void const *)(base + layout.fixed_values);
+  file->slices = (void const *)(base + layout.slices);
+  file->link_tgt = (void const *)(base + layout.link_tgt);
+  file->link_src = (void const *)(base + layout.link_src);
+  file->link_src_field_idx = (void const *)(base + layout.link_src_field_idx);
+  file->link_weight = (void const *)(base + layout.link_weight);
+  file->fixed_tgt = (void const *)(base + layout.fixed_tgt);
+  file->fixed_value_idx = (void const *)(base + layout.fixed_value_idx);
+
+  // the slices have to be within the link and fixed sections
+  for (uint64_t i = 0; i < header->num_slices; ++i) {
+    struct yac_binary_weight_file_slice slice = file->slices[i];
+    YAC_ASSERT_F(
+      (slice.link_offset <= header->num_links) &&
+      (slice.link_count <= header->num_links - slice.link_offset) &&
+      (slice.fixed_offset <= header->num_fixed_tgt) &&
+      (slice.fixed_count <= header->num_fixed_tgt - slice.fixed_offset),
+      "ERROR(yac_binary_weight_file_open): "
+      "slice %" PRIu64 " of file \"%s\" is out of bounds", i, filename)
+  }
+
+  return file;
+}
+
+void yac_binary_weight_file_close(struct yac_binary_weight_file * file) {
+
+  if (file == NULL) return;
+
+  munmap(file->data, file->size);
+  free(file);
+}
@@ -0,0 +1,203 @@
+/**
+ * @file weight_file_binary.h
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WEIGHT_FILE_BINARY_H
+#define WEIGHT_FILE_BINARY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** \example test_weight_file_binary_parallel.c
+ * This example shows how to write and read binary weight files.
+ */
+
+/*
+ * In addition to the SCRIP-style NetCDF weight files, YAC supports a binary
+ * weight file format, which can be memory-mapped directly. The file is
+ * written in native byte order by all processes of the communicator used
+ * for the interpolation weights. Each process writes its own stencils into a
+ * dedicated slice of the file. Therefore, the file implicitly stores the
+ * decomposition of the target points.\n
+ * If a file is read with the same number of processes and each process
+ * holds all target points of its slice, each process maps its slice and
+ * uses the data directly. Otherwise, the data is read and redistributed in
+ * the same way as it is done for NetCDF weight files.
+ *
+ * Layout of the file (all sections are aligned to
+ * \ref YAC_BINARY_WEIGHT_FILE_ALIGNMENT bytes):
+ *  - header (\ref yac_binary_weight_file_header)
+ *  - source field locations (int32_t[num_src_fields])
+ *  - source and target grid name (without terminating '\\0')
+ *  - key (key_size bytes of opaque data; used by the weight cache to store
+ *    the inputs from which the weights were computed, see
+ *    \ref weight_cache.h)
+ *  - fixed values (double[num_fixed_values])
+ *  - slice table (\ref yac_binary_weight_file_slice[num_slices])
+ *  - link target global ids (int64_t[num_links])
+ *  - link source global ids (int64_t[num_links])
+ *  - link source field indices (uint64_t[num_links])
+ *  - link weights (double[num_links])
+ *  - fixed target global ids (int64_t[num_fixed_tgt])
+ *  - fixed value indices (uint64_t[num_fixed_tgt])
+ *
+ * Within a slice, the links are sorted by target global id, source field
+ * index, and source global id. The fixed targets are sorted by fixed value
+ * and target global id.
+ */
+
+#define YAC_BINARY_WEIGHT_FILE_MAGIC "YACWGTS"
+#define YAC_BINARY_WEIGHT_FILE_VERSION (2)
+#define YAC_BINARY_WEIGHT_FILE_BYTE_ORDER_MARK (0x01020304)
+#define YAC_BINARY_WEIGHT_FILE_ALIGNMENT (64)
+#define YAC_BINARY_WEIGHT_FILE_SUFFIX ".yacbin"
+
+struct yac_binary_weight_file_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order_mark;
+  uint64_t num_slices;
+  uint64_t num_src_fields;
+  uint64_t num_fixed_values;
+  uint64_t num_links;
+  uint64_t num_fixed_tgt;
+  uint64_t src_grid_name_len;
+  uint64_t tgt_grid_name_len;
+  uint64_t key_size;
+  int32_t tgt_location;
+  int32_t reserved;
+};
+
+struct yac_binary_weight_file_slice {
+  uint64_t link_offset, link_count;
+  uint64_t fixed_offset, fixed_count;
+};
+
+/**
+ * byte offsets of all sections of a binary weight file
+ */
+struct yac_binary_weight_file_layout {
+  uint64_t src_locations;
+  uint64_t src_grid_name;
+  uint64_t tgt_grid_name;
+  uint64_t key;
+  uint64_t fixed_values;
+  uint64_t slices;
+  uint64_t link_tgt;
+  uint64_t link_src;
+  uint64_t link_src_field_idx;
+  uint64_t link_weight;
+  uint64_t fixed_tgt;
+  uint64_t fixed_value_idx;
+  uint64_t file_size;
+};
+
+/**
+ * memory-mapped binary weight file
+ */
+struct yac_binary_weight_file {
+  void * data;
+  size_t size;
+  struct yac_binary_weight_file_header const * header;
+  int32_t const * src_locations;
+  char const * src_grid_name;
+  char const * tgt_grid_name;
+  void const * key;
+  double const * fixed_values;
+  struct yac_binary_weight_file_slice const * slices;
+  int64_t const * link_tgt;
+  int64_t const * link_src;
+  uint64_t const * link_src_field_idx;
+  double const * link_weight;
+  int64_t const * fixed_tgt;
+  uint64_t const * fixed_value_idx;
+};
+
+/**
+ * computes the byte offsets of all sections based on the header
+ * @param[in]  header header of a binary weight file
+ * @param[out] layout byte offsets of all sections
+ * @return 0 if the sizes in the header result in an overflow of the
+ *         offsets, 1 otherwise
+ */
+int yac_binary_weight_file_get_layout(
+  struct yac_binary_weight_file_header const * header,
+  struct yac_binary_weight_file_layout * layout);
+
+/**
+ * checks whether a weight file name has the suffix of a binary weight file
+ * (\ref YAC_BINARY_WEIGHT_FILE_SUFFIX)
+ * @param[in] filename name of the weight file
+ * @return 1 if the name has the suffix, 0 otherwise
+ */
+int yac_binary_weight_file_check_suffix(char const * filename);
+
+/**
+ * checks whether a file starts with the magic string of a binary
+ * weight file
+ * @param[in] filename name of the weight file
+ * @return 1 if the file is a binary weight file, 0 otherwise
+ */
+int yac_binary_weight_file_check_magic(char const * filename);
+
+/**
+ * checks whether a file is a binary weight file of the current version,
+ * which contains the provided key
+ * @param[in] filename name of the weight file
+ * @param[in] key      key
+ * @param[in] key_size size of the key in bytes
+ * @return 1 if the file contains the key, 0 otherwise
+ * @remark in contrast to \ref yac_binary_weight_file_open, this routine
+ *         does not abort for invalid files
+ */
+int yac_binary_weight_file_check_key(
+  char const * filename, void const * key, size_t key_size);
+
+/**
+ * maps a binary weight file into memory and checks its header
+ * @param[in] filename name of the weight file
+ * @return mapped weight file
+ * @remark all counts in the header and the slice table are checked against
+ *         the size of the file, invalid files result in an abort
+ * @remark this routine is not collective
+ */
+struct yac_binary_weight_file * yac_binary_weight_file_open(
+  char const * filename);
+
+/**
+ * unmaps a binary weight file
+ * @param[in] file mapped weight file
+ */
+void yac_binary_weight_file_close(struct yac_binary_weight_file * file);
+
+#endif // WEIGHT_FILE_BINARY_H
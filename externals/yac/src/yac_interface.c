@@ -53,6 +53,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include "ensure_array_size.h"
 #include "event.h"
 #include "interpolation.h"
@@ -65,6 +66,7 @@
 #include "fields.h"
 #include "couple_config.h"
 #include "config_yaml.h"
+#include "progress.h"
 
 int const YAC_LOCATION_CELL   = CELL;
 int const YAC_LOCATION_CORNER = CORNER;
@@ -168,6 +170,8 @@ struct yac_ext_couple_config {
   size_t num_src_mask_names;
   char ** src_mask_names;
   char * tgt_mask_name;
+  int use_single_precision;
+  double weight_pruning_threshold;
 };
 
 /**
@@ -520,6 +524,9 @@ static void yac_ccleanup_instance_(int yac_instance_id) {
   if(yac_instance_id == default_instance_id)
     default_instance_id = INT_MAX;
 
+  // the progress thread must not outlive the last instance
+  if (yac_instance_count == 0) yac_progress_stop();
+
   // remove dangeling pointers from components
   for(int i = 0; i<num_components;++i){
     if(components[i]->instance == instance){
@@ -642,6 +649,48 @@ char * yac_cget_end_datetime ( void ) {
 
 /* ---------------------------------------------------------------------- */
 
+void yac_cget_setup_timer_instance (
+  int yac_instance_id, const char * comp_name, const char * phase_name,
+  double * min_time, double * max_time, double * avg_time ) {
+
+  yac_setup_stats_get_timer(
+    yac_instance_get_setup_stats(
+      yac_unique_id_to_pointer(yac_instance_id, "yac_instance_id")),
+    comp_name, phase_name, min_time, max_time, avg_time);
+}
+
+void yac_cget_setup_timer (
+  const char * comp_name, const char * phase_name,
+  double * min_time, double * max_time, double * avg_time ) {
+
+  check_default_instance_id("yac_cget_setup_timer");
+  yac_cget_setup_timer_instance(
+    default_instance_id, comp_name, phase_name, min_time, max_time, avg_time);
+}
+
+void yac_cget_setup_counter_instance (
+  int yac_instance_id, const char * comp_name, const char * phase_name,
+  const char * counter_name,
+  int64_t * min_value, int64_t * max_value, int64_t * sum_value ) {
+
+  yac_setup_stats_get_counter(
+    yac_instance_get_setup_stats(
+      yac_unique_id_to_pointer(yac_instance_id, "yac_instance_id")),
+    comp_name, phase_name, counter_name, min_value, max_value, sum_value);
+}
+
+void yac_cget_setup_counter (
+  const char * comp_name, const char * phase_name, const char * counter_name,
+  int64_t * min_value, int64_t * max_value, int64_t * sum_value ) {
+
+  check_default_instance_id("yac_cget_setup_counter");
+  yac_cget_setup_counter_instance(
+    default_instance_id, comp_name, phase_name, counter_name,
+    min_value, max_value, sum_value);
+}
+
+/* ---------------------------------------------------------------------- */
+
 /* The YAC version number is provided in version.h
  */
 
@@ -1007,6 +1056,15 @@ void yac_cdef_mask ( int const grid_id,
   yac_cdef_mask_named(grid_id, nbr_points, located, is_valid, NULL, mask_id);
 }
 
+void yac_cupdate_mask ( int const mask_id, int const * is_valid ) {
+
+  struct user_input_data_masks * mask =
+    yac_unique_id_to_pointer(mask_id, "mask_id");
+
+  yac_basic_grid_update_mask(
+    mask->grid, mask->location, mask->masks_idx, is_valid);
+}
+
 void yac_cset_mask ( int const * is_valid, int points_id ) {
 
   struct user_input_data_points * points =
@@ -1245,6 +1303,8 @@ static void init_ext_couple_config(
   ext_couple_config->num_src_mask_names = 0;
   ext_couple_config->src_mask_names = NULL;
   ext_couple_config->tgt_mask_name = NULL;
+  ext_couple_config->use_single_precision = 0;
+  ext_couple_config->weight_pruning_threshold = 0.0;
 }
 
 void yac_cget_ext_couple_config(int * ext_couple_config_id) {
@@ -1293,9 +1353,10 @@ void yac_cset_ext_couple_config_mapping_side_(
   int mapping_side) {
   YAC_ASSERT_F(
     (mapping_side == 0) ||
-    (mapping_side == 1),
+    (mapping_side == 1) ||
+    (mapping_side == 2),
     "ERROR(yac_cset_ext_couple_config_mapping_side_): "
-    "\"%d\" is not a valid mapping side (has to be 0 or 1)",
+    "\"%d\" is not a valid mapping side (has to be 0, 1, or 2)",
     mapping_side);
   ext_couple_config->mapping_side = mapping_side;
 }
@@ -1419,6 +1480,57 @@ void yac_cget_ext_couple_config_mask_name(
   *tgt_mask_name = ext_couple_config->tgt_mask_name;
 }
 
+void yac_cset_ext_couple_config_use_single_precision_(
+  struct yac_ext_couple_config * ext_couple_config,
+  int use_single_precision) {
+  YAC_ASSERT_F(
+    (use_single_precision == 0) ||
+    (use_single_precision == 1),
+    "ERROR(yac_cset_ext_couple_config_use_single_precision_): "
+    "\"%d\" is not a valid precision flag (has to be 0 or 1)",
+    use_single_precision);
+  ext_couple_config->use_single_precision = use_single_precision;
+}
+
+void yac_cset_ext_couple_config_use_single_precision(
+  int ext_couple_config_id, int use_single_precision) {
+  yac_cset_ext_couple_config_use_single_precision_(
+    yac_unique_id_to_pointer(ext_couple_config_id, "ext_couple_config_id"),
+    use_single_precision);
+}
+
+void yac_cget_ext_couple_config_use_single_precision(
+  int ext_couple_config_id, int * use_single_precision) {
+  struct yac_ext_couple_config * ext_couple_config =
+    yac_unique_id_to_pointer(ext_couple_config_id, "ext_couple_config_id");
+  *use_single_precision = ext_couple_config->use_single_precision;
+}
+
+void yac_cset_ext_couple_config_weight_pruning_threshold_(
+  struct yac_ext_couple_config * ext_couple_config,
+  double weight_pruning_threshold) {
+  YAC_ASSERT_F(
+    (weight_pruning_threshold >= 0.0) && (weight_pruning_threshold < 1.0),
+    "ERROR(yac_cset_ext_couple_config_weight_pruning_threshold_): "
+    "\"%lf\" is not a valid weight pruning threshold "
+    "(has to be in the range [0.0,1.0))", weight_pruning_threshold);
+  ext_couple_config->weight_pruning_threshold = weight_pruning_threshold;
+}
+
+void yac_cset_ext_couple_config_weight_pruning_threshold(
+  int ext_couple_config_id, double weight_pruning_threshold) {
+  yac_cset_ext_couple_config_weight_pruning_threshold_(
+    yac_unique_id_to_pointer(ext_couple_config_id, "ext_couple_config_id"),
+    weight_pruning_threshold);
+}
+
+void yac_cget_ext_couple_config_weight_pruning_threshold(
+  int ext_couple_config_id, double * weight_pruning_threshold) {
+  struct yac_ext_couple_config * ext_couple_config =
+    yac_unique_id_to_pointer(ext_couple_config_id, "ext_couple_config_id");
+  *weight_pruning_threshold = ext_couple_config->weight_pruning_threshold;
+}
+
 void yac_cdef_couple_custom_instance_(
   int yac_instance_id,
   char const * src_comp_name, char const * src_grid_name, char const * src_field_name,
@@ -1444,7 +1556,9 @@ void yac_cdef_couple_custom_instance_(
     ext_couple_config->scale_summand,
     ext_couple_config->num_src_mask_names,
     (char const * const *)ext_couple_config->src_mask_names,
-    ext_couple_config->tgt_mask_name);
+    ext_couple_config->tgt_mask_name,
+    ext_couple_config->use_single_precision,
+    ext_couple_config->weight_pruning_threshold);
 }
 
 void yac_cdef_couple_custom_instance(
@@ -1517,7 +1631,8 @@ void yac_cdef_couple_instance_(
   char const * weight_file, int mapping_side,
   double scale_factor, double scale_summand,
   int num_src_mask_names, char const * const * src_mask_names,
-  char const * tgt_mask_name) {
+  char const * tgt_mask_name, int use_single_precision,
+  double weight_pruning_threshold) {
 
   YAC_ASSERT_F(
     num_src_mask_names >= 0,
@@ -1538,6 +1653,10 @@ void yac_cdef_couple_instance_(
     &ext_couple_config, (size_t)num_src_mask_names, src_mask_names);
   yac_cset_ext_couple_config_tgt_mask_name_(
     &ext_couple_config, tgt_mask_name);
+  yac_cset_ext_couple_config_use_single_precision_(
+    &ext_couple_config, use_single_precision);
+  yac_cset_ext_couple_config_weight_pruning_threshold_(
+    &ext_couple_config, weight_pruning_threshold);
 
   yac_cdef_couple_custom_instance_(
     yac_instance_id, src_comp_name, src_grid_name, src_field_name,
@@ -1554,7 +1673,8 @@ void yac_cdef_couple_(
     char const * weight_file, int mapping_side,
     double scale_factor, double scale_summand,
     int num_src_mask_names, char const * const * src_mask_names,
-    char const * tgt_mask_name) {
+    char const * tgt_mask_name, int use_single_precision,
+    double weight_pruning_threshold) {
 
   check_default_instance_id("yac_cdef_couple_");
   yac_cdef_couple_instance_(default_instance_id,
@@ -1563,7 +1683,8 @@ void yac_cdef_couple_(
     coupling_timestep, time_unit, time_reduction,  interp_stack_config_id,
     src_lag, tgt_lag, weight_file, mapping_side,
     scale_factor, scale_summand,
-    num_src_mask_names, src_mask_names, tgt_mask_name);
+    num_src_mask_names, src_mask_names, tgt_mask_name, use_single_precision,
+    weight_pruning_threshold);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -1733,6 +1854,110 @@ void yac_cupdate(int field_id) {
 
 /* ---------------------------------------------------------------------- */
 
+// The field data passed to an interpolation has to match its precision. In
+// case the precision of the user data differs, the data is converted into
+// temporary buffers.
+
+static size_t get_send_field_point_counts(
+  struct coupling_field * cpl_field, size_t ** num_points) {
+
+  size_t num_interp_fields =
+    yac_coupling_field_get_num_interp_fields(cpl_field);
+
+  size_t total_num_points = 0;
+  *num_points = xmalloc(num_interp_fields * sizeof(**num_points));
+  for (size_t i = 0; i < num_interp_fields; i++) {
+    enum yac_location location =
+      yac_coupling_field_get_interp_fields(cpl_field)[i].location;
+    (*num_points)[i] = yac_coupling_field_get_data_size(cpl_field, location);
+    total_num_points += (*num_points)[i];
+  }
+  return total_num_points;
+}
+
+#define DEF_CONVERT_SEND_FIELD(NAME, SRC_TYPE, DST_TYPE) \
+  static DST_TYPE *** NAME( \
+    struct coupling_field * cpl_field, int collection_size, \
+    SRC_TYPE *** field) { \
+ \
+    size_t num_interp_fields = \
+      yac_coupling_field_get_num_interp_fields(cpl_field); \
+    size_t * num_points; \
+    size_t total_num_points = \
+      get_send_field_point_counts(cpl_field, &num_points); \
+ \
+    DST_TYPE *** converted_field = \
+      xmalloc((size_t)collection_size * sizeof(*converted_field)); \
+    converted_field[0] = \
+      xmalloc((size_t)collection_size * num_interp_fields * \
+              sizeof(**converted_field)); \
+    DST_TYPE * data = \
+      xmalloc((size_t)collection_size * total_num_points * sizeof(*data)); \
+    for (int h = 0; h < collection_size; ++h) { \
+      converted_field[h] = converted_field[0] + h * num_interp_fields; \
+      for (size_t i = 0; i < num_interp_fields; ++i) { \
+        converted_field[h][i] = data; \
+        for (size_t j = 0; j < num_points[i]; ++j) \
+          data[j] = (DST_TYPE)(field[h][i][j]); \
+        data += num_points[i]; \
+      } \
+    } \
+    free(num_points); \
+    return converted_field; \
+  } \
+  static void NAME ## _free(DST_TYPE *** converted_field) { \
+    if (converted_field == NULL) return; \
+    free(converted_field[0][0]); \
+    free(converted_field[0]); \
+    free(converted_field); \
+  }
+
+DEF_CONVERT_SEND_FIELD(convert_send_field_to_float, double, float)
+DEF_CONVERT_SEND_FIELD(convert_send_field_to_double, float, double)
+
+#undef DEF_CONVERT_SEND_FIELD
+
+static size_t get_recv_field_size(struct coupling_field * cpl_field) {
+
+  YAC_ASSERT(
+    yac_coupling_field_get_num_interp_fields(cpl_field) == 1,
+    "ERROR(get_recv_field_size): invalid number of interpolation fields "
+    "(should be one)")
+
+  return
+    yac_coupling_field_get_data_size(
+      cpl_field, yac_coupling_field_get_interp_fields(cpl_field)->location);
+}
+
+// receives a field in double precision into a single precision user buffer
+static void execute_get_double_to_float(
+  struct coupling_field * cpl_field, struct interpolation * interpolation,
+  int collection_size, float ** recv_field) {
+
+  size_t num_points = get_recv_field_size(cpl_field);
+
+  double ** recv_field_dble =
+    xmalloc((size_t)collection_size * sizeof(*recv_field_dble));
+  recv_field_dble[0] =
+    xmalloc((size_t)collection_size * num_points * sizeof(**recv_field_dble));
+  for (int h = 0; h < collection_size; ++h) {
+    recv_field_dble[h] = recv_field_dble[0] + (size_t)h * num_points;
+    for (size_t j = 0; j < num_points; ++j)
+      recv_field_dble[h][j] = (double)(recv_field[h][j]);
+  }
+
+  yac_interpolation_execute_get(interpolation, recv_field_dble);
+
+  for (int h = 0; h < collection_size; ++h)
+    for (size_t j = 0; j < num_points; ++j)
+      recv_field[h][j] = (float)(recv_field_dble[h][j]);
+
+  free(recv_field_dble[0]);
+  free(recv_field_dble);
+}
+
+/* ---------------------------------------------------------------------- */
+
 static double ** get_recv_field_pointers(
   int const field_id,
   int const collection_size,
@@ -1829,6 +2054,9 @@ static struct interpolation * yac_cget_pre_processing(
     collection_size == yac_get_coupling_field_collection_size(cpl_field),
     "ERROR: collection size does not match with coupling configuration.")
 
+  // generate the interpolation, if this was deferred by a lazy setup
+  yac_coupling_field_get_op_complete_setup(cpl_field);
+
   return yac_get_coupling_field_get_op_interpolation(cpl_field);
 }
 
@@ -1843,8 +2071,58 @@ void yac_cget ( int const field_id,
   struct interpolation * interpolation =
     yac_cget_pre_processing(field_id, collection_size, info, ierr);
 
-  if ((*ierr == 0) && (interpolation != NULL))
-    yac_interpolation_execute_get(interpolation, recv_field);
+  if ((*ierr == 0) && (interpolation != NULL)) {
+    if (yac_interpolation_use_single_precision(interpolation))
+      yac_interpolation_execute_get_float_to_double(
+        interpolation, recv_field);
+    else
+      yac_interpolation_execute_get(interpolation, recv_field);
+  }
+}
+
+void yac_cget_float_ ( int const field_id,
+                       int const collection_size,
+                       float *recv_field, // recv_field[collection_size][Points]
+                       int   *info,
+                       int   *ierr ) {
+
+  yac_ccheck_field_dimensions(field_id, collection_size, 1, NULL);
+
+  struct coupling_field * cpl_field =
+    yac_unique_id_to_pointer(field_id, "field_id");
+  size_t num_points = get_recv_field_size(cpl_field);
+
+  /* Needed to transfer from Fortran data structure to C */
+  float ** recv_field_ = xmalloc(collection_size * sizeof(*recv_field_));
+  for (int i = 0; i < collection_size; ++i) {
+    recv_field_[i] = recv_field;
+    recv_field += num_points;
+  }
+
+  yac_cget_float ( field_id, collection_size, recv_field_, info, ierr );
+
+  free(recv_field_);
+}
+
+void yac_cget_float ( int const field_id,
+                      int collection_size,
+                      float ** recv_field, // recv_field[collection_size][Points]
+                      int   *info,
+                      int   *ierr ) {
+
+  yac_ccheck_field_dimensions(field_id, collection_size, 1, NULL);
+
+  struct interpolation * interpolation =
+    yac_cget_pre_processing(field_id, collection_size, info, ierr);
+
+  if ((*ierr == 0) && (interpolation != NULL)) {
+    if (yac_interpolation_use_single_precision(interpolation))
+      yac_interpolation_execute_get_float(interpolation, recv_field);
+    else
+      execute_get_double_to_float(
+        yac_unique_id_to_pointer(field_id, "field_id"),
+        interpolation, collection_size, recv_field);
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -1949,6 +2227,78 @@ void yac_cput_frac_ ( int const field_id,
 
 /* ---------------------------------------------------------------------- */
 
+static float *** get_send_field_pointers_float(
+  int const field_id,
+  int const collection_size,
+  float * send_field) { // send_field[collection_size][nPointSets][Points]
+
+  struct coupling_field * cpl_field =
+    yac_unique_id_to_pointer(field_id, "field_id");
+
+  size_t num_interp_fields =
+    yac_coupling_field_get_num_interp_fields(cpl_field);
+  size_t * num_points;
+  get_send_field_point_counts(cpl_field, &num_points);
+
+  float *** send_field_ = xmalloc(collection_size * sizeof(*send_field_));
+  for (int i = 0; i < collection_size; ++i) {
+    send_field_[i] = xmalloc(num_interp_fields * sizeof(**send_field_));
+    for (size_t j = 0; j < num_interp_fields; ++j) {
+      send_field_[i][j] = send_field;
+      send_field += num_points[j];
+    }
+  }
+  free(num_points);
+
+  return send_field_;
+}
+
+void yac_cput_float_ ( int const field_id,
+                       int const collection_size,
+                       float *send_field,   // send_field[collection_size]
+                                            //           [nPointSets]
+                                            //           [Points]
+                       int   *info,
+                       int   *ierr ) {
+
+  yac_cput_frac_float_(
+    field_id, collection_size, send_field, NULL, info, ierr);
+}
+
+void yac_cput_frac_float_ ( int const field_id,
+                            int const collection_size,
+                            float *send_field,     // send_field[collection_size]
+                                                   //           [nPointSets]
+                                                   //           [Points]
+                            float *send_frac_mask, // send_frac_mask[collection_size]
+                                                   //               [nPointSets]
+                                                   //               [Points]
+                            int   *info,
+                            int   *ierr ) {
+
+  yac_ccheck_field_dimensions(field_id, collection_size, -1, NULL);
+
+  /* Needed to transfer from Fortran data structure to C */
+  float *** send_field_ =
+    get_send_field_pointers_float(field_id, collection_size, send_field);
+  float *** send_frac_mask_ =
+    (send_frac_mask != NULL)?
+      get_send_field_pointers_float(field_id, collection_size, send_frac_mask):
+      NULL;
+
+  yac_cput_frac_float(
+    field_id, collection_size, send_field_, send_frac_mask_, info, ierr);
+
+  for (int i = 0; i < collection_size; ++i) {
+    free(send_field_[i]);
+    if (send_frac_mask_ != NULL) free(send_frac_mask_[i]);
+  }
+  free(send_field_);
+  free(send_frac_mask_);
+}
+
+/* ---------------------------------------------------------------------- */
+
 static void get_send_field_pointers_ptr_(
   int const field_id,
   int const collection_size,
@@ -2054,14 +2404,47 @@ void yac_ctest(int field_id, int * flag) {
     return;
   }
 
+  // put operations whose interpolation was not yet generated by a lazy
+  // setup have no outstanding communication
   *flag = 0;
   for (
     unsigned put_idx = 0;
     (put_idx < yac_get_coupling_field_num_puts(cpl_field)) && !*flag;
-    ++put_idx)
+    ++put_idx) {
+    struct interpolation * interpolation =
+      yac_get_coupling_field_put_op_interpolation(cpl_field, put_idx);
     *flag =
-      yac_interpolation_execute_test(
-        yac_get_coupling_field_put_op_interpolation(cpl_field, put_idx));
+      (interpolation == NULL) ||
+      yac_interpolation_execute_test(interpolation);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void yac_cset_field_stable_put_buffer(int field_id, int is_stable) {
+
+  yac_set_coupling_field_stable_put_buffer(
+    yac_unique_id_to_pointer(field_id, "field_id"), is_stable);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void yac_cset_field_eager_setup(int field_id) {
+
+  yac_set_coupling_field_eager_setup(
+    yac_unique_id_to_pointer(field_id, "field_id"), 1);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void yac_cenable_progress_thread(int interval_usec) {
+
+  yac_progress_start(interval_usec);
+}
+
+void yac_cdisable_progress_thread(void) {
+
+  yac_progress_stop();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -2084,6 +2467,217 @@ void * yac_get_field_get_mask_c2f(int field_id) {
 
 /* ---------------------------------------------------------------------- */
 
+/* Kernels for the time reduction of put operations.
+ *
+ * Each kernel processes one contiguous buffer of a single collection entry
+ * and interpolation field. All loops are free of branches, such that they
+ * can be vectorised by the compiler. The (optional) put mask is handled by
+ * separate kernel variants. The scaling of the accumulated data at the end
+ * of a reduction period is fused into the final accumulation step
+ * (weights are 1.0 for all other steps).
+ */
+
+/* bitwise select between two values; unlike the ?:-operator this
+ * evaluates both values, which allows the compiler to vectorise loops
+ * containing conditional floating point operations (otherwise it is
+ * not allowed to speculatively execute them, if floating point
+ * exceptions may trap) */
+static inline double put_acc_select(int64_t cond, double a, double b) {
+
+  uint64_t a_bits, b_bits, mask = -(uint64_t)(cond != 0);
+  memcpy(&a_bits, &a, sizeof(a));
+  memcpy(&b_bits, &b, sizeof(b));
+  uint64_t r_bits = (a_bits & mask) | (b_bits & ~mask);
+  double r;
+  memcpy(&r, &r_bits, sizeof(r));
+  return r;
+}
+
+#define PUT_ACC_NO_CHECK (1)
+#define PUT_ACC_PUT_CHECK (mask[j] != 0)
+
+#define DEF_PUT_ACC_KERNELS(SUFFIX, CHECK) \
+  static void put_acc_sum_ ## SUFFIX( \
+    size_t n, double * restrict acc, double const * restrict field, \
+    int const * restrict mask, double weight) { \
+    (void)mask; \
+    for (size_t j = 0; j < n; ++j) \
+      acc[j] = put_acc_select(CHECK, (acc[j] + field[j]) * weight, acc[j]); \
+  } \
+  static void put_acc_min_ ## SUFFIX( \
+    size_t n, double * restrict acc, double const * restrict field, \
+    int const * restrict mask, double weight) { \
+    (void)mask; (void)weight; \
+    for (size_t j = 0; j < n; ++j) \
+      acc[j] = \
+        put_acc_select((CHECK) & (acc[j] > field[j]), field[j], acc[j]); \
+  } \
+  static void put_acc_max_ ## SUFFIX( \
+    size_t n, double * restrict acc, double const * restrict field, \
+    int const * restrict mask, double weight) { \
+    (void)mask; (void)weight; \
+    for (size_t j = 0; j < n; ++j) \
+      acc[j] = \
+        put_acc_select((CHECK) & (acc[j] < field[j]), field[j], acc[j]); \
+  } \
+  static void put_acc_frac_none_ ## SUFFIX( \
+    size_t n, double * restrict acc, double * restrict frac_acc, \
+    double const * restrict field, double const * restrict frac_mask, \
+    int const * restrict mask, double frac_weight, double weight) { \
+    (void)mask; (void)frac_acc; (void)frac_weight; (void)weight; \
+    for (size_t j = 0; j < n; ++j) { \
+      double frac = frac_mask[j]; \
+      acc[j] = \
+        put_acc_select((CHECK) & (frac != 0.0), field[j] * frac, acc[j]); \
+    } \
+  } \
+  static void put_acc_frac_sum_ ## SUFFIX( \
+    size_t n, double * restrict acc, double * restrict frac_acc, \
+    double const * restrict field, double const * restrict frac_mask, \
+    int const * restrict mask, double frac_weight, double weight) { \
+    (void)mask; \
+    for (size_t j = 0; j < n; ++j) { \
+      double frac = frac_mask[j]; \
+      int check = CHECK; \
+      int take = check & (frac != 0.0); \
+      double acc_value = \
+        put_acc_select(take, acc[j] + field[j] * frac, acc[j]); \
+      double frac_acc_value = \
+        put_acc_select(take, frac_acc[j] + frac, frac_acc[j]); \
+      frac_acc_value = \
+        put_acc_select(check, frac_acc_value * frac_weight, frac_acc_value); \
+      acc[j] = \
+        put_acc_select( \
+          check & (frac_acc_value != 0.0), acc_value * weight, acc_value); \
+      frac_acc[j] = frac_acc_value; \
+    } \
+  } \
+  static void put_acc_frac_min_ ## SUFFIX( \
+    size_t n, double * restrict acc, double * restrict frac_acc, \
+    double const * restrict field, double const * restrict frac_mask, \
+    int const * restrict mask, double frac_weight, double weight) { \
+    (void)mask; (void)frac_weight; (void)weight; \
+    for (size_t j = 0; j < n; ++j) { \
+      double frac = frac_mask[j]; \
+      double value = field[j] * frac; \
+      int take = (CHECK) & (frac != 0.0) & (acc[j] > value); \
+      acc[j] = put_acc_select(take, value, acc[j]); \
+      frac_acc[j] = put_acc_select(take, frac, frac_acc[j]); \
+    } \
+  } \
+  static void put_acc_frac_max_ ## SUFFIX( \
+    size_t n, double * restrict acc, double * restrict frac_acc, \
+    double const * restrict field, double const * restrict frac_mask, \
+    int const * restrict mask, double frac_weight, double weight) { \
+    (void)mask; (void)frac_weight; (void)weight; \
+    for (size_t j = 0; j < n; ++j) { \
+      double frac = frac_mask[j]; \
+      double value = field[j] * frac; \
+      int take = (CHECK) & (frac != 0.0) & (acc[j] < value); \
+      acc[j] = put_acc_select(take, value, acc[j]); \
+      frac_acc[j] = put_acc_select(take, frac, frac_acc[j]); \
+    } \
+  }
+
+DEF_PUT_ACC_KERNELS(no_mask, PUT_ACC_NO_CHECK)
+DEF_PUT_ACC_KERNELS(mask, PUT_ACC_PUT_CHECK)
+
+#undef DEF_PUT_ACC_KERNELS
+#undef PUT_ACC_PUT_CHECK
+#undef PUT_ACC_NO_CHECK
+
+typedef void (*put_acc_kernel)(
+  size_t n, double * restrict acc, double const * restrict field,
+  int const * restrict mask, double weight);
+typedef void (*put_acc_frac_kernel)(
+  size_t n, double * restrict acc, double * restrict frac_acc,
+  double const * restrict field, double const * restrict frac_mask,
+  int const * restrict mask, double frac_weight, double weight);
+
+enum put_acc_op {
+  PUT_ACC_NONE, //!< only applies the fractional mask
+  PUT_ACC_SUM,
+  PUT_ACC_MIN,
+  PUT_ACC_MAX,
+};
+
+/* applies the time reduction operation to all collection entries and
+ * interpolation fields of a put
+ *
+ * frac_weight is applied to the accumulated fractional mask and
+ * weight to the accumulated field data
+ * (only used by PUT_ACC_SUM, for PUT_ACC_SUM without fractional mask,
+ *  weight is applied to all accumulated field data)
+ */
+static void put_accumulate(
+  struct coupling_field * cpl_field, int collection_size,
+  enum put_acc_op op, double *** send_field_acc,
+  double *** send_frac_mask_acc, double *** send_field,
+  double *** send_frac_mask, double frac_weight, double weight) {
+
+  int ** put_mask = yac_get_coupling_field_put_mask(cpl_field);
+  size_t num_interp_fields =
+    yac_coupling_field_get_num_interp_fields(cpl_field);
+  struct interp_field const * interp_fields =
+    yac_coupling_field_get_interp_fields(cpl_field);
+
+  if (send_frac_mask != NULL) {
+
+    put_acc_frac_kernel kernel;
+    switch (op) {
+      default:
+      case (PUT_ACC_NONE):
+        kernel = (put_mask)?put_acc_frac_none_mask:put_acc_frac_none_no_mask;
+        break;
+      case (PUT_ACC_SUM):
+        kernel = (put_mask)?put_acc_frac_sum_mask:put_acc_frac_sum_no_mask;
+        break;
+      case (PUT_ACC_MIN):
+        kernel = (put_mask)?put_acc_frac_min_mask:put_acc_frac_min_no_mask;
+        break;
+      case (PUT_ACC_MAX):
+        kernel = (put_mask)?put_acc_frac_max_mask:put_acc_frac_max_no_mask;
+        break;
+    }
+
+    for (int h = 0; h < collection_size; h++)
+      for (size_t i = 0; i < num_interp_fields; i++)
+        kernel(
+          yac_coupling_field_get_data_size(
+            cpl_field, interp_fields[i].location),
+          send_field_acc[h][i],
+          (send_frac_mask_acc != NULL)?send_frac_mask_acc[h][i]:NULL,
+          send_field[h][i], send_frac_mask[h][i],
+          (put_mask)?put_mask[i]:NULL, frac_weight, weight);
+
+  } else {
+
+    put_acc_kernel kernel;
+    switch (op) {
+      default:
+      case (PUT_ACC_SUM):
+        kernel = (put_mask)?put_acc_sum_mask:put_acc_sum_no_mask;
+        break;
+      case (PUT_ACC_MIN):
+        kernel = (put_mask)?put_acc_min_mask:put_acc_min_no_mask;
+        break;
+      case (PUT_ACC_MAX):
+        kernel = (put_mask)?put_acc_max_mask:put_acc_max_no_mask;
+        break;
+    }
+
+    for (int h = 0; h < collection_size; h++)
+      for (size_t i = 0; i < num_interp_fields; i++)
+        kernel(
+          yac_coupling_field_get_data_size(
+            cpl_field, interp_fields[i].location),
+          send_field_acc[h][i], send_field[h][i],
+          (put_mask)?put_mask[i]:NULL, weight);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
 static struct interpolation * yac_cput_pre_processing(
   struct coupling_field * cpl_field, unsigned put_idx,
   int const collection_size, double *** send_field,
@@ -2137,10 +2731,6 @@ static struct interpolation * yac_cput_pre_processing(
      First deal with instant sends
      ------------------------------------------------------------------ */
 
-  int ** put_mask = yac_get_coupling_field_put_mask(cpl_field);
-  size_t num_interp_fields =
-    yac_coupling_field_get_num_interp_fields(cpl_field);
-
   int time_operation = yac_get_event_time_operation(event);
   if ( time_operation == TIME_NONE ) {
 
@@ -2154,33 +2744,16 @@ static struct interpolation * yac_cput_pre_processing(
       *send_field_acc_ = send_field_acc;
       *send_frac_mask_acc_ = send_frac_mask;
 
-      for (int h = 0; h < collection_size; h++) {
-        for (size_t i = 0; i < num_interp_fields; i++) {
-          size_t num_points =
-            yac_coupling_field_get_data_size(
-              cpl_field,
-              yac_coupling_field_get_interp_fields(cpl_field)[i].location);
-          if (put_mask) {
-            for (size_t j = 0; j < num_points; ++j) {
-              if (put_mask[i][j]) {
-                double frac_mask = send_frac_mask[h][i][j];
-                if (frac_mask != 0.0)
-                  send_field_acc[h][i][j] = send_field[h][i][j] * frac_mask;
-              }
-            }
-          } else {
-            for (size_t j = 0; j < num_points; ++j) {
-              double frac_mask = send_frac_mask[h][i][j];
-              if (frac_mask != 0.0)
-                send_field_acc[h][i][j] = send_field[h][i][j] * frac_mask;
-            }
-          }
-        }
-      }
+      put_accumulate(
+        cpl_field, collection_size, PUT_ACC_NONE, send_field_acc, NULL,
+        send_field, send_frac_mask, 1.0, 1.0);
+
     } else {
       *send_field_acc_ = NULL;
       *send_frac_mask_acc_ = NULL;
     }
+    // generate the interpolation, if this was deferred by a lazy setup
+    yac_coupling_field_put_op_complete_setup(cpl_field, put_idx);
     return yac_get_coupling_field_put_op_interpolation(cpl_field, put_idx);
   }
 
@@ -2242,125 +2815,47 @@ static struct interpolation * yac_cput_pre_processing(
     *send_frac_mask_acc_ = NULL;
   }
 
-#define NO_CHECK (1)
-#define PUT_CHECK (put_mask[i][j])
-#define SUM +=
-#define ASSIGN =
-#define AGGREGATE_FRAC(CHECK, EXTRA_CHECK, ACCU_OP) \
-  { \
-    for (size_t j = 0; j < num_points; ++j) { \
-      double frac_mask = send_frac_mask[h][i][j]; \
-      double send_field_value = send_field[h][i][j] * frac_mask; \
-      if (CHECK && (EXTRA_CHECK)) { \
-        if (frac_mask != 0.0) { \
-          send_field_acc[h][i][j] ACCU_OP send_field_value; \
-          send_frac_mask_acc[h][i][j] ACCU_OP frac_mask; \
-        } \
-      } \
-    } \
-  }
-#define AGGREATE_NOFRAC(CHECK, EXTRA_CHECK, ACCU_OP) \
-  { \
-    for (size_t j = 0; j < num_points; ++j) {\
-      double send_field_value = send_field[h][i][j]; \
-      if (CHECK && (EXTRA_CHECK)) \
-        send_field_acc[h][i][j] ACCU_OP send_field_value; \
-    } \
-  }
-#define AGGREGATE(EXTRA_CHECK, ACCU_OP) \
-  { \
-    for (int h = 0; h < collection_size; h++) { \
-      for (size_t i = 0; i < num_interp_fields; i++) { \
-        size_t num_points = \
-          yac_coupling_field_get_data_size( \
-            cpl_field, \
-            yac_coupling_field_get_interp_fields(cpl_field)[i].location); \
-        if (with_frac_mask) { \
-          if (put_mask) AGGREGATE_FRAC(PUT_CHECK, EXTRA_CHECK, ACCU_OP) \
-          else          AGGREGATE_FRAC(NO_CHECK,  EXTRA_CHECK, ACCU_OP) \
-        } else { \
-          if (put_mask) AGGREATE_NOFRAC(PUT_CHECK, EXTRA_CHECK, ACCU_OP) \
-          else          AGGREATE_NOFRAC(NO_CHECK,  EXTRA_CHECK, ACCU_OP) \
-        } \
-      } \
-    } \
-    break; \
-  }
+  /* --------------------------------------------------------------------
+     on coupling events the accumulated data has to be averaged; this is
+     fused into the accumulation of the current data
+     -------------------------------------------------------------------- */
+
+  int is_coupling_step = action != REDUCTION;
+  double weight =
+    (is_coupling_step)?(1.0 / (double)time_accumulation_count):1.0;
+  double frac_weight = weight;
+  // for accumulation only the fractional mask is averaged
+  if ( time_operation == TIME_ACCUMULATE ) weight = 1.0;
 
+  enum put_acc_op op;
   switch (time_operation) {
     default:
     case(TIME_ACCUMULATE):
     case(TIME_AVERAGE):
-      AGGREGATE(NO_CHECK, SUM)
+      op = PUT_ACC_SUM;
+      break;
     case(TIME_MINIMUM):
-      AGGREGATE(send_field_acc[h][i][j] > send_field_value, ASSIGN)
+      op = PUT_ACC_MIN;
+      break;
     case(TIME_MAXIMUM):
-      AGGREGATE(send_field_acc[h][i][j] < send_field_value, ASSIGN)
+      op = PUT_ACC_MAX;
+      break;
   }
 
-#undef AGGREGATE
-#undef AGGREATE_NOFRAC
-#undef AGGREGATE_FRAC
-#undef ASSIGN
-#undef SUM
-#undef PUT_CHECK
-#undef NO_CHECK
+  put_accumulate(
+    cpl_field, collection_size, op, send_field_acc, send_frac_mask_acc,
+    send_field, send_frac_mask, frac_weight, weight);
 
 /* --------------------------------------------------------------------
    Check whether we have to perform the coupling in this call
    -------------------------------------------------------------------- */
 
-  if (action == REDUCTION) {
+  if (!is_coupling_step) {
     yac_set_coupling_field_put_op_time_accumulation_count(
       cpl_field, put_idx, time_accumulation_count);
     return NULL;
   }
 
-/* --------------------------------------------------------------------
-   Average data if required
-   -------------------------------------------------------------------- */
-
-  if (( time_operation == TIME_AVERAGE ) ||
-      ( time_operation == TIME_ACCUMULATE )) {
-
-    double weight = 1.0 / (double)time_accumulation_count;
-
-#define NO_CHECK (1)
-#define PUT_CHECK (put_mask[i][j])
-#define WEIGHT_ACC_(ACC, CHECK, EXTRA_CHECK) \
-  { \
-    for (size_t j = 0; j < num_points; j++) \
-      if (CHECK && (EXTRA_CHECK)) ACC[h][i][j] *= weight; \
-  }
-#define WEIGHT_ACC(ACC, EXTRA_CHECK) \
-  { \
-    if (put_mask) WEIGHT_ACC_(ACC, PUT_CHECK, EXTRA_CHECK) \
-    else          WEIGHT_ACC_(ACC, NO_CHECK,  EXTRA_CHECK) \
-  }
-
-    for (int h = 0; h < collection_size; ++h) {
-      for (size_t i = 0; i < num_interp_fields; i++) {
-        size_t num_points =
-          yac_coupling_field_get_data_size(
-            cpl_field,
-            yac_coupling_field_get_interp_fields(cpl_field)[i].location);
-        if (with_frac_mask)
-          WEIGHT_ACC(send_frac_mask_acc, NO_CHECK)
-        if (time_operation == TIME_AVERAGE) {
-          if (with_frac_mask)
-            WEIGHT_ACC(send_field_acc, send_frac_mask_acc[h][i][j] != 0.0)
-          else
-            WEIGHT_ACC(send_field_acc, NO_CHECK)
-        }
-      }
-    }
-  }
-
-#undef NO_CHECK
-#undef PUT_CHECK
-#undef WEIGHT_ACC_
-#undef WEIGHT_ACC
-
   // reset time_accumulation_count
   yac_set_coupling_field_put_op_time_accumulation_count(
     cpl_field, put_idx, 0);
@@ -2370,19 +2865,71 @@ static struct interpolation * yac_cput_pre_processing(
    -------------------------------------------------------------------- */
 
   *info = MAX((int)COUPLING, *info);
+  // generate the interpolation, if this was deferred by a lazy setup
+  yac_coupling_field_put_op_complete_setup(cpl_field, put_idx);
   return yac_get_coupling_field_put_op_interpolation(cpl_field, put_idx);
 }
 
-void yac_cput_frac ( int const field_id,
-                     int const collection_size,
-                     double *** const send_field,     // send_field[collection_size]
-                                                      //           [nPointSets][Points]
-                     double *** const send_frac_mask, // send_frac_mask[collection_size]
-                                                      //               [nPointSets][Points]
-                     int    *info,
-                     int    *ierr ) {
+// is_stable: send_field/send_field_float point to user data, which the user
+//            guarantees not to modify until the put is completed
+static void execute_put(
+  struct coupling_field * cpl_field, struct interpolation * interpolation,
+  int collection_size, double *** send_field, double *** send_frac_mask,
+  float *** send_field_float, int is_stable) {
 
-  yac_ccheck_field_dimensions(field_id, collection_size, -1, NULL);
+  int with_frac_mask = send_frac_mask != NULL;
+
+  if (yac_interpolation_use_single_precision(interpolation)) {
+
+    // user data provided in single precision can be sent without any copy
+    if (is_stable && !with_frac_mask && (send_field_float != NULL)) {
+      yac_interpolation_execute_put_zero_copy_float(
+        interpolation, send_field_float);
+      return;
+    }
+
+    // user data provided in single precision can be passed on directly
+    float *** send_field_float_ =
+      (send_field_float != NULL)?
+        send_field_float:
+        convert_send_field_to_float(cpl_field, collection_size, send_field);
+
+    if (with_frac_mask) {
+      float *** send_frac_mask_float =
+        convert_send_field_to_float(
+          cpl_field, collection_size, send_frac_mask);
+      yac_interpolation_execute_put_frac_float(
+        interpolation, send_field_float_, send_frac_mask_float);
+      convert_send_field_to_float_free(send_frac_mask_float);
+    } else {
+      yac_interpolation_execute_put_float(interpolation, send_field_float_);
+    }
+
+    // the interpolation copies the data into its own send buffers, therefore
+    // the temporary buffers can be freed directly
+    if (send_field_float_ != send_field_float)
+      convert_send_field_to_float_free(send_field_float_);
+
+  } else {
+
+    if (with_frac_mask)
+      yac_interpolation_execute_put_frac(
+        interpolation, send_field, send_frac_mask);
+    // send_field only contains user data, if it was not converted from
+    // single precision
+    else if (is_stable && (send_field_float == NULL))
+      yac_interpolation_execute_put_zero_copy(interpolation, send_field);
+    else
+      yac_interpolation_execute_put(interpolation, send_field);
+  }
+}
+
+// send_field may only be NULL if send_field_float is provided and no put
+// operation requires the data in double precision (see yac_cput_frac_float)
+static void yac_cput_frac_prec (
+  int const field_id, int const collection_size,
+  double *** const send_field, double *** const send_frac_mask,
+  float *** const send_field_float, int *info, int *ierr ) {
 
   *info = NONE;
   *ierr = 0;
@@ -2453,13 +3000,86 @@ void yac_cput_frac ( int const field_id,
       double *** send_frac_mask_ptr =
         (send_frac_mask_acc == NULL)?send_frac_mask:send_frac_mask_acc;
 
-      if (with_frac_mask)
-        yac_interpolation_execute_put_frac(
-          interpolation, send_field_ptr, send_frac_mask_ptr);
-      else
-        yac_interpolation_execute_put(interpolation, send_field_ptr);
+      // accumulation buffers are overwritten by the next put before it
+      // waits for the completion of the current one
+      int is_stable =
+        yac_get_coupling_field_stable_put_buffer(cpl_field) &&
+        (send_field_acc == NULL);
+
+      execute_put(
+        cpl_field, interpolation, collection_size, send_field_ptr,
+        with_frac_mask?send_frac_mask_ptr:NULL,
+        (send_field_acc == NULL)?send_field_float:NULL, is_stable);
+    }
+  }
+}
+
+void yac_cput_frac ( int const field_id,
+                     int const collection_size,
+                     double *** const send_field,     // send_field[collection_size]
+                                                      //           [nPointSets][Points]
+                     double *** const send_frac_mask, // send_frac_mask[collection_size]
+                                                      //               [nPointSets][Points]
+                     int    *info,
+                     int    *ierr ) {
+
+  yac_ccheck_field_dimensions(field_id, collection_size, -1, NULL);
+
+  yac_cput_frac_prec(
+    field_id, collection_size, send_field, send_frac_mask, NULL, info, ierr);
+}
+
+void yac_cput_frac_float ( int const field_id,
+                           int const collection_size,
+                           float *** const send_field,     // send_field[collection_size]
+                                                           //           [nPointSets][Points]
+                           float *** const send_frac_mask, // send_frac_mask[collection_size]
+                                                           //               [nPointSets][Points]
+                           int   *info,
+                           int   *ierr ) {
+
+  yac_ccheck_field_dimensions(field_id, collection_size, -1, NULL);
+
+  struct coupling_field * cpl_field =
+    yac_unique_id_to_pointer(field_id, "field_id");
+
+  // the data has to be converted to double precision, if any put operation
+  // works in double precision or has to pre-process the data (time
+  // reduction or fractional masking)
+  // (the precision of interpolations that have not yet been generated by a
+  //  lazy setup is unknown, therefore the data is converted for them)
+  int convert_to_double = 0;
+  if (yac_get_coupling_field_exchange_type(cpl_field) == SOURCE) {
+    convert_to_double = send_frac_mask != NULL;
+    for (unsigned put_idx = 0;
+         (put_idx < yac_get_coupling_field_num_puts(cpl_field)) &&
+         !convert_to_double; ++put_idx) {
+      struct interpolation * interpolation =
+        yac_get_coupling_field_put_op_interpolation(cpl_field, put_idx);
+      convert_to_double =
+        (yac_get_event_time_operation(
+           yac_get_coupling_field_put_op_event(cpl_field, put_idx)) !=
+         TIME_NONE) ||
+        (interpolation == NULL) ||
+        !yac_interpolation_use_single_precision(interpolation);
     }
   }
+
+  double *** send_field_dble =
+    convert_to_double?
+      convert_send_field_to_double(cpl_field, collection_size, send_field):
+      NULL;
+  double *** send_frac_mask_dble =
+    (convert_to_double && (send_frac_mask != NULL))?
+      convert_send_field_to_double(cpl_field, collection_size, send_frac_mask):
+      NULL;
+
+  yac_cput_frac_prec(
+    field_id, collection_size, send_field_dble, send_frac_mask_dble,
+    (send_frac_mask == NULL)?send_field:NULL, info, ierr);
+
+  convert_send_field_to_double_free(send_frac_mask_dble);
+  convert_send_field_to_double_free(send_field_dble);
 }
 
 void yac_cput ( int const field_id,
@@ -2473,6 +3093,17 @@ void yac_cput ( int const field_id,
     field_id, collection_size, send_field, NULL, info, ierr);
 }
 
+void yac_cput_float ( int const field_id,
+                      int const collection_size,
+                      float *** const send_field, // send_field[collection_size]
+                                                  //           [nPointSets][Points]
+                      int   *info,
+                      int   *ierr ) {
+
+  yac_cput_frac_float(
+    field_id, collection_size, send_field, NULL, info, ierr);
+}
+
 /* ---------------------------------------------------------------------- */
 
 
@@ -2718,12 +3349,23 @@ void yac_cexchange_frac ( int const send_field_id,
         "fractional masking, but a mask was provided",
         yac_get_coupling_field_name(send_cpl_field));
 
-      if (with_frac_mask)
+      if (yac_interpolation_use_single_precision(put_interpolation)) {
+
+        // the interpolation uses single precision; since the exchange is
+        // performed in a single call, it is split into a put and a get
+        execute_put(
+          send_cpl_field, put_interpolation, collection_size,
+          send_field_ptr, with_frac_mask?send_frac_mask_ptr:NULL, NULL, 0);
+        yac_interpolation_execute_get_float_to_double(
+          put_interpolation, recv_field);
+
+      } else if (with_frac_mask) {
         yac_interpolation_execute_frac(
           put_interpolation, send_field_ptr, send_frac_mask_ptr, recv_field);
-      else
+      } else {
         yac_interpolation_execute(
           put_interpolation, send_field_ptr, recv_field);
+      }
 
     } else {
 
@@ -2741,11 +3383,11 @@ void yac_cexchange_frac ( int const send_field_id,
         yac_get_coupling_field_name(send_cpl_field));
 
       // just execute the put
-      if (with_frac_mask)
-        yac_interpolation_execute_put_frac(
-          put_interpolation, send_field_ptr, send_frac_mask_ptr);
-      else
-        yac_interpolation_execute_put(put_interpolation, send_field_ptr);
+      execute_put(
+        send_cpl_field, put_interpolation, collection_size,
+        send_field_ptr, with_frac_mask?send_frac_mask_ptr:NULL, NULL,
+        yac_get_coupling_field_stable_put_buffer(send_cpl_field) &&
+        (send_field_acc == NULL));
     }
   }
 }
@@ -2810,6 +3452,42 @@ void yac_cenddef_and_emit_config ( int emit_flags, char ** config ) {
     default_instance_id, emit_flags, config);
 }
 
+void yac_cenable_lazy_setup_instance(int yac_instance_id) {
+
+  yac_instance_enable_lazy_setup(
+    yac_unique_id_to_pointer(yac_instance_id, "yac_instance_id"));
+}
+
+void yac_cenable_lazy_setup (void) {
+
+  check_default_instance_id("yac_cenable_lazy_setup");
+  yac_cenable_lazy_setup_instance(default_instance_id);
+}
+
+void yac_cenable_dynamic_masks_instance(int yac_instance_id) {
+
+  yac_instance_enable_dynamic_masks(
+    yac_unique_id_to_pointer(yac_instance_id, "yac_instance_id"));
+}
+
+void yac_cenable_dynamic_masks (void) {
+
+  check_default_instance_id("yac_cenable_dynamic_masks");
+  yac_cenable_dynamic_masks_instance(default_instance_id);
+}
+
+void yac_cupdate_interpolations_instance(int yac_instance_id) {
+
+  yac_instance_update_masks(
+    yac_unique_id_to_pointer(yac_instance_id, "yac_instance_id"));
+}
+
+void yac_cupdate_interpolations (void) {
+
+  check_default_instance_id("yac_cupdate_interpolations");
+  yac_cupdate_interpolations_instance(default_instance_id);
+}
+
 /* ----------------------------------------------------------------------
                    query functions
    ----------------------------------------------------------------------*/
@@ -66,6 +66,7 @@
 #define YAC_INTERFACE_H
 
 #include <mpi.h>
+#include <stdint.h>
 
 extern int const YAC_LOCATION_CELL;
 extern int const YAC_LOCATION_CORNER;
@@ -776,6 +777,21 @@ void yac_cpredef_comp_instance(int yac_instance_id,
 
 /* -------------------------------------------------------------------------------- */
 
+/** updates the values of a mask that was defined before
+
+     @param[in]  mask_id    mask ID returned by \ref yac_cdef_mask or
+                            \ref yac_cdef_mask_named
+     @param[in]  is_valid   0 for points that are masked out, 1 for valid points
+     @remark this routine is not collective
+     @remark the new mask values are only applied to the interpolations
+             by a subsequent call to \ref yac_cupdate_interpolations
+*/
+
+     void yac_cupdate_mask ( int const mask_id,
+                             int const * is_valid );
+
+/* -------------------------------------------------------------------------------- */
+
 /** Definition of the coupling field (using default mask, if defined)
 
      @param[in]  field_name      character string providing the name of the coupling field
@@ -994,7 +1010,11 @@ void yac_cget_ext_couple_config_weight_file(int ext_couple_config_id,
 /** Sets the mapping side
     @param[in] ext_couple_config_id extended coupling configuration
     @param[in] mapping_side mapping side
-    @remark Valid values are: source = 1 and target = 0
+    @remark Valid values are: source = 1, target = 0, and auto = 2
+    @remark If the mapping side is set to auto, YAC estimates the
+            communication costs of both sides from the computed weights
+            and selects the cheaper one (the selected side is printed to
+            stderr for each couple)
  */
 void yac_cset_ext_couple_config_mapping_side(int ext_couple_config_id,
                                              int mapping_side);
@@ -1066,6 +1086,45 @@ void yac_cset_ext_couple_config_tgt_mask_name(
 void yac_cget_ext_couple_config_mask_name(
   int ext_couple_config_id, char const ** tgt_mask_name);
 
+/** Sets the precision in which the field data is exchanged
+    @param[in] ext_couple_config_id extended coupling configuration
+    @param[in] use_single_precision 1 for single precision, 0 for double
+                                    precision (default)
+    @remark the interpolation weights are always applied in double precision
+ */
+void yac_cset_ext_couple_config_use_single_precision(
+  int ext_couple_config_id, int use_single_precision);
+
+/** Gets the precision in which the field data is exchanged
+    @param[in]  ext_couple_config_id extended coupling configuration
+    @param[out] use_single_precision 1 for single precision, 0 for double
+                                     precision
+ */
+void yac_cget_ext_couple_config_use_single_precision(
+  int ext_couple_config_id, int * use_single_precision);
+
+/** Sets the threshold for the removal of small interpolation weights
+    @param[in] ext_couple_config_id     extended coupling configuration
+    @param[in] weight_pruning_threshold relative threshold in the range
+                                        [0.0,1.0); weights whose absolute
+                                        value is below this threshold times
+                                        the largest absolute weight of the
+                                        respective target point are removed
+                                        (default 0.0, which disables the
+                                        pruning)
+    @remark the remaining weights of each target point are rescaled, such
+            that their sum is preserved
+ */
+void yac_cset_ext_couple_config_weight_pruning_threshold(
+  int ext_couple_config_id, double weight_pruning_threshold);
+
+/** Gets the threshold for the removal of small interpolation weights
+    @param[in]  ext_couple_config_id     extended coupling configuration
+    @param[out] weight_pruning_threshold relative threshold
+ */
+void yac_cget_ext_couple_config_weight_pruning_threshold(
+  int ext_couple_config_id, double * weight_pruning_threshold);
+
 /* -------------------------------------------------------------------------- */
 
 /** Define couple using an extended coupling configuration
@@ -1226,6 +1285,41 @@ void yac_cdef_couple(
                      int    *info,
                      int    *ierror );
 
+/** Receiving of the coupling fields in single precision
+
+     @param[in]  field_id           -
+     @param[in]  collection_size    -
+     @param[in]  recv_field         - receive buffer (all data is stored in one
+                                                      contiguous part of the memory)
+                                      dimensions: recv_field[collection_size][nbr_points]
+     @param[out] info               - returned info argument indicating the action performed
+     @param[out] ierror             - returned error
+     @remark the data is converted if the couple was not configured for
+             single precision
+*/
+     void yac_cget_float_ ( int const field_id,
+                            int const collection_size,
+                            float *recv_field,
+                            int   *info,
+                            int   *ierror );
+
+/** Receiving of the coupling fields in single precision
+
+     @param[in]  field_id           -
+     @param[in]  collection_size    -
+     @param[in]  recv_field         - receive buffer
+                                      dimensions: recv_field[collection_size][nbr_points]
+     @param[out] info               - returned info argument indicating the action performed
+     @param[out] ierror             - returned error
+     @remark the data is converted if the couple was not configured for
+             single precision
+*/
+     void yac_cget_float ( int const field_id,
+                           int const collection_size,
+                           float **recv_field,
+                           int   *info,
+                           int   *ierror );
+
 /* -------------------------------------------------------------------------------- */
 
 /** Sending of the coupling fields
@@ -1317,6 +1411,97 @@ void yac_cdef_couple(
 
 /* -------------------------------------------------------------------------------- */
 
+/** Sending of the coupling fields in single precision
+
+     @param[in]  field_id           -
+     @param[in]  collection_size    -
+     @param[in]  send_field         - send buffer (all data is stored in one
+                                                   contiguous part of the memory)
+                                      dimensions send_field[collection_size]
+                                                           [nbr_fields]
+                                                           [nbr_points]
+     @param[out] info               - returned info
+     @param[out] ierror             - returned error
+     @remark if the couple is configured for single precision and no time
+             reduction is applied, the data is passed on without conversion
+*/
+
+     void yac_cput_float_ ( int const field_id,
+                            int const collection_size,
+                            float *send_field,
+                            int   *info,
+                            int   *ierror );
+
+/** Sending of the coupling fields in single precision
+
+     @param[in]  field_id           -
+     @param[in]  collection_size    -
+     @param[in]  send_field         - send buffer
+                                      dimensions send_field[collection_size]
+                                                           [nbr_fields]
+                                                           [nbr_points]
+     @param[out] info               - returned info
+     @param[out] ierror             - returned error
+     @remark if the couple is configured for single precision and no time
+             reduction is applied, the data is passed on without conversion
+*/
+
+     void yac_cput_float ( int const field_id,
+                           int const collection_size,
+                           float *** const send_field,
+                           int *info,
+                           int *ierror );
+
+/** Sending of the coupling fields in single precision
+
+     @param[in]  field_id           -
+     @param[in]  collection_size    -
+     @param[in]  send_field         - send buffer (all data is stored in one
+                                                   contiguous part of the memory)
+                                      dimensions send_field[collection_size]
+                                                           [nbr_fields]
+                                                           [nbr_points]
+     @param[in]  send_frac_mask    - send fractional mask (all data is stored in one
+                                                           contiguous part of the memory)
+                                      dimensions send_frac_mask[collection_size]
+                                                               [nbr_fields]
+                                                               [nbr_points]
+     @param[out] info               - returned info
+     @param[out] ierror             - returned error
+*/
+
+     void yac_cput_frac_float_ ( int const field_id,
+                                 int const collection_size,
+                                 float *send_field,
+                                 float *send_frac_mask,
+                                 int   *info,
+                                 int   *ierror );
+
+/** Sending of the coupling fields in single precision
+
+     @param[in]  field_id           -
+     @param[in]  collection_size    -
+     @param[in]  send_field         - send buffer
+                                      dimensions send_field[collection_size]
+                                                           [nbr_fields]
+                                                           [nbr_points]
+     @param[in]  send_frac_mask     - send fractional mask
+                                      dimensions send_frac_mask[collection_size]
+                                                               [nbr_fields]
+                                                               [nbr_points]
+     @param[out] info               - returned info
+     @param[out] ierror             - returned error
+*/
+
+     void yac_cput_frac_float ( int const field_id,
+                                int const collection_size,
+                                float *** const send_field,
+                                float *** const send_frac_mask,
+                                int *info,
+                                int *ierror );
+
+/* -------------------------------------------------------------------------------- */
+
 /** Sending of the coupling fields
 
      @param[in]  field_id           -
@@ -1549,6 +1734,68 @@ void yac_cdef_couple(
 
 /* -------------------------------------------------------------------------------- */
 
+/** Declares whether the data passed to puts of a field stays untouched
+    until the respective put has been completed (i.e. until \ref yac_ctest
+    returns "1" for the field or until the next put of the field).
+    In this case, YAC may send the data directly from the user arrays
+    instead of copying it into internal buffers first. The setting can be
+    changed between puts.
+
+     @param[in]   field_id
+     @param[in]   is_stable  "1" if the user guarantees that put data
+                             is not modified or freed until the put is
+                             completed, "0" otherwise (default)
+
+     @remark the data is still copied for puts that require pre-processing
+             (time reduction, fractional masking, scaling, or conversion
+             between single and double precision)
+*/
+
+     void yac_cset_field_stable_put_buffer ( int field_id, int is_stable );
+
+/* -------------------------------------------------------------------------------- */
+
+/** Marks a field as critical. The interpolations of all couples between
+    the components of the couples of this field are generated during
+    \ref yac_cenddef, even if the lazy setup was enabled
+    (see \ref yac_cenable_lazy_setup).
+
+     @param[in]   field_id
+     @remark has to be called before \ref yac_cenddef
+*/
+
+     void yac_cset_field_eager_setup ( int field_id );
+
+/* -------------------------------------------------------------------------------- */
+
+/** Starts a background thread, which periodically tests all outstanding
+    asynchronous communications (for example from previous puts) and thereby
+    drives their completion while the model is computing. If the thread is
+    already running, only its polling interval is updated.\n
+    If the weights of a field are applied on the target side, a get
+    receives the data of each group of source processes separately. Once
+    the data of a group has been received, the thread can compute the
+    target points that depend on it, while the get is still computing
+    other target points.
+
+     @param[in]   interval_usec  polling interval in microseconds
+
+     @remark MPI has to be initialised with MPI_THREAD_MULTIPLE
+     @remark if YAC was built without pthread support, a warning is printed
+             and no thread is started
+     @remark the thread is stopped automatically when the last YAC instance
+             is cleaned up
+*/
+
+     void yac_cenable_progress_thread ( int interval_usec );
+
+/** Stops the background thread started by \ref yac_cenable_progress_thread
+*/
+
+     void yac_cdisable_progress_thread ( void );
+
+/* -------------------------------------------------------------------------------- */
+
 /** synchronize grids and fields of the default instance
  */
 void yac_csync_def ( void );
@@ -1607,6 +1854,70 @@ void yac_cenddef_and_emit_config ( int emit_flags, char ** config );
 void yac_cenddef_and_emit_config_instance (
   int yac_instance_id, int emit_flags, char ** config);
 
+/** Enables the lazy setup for the default YAC instance. The interpolations
+ *  of a pair of components are not generated by \ref yac_cenddef, but on
+ *  the first exchange of any field coupled between these components. This
+ *  reduces the time required by \ref yac_cenddef.
+ *  @remark has to be called before \ref yac_cenddef
+ *  @remark the generation of the interpolations is collective for all
+ *          processes of both components, therefore the first exchanges
+ *          of different component pairs have to occur in the same order
+ *          in all components. If two processes start the setups of
+ *          different component pairs, which both contain these two
+ *          processes, YAC aborts with an error message.
+ *  @remark fields can be excluded from the lazy setup using
+ *          \ref yac_cset_field_eager_setup
+ */
+void yac_cenable_lazy_setup ( void );
+
+/** Enables the lazy setup (see \ref yac_cenable_lazy_setup)
+ *
+ *  @param[in]  yac_instance_id id of the YAC instance
+ *  @remark has to be called before \ref yac_cenddef_instance
+ */
+void yac_cenable_lazy_setup_instance ( int yac_instance_id );
+
+/** Enables the update of masks after the end of the definition phase
+ *  of the default YAC instance (see \ref yac_cupdate_interpolations)
+ *  @remark has to be called before \ref yac_cenddef
+ *  @remark the internal data required for the update of the interpolations
+ *          of all couples that use masks is kept after the end of the
+ *          definition phase, which increases the memory consumption
+ *  @remark the weights of couples that use masks are always computed and
+ *          not read from the weight cache
+ */
+void yac_cenable_dynamic_masks ( void );
+
+/** Enables the update of masks after the end of the definition phase
+ *  (see \ref yac_cupdate_interpolations_instance)
+ *
+ *  @param[in]  yac_instance_id id of the YAC instance
+ *  @remark has to be called before \ref yac_cenddef_instance
+ */
+void yac_cenable_dynamic_masks_instance ( int yac_instance_id );
+
+/** Updates the interpolations of the default YAC instance after masks
+ *  were changed with \ref yac_cupdate_mask. Only the interpolation
+ *  stencils affected by the changes are recomputed, starting with the
+ *  interpolation method that generated their previous stencils, and the
+ *  existing interpolations are patched accordingly.
+ *  @remark all stencils of a couple are recomputed, if one of its source
+ *          points became valid or its interpolation stack contains the
+ *          spmap or creep method
+ *  @remark this routine is collective for all processes of the instance
+ *  @remark no exchange may be pending when this routine is called
+ */
+void yac_cupdate_interpolations ( void );
+
+/** Updates the interpolations after masks were changed with
+ *  \ref yac_cupdate_mask (see \ref yac_cupdate_interpolations).
+ *
+ *  @param[in]  yac_instance_id id of the YAC instance
+ *  @remark this routine is collective for all processes of the instance
+ *  @remark no exchange may be pending when this routine is called
+ */
+void yac_cupdate_interpolations_instance ( int yac_instance_id );
+
 /* --------------------------------------------------------------------------------
            query routines
    -------------------------------------------------------------------------------- */
@@ -1635,6 +1946,80 @@ char * yac_cget_end_datetime ( void );
 
 char * yac_cget_end_datetime_instance ( int yac_instance_id );
 
+/** query routine for the time spent by a component in a phase of the
+ *  setup (\ref yac_cenddef) of the default YAC instance
+
+     @param[in]  comp_name  name of the component
+     @param[in]  phase_name name of the setup phase (e.g. "setup" or
+                            "setup/interp_weights/do_search/nnn")
+     @param[out] min_time   minimum time over all processes of the component
+     @param[out] max_time   maximum time over all processes of the component
+     @param[out] avg_time   average time over all processes of the component
+
+     \remark the names of all available phases are listed in setup_stats.h
+     \remark processes that did not pass through a phase contribute a
+             time of zero
+*/
+
+void yac_cget_setup_timer (
+  const char * comp_name, const char * phase_name,
+  double * min_time, double * max_time, double * avg_time );
+
+/** query routine for the time spent by a component in a phase of the
+ *  setup
+
+     @param[in]  yac_instance_id id of the YAC instance
+     @param[in]  comp_name       name of the component
+     @param[in]  phase_name      name of the setup phase
+     @param[out] min_time        minimum time over all processes of the
+                                 component
+     @param[out] max_time        maximum time over all processes of the
+                                 component
+     @param[out] avg_time        average time over all processes of the
+                                 component
+*/
+
+void yac_cget_setup_timer_instance (
+  int yac_instance_id, const char * comp_name, const char * phase_name,
+  double * min_time, double * max_time, double * avg_time );
+
+/** query routine for a counter ("bytes_exchanged", "num_stencils",
+ *  "peak_memory", "num_pruned_links", "num_auto_mapping_on_source", or
+ *  "num_auto_mapping_on_target") of a component in a phase of the setup
+ *  (\ref yac_cenddef) of the default YAC instance
+
+     @param[in]  comp_name    name of the component
+     @param[in]  phase_name   name of the setup phase
+     @param[in]  counter_name name of the counter
+     @param[out] min_value    minimum value over all processes of the
+                              component
+     @param[out] max_value    maximum value over all processes of the
+                              component
+     @param[out] sum_value    sum over all processes of the component
+*/
+
+void yac_cget_setup_counter (
+  const char * comp_name, const char * phase_name, const char * counter_name,
+  int64_t * min_value, int64_t * max_value, int64_t * sum_value );
+
+/** query routine for a counter of a component in a phase of the setup
+
+     @param[in]  yac_instance_id id of the YAC instance
+     @param[in]  comp_name       name of the component
+     @param[in]  phase_name      name of the setup phase
+     @param[in]  counter_name    name of the counter
+     @param[out] min_value       minimum value over all processes of the
+                                 component
+     @param[out] max_value       maximum value over all processes of the
+                                 component
+     @param[out] sum_value       sum over all processes of the component
+*/
+
+void yac_cget_setup_counter_instance (
+  int yac_instance_id, const char * comp_name, const char * phase_name,
+  const char * counter_name,
+  int64_t * min_value, int64_t * max_value, int64_t * sum_value );
+
 /** query routine for the yac version
 */
 
@@ -79,6 +79,26 @@ lapack_int LAPACKE_dgetri_work( int matrix_layout, lapack_int n, double* a,
   }
 }
 
+lapack_int LAPACKE_dpotrf( int matrix_layout, char uplo, lapack_int n,
+                           double* a, lapack_int lda )
+{
+  assert(matrix_layout == LAPACK_COL_MAJOR);
+  return (lapack_int) clapack_dpotrf(LAPACK_COL_MAJOR,
+                                     uplo == 'U' ? CblasUpper : CblasLower,
+                                     (int) n, a, (int) lda);
+}
+
+lapack_int LAPACKE_dpotrs( int matrix_layout, char uplo, lapack_int n,
+                           lapack_int nrhs, const double* a, lapack_int lda,
+                           double* b, lapack_int ldb )
+{
+  assert(matrix_layout == LAPACK_COL_MAJOR);
+  return (lapack_int) clapack_dpotrs(LAPACK_COL_MAJOR,
+                                     uplo == 'U' ? CblasUpper : CblasLower,
+                                     (int) n, (int) nrhs, a, (int) lda,
+                                     b, (int) ldb);
+}
+
 #elif YAC_LAPACK_INTERFACE_ID == 4 // Netlib CLAPACK
 
 #include <assert.h>
@@ -262,6 +282,8 @@ extern "C" {
 #define LAPACK_dgetri YAC_FC_GLOBAL(dgetri,DGETRI)
 #define LAPACK_dsytrf YAC_FC_GLOBAL(dsytrf,DSYTRF)
 #define LAPACK_dsytri YAC_FC_GLOBAL(dsytri,DSYTRI)
+#define LAPACK_dpotrf YAC_FC_GLOBAL(dpotrf,DPOTRF)
+#define LAPACK_dpotrs YAC_FC_GLOBAL(dpotrs,DPOTRS)
 
 #if 0
 void LAPACK_dgels( char* trans, lapack_int* m, lapack_int* n, lapack_int* nrhs,
@@ -281,6 +303,11 @@ void LAPACK_dsytrf( char* uplo, lapack_int* n, double* a, lapack_int* lda,
                     lapack_int *info );
 void LAPACK_dsytri( char* uplo, lapack_int* n, double* a, lapack_int* lda,
                     const lapack_int* ipiv, double* work, lapack_int *info );
+void LAPACK_dpotrf( char* uplo, lapack_int* n, double* a, lapack_int* lda,
+                    lapack_int *info );
+void LAPACK_dpotrs( char* uplo, lapack_int* n, lapack_int* nrhs,
+                    const double* a, lapack_int* lda, double* b,
+                    lapack_int* ldb, lapack_int *info );
 
 #ifdef __cplusplus
 }
@@ -355,4 +382,25 @@ lapack_int LAPACKE_dsytri_work( int matrix_layout, char uplo, lapack_int n,
   return info;
 }
 
+lapack_int LAPACKE_dpotrf( int matrix_layout, char uplo, lapack_int n,
+                           double* a, lapack_int lda )
+{
+  lapack_int info = 0;
+  assert(matrix_layout == LAPACK_COL_MAJOR);
+  LAPACK_dpotrf( &uplo, &n, a, &lda, &info );
+  if( info < 0 ) { info = info - 1; }
+  return info;
+}
+
+lapack_int LAPACKE_dpotrs( int matrix_layout, char uplo, lapack_int n,
+                           lapack_int nrhs, const double* a, lapack_int lda,
+                           double* b, lapack_int ldb )
+{
+  lapack_int info = 0;
+  assert(matrix_layout == LAPACK_COL_MAJOR);
+  LAPACK_dpotrs( &uplo, &n, &nrhs, a, &lda, b, &ldb, &info );
+  if( info < 0 ) { info = info - 1; }
+  return info;
+}
+
 #endif
@@ -49,6 +49,13 @@ lapack_int LAPACKE_dgetri_work( int matrix_layout, lapack_int n, double* a,
                                 lapack_int lda, const lapack_int* ipiv,
                                 double* work, lapack_int lwork );
 
+lapack_int LAPACKE_dpotrf( int matrix_layout, char uplo, lapack_int n,
+                           double* a, lapack_int lda );
+
+lapack_int LAPACKE_dpotrs( int matrix_layout, char uplo, lapack_int n,
+                           lapack_int nrhs, const double* a, lapack_int lda,
+                           double* b, lapack_int ldb );
+
 #define YAC_LAPACK_NO_DSYTR
 #define YAC_LAPACK_C_INDEXING
 
@@ -88,6 +95,9 @@ lapack_int LAPACKE_dsytri_work( int matrix_layout, char uplo, lapack_int n,
                                 double* a, lapack_int lda,
                                 const lapack_int* ipiv, double* work );
 
+// the bundled CLAPACK does not provide dpotrf and dpotrs
+#define YAC_LAPACK_NO_DPOTR
+
 #elif YAC_LAPACK_INTERFACE_ID == 5 // Fortran LAPACK
 
 #ifndef lapack_int
@@ -122,6 +132,13 @@ lapack_int LAPACKE_dsytri_work( int matrix_layout, char uplo, lapack_int n,
                                 double* a, lapack_int lda,
                                 const lapack_int* ipiv, double* work );
 
+lapack_int LAPACKE_dpotrf( int matrix_layout, char uplo, lapack_int n,
+                           double* a, lapack_int lda );
+
+lapack_int LAPACKE_dpotrs( int matrix_layout, char uplo, lapack_int n,
+                           lapack_int nrhs, const double* a, lapack_int lda,
+                           double* b, lapack_int ldb );
+
 #else
 
 #error Unexpected value for YAC_LAPACK_INTERFACE_ID
@@ -55,6 +55,7 @@
 
 #include <mpi.h>
 #include "yac_mpi.h"
+#include "setup_stats.h"
 #include "geometry.h"
 #include "ensure_array_size.h"
 #include "core/core.h"
@@ -81,17 +82,562 @@ void yac_mpi_error(int error_code, MPI_Comm comm) {
   MPI_Abort(comm, error_code);
 }
 
+/* ---------------------------------------------------------------------------
+ * hierarchical alltoallv
+ *
+ * For large communicators the number of messages of the direct exchange
+ * (one per non-empty pair of processes) dominates the run time of the
+ * setup. Therefore, the data for other nodes is first gathered by a leader
+ * process per node, then exchanged among the leaders, and finally
+ * scattered within the node. Data for processes on the same node is still
+ * exchanged directly.
+ *
+ * The node layout of each communicator is determined on first use and
+ * cached as an attribute of the communicator.
+ * ------------------------------------------------------------------------- */
+
+enum {
+  DEFAULT_HIERARCHICAL_MIN_SIZE = 2048,
+  NODE_GATHER_TAG = 1,
+  NODE_SCATTER_TAG = 2,
+  LEADER_TAG = 3,
+};
+
+struct node_info {
+  int use_hierarchical;
+  MPI_Comm node_comm;   // processes on the same node
+  MPI_Comm leader_comm; // node leaders (MPI_COMM_NULL on other processes)
+  int num_nodes;
+  int node_idx;         // index of the local node
+  int * rank_node;      // [comm_size] node index of each process
+  int * node_ranks;     // [comm_size] processes sorted by node and rank
+  int * node_offsets;   // [num_nodes + 1] offsets in node_ranks
+};
+
+static int node_info_keyval = MPI_KEYVAL_INVALID;
+
+static void node_info_delete(struct node_info * info) {
+
+  if (info->node_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(info->node_comm));
+  if (info->leader_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(info->leader_comm));
+  free(info->node_offsets);
+  free(info->rank_node);
+  free(info);
+}
+
+static int node_info_delete_attr(
+  MPI_Comm comm, int keyval, void * attribute_val, void * extra_state) {
+
+  UNUSED(comm);
+  UNUSED(keyval);
+  UNUSED(extra_state);
+
+  node_info_delete((struct node_info *)attribute_val);
+  return MPI_SUCCESS;
+}
+
+static void read_hierarchical_config(
+  MPI_Comm comm, int * min_size, int * max_ranks_per_node) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  int config[2] = {DEFAULT_HIERARCHICAL_MIN_SIZE, -1};
+
+  // environment is only checked on rank 0, results are broadcasted
+  // to other processes
+  if (rank == 0) {
+
+    char const * min_size_str =
+      getenv(YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV);
+    if ((min_size_str != NULL) && (min_size_str[0] != '\0')) {
+      config[0] = atoi(min_size_str);
+      YAC_ASSERT_F(
+        (config[0] >= 0) || (config[0] == -1),
+        "ERROR(read_hierarchical_config): \"%s\" is not a valid value for "
+        "%s", min_size_str, YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV);
+    }
+
+    char const * max_ranks_str =
+      getenv(YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV);
+    if ((max_ranks_str != NULL) && (max_ranks_str[0] != '\0')) {
+      config[1] = atoi(max_ranks_str);
+      YAC_ASSERT_F(
+        (config[1] > 0) || (config[1] == -1),
+        "ERROR(read_hierarchical_config): \"%s\" is not a valid value for "
+        "%s", max_ranks_str, YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV);
+    }
+  }
+  yac_mpi_call(MPI_Bcast(config, 2, MPI_INT, 0, comm), comm);
+
+  *min_size = config[0];
+  *max_ranks_per_node = config[1];
+}
+
+static struct node_info * node_info_new(MPI_Comm comm) {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  struct node_info * info = xmalloc(1 * sizeof(*info));
+  info->use_hierarchical = 0;
+  info->node_comm = MPI_COMM_NULL;
+  info->leader_comm = MPI_COMM_NULL;
+  info->num_nodes = 0;
+  info->node_idx = 0;
+  info->rank_node = NULL;
+  info->node_ranks = NULL;
+  info->node_offsets = NULL;
+
+  int min_size, max_ranks_per_node;
+  read_hierarchical_config(comm, &min_size, &max_ranks_per_node);
+
+  if ((min_size == -1) || (comm_size < min_size)) return info;
+
+  // create one communicator per node (optionally split into smaller groups)
+  MPI_Comm shared_comm;
+  yac_mpi_call(
+    MPI_Comm_split_type(
+      comm, MPI_COMM_TYPE_SHARED, comm_rank, MPI_INFO_NULL, &shared_comm),
+    comm);
+  if (max_ranks_per_node > 0) {
+    int shared_rank;
+    yac_mpi_call(MPI_Comm_rank(shared_comm, &shared_rank), shared_comm);
+    yac_mpi_call(
+      MPI_Comm_split(
+        shared_comm, shared_rank / max_ranks_per_node, shared_rank,
+        &(info->node_comm)), shared_comm);
+    yac_mpi_call(MPI_Comm_free(&shared_comm), comm);
+  } else {
+    info->node_comm = shared_comm;
+  }
+
+  int node_rank;
+  yac_mpi_call(MPI_Comm_rank(info->node_comm, &node_rank), info->node_comm);
+
+  // the process with the lowest rank of each node is its leader
+  yac_mpi_call(
+    MPI_Comm_split(
+      comm, (node_rank == 0)?0:MPI_UNDEFINED, comm_rank,
+      &(info->leader_comm)), comm);
+
+  // determine the leader of each process
+  int leader_rank = comm_rank;
+  yac_mpi_call(
+    MPI_Bcast(&leader_rank, 1, MPI_INT, 0, info->node_comm),
+    info->node_comm);
+  info->rank_node = xmalloc(2 * (size_t)comm_size * sizeof(*info->rank_node));
+  info->node_ranks = info->rank_node + comm_size;
+  yac_mpi_call(
+    MPI_Allgather(
+      &leader_rank, 1, MPI_INT, info->rank_node, 1, MPI_INT, comm), comm);
+
+  // nodes are numbered in the order of the ranks of their leaders, which
+  // matches the ranks in leader_comm
+  int num_nodes = 0;
+  for (int i = 0; i < comm_size; ++i)
+    if (info->rank_node[i] == i) info->node_ranks[i] = num_nodes++;
+  for (int i = 0; i < comm_size; ++i)
+    info->rank_node[i] = info->node_ranks[info->rank_node[i]];
+
+  info->num_nodes = num_nodes;
+  info->node_idx = info->rank_node[comm_rank];
+
+  // the processes of each node are sorted by their rank, which
+  // matches the ranks in node_comm
+  info->node_offsets =
+    xcalloc((size_t)num_nodes + 2, sizeof(*(info->node_offsets)));
+  for (int i = 0; i < comm_size; ++i) info->node_offsets[info->rank_node[i]+2]++;
+  for (int i = 0; i < num_nodes; ++i)
+    info->node_offsets[i+2] += info->node_offsets[i+1];
+  for (int i = 0; i < comm_size; ++i)
+    info->node_ranks[info->node_offsets[info->rank_node[i]+1]++] = i;
+
+  info->use_hierarchical = (num_nodes > 1) && (num_nodes < comm_size);
+
+  if (!info->use_hierarchical) {
+    free(info->node_offsets);
+    free(info->rank_node);
+    info->node_offsets = NULL;
+    info->rank_node = NULL;
+    info->node_ranks = NULL;
+    yac_mpi_call(MPI_Comm_free(&(info->node_comm)), comm);
+    if (info->leader_comm != MPI_COMM_NULL)
+      yac_mpi_call(MPI_Comm_free(&(info->leader_comm)), comm);
+  }
+
+  return info;
+}
+
+static struct node_info * get_node_info(MPI_Comm comm) {
+
+  if (node_info_keyval == MPI_KEYVAL_INVALID)
+    yac_mpi_call(
+      MPI_Comm_create_keyval(
+        MPI_COMM_NULL_COPY_FN, node_info_delete_attr, &node_info_keyval,
+        NULL), comm);
+
+  struct node_info * info;
+  int flag;
+  yac_mpi_call(
+    MPI_Comm_get_attr(comm, node_info_keyval, &info, &flag), comm);
+
+  if (!flag) {
+    info = node_info_new(comm);
+    yac_mpi_call(MPI_Comm_set_attr(comm, node_info_keyval, info), comm);
+  }
+
+  return info;
+}
+
+static void check_count(size_t count, char const * name) {
+
+  YAC_ASSERT_F(
+    count <= INT_MAX,
+    "ERROR(yac_alltoallv_p2p_hierarchical): %s = %zu exceeds INT_MAX (%d)",
+    name, count, (int)INT_MAX)
+}
+
+static void leader_exchange(
+  size_t const * node_counts, size_t dt_size, MPI_Datatype dt,
+  int comm_size, int node_size, struct node_info * info) {
+
+  int num_nodes = info->num_nodes;
+  int node_idx = info->node_idx;
+  int const * rank_node = info->rank_node;
+  int const * node_ranks = info->node_ranks;
+  int const * node_offsets = info->node_offsets;
+
+#define SEND_COUNT(member, rank) \
+  (node_counts[2 * (size_t)comm_size * (size_t)(member) + (size_t)(rank)])
+#define RECV_COUNT(member, rank) \
+  (node_counts[2 * (size_t)comm_size * (size_t)(member) + \
+               (size_t)comm_size + (size_t)(rank)])
+
+  // offsets of the data in the gather and scatter buffers
+  // (gather_offsets[member * comm_size + rank] -> data from member to rank)
+  // (scatter_offsets[member * comm_size + rank] -> data from rank to member)
+  size_t * offsets =
+    xmalloc(2 * (size_t)node_size * (size_t)comm_size * sizeof(*offsets));
+  size_t * gather_offsets = offsets;
+  size_t * scatter_offsets = offsets + (size_t)node_size * (size_t)comm_size;
+  size_t * member_counts = xmalloc(2 * (size_t)node_size * sizeof(*member_counts));
+  size_t * gather_counts = member_counts;
+  size_t * scatter_counts = member_counts + node_size;
+
+  // the data received from each member is sorted by node and rank
+  size_t gather_count = 0;
+  for (int m = 0; m < node_size; ++m) {
+    size_t member_count = 0;
+    for (int i = 0; i < comm_size; ++i) {
+      int rank = node_ranks[i];
+      if (rank_node[rank] == node_idx) continue;
+      gather_offsets[(size_t)m * (size_t)comm_size + (size_t)rank] =
+        gather_count + member_count;
+      member_count += SEND_COUNT(m, rank);
+    }
+    check_count(member_count, "gather_count");
+    gather_counts[m] = member_count;
+    gather_count += member_count;
+  }
+
+  // the data for and from other nodes is sorted by source member and
+  // destination member
+  size_t * node_send_counts = xcalloc(2 * (size_t)num_nodes, sizeof(*node_send_counts));
+  size_t * node_recv_counts = node_send_counts + num_nodes;
+  size_t leader_send_count = 0, leader_recv_count = 0;
+  for (int n = 0; n < num_nodes; ++n) {
+    if (n == node_idx) continue;
+    int const * remote_ranks = node_ranks + node_offsets[n];
+    int remote_size = node_offsets[n+1] - node_offsets[n];
+    for (int m = 0; m < node_size; ++m)
+      for (int r = 0; r < remote_size; ++r)
+        node_send_counts[n] += SEND_COUNT(m, remote_ranks[r]);
+    for (int r = 0; r < remote_size; ++r) {
+      for (int m = 0; m < node_size; ++m) {
+        scatter_offsets[(size_t)m * (size_t)comm_size +
+                        (size_t)remote_ranks[r]] =
+          leader_recv_count + node_recv_counts[n];
+        node_recv_counts[n] += RECV_COUNT(m, remote_ranks[r]);
+      }
+    }
+    check_count(node_send_counts[n], "node_send_counts");
+    check_count(node_recv_counts[n], "node_recv_counts");
+    leader_send_count += node_send_counts[n];
+    leader_recv_count += node_recv_counts[n];
+  }
+
+  unsigned char * gather_buffer =
+    xmalloc((gather_count + leader_send_count + 2 * leader_recv_count) *
+            dt_size);
+  unsigned char * leader_send_buffer =
+    gather_buffer + gather_count * dt_size;
+  unsigned char * leader_recv_buffer =
+    leader_send_buffer + leader_send_count * dt_size;
+  // all data received from other nodes is scattered to the members
+  unsigned char * scatter_buffer =
+    leader_recv_buffer + leader_recv_count * dt_size;
+
+  size_t max_num_req =
+    MAX((size_t)node_size, 2 * (size_t)num_nodes);
+  MPI_Request * req = xmalloc(max_num_req * sizeof(*req));
+  int req_count = 0;
+
+  // gather data from all members of the node
+  MPI_Comm node_comm = info->node_comm;
+  for (size_t m = 0, offset = 0; m < (size_t)node_size; ++m) {
+    if (gather_counts[m] > 0) {
+      yac_mpi_call(
+        MPI_Irecv(
+          gather_buffer + offset * dt_size, (int)(gather_counts[m]),
+          dt, (int)m, NODE_GATHER_TAG, node_comm, req + req_count), node_comm);
+      ++req_count;
+    }
+    offset += gather_counts[m];
+  }
+  yac_mpi_call(
+    MPI_Waitall(req_count, req, MPI_STATUSES_IGNORE), node_comm);
+  req_count = 0;
+
+  // exchange data with the leaders of the other nodes
+  MPI_Comm leader_comm = info->leader_comm;
+  size_t send_offset = 0, recv_offset = 0;
+  for (int n = 0; n < num_nodes; ++n) {
+    if (n == node_idx) continue;
+    int const * remote_ranks = node_ranks + node_offsets[n];
+    int remote_size = node_offsets[n+1] - node_offsets[n];
+    if (node_recv_counts[n] > 0) {
+      yac_mpi_call(
+        MPI_Irecv(
+          leader_recv_buffer + recv_offset * dt_size,
+          (int)(node_recv_counts[n]), dt, n, LEADER_TAG, leader_comm,
+          req + req_count), leader_comm);
+      ++req_count;
+    }
+    recv_offset += node_recv_counts[n];
+    if (node_send_counts[n] > 0) {
+      unsigned char * send_buffer =
+        leader_send_buffer + send_offset * dt_size;
+      size_t count = 0;
+      for (int m = 0; m < node_size; ++m) {
+        for (int r = 0; r < remote_size; ++r) {
+          int rank = remote_ranks[r];
+          size_t curr_count = SEND_COUNT(m, rank);
+          memcpy(
+            send_buffer + count * dt_size,
+            gather_buffer +
+              gather_offsets[(size_t)m * (size_t)comm_size + (size_t)rank] *
+              dt_size, curr_count * dt_size);
+          count += curr_count;
+        }
+      }
+      yac_mpi_call(
+        MPI_Isend(
+          send_buffer, (int)(node_send_counts[n]), dt, n, LEADER_TAG,
+          leader_comm, req + req_count), leader_comm);
+      ++req_count;
+    }
+    send_offset += node_send_counts[n];
+  }
+  yac_mpi_call(
+    MPI_Waitall(req_count, req, MPI_STATUSES_IGNORE), leader_comm);
+  req_count = 0;
+
+  // scatter data to the members of the node (sorted by node and rank)
+  for (size_t m = 0, offset = 0; m < (size_t)node_size; ++m) {
+    size_t count = 0;
+    unsigned char * member_buffer = scatter_buffer + offset * dt_size;
+    for (int i = 0; i < comm_size; ++i) {
+      int rank = node_ranks[i];
+      if (rank_node[rank] == node_idx) continue;
+      size_t curr_count = RECV_COUNT(m, rank);
+      memcpy(
+        member_buffer + count * dt_size,
+        leader_recv_buffer +
+          scatter_offsets[(size_t)m * (size_t)comm_size + (size_t)rank] *
+          dt_size, curr_count * dt_size);
+      count += curr_count;
+    }
+    check_count(count, "scatter_count");
+    scatter_counts[m] = count;
+    if (count > 0) {
+      yac_mpi_call(
+        MPI_Isend(
+          member_buffer, (int)count, dt, (int)m, NODE_SCATTER_TAG, node_comm,
+          req + req_count), node_comm);
+      ++req_count;
+    }
+    offset += count;
+  }
+  yac_mpi_call(
+    MPI_Waitall(req_count, req, MPI_STATUSES_IGNORE), node_comm);
+
+#undef RECV_COUNT
+#undef SEND_COUNT
+
+  free(req);
+  free(gather_buffer);
+  free(node_send_counts);
+  free(member_counts);
+  free(offsets);
+}
+
+static void alltoallv_p2p_hierarchical(
+  void const * send_buffer, size_t const * sendcounts, size_t const * sdispls,
+  void * recv_buffer, size_t const * recvcounts, size_t const * rdispls,
+  size_t dt_size, MPI_Datatype dt, MPI_Comm comm, struct node_info * info) {
+
+  int comm_size;
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  MPI_Comm node_comm = info->node_comm;
+  int node_rank, node_size;
+  yac_mpi_call(MPI_Comm_rank(node_comm, &node_rank), node_comm);
+  yac_mpi_call(MPI_Comm_size(node_comm, &node_size), node_comm);
+
+  int node_idx = info->node_idx;
+  int const * rank_node = info->rank_node;
+  int const * node_ranks = info->node_ranks;
+  int const * node_offsets = info->node_offsets;
+  int const * local_ranks = node_ranks + node_offsets[node_idx];
+  int is_leader = node_rank == 0;
+
+  // number of requests: direct exchange within the node, gather, scatter
+  MPI_Request * req =
+    xmalloc((2 * (size_t)node_size + 2) * sizeof(*req));
+  int req_count = 0;
+
+  // exchange data within the node directly
+  for (int i = 0; i < node_size; ++i) {
+    int rank = local_ranks[i];
+    if (sendcounts[rank] > 0) {
+      check_count(sendcounts[rank], "sendcounts");
+      yac_mpi_call(
+        MPI_Isend(
+          (void const *)((unsigned char *)send_buffer +
+                         dt_size * sdispls[rank]),
+          (int)(sendcounts[rank]), dt, rank, 0, comm, req + req_count), comm);
+      ++req_count;
+    }
+    if (recvcounts[rank] > 0) {
+      check_count(recvcounts[rank], "recvcounts");
+      yac_mpi_call(
+        MPI_Irecv(
+          (void *)((unsigned char *)recv_buffer + dt_size * rdispls[rank]),
+          (int)(recvcounts[rank]), dt, rank, 0, comm, req + req_count), comm);
+      ++req_count;
+    }
+  }
+
+  // the leader requires the counts of all processes of its node
+  size_t * local_counts = xmalloc(2 * (size_t)comm_size * sizeof(*local_counts));
+  memcpy(local_counts, sendcounts, (size_t)comm_size * sizeof(*sendcounts));
+  memcpy(local_counts + comm_size, recvcounts,
+         (size_t)comm_size * sizeof(*recvcounts));
+  size_t * node_counts =
+    is_leader?
+      xmalloc(2 * (size_t)comm_size * (size_t)node_size * sizeof(*node_counts)):
+      NULL;
+  yac_mpi_call(
+    MPI_Gather(
+      local_counts, 2 * comm_size, YAC_MPI_SIZE_T,
+      node_counts, 2 * comm_size, YAC_MPI_SIZE_T, 0, node_comm), node_comm);
+
+  // pack data for other nodes (sorted by node and rank) and send it to
+  // the leader
+  size_t gather_send_count = 0, scatter_recv_count = 0;
+  for (int i = 0; i < comm_size; ++i) {
+    if (rank_node[i] == node_idx) continue;
+    gather_send_count += sendcounts[i];
+    scatter_recv_count += recvcounts[i];
+  }
+  check_count(gather_send_count, "gather_send_count");
+  check_count(scatter_recv_count, "scatter_recv_count");
+  unsigned char * gather_send_buffer =
+    xmalloc((gather_send_count + scatter_recv_count) * dt_size);
+  unsigned char * scatter_recv_buffer =
+    gather_send_buffer + gather_send_count * dt_size;
+  {
+    size_t offset = 0;
+    for (int i = 0; i < comm_size; ++i) {
+      int rank = node_ranks[i];
+      if (rank_node[rank] == node_idx) continue;
+      size_t count = sendcounts[rank] * dt_size;
+      memcpy(
+        gather_send_buffer + offset,
+        (unsigned char const *)send_buffer + dt_size * sdispls[rank], count);
+      offset += count;
+    }
+  }
+  if (gather_send_count > 0) {
+    yac_mpi_call(
+      MPI_Isend(
+        gather_send_buffer, (int)gather_send_count, dt, 0, NODE_GATHER_TAG,
+        node_comm, req + req_count), node_comm);
+    ++req_count;
+  }
+  if (scatter_recv_count > 0) {
+    yac_mpi_call(
+      MPI_Irecv(
+        scatter_recv_buffer, (int)scatter_recv_count, dt, 0, NODE_SCATTER_TAG,
+        node_comm, req + req_count), node_comm);
+    ++req_count;
+  }
+
+  if (is_leader)
+    leader_exchange(
+      node_counts, dt_size, dt, comm_size, node_size, info);
+
+  yac_mpi_call(MPI_Waitall(req_count, req, MPI_STATUSES_IGNORE), comm);
+
+  // unpack data from other nodes
+  {
+    size_t offset = 0;
+    for (int i = 0; i < comm_size; ++i) {
+      int rank = node_ranks[i];
+      if (rank_node[rank] == node_idx) continue;
+      size_t count = recvcounts[rank] * dt_size;
+      memcpy(
+        (unsigned char *)recv_buffer + dt_size * rdispls[rank],
+        scatter_recv_buffer + offset, count);
+      offset += count;
+    }
+  }
+
+  free(gather_send_buffer);
+  free(node_counts);
+  free(local_counts);
+  free(req);
+}
+
 void yac_alltoallv_p2p(
   void const * send_buffer, size_t const * sendcounts, size_t const * sdispls,
   void * recv_buffer, size_t const * recvcounts, size_t const * rdispls,
   size_t dt_size, MPI_Datatype dt, MPI_Comm comm) {
 
-#define USE_P2P_ALLTOALLV
-#ifdef USE_P2P_ALLTOALLV
   int comm_rank, comm_size;
   yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
   yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
 
+  uint64_t send_size = 0;
+  for (int i = 0; i < comm_size; ++i)
+    if (i != comm_rank) send_size += (uint64_t)(sendcounts[i] * dt_size);
+  yac_setup_stats_add(YAC_SETUP_COUNTER_BYTES_EXCHANGED, send_size);
+
+#define USE_P2P_ALLTOALLV
+#ifdef USE_P2P_ALLTOALLV
+
+  struct node_info * node_info = get_node_info(comm);
+  if (node_info->use_hierarchical) {
+    alltoallv_p2p_hierarchical(
+      send_buffer, sendcounts, sdispls, recv_buffer, recvcounts, rdispls,
+      dt_size, dt, comm, node_info);
+    return;
+  }
+
   int req_count = 0;
   for (int i = 0; i < comm_size; ++i)
     req_count += (sendcounts[i] > 0) + (recvcounts[i] > 0);
@@ -132,8 +678,6 @@ void yac_alltoallv_p2p(
   yac_mpi_call(MPI_Waitall(req_count, req, MPI_STATUSES_IGNORE), comm);
   free(req);
 #else // USE_P2P_ALLTOALLV
-  int comm_size;
-  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
   int * int_buffer = xmalloc(4 * comm_size * sizeof(*int_buffer));
   int * int_sendcounts = int_buffer + 0 * comm_size;
   int * int_sdispls    = int_buffer + 1 * comm_size;
@@ -168,6 +712,19 @@ void yac_alltoallv_p2p(
 #endif // USE_P2P_ALLTOALLV
 }
 
+void yac_bcast_string(char ** string, MPI_Comm comm) {
+
+  int rank;
+  yac_mpi_call(MPI_Comm_rank(comm, &rank), comm);
+
+  int len = ((rank == 0) && (*string != NULL))?((int)strlen(*string) + 1):0;
+  yac_mpi_call(MPI_Bcast(&len, 1, MPI_INT, 0, comm), comm);
+
+  if (rank != 0) *string = (len > 0)?xmalloc((size_t)len):NULL;
+  if (len > 0)
+    yac_mpi_call(MPI_Bcast(*string, len, MPI_CHAR, 0, comm), comm);
+}
+
 #define YAC_ALLTOALL_P2P_TYPE(NAME, TYPE, TYPE_SIZE, MPI_TYPE) \
   void yac_alltoallv_ ## NAME ## _p2p( \
     TYPE const * send_buffer, size_t const * sendcounts, size_t const * sdispls, \
@@ -196,6 +753,11 @@ void yac_alltoallv_p2p_group(
   yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
   int rank = comm_rank - group_comm.start;
 
+  uint64_t send_size = 0;
+  for (int i = 0; i < group_comm.size; ++i)
+    if (i != rank) send_size += (uint64_t)sendcounts[i] * (uint64_t)dt_size;
+  yac_setup_stats_add(YAC_SETUP_COUNTER_BYTES_EXCHANGED, send_size);
+
   int req_count = 0;
   for (int i = 0; i < group_comm.size; ++i)
     req_count += (sendcounts[i] > 0) + (recvcounts[i] > 0);
@@ -652,6 +1214,9 @@ void yac_mpi_cleanup() {
     free(comm_buffer);
     comm_buffer = NULL;
     comm_buffer_array_size = 0;
+    if (node_info_keyval != MPI_KEYVAL_INVALID)
+      yac_mpi_call(
+        MPI_Comm_free_keyval(&node_info_keyval), MPI_COMM_WORLD);
   }
   init_count--;
   yac_yaxt_cleanup();
@@ -113,6 +113,39 @@ YAC_ALLTOALLV_P2P_DEC(size_t, size_t)
 
 #undef YAC_ALLTOALLV_P2P_DEC
 
+/**
+ * name of the environment variable through which the minimum communicator
+ * size for the hierarchical variant of \ref yac_alltoallv_p2p can be set
+ * (default: 2048, -1: hierarchical exchange is disabled)
+ */
+#define YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV \
+  "YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE"
+
+/**
+ * name of the environment variable through which the maximum number of
+ * processes per node for the hierarchical variant of \ref yac_alltoallv_p2p
+ * can be set, shared memory nodes with more processes are split into
+ * multiple groups (default: -1, nodes are not split)
+ */
+#define YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV \
+  "YAC_ALLTOALLV_MAX_RANKS_PER_NODE"
+
+/**
+ * exchanges data between all processes of a communicator
+ * (same arguments as MPI_Alltoallv, but counts and displacements are
+ * of type size_t)
+ *
+ * For communicators with at least
+ * \ref YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV processes spanning multiple
+ * shared memory nodes, data for other nodes is aggregated by one leader
+ * process per node, exchanged between the leaders, and scattered within the
+ * destination node. This reduces the number of messages from
+ * O(comm_size^2) to O(num_nodes^2) at the cost of an additional copy.
+ * The node layout is determined on first use and cached with the
+ * communicator.
+ * @remark the environment is evaluated on rank 0 of each communicator
+ *         when it is used for the first time
+ */
 void yac_alltoallv_p2p(
   void const * send_buffer, size_t const * sendcounts, size_t const * sdispls,
   void * recv_buffer, size_t const * recvcounts, size_t const * rdispls,
@@ -123,6 +156,14 @@ void yac_alltoallv_p2p_group(
   void * recv_buffer, int const * recvcounts, int const * rdispls,
   size_t dt_size, MPI_Datatype dt, struct yac_group_comm group_comm);
 
+/**
+ * broadcasts a string from the root process (rank 0) to all other processes
+ * @param[in,out] string string (NULL is a valid value), on non-root
+ *                       processes a copy of the string is allocated
+ * @param[in]     comm   communicator
+ */
+void yac_bcast_string(char ** string, MPI_Comm comm);
+
 void yac_allreduce_sum_dble(
   double * buffer, int count, struct yac_group_comm group_comm);
 
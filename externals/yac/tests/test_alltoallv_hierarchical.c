@@ -0,0 +1,193 @@
+/**
+ * @file test_alltoallv_hierarchical.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <mpi.h>
+
+#include "tests.h"
+#include "yac_mpi.h"
+
+// tests the direct and the hierarchical variant of yac_alltoallv_p2p
+
+static size_t get_count(int src, int dst, int type) {
+  return (size_t)((src * 7 + dst * 3 + type) % 5);
+}
+
+static int get_value(int src, int dst, size_t k) {
+  return (src * 1000 + dst) * 10 + (int)k;
+}
+
+static void check_alltoallv(MPI_Comm comm);
+
+int main (void) {
+
+  MPI_Init(NULL, NULL);
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
+
+  if (comm_size != 9) {
+
+    PUT_ERR("ERROR: wrong number of processes\n");
+    return TEST_EXIT_CODE;
+  }
+
+  // default configuration (direct exchange for small communicators)
+  {
+    MPI_Comm comm;
+    yac_mpi_call(MPI_Comm_dup(MPI_COMM_WORLD, &comm), MPI_COMM_WORLD);
+    check_alltoallv(comm);
+    check_alltoallv(comm);
+    yac_mpi_call(MPI_Comm_free(&comm), MPI_COMM_WORLD);
+  }
+
+  // hierarchical exchange with emulated nodes of different sizes
+  // (with one process per node the direct exchange is used)
+  char const * max_ranks_per_node[] = {"1", "2", "3", "4", "8", "-1"};
+  enum {
+    NUM_CONFIGS = sizeof(max_ranks_per_node) / sizeof(max_ranks_per_node[0])};
+
+  for (int i = 0; i < NUM_CONFIGS; ++i) {
+
+    if (comm_rank == 0) {
+      setenv(YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV, "0", 1);
+      setenv(YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV, max_ranks_per_node[i], 1);
+    }
+
+    MPI_Comm comm;
+    yac_mpi_call(MPI_Comm_dup(MPI_COMM_WORLD, &comm), MPI_COMM_WORLD);
+    check_alltoallv(comm);
+    check_alltoallv(comm);
+    yac_mpi_call(MPI_Comm_free(&comm), MPI_COMM_WORLD);
+
+    if (comm_rank == 0) {
+      unsetenv(YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV);
+      unsetenv(YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV);
+    }
+  }
+
+  // hierarchical exchange is disabled
+  {
+    if (comm_rank == 0) {
+      setenv(YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV, "-1", 1);
+      setenv(YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV, "2", 1);
+    }
+    MPI_Comm comm;
+    yac_mpi_call(MPI_Comm_dup(MPI_COMM_WORLD, &comm), MPI_COMM_WORLD);
+    check_alltoallv(comm);
+    yac_mpi_call(MPI_Comm_free(&comm), MPI_COMM_WORLD);
+    if (comm_rank == 0) {
+      unsetenv(YAC_ALLTOALLV_HIERARCHICAL_MIN_SIZE_ENV);
+      unsetenv(YAC_ALLTOALLV_MAX_RANKS_PER_NODE_ENV);
+    }
+  }
+
+  MPI_Finalize();
+
+  return TEST_EXIT_CODE;
+}
+
+static void check_alltoallv(MPI_Comm comm) {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  // the test is done for two data types
+  for (int type = 0; type < 2; ++type) {
+
+    size_t * sendcounts = xmalloc(4 * (size_t)comm_size * sizeof(*sendcounts));
+    size_t * recvcounts = sendcounts + 1 * comm_size;
+    size_t * sdispls = sendcounts + 2 * comm_size;
+    size_t * rdispls = sendcounts + 3 * comm_size;
+
+    size_t send_count = 0, recv_count = 0;
+    for (int i = 0; i < comm_size; ++i) {
+      sendcounts[i] = get_count(comm_rank, i, type);
+      recvcounts[i] = get_count(i, comm_rank, type);
+      sdispls[i] = send_count;
+      rdispls[i] = recv_count;
+      send_count += sendcounts[i];
+      recv_count += recvcounts[i];
+    }
+
+    if (type == 0) {
+
+      int * send_buffer = xmalloc(send_count * sizeof(*send_buffer));
+      int * recv_buffer = xmalloc(recv_count * sizeof(*recv_buffer));
+      for (int i = 0; i < comm_size; ++i)
+        for (size_t k = 0; k < sendcounts[i]; ++k)
+          send_buffer[sdispls[i] + k] = get_value(comm_rank, i, k);
+      for (size_t i = 0; i < recv_count; ++i) recv_buffer[i] = -1;
+
+      yac_alltoallv_int_p2p(
+        send_buffer, sendcounts, sdispls,
+        recv_buffer, recvcounts, rdispls, comm);
+
+      for (int i = 0; i < comm_size; ++i)
+        for (size_t k = 0; k < recvcounts[i]; ++k)
+          if (recv_buffer[rdispls[i] + k] != get_value(i, comm_rank, k))
+            PUT_ERR("ERROR in yac_alltoallv_int_p2p");
+
+      free(recv_buffer);
+      free(send_buffer);
+
+    } else {
+
+      double * send_buffer = xmalloc(send_count * sizeof(*send_buffer));
+      double * recv_buffer = xmalloc(recv_count * sizeof(*recv_buffer));
+      for (int i = 0; i < comm_size; ++i)
+        for (size_t k = 0; k < sendcounts[i]; ++k)
+          send_buffer[sdispls[i] + k] =
+            (double)get_value(comm_rank, i, k) + 0.5;
+      for (size_t i = 0; i < recv_count; ++i) recv_buffer[i] = -1.0;
+
+      yac_alltoallv_dble_p2p(
+        send_buffer, sendcounts, sdispls,
+        recv_buffer, recvcounts, rdispls, comm);
+
+      for (int i = 0; i < comm_size; ++i)
+        for (size_t k = 0; k < recvcounts[i]; ++k)
+          if (recv_buffer[rdispls[i] + k] !=
+              (double)get_value(i, comm_rank, k) + 0.5)
+            PUT_ERR("ERROR in yac_alltoallv_dble_p2p");
+
+      free(recv_buffer);
+      free(send_buffer);
+    }
+
+    free(sendcounts);
+  }
+}
@@ -706,6 +706,85 @@ int main (void) {
     yac_free_grid_cell(&Tri);
   }
 
+  { // compare yac_huiliers_area_batch against yac_huiliers_area for cells
+    // of different sizes, shapes, and orientations (the number of triangles
+    // exceeds the internal block size of yac_huiliers_area_batch)
+
+    enum {NUM_CELLS = 600, MAX_NUM_CORNERS = 8};
+    double radii[] = {1e-7, 1e-5, 1e-3, 1e-1, 0.5};
+    enum {NUM_RADII = sizeof(radii) / sizeof(radii[0])};
+
+    size_t * num_corners = xmalloc(NUM_CELLS * sizeof(*num_corners));
+    double * coords =
+      xmalloc(3 * NUM_CELLS * MAX_NUM_CORNERS * sizeof(*coords));
+    double * x = coords;
+    double * y = x + NUM_CELLS * MAX_NUM_CORNERS;
+    double * z = y + NUM_CELLS * MAX_NUM_CORNERS;
+    double * ref_areas = xmalloc(NUM_CELLS * sizeof(*ref_areas));
+    double * areas = xmalloc(NUM_CELLS * sizeof(*areas));
+    enum yac_edge_type edge_types[MAX_NUM_CORNERS];
+    for (int i = 0; i < MAX_NUM_CORNERS; ++i)
+      edge_types[i] = GREAT_CIRCLE_EDGE;
+
+    srand(1337);
+    size_t offset = 0;
+    for (size_t i = 0; i < NUM_CELLS; ++i) {
+
+      // cells have 0 to MAX_NUM_CORNERS corners
+      num_corners[i] = i % (MAX_NUM_CORNERS + 1);
+      double radius = radii[i % NUM_RADII];
+      double center[3], e1[3], e2[3];
+      LLtoXYZ(
+        2.0 * M_PI * ((double)rand() / (double)RAND_MAX),
+        0.99 * M_PI * ((double)rand() / (double)RAND_MAX - 0.5), center);
+      crossproduct_kahan(center, (double[3]){0.0,0.0,1.0}, e1);
+      normalise_vector(e1);
+      crossproduct_kahan(center, e1, e2);
+      normalise_vector(e2);
+      double orientation = (i & 1)?1.0:-1.0;
+
+      for (size_t j = 0; j < num_corners[i]; ++j) {
+        // every third cell is concave
+        double r = ((i % 3 == 0) && (j & 1))?(0.4 * radius):radius;
+        double angle =
+          orientation * 2.0 * M_PI * (double)j / (double)num_corners[i];
+        double sin_r = sin(r), cos_r = cos(r);
+        double p[3];
+        for (int k = 0; k < 3; ++k)
+          p[k] = center[k] * cos_r +
+                 (e1[k] * cos(angle) + e2[k] * sin(angle)) * sin_r;
+        normalise_vector(p);
+        x[offset + j] = p[0];
+        y[offset + j] = p[1];
+        z[offset + j] = p[2];
+      }
+
+      double cell_coords[MAX_NUM_CORNERS][3];
+      for (size_t j = 0; j < num_corners[i]; ++j) {
+        cell_coords[j][0] = x[offset + j];
+        cell_coords[j][1] = y[offset + j];
+        cell_coords[j][2] = z[offset + j];
+      }
+      ref_areas[i] =
+        yac_huiliers_area(
+          (struct grid_cell){.coordinates_xyz = cell_coords,
+                             .edge_type = edge_types,
+                             .num_corners = num_corners[i]});
+      offset += num_corners[i];
+    }
+
+    yac_huiliers_area_batch(NUM_CELLS, num_corners, x, y, z, areas);
+
+    for (size_t i = 0; i < NUM_CELLS; ++i)
+      if (fabs(areas[i] - ref_areas[i]) > MAX(ref_areas[i] * 1e-10, 1e-24))
+        PUT_ERR("ERROR in yac_huiliers_area_batch");
+
+    free(areas);
+    free(ref_areas);
+    free(coords);
+    free(num_corners);
+  }
+
   return TEST_EXIT_CODE;
 }
 
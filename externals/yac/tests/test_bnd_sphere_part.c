@@ -45,6 +45,10 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <float.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "tests.h"
 #include "test_common.h"
@@ -57,6 +61,7 @@ static void random_test_big(size_t count);
 static void empty_test();
 static void zero_balance_point();
 static void mean_point_test();
+static void large_test(size_t count, size_t num_queries);
 
 int main(void) {
 
@@ -72,6 +77,7 @@ int main(void) {
   empty_test();
   zero_balance_point();
   mean_point_test();
+  large_test(40000, 200);
 
   return TEST_EXIT_CODE;
 }
@@ -347,3 +353,118 @@ static void mean_point_test() {
   free(results);
   yac_bnd_sphere_part_search_delete(search);
 }
+
+static void large_test_search(
+  struct bounding_circle * bnd_circles, size_t count,
+  double (*point_coords)[3], struct bounding_circle * query_circles,
+  size_t num_queries, size_t ** point_results, size_t * num_point_results,
+  size_t ** circle_results, size_t * num_circle_results) {
+
+  struct bnd_sphere_part_search * search =
+    yac_bnd_sphere_part_search_new(bnd_circles, count);
+  yac_bnd_sphere_part_search_do_point_search(
+    search, point_coords, num_queries, point_results, num_point_results);
+  yac_bnd_sphere_part_search_do_bnd_circle_search(
+    search, query_circles, num_queries, circle_results, num_circle_results);
+  yac_bnd_sphere_part_search_delete(search);
+}
+
+// large enough for the tree to be generated in parallel (if OpenMP is
+// available)
+static void large_test(size_t count, size_t num_queries) {
+
+  struct bounding_circle * bnd_circles =
+    xmalloc((count + num_queries) * sizeof(*bnd_circles));
+  struct bounding_circle * query_circles = bnd_circles + count;
+  double (*point_coords)[3] = xmalloc(num_queries * sizeof(*point_coords));
+
+  for (size_t i = 0; i < count + num_queries; ++i) {
+    gen_random_point(bnd_circles[i].base_vector);
+    double angle = 0.05 * (((double)rand()) / ((double)RAND_MAX));
+    bnd_circles[i].inc_angle = sin_cos_angle_new(sin(angle), cos(angle));
+    bnd_circles[i].sq_crd = DBL_MAX;
+  }
+  for (size_t i = 0; i < num_queries; ++i) gen_random_point(point_coords[i]);
+
+  size_t * point_results, * circle_results;
+  size_t * num_results = xmalloc(2 * num_queries * sizeof(*num_results));
+  size_t * num_point_results = num_results;
+  size_t * num_circle_results = num_results + num_queries;
+
+  large_test_search(
+    bnd_circles, count, point_coords, query_circles, num_queries,
+    &point_results, num_point_results, &circle_results, num_circle_results);
+
+  size_t * ref_results = xmalloc(count * sizeof(*ref_results));
+  size_t total_num_point_results = 0, total_num_circle_results = 0;
+  for (size_t i = 0; i < num_queries; ++i) {
+
+    size_t ref_num_results = 0;
+    for (size_t j = 0; j < count; ++j)
+      if (yac_point_in_bounding_circle_vec(point_coords[i], bnd_circles + j))
+        ref_results[ref_num_results++] = j;
+    if ((ref_num_results > num_point_results[i]) ||
+        check_results(
+          point_results + total_num_point_results, num_point_results[i],
+          ref_results, ref_num_results))
+      PUT_ERR("ERROR in yac_bnd_sphere_part_search_do_point_search");
+    total_num_point_results += num_point_results[i];
+
+    ref_num_results = 0;
+    for (size_t j = 0; j < count; ++j)
+      if (yac_extents_overlap(query_circles + i, bnd_circles + j))
+        ref_results[ref_num_results++] = j;
+    if ((ref_num_results > num_circle_results[i]) ||
+        check_results(
+          circle_results + total_num_circle_results, num_circle_results[i],
+          ref_results, ref_num_results))
+      PUT_ERR("ERROR in yac_bnd_sphere_part_search_do_bnd_circle_search");
+    total_num_circle_results += num_circle_results[i];
+  }
+  free(ref_results);
+
+#ifdef _OPENMP
+  { // the tree (and with it the order of the unsorted search results) has to
+    // be independent of the number of threads
+
+    // sorted by check_results
+    free(point_results);
+    free(circle_results);
+    large_test_search(
+      bnd_circles, count, point_coords, query_circles, num_queries,
+      &point_results, num_point_results, &circle_results, num_circle_results);
+
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+
+    size_t * serial_point_results, * serial_circle_results;
+    size_t * serial_num_results =
+      xmalloc(2 * num_queries * sizeof(*serial_num_results));
+    large_test_search(
+      bnd_circles, count, point_coords, query_circles, num_queries,
+      &serial_point_results, serial_num_results, &serial_circle_results,
+      serial_num_results + num_queries);
+
+    omp_set_num_threads(max_threads);
+
+    if (memcmp(num_results, serial_num_results,
+               2 * num_queries * sizeof(*num_results)) ||
+        memcmp(point_results, serial_point_results,
+               total_num_point_results * sizeof(*point_results)) ||
+        memcmp(circle_results, serial_circle_results,
+               total_num_circle_results * sizeof(*circle_results)))
+      PUT_ERR("ERROR in yac_bnd_sphere_part_search_new: "
+              "tree depends on number of threads");
+
+    free(serial_num_results);
+    free(serial_circle_results);
+    free(serial_point_results);
+  }
+#endif
+
+  free(circle_results);
+  free(point_results);
+  free(num_results);
+  free(point_coords);
+  free(bnd_circles);
+}
@@ -172,4 +172,5 @@ void clear_yac_io_env() {
   unsetenv("YAC_IO_MAX_NUM_RANKS");
   unsetenv("YAC_IO_RANK_EXCLUDE_LIST");
   unsetenv("YAC_IO_MAX_NUM_RANKS_PER_NODE");
+  unsetenv("YAC_IO_PARALLEL_NETCDF");
 }
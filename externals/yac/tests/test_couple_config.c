@@ -124,7 +124,7 @@ int main(void) {
     yac_couple_config_def_couple(
       couple_config, "comp_a", "grid_a", "field_a",
       "comp_b", "grid_b", "field_b", "1", YAC_REDUCTION_TIME_NONE,
-      interp_stack_config, 0, 0, NULL, 0, 1.0, 0.0, 0, NULL, NULL);
+      interp_stack_config, 0, 0, NULL, 0, 1.0, 0.0, 0, NULL, NULL, 0, 0.0);
     yac_interp_stack_config_delete(interp_stack_config);
     yac_couple_config_add_component(
       couple_config, (rank == 0)?"comp_c":"comp_d");
@@ -635,7 +635,7 @@ static struct yac_couple_config * generate_couple_config_from_YAML_parallel(
       yac_time_to_ISO("60", YAC_TIME_UNIT_SECOND), TIME_NONE,
       interp_stack, 0, 0, NULL, 0, 9.0/5.0, 32.0,
       2, (char const *[]){"src_mask1", "src_mask2"},
-      "tgt_mask");
+      "tgt_mask", 0, 0.0);
     yac_interp_stack_config_delete(interp_stack);
   } else if (rank == 1) {
     yac_couple_config_component_add_field(
@@ -0,0 +1,280 @@
+/**
+ * @file test_dynamic_masks_c.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <yaxt.h>
+#include "tests.h"
+#include "yac_interface.h"
+
+#define YAC_RAD (0.01745329251994329576923690768489) // M_PI / 180
+
+/* This test checks the update of source and target masks after the end of
+ * the definition phase. The source component comp_A has two cells, the
+ * target component comp_B has two cells. A nearest neighbour interpolation
+ * is used for the coupling of multiple fields, which differ in mapping side
+ * and precision. */
+
+#define NUM_STEPS (6)
+#define NUM_FIELDS (3)
+#define NO_VALUE (-1.0)
+
+static char const * field_names[NUM_FIELDS] =
+  {"A_to_B", "A_to_B_src", "A_to_B_float"};
+static int mapping_sides[NUM_FIELDS] = {0, 1, 0};
+static int use_single_precision[NUM_FIELDS] = {0, 0, 1};
+
+static int src_masks[NUM_STEPS][2] =
+  {{1,1}, {1,0}, {1,0}, {1,1}, {1,1}, {0,1}};
+static int tgt_masks[NUM_STEPS][2] =
+  {{1,1}, {1,1}, {0,1}, {0,1}, {1,1}, {1,1}};
+static double ref_tgt_field[NUM_STEPS][2] =
+  {{4.0, 3.0},
+   {3.0, 3.0},       // source cell 1 is masked
+   {NO_VALUE, 3.0},  // target cell 0 is masked
+   {NO_VALUE, 3.0},  // source cell 1 becomes valid again
+   {4.0, 3.0},       // target cell 0 becomes valid again
+   {4.0, 4.0}};      // source cell 0 is masked
+
+static void run_comp_a(void);
+static void run_comp_b(void);
+
+int main (void) {
+
+  MPI_Init(NULL, NULL);
+  xt_initialize(MPI_COMM_WORLD);
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  switch(rank) {
+    case(0):
+      run_comp_a();
+      break;
+    case(1):
+      run_comp_b();
+      break;
+    default:
+      PUT_ERR("wrong number of processes (has to be 2)");
+      break;
+  }
+
+  xt_finalize();
+  MPI_Finalize();
+  return TEST_EXIT_CODE;
+}
+
+static void run_comp_a(void) {
+
+  // initialise YAC default instance
+  yac_cinit();
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+  yac_cdef_datetime("2000-01-01T00:00:00", "2000-01-01T00:00:12");
+  yac_cenable_dynamic_masks();
+
+  // define local component
+  int comp_id;
+  yac_cdef_comp("comp_A", &comp_id);
+
+  int nbr_vertices = 4;
+  int nbr_cells = 2;
+  int nbr_vertices_per_cell[2] = {3,3};
+  double x_vertices[4] =
+    {0.0 * YAC_RAD, -1.0 * YAC_RAD, 1.0 * YAC_RAD, 0.0 * YAC_RAD};
+  double y_vertices[4] =
+    {1.0 * YAC_RAD, 0.0 * YAC_RAD, 0.0 * YAC_RAD, -1.0 * YAC_RAD};
+  int cell_to_vertex[6] = {0,1,2, 1,3,2};
+
+  /* define local grid
+
+      0
+     / \
+    / o \
+   /     \
+  1-------2   Eq.
+   \     /
+    \ o /
+     \ /
+      3
+
+  */
+  int grid_id;
+  yac_cdef_grid_unstruct(
+    "grid_A", nbr_vertices, nbr_cells, nbr_vertices_per_cell,
+    x_vertices, y_vertices, cell_to_vertex, &grid_id);
+
+  double x_cells[2] = {0.0 * YAC_RAD, 0.0 * YAC_RAD};
+  double y_cells[2] = {0.5 * YAC_RAD, -0.5 * YAC_RAD};
+
+  int cell_point_id;
+  yac_cdef_points_unstruct(
+    grid_id, nbr_cells, YAC_LOCATION_CELL, x_cells, y_cells, &cell_point_id);
+
+  int cell_mask_id;
+  yac_cdef_mask(
+    grid_id, nbr_cells, YAC_LOCATION_CELL, src_masks[0], &cell_mask_id);
+
+  // define fields
+  int field_ids[NUM_FIELDS];
+  int collection_size = 1;
+  for (int i = 0; i < NUM_FIELDS; ++i)
+    yac_cdef_field_mask(
+      field_names[i], comp_id, &cell_point_id, &cell_mask_id, 1,
+      collection_size, "1", YAC_TIME_UNIT_SECOND, &field_ids[i]);
+
+  // generate coupling
+  yac_cenddef();
+
+  for (int step = 0; step < NUM_STEPS; ++step) {
+
+    if (step > 0) {
+      yac_cupdate_mask(cell_mask_id, src_masks[step]);
+      yac_cupdate_interpolations();
+    }
+
+    double send_field_data[2] = {3.0, 4.0};
+    double * send_field_[1] = {&send_field_data[0]};
+    double ** send_field[1] = {&send_field_[0]};
+    for (int i = 0; i < NUM_FIELDS; ++i) {
+      int info, ierror;
+      yac_cput(field_ids[i], collection_size, send_field, &info, &ierror);
+    }
+  }
+
+  // finalise YAC default instance
+  yac_cfinalize();
+}
+
+static void run_comp_b(void) {
+
+  // initialise YAC default instance
+  yac_cinit();
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+  yac_cdef_datetime("2000-01-01T00:00:00", "2000-01-01T00:00:12");
+  yac_cenable_dynamic_masks();
+
+  // define local component
+  int comp_id;
+  yac_cdef_comp("comp_B", &comp_id);
+
+  int nbr_vertices[2] = {2,3};
+  int cyclic[2] = {0,0};
+  double x_vertices[2] = {-0.5 * YAC_RAD, 0.5 * YAC_RAD};
+  double y_vertices[3] = {-1.0 * YAC_RAD, 0.0 * YAC_RAD, 1.0 * YAC_RAD};
+
+  /* define local grid
+
+  4-------5
+  |       |
+  |   o   |
+  |       |
+  2-------3
+  |       |
+  |   o   |
+  |       |
+  0-------1
+
+  */
+  int grid_id;
+  yac_cdef_grid_reg2d(
+    "grid_B", nbr_vertices, cyclic, x_vertices, y_vertices, &grid_id);
+
+  int nbr_cells[2] = {1,2};
+  double x_cells[1] = {0.0 * YAC_RAD};
+  double y_cells[2] = {-0.5 * YAC_RAD, 0.5 * YAC_RAD};
+
+  int cell_point_id;
+  yac_cdef_points_reg2d(
+    grid_id, nbr_cells, YAC_LOCATION_CELL, x_cells, y_cells, &cell_point_id);
+
+  int cell_mask_id;
+  yac_cdef_mask(
+    grid_id, 2, YAC_LOCATION_CELL, tgt_masks[0], &cell_mask_id);
+
+  // define fields
+  int field_ids[NUM_FIELDS];
+  int collection_size = 1;
+  for (int i = 0; i < NUM_FIELDS; ++i)
+    yac_cdef_field_mask(
+      field_names[i], comp_id, &cell_point_id, &cell_mask_id, 1,
+      collection_size, "1", YAC_TIME_UNIT_SECOND, &field_ids[i]);
+
+  // define interpolation stack
+  int interp_stack;
+  yac_cget_interp_stack_config(&interp_stack);
+  yac_cadd_interp_stack_config_nnn(interp_stack, YAC_NNN_AVG, 1, 0.0);
+
+  // define couplings
+  for (int i = 0; i < NUM_FIELDS; ++i) {
+    int ext_couple_config;
+    yac_cget_ext_couple_config(&ext_couple_config);
+    yac_cset_ext_couple_config_mapping_side(
+      ext_couple_config, mapping_sides[i]);
+    yac_cset_ext_couple_config_use_single_precision(
+      ext_couple_config, use_single_precision[i]);
+    yac_cdef_couple_custom(
+      "comp_A", "grid_A", field_names[i], "comp_B", "grid_B", field_names[i],
+      "PT01.000S", YAC_TIME_UNIT_ISO_FORMAT, YAC_REDUCTION_TIME_NONE,
+      interp_stack, 0, 0, ext_couple_config);
+    yac_cfree_ext_couple_config(ext_couple_config);
+  }
+  yac_cfree_interp_stack_config(interp_stack);
+
+  // generate coupling
+  yac_cenddef();
+
+  for (int step = 0; step < NUM_STEPS; ++step) {
+
+    if (step > 0) {
+      yac_cupdate_mask(cell_mask_id, tgt_masks[step]);
+      yac_cupdate_interpolations();
+    }
+
+    for (int i = 0; i < NUM_FIELDS; ++i) {
+
+      double recv_field_data[2] = {NO_VALUE, NO_VALUE};
+      double * recv_field[1] = {&recv_field_data[0]};
+      int info, ierror;
+      yac_cget(field_ids[i], collection_size, recv_field, &info, &ierror);
+
+      for (int j = 0; j < 2; ++j)
+        if (recv_field_data[j] != ref_tgt_field[step][j])
+          PUT_ERR("ERROR: wrong results after mask update");
+    }
+  }
+
+  // finalise YAC default instance
+  yac_cfinalize();
+}
@@ -0,0 +1,108 @@
+/**
+ * @file test_id_hash.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "tests.h"
+#include "id_hash.h"
+#include "utils.h"
+
+int main(void) {
+
+  { // empty hash index
+
+    struct yac_id_hash * hash = yac_id_hash_new(0);
+
+    size_t idx = 13;
+    if (yac_id_hash_get_count(hash) != 0) PUT_ERR("wrong count");
+    if (yac_id_hash_lookup(hash, 0, &idx)) PUT_ERR("found missing id");
+    if (idx != 13) PUT_ERR("idx was changed");
+
+    yac_id_hash_delete(hash);
+  }
+
+  { // hash index from an array of ids (including negative, large and
+    // consecutive ids)
+
+    enum {NUM_IDS = 1000};
+    yac_int ids[NUM_IDS];
+    for (size_t i = 0; i < NUM_IDS; ++i)
+      ids[i] = (i & 1)?((yac_int)i * 7919):-(yac_int)i - 1;
+    ids[0] = XT_INT_MAX;
+
+    struct yac_id_hash * hash = yac_id_hash_new_from_ids(ids, NUM_IDS);
+
+    if (yac_id_hash_get_count(hash) != NUM_IDS) PUT_ERR("wrong count");
+
+    for (size_t i = 0; i < NUM_IDS; ++i) {
+      size_t idx = SIZE_MAX;
+      if (!yac_id_hash_lookup(hash, ids[i], &idx) || (idx != i))
+        PUT_ERR("error in yac_id_hash_lookup");
+    }
+    for (size_t i = 0; i < NUM_IDS; ++i) {
+      size_t idx = SIZE_MAX;
+      if (yac_id_hash_lookup(hash, (yac_int)(2 * i + 2) * 7919, &idx) ||
+          (idx != SIZE_MAX))
+        PUT_ERR("error in yac_id_hash_lookup");
+    }
+
+    yac_id_hash_delete(hash);
+  }
+
+  { // incremental insertion (with resizing) and duplicated ids
+
+    struct yac_id_hash * hash = yac_id_hash_new(1);
+
+    enum {NUM_IDS = 5000};
+    for (size_t i = 0; i < NUM_IDS; ++i)
+      if (yac_id_hash_insert(hash, (yac_int)(i * 3), i) != i)
+        PUT_ERR("error in yac_id_hash_insert");
+    for (size_t i = 0; i < NUM_IDS; ++i)
+      if (yac_id_hash_insert(hash, (yac_int)(i * 3), NUM_IDS + i) != i)
+        PUT_ERR("error in yac_id_hash_insert (duplicated id)");
+
+    if (yac_id_hash_get_count(hash) != NUM_IDS) PUT_ERR("wrong count");
+
+    for (size_t i = 0; i < 3 * NUM_IDS; ++i) {
+      size_t idx;
+      int found = yac_id_hash_lookup(hash, (yac_int)i, &idx);
+      if (found != ((i % 3) == 0)) PUT_ERR("error in yac_id_hash_lookup");
+      if (found && (idx != i / 3)) PUT_ERR("error in yac_id_hash_lookup");
+    }
+
+    yac_id_hash_delete(hash);
+  }
+
+  return TEST_EXIT_CODE;
+}
@@ -331,7 +331,7 @@ static void run_test_configuration(struct field_config test_config[2][3][4]) {
           instance, src_comp_name, src_grid_name, field_name,
           tgt_comp_name, tgt_grid_name, field_name,
           coupling_period, YAC_REDUCTION_TIME_NONE, interp_stack, 60, 60,
-          NULL, 0, 1.0, 0.0, 0, NULL, NULL);
+          NULL, 0, 1.0, 0.0, 0, NULL, NULL, 0, 0.0);
       }
       yac_interp_stack_config_delete(interp_stack);
     }
@@ -103,7 +103,7 @@ int main (void) {
         instance, src_comp_name, src_grid_name, field_name,
         tgt_comp_name, tgt_grid_name, field_name, coupling_timestep,
         YAC_REDUCTION_TIME_ACCUMULATE, interp_stack_config, 0, 0, NULL,
-        mapping_side[src_comp_idx][tgt_comp_idx], 1.0, 0.0, 0, NULL, NULL);
+        mapping_side[src_comp_idx][tgt_comp_idx], 1.0, 0.0, 0, NULL, NULL, 0, 0.0);
     }
   }
   yac_interp_stack_config_delete(interp_stack_config);
@@ -101,6 +101,10 @@ static void test12();
 // (replicates a bug found in the packing of the final results)
 static void test13();
 
+// conservative remapping with one source and two target processes, one of
+// the target processes has an empty partition
+static void test14();
+
 int main (void) {
 
   MPI_Init(NULL, NULL);
@@ -120,6 +124,7 @@ int main (void) {
   test11();
   test12();
   test13();
+  test14();
 
   xt_finalize();
   MPI_Finalize();
@@ -3407,3 +3412,219 @@ static void test13() {
   yac_mpi_call(MPI_Comm_free(&split_comm), MPI_COMM_WORLD);
   yac_mpi_call(MPI_Comm_free(&global_comm), MPI_COMM_WORLD);
 }
+
+static void test14() {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (comm_size < 3) {
+    PUT_ERR("ERROR: too few processes");
+    xt_finalize();
+    MPI_Finalize();
+    exit(TEST_EXIT_CODE);
+  }
+
+  int is_active = comm_rank < 3;
+
+  MPI_Comm global_comm;
+  yac_mpi_call(
+    MPI_Comm_split(
+      MPI_COMM_WORLD, is_active, 0, &global_comm), MPI_COMM_WORLD);
+
+  if (!is_active) {
+    yac_mpi_call(MPI_Comm_free(&global_comm), MPI_COMM_WORLD);
+    return;
+  }
+
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
+
+  int is_source = comm_rank == 2;
+  int is_target = comm_rank < 2;
+
+  MPI_Comm split_comm;
+  yac_mpi_call(
+    MPI_Comm_split(
+      global_comm, is_target, 0, &split_comm), MPI_COMM_WORLD);
+
+  yac_mpi_call(MPI_Comm_rank(split_comm, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(split_comm, &comm_size), MPI_COMM_WORLD);
+
+  struct yac_basic_grid * src_grid = NULL;
+  struct yac_basic_grid * tgt_grid = NULL;
+
+  if (is_source) {
+
+    // the global source grid is a 2x2 grid:
+    //       06--10--07--11--08
+    //       |       |       |
+    //       06  02  08  03  09
+    //       |       |       |
+    //       03--05--04--07--05
+    //       |       |       |
+    //       01  00  03  01  04
+    //       |       |       |
+    //       00--00--01--02--02
+
+    double coordinates_x[] = {-1,0,1};
+    double coordinates_y[] = {-1,0,1};
+    size_t const num_cells[2] = {2,2};
+    size_t local_start[1][2] = {{0,0}};
+    size_t local_count[1][2] = {{2,2}};
+    int with_halo = 1;
+    for (size_t i = 0; i <= num_cells[0]; ++i) coordinates_x[i] *= YAC_RAD;
+    for (size_t i = 0; i <= num_cells[1]; ++i) coordinates_y[i] *= YAC_RAD;
+
+
+    src_grid =
+      yac_basic_grid_new(
+        src_grid_name,
+        yac_generate_basic_grid_data_reg2d(
+          coordinates_x, coordinates_y, num_cells,
+          local_start[comm_rank], local_count[comm_rank], with_halo));
+  } else src_grid = yac_basic_grid_empty_new(src_grid_name);
+
+  // the second target process has an empty partition
+  if (is_target && (comm_rank == 0)) {
+
+    double coordinates_x[] = {-0.5,0.5};
+    double coordinates_y[] = {-0.5,0.5};
+    size_t const num_cells[2] = {1,1};
+    size_t local_start[1][2] = {{0,0}};
+    size_t local_count[1][2] = {{1,1}};
+    int with_halo = 1;
+    for (size_t i = 0; i <= num_cells[0]; ++i) coordinates_x[i] *= YAC_RAD;
+    for (size_t i = 0; i <= num_cells[1]; ++i) coordinates_y[i] *= YAC_RAD;
+
+    tgt_grid =
+      yac_basic_grid_new(
+        tgt_grid_name,
+        yac_generate_basic_grid_data_reg2d(
+          coordinates_x, coordinates_y, num_cells,
+          local_start[comm_rank], local_count[comm_rank], with_halo));
+  } else tgt_grid = yac_basic_grid_empty_new(tgt_grid_name);
+
+  struct dist_grid_pair * grid_pair =
+    yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
+
+  struct interp_field src_fields[] =
+    {{.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX}};
+  size_t num_src_fields = sizeof(src_fields) / sizeof(src_fields[0]);
+  struct interp_field tgt_field =
+    {.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX};
+
+  struct interp_grid * interp_grid =
+    yac_interp_grid_new(grid_pair, src_grid_name, tgt_grid_name,
+                        num_src_fields, src_fields, tgt_field);
+
+  int order = 1;
+  int enforced_conserv = 0;
+  int partial_coverage = 0;
+  enum yac_interp_method_conserv_normalisation normalisation = CONSERV_DESTAREA;
+
+  struct interp_method * method_stack[] = {
+    yac_interp_method_conserv_new(
+      order, enforced_conserv, partial_coverage, normalisation), NULL};
+
+  struct interp_weights * weights =
+    yac_interp_method_do_search(method_stack, interp_grid);
+
+  yac_interp_method_delete(method_stack);
+
+  enum interp_weights_reorder_type reorder_type[2] =
+    {MAPPING_ON_SRC, MAPPING_ON_TGT};
+
+  for (size_t j = 0; j < 2; ++j) {
+    for (size_t collection_size = 1; collection_size < 4;
+         collection_size += 2) {
+
+      struct interpolation * interpolation =
+        yac_interp_weights_get_interpolation(
+          weights, reorder_type[j], collection_size, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0);
+
+      // check generated interpolation
+      if (is_source) {
+        double *** src_data = xmalloc(collection_size * sizeof(*src_data));
+        for (size_t i = 0; i < collection_size; ++i)
+          src_data[i] = xmalloc(1 * sizeof(**src_data));
+
+        struct basic_grid_data * src_grid_data =
+          yac_basic_grid_get_data(src_grid);
+
+        for (size_t collection_idx = 0; collection_idx < collection_size;
+             ++collection_idx) {
+          double * src_field =
+            xmalloc(src_grid_data->num_cells * sizeof(*src_field));
+          for (size_t i = 0; i < src_grid_data->num_cells; ++i)
+            src_field[i] =
+              (src_grid_data->core_cell_mask[i])?
+                (double)(src_grid_data->cell_ids[i] + 1) +
+                (double)(collection_idx * 4):
+                -1.0;
+          src_data[collection_idx][0] = src_field;
+        }
+
+        yac_interpolation_execute_put(interpolation, src_data);
+
+        for (size_t collection_idx = 0; collection_idx < collection_size;
+             ++collection_idx) {
+          free(src_data[collection_idx][0]);
+          free(src_data[collection_idx]);
+        }
+        free(src_data);
+      }
+      if (is_target) {
+        double ref_tgt_field[1] = {2.5};
+
+        struct basic_grid_data * tgt_grid_data =
+          yac_basic_grid_get_data(tgt_grid);
+
+        double ** tgt_data = xmalloc(collection_size * sizeof(*tgt_data));
+        for (size_t collection_idx = 0; collection_idx < collection_size;
+             ++collection_idx) {
+          tgt_data[collection_idx] =
+            xmalloc(tgt_grid_data->num_cells * sizeof(**tgt_data));
+          for (size_t k = 0; k < tgt_grid_data->num_cells; ++k)
+            tgt_data[collection_idx][k] = -1;
+        }
+
+        yac_interpolation_execute_get(interpolation, tgt_data);
+
+        for (size_t collection_idx = 0; collection_idx < collection_size;
+             ++collection_idx) {
+          for (size_t j = 0, offset = collection_idx * 4;
+               j < tgt_grid_data->num_cells; ++j) {
+            if (tgt_grid_data->core_cell_mask[j] &&
+                (ref_tgt_field[tgt_grid_data->cell_ids[j]] != -1.0)) {
+              if (fabs((ref_tgt_field[tgt_grid_data->cell_ids[j]] +
+                        (double)offset) - tgt_data[collection_idx][j]) > 1e-3)
+                PUT_ERR("wrong interpolation result");
+            } else {
+              if (tgt_data[collection_idx][j] != -1.0)
+                PUT_ERR("wrong interpolation result");
+            }
+          }
+        }
+
+        for (size_t collection_idx = 0; collection_idx < collection_size;
+             ++collection_idx)
+          free(tgt_data[collection_idx]);
+        free(tgt_data);
+      }
+
+      yac_interpolation_delete(interpolation);
+    }
+  }
+
+  yac_basic_grid_delete(src_grid);
+  yac_basic_grid_delete(tgt_grid);
+  yac_interp_weights_delete(weights);
+  yac_interp_grid_delete(interp_grid);
+  yac_dist_grid_pair_delete(grid_pair);
+
+  yac_mpi_call(MPI_Comm_free(&split_comm), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_free(&global_comm), MPI_COMM_WORLD);
+}
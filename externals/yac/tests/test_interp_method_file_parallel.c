@@ -48,6 +48,7 @@
 #include "test_common.h"
 #include "geometry.h"
 #include "interp_method.h"
+#include "interp_method_avg.h"
 #include "interp_method_file.h"
 #include "interp_method_fixed.h"
 #include "dist_grid_utils.h"
@@ -68,6 +69,7 @@ char const file_name_2[] = "weights_2.nc";
 
 static void target_main(MPI_Comm global_comm, MPI_Comm target_comm);
 static void source_main(MPI_Comm global_comm, MPI_Comm source_comm);
+static void test_tgt_index(MPI_Comm comm);
 
 int main (void) {
 
@@ -80,24 +82,40 @@ int main (void) {
   yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
   MPI_Barrier(MPI_COMM_WORLD);
 
-  if (comm_size != 3) {
+  if (comm_size != 6) {
     PUT_ERR("ERROR: wrong number of processes");
     xt_finalize();
     MPI_Finalize();
     return TEST_EXIT_CODE;
   }
 
-  int tgt_flag = comm_rank < 1;
-
-  MPI_Comm split_comm;
+  // the first three processes run the basic tests
+  MPI_Comm global_comm;
   yac_mpi_call(
     MPI_Comm_split(
-      MPI_COMM_WORLD, tgt_flag, 0, &split_comm), MPI_COMM_WORLD);
+      MPI_COMM_WORLD, comm_rank < 3, 0, &global_comm), MPI_COMM_WORLD);
+
+  if (comm_rank < 3) {
+
+    int tgt_flag = comm_rank < 1;
+
+    MPI_Comm split_comm;
+    yac_mpi_call(
+      MPI_Comm_split(
+        global_comm, tgt_flag, 0, &split_comm), global_comm);
 
-  if (tgt_flag) target_main(MPI_COMM_WORLD, split_comm);
-  else          source_main(MPI_COMM_WORLD, split_comm);
+    if (tgt_flag) target_main(global_comm, split_comm);
+    else          source_main(global_comm, split_comm);
 
-  yac_mpi_call(MPI_Comm_free(&split_comm), MPI_COMM_WORLD);
+    yac_mpi_call(MPI_Comm_free(&split_comm), global_comm);
+  }
+
+  // test the target index of weight files with different numbers of
+  // processes
+  test_tgt_index(MPI_COMM_WORLD);
+  if (comm_rank < 3) test_tgt_index(global_comm);
+
+  yac_mpi_call(MPI_Comm_free(&global_comm), MPI_COMM_WORLD);
   xt_finalize();
   MPI_Finalize();
 
@@ -185,7 +203,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = 0},
@@ -355,7 +373,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -541,7 +559,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = 0},
        {.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = 0}};
@@ -685,7 +703,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -828,7 +846,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -971,7 +989,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX}};
@@ -1151,7 +1169,7 @@ static void source_main(MPI_Comm global_comm,
         yac_basic_grid_empty_new(tgt_grid_name);
 
       struct dist_grid_pair * grid_pair =
-        yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+        yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
       struct interp_field src_fields[] =
         {{.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -1363,7 +1381,7 @@ static void source_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(tgt_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(src_grid, tgt_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(src_grid, tgt_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -1544,7 +1562,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = 0},
@@ -1677,7 +1695,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -1808,7 +1826,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = 0},
@@ -1938,7 +1956,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -2055,7 +2073,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -2174,7 +2192,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX}};
@@ -2294,7 +2312,7 @@ static void target_main(MPI_Comm global_comm,
         yac_basic_grid_empty_new(src_grid_name);
 
       struct dist_grid_pair * grid_pair =
-        yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+        yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
       struct interp_field src_fields[] =
         {{.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -2468,7 +2486,7 @@ static void target_main(MPI_Comm global_comm,
       yac_basic_grid_empty_new(src_grid_name);
 
     struct dist_grid_pair * grid_pair =
-      yac_dist_grid_pair_new(tgt_grid, src_grid, MPI_COMM_WORLD);
+      yac_dist_grid_pair_new(tgt_grid, src_grid, global_comm);
 
     struct interp_field src_fields[] =
       {{.location = CELL, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX},
@@ -2578,3 +2596,165 @@ static void target_main(MPI_Comm global_comm,
     yac_basic_grid_delete(tgt_grid);
   }
 }
+
+static void check_tgt_index_file(
+  char const * weight_file_name, struct interp_grid * interp_grid,
+  struct interp_weights * ref_weights,
+  struct basic_grid_data * grid_data) {
+
+  // target points not covered by the weight file would get a different
+  // fixed value
+  struct interp_method * file_method_stack[] =
+    {yac_interp_method_file_new(
+       weight_file_name, src_grid_name, tgt_grid_name),
+     yac_interp_method_fixed_new(-2.0), NULL};
+  struct interp_weights * file_weights =
+    yac_interp_method_do_search(file_method_stack, interp_grid);
+  yac_interp_method_delete(file_method_stack);
+
+  if (yac_interp_weights_get_interp_count(ref_weights) !=
+      yac_interp_weights_get_interp_count(file_weights))
+    PUT_ERR("ERROR in yac_interp_weights_get_interp_count");
+
+  enum interp_weights_reorder_type reorder_types[] =
+    {MAPPING_ON_SRC, MAPPING_ON_TGT};
+  size_t num_reorder_types = sizeof(reorder_types) / sizeof(reorder_types[0]);
+
+  for (size_t i = 0; i < num_reorder_types; ++i) {
+
+    struct interpolation * interpolations[2] =
+      {yac_interp_weights_get_interpolation(
+         ref_weights, reorder_types[i], 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0),
+       yac_interp_weights_get_interpolation(
+         file_weights, reorder_types[i], 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0)};
+
+    double * src_field =
+      xmalloc(grid_data[0].num_vertices * sizeof(*src_field));
+    double ** src_fields = &src_field;
+    for (size_t j = 0; j < grid_data[0].num_vertices; ++j)
+      src_field[j] = (double)(grid_data[0].vertex_ids[j]);
+
+    double * tgt_field[2];
+    for (int j = 0; j < 2; ++j) {
+      tgt_field[j] = xmalloc(grid_data[1].num_vertices * sizeof(*tgt_field[j]));
+      for (size_t k = 0; k < grid_data[1].num_vertices; ++k)
+        tgt_field[j][k] = -3.0;
+      yac_interpolation_execute(interpolations[j], &src_fields, &tgt_field[j]);
+    }
+
+    for (size_t j = 0; j < grid_data[1].num_vertices; ++j)
+      if (fabs(tgt_field[0][j] - tgt_field[1][j]) > err_tol)
+        PUT_ERR("wrong interpolation result");
+
+    free(tgt_field[1]);
+    free(tgt_field[0]);
+    free(src_field);
+    yac_interpolation_delete(interpolations[1]);
+    yac_interpolation_delete(interpolations[0]);
+  }
+
+  yac_interp_weights_delete(file_weights);
+}
+
+static void test_tgt_index(MPI_Comm comm) {
+
+  // weight files written by yac contain a target index, which allows each
+  // process to directly read the parts of the file it requires; this
+  // tests checks:
+  //  * a weight file written by yac (the target index consists of a single
+  //    block per source field/fixed value; with six processes each process
+  //    would read the whole file, which triggers the fallback to the
+  //    redistribution of the file data, with three processes the file is
+  //    read directly)
+  //  * a weight file without target index (legacy format)
+  //  * a weight file with a small block size (file is read directly)
+  // the results are compared against the original weights
+
+  char const writer_file_name[] = "weights_tgt_index.nc";
+  char const legacy_file_name[] = "weights_tgt_index_legacy.nc";
+  char const block_file_name[] = "weights_tgt_index_block.nc";
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  // the source grid is a 12x12 grid covering 0-12 degree, the target grid
+  // is a 12x12 grid covering 0.5-12.5 degree (target points outside of the
+  // source grid get a fixed value); the rows of cells are distributed among
+  // the processes
+
+  double coordinates_x[2][13], coordinates_y[2][13];
+  size_t const num_cells[2] = {12,12};
+  for (int i = 0; i < 2; ++i) {
+    for (size_t j = 0; j <= num_cells[0]; ++j)
+      coordinates_x[i][j] = ((double)j + 0.5 * (double)i) * YAC_RAD;
+    for (size_t j = 0; j <= num_cells[1]; ++j)
+      coordinates_y[i][j] = ((double)j + 0.5 * (double)i) * YAC_RAD;
+  }
+  size_t local_start[2] =
+    {0, ((size_t)comm_rank * num_cells[1]) / (size_t)comm_size};
+  size_t local_count[2] =
+    {num_cells[0],
+     (((size_t)comm_rank + 1) * num_cells[1]) / (size_t)comm_size -
+     local_start[1]};
+  int with_halo = 0;
+
+  char const * grid_names[2] = {src_grid_name, tgt_grid_name};
+  struct yac_basic_grid * grids[2];
+  struct basic_grid_data grid_data[2];
+  for (int i = 0; i < 2; ++i) {
+    grid_data[i] =
+      yac_generate_basic_grid_data_reg2d(
+        coordinates_x[i], coordinates_y[i], num_cells,
+        local_start, local_count, with_halo);
+    grids[i] = yac_basic_grid_new(grid_names[i], grid_data[i]);
+  }
+
+  struct dist_grid_pair * grid_pair =
+    yac_dist_grid_pair_new(grids[0], grids[1], comm);
+
+  struct interp_field src_fields[] =
+    {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX}};
+  size_t num_src_fields = sizeof(src_fields) / sizeof(src_fields[0]);
+  struct interp_field tgt_field =
+    {.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX};
+
+  struct interp_grid * interp_grid =
+    yac_interp_grid_new(grid_pair, src_grid_name, tgt_grid_name,
+                        num_src_fields, src_fields, tgt_field);
+
+  struct interp_method * ref_method_stack[] =
+    {yac_interp_method_avg_new(AVG_ARITHMETIC, 0),
+     yac_interp_method_fixed_new(-1.0), NULL};
+  struct interp_weights * ref_weights =
+    yac_interp_method_do_search(ref_method_stack, interp_grid);
+  yac_interp_method_delete(ref_method_stack);
+
+  yac_interp_weights_write_to_file(
+    ref_weights, writer_file_name, src_grid_name, tgt_grid_name);
+
+  if (comm_rank == 0) {
+    check_weight_file_tgt_index(writer_file_name);
+    copy_weight_file(writer_file_name, legacy_file_name, 0);
+    copy_weight_file(writer_file_name, block_file_name, 5);
+    check_weight_file_tgt_index(block_file_name);
+  }
+  MPI_Barrier(comm);
+
+  check_tgt_index_file(writer_file_name, interp_grid, ref_weights, grid_data);
+  check_tgt_index_file(legacy_file_name, interp_grid, ref_weights, grid_data);
+  check_tgt_index_file(block_file_name, interp_grid, ref_weights, grid_data);
+
+  MPI_Barrier(comm);
+  if (comm_rank == 0) {
+    unlink(block_file_name);
+    unlink(legacy_file_name);
+    unlink(writer_file_name);
+  }
+
+  yac_interp_weights_delete(ref_weights);
+  yac_interp_grid_delete(interp_grid);
+  yac_dist_grid_pair_delete(grid_pair);
+  yac_basic_grid_delete(grids[1]);
+  yac_basic_grid_delete(grids[0]);
+}
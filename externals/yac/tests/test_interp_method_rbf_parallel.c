@@ -58,7 +58,8 @@
 char const src_grid_name[] = "src_grid";
 char const tgt_grid_name[] = "tgt_grid";
 
-static void target_main(MPI_Comm global_comm, MPI_Comm target_comm);
+static void target_main(
+  MPI_Comm global_comm, MPI_Comm target_comm, int test_idx);
 static void source_main(MPI_Comm global_comm, MPI_Comm source_comm);
 
 int main (void) {
@@ -86,8 +87,12 @@ int main (void) {
     MPI_Comm_split(
       MPI_COMM_WORLD, tgt_flag, 0, &split_comm), MPI_COMM_WORLD);
 
-  if (tgt_flag) target_main(MPI_COMM_WORLD, split_comm);
-  else          source_main(MPI_COMM_WORLD, split_comm);
+  // test 0: each target point has its own set of source points
+  // test 1: multiple target points share the same set of source points
+  for (int test_idx = 0; test_idx < 2; ++test_idx) {
+    if (tgt_flag) target_main(MPI_COMM_WORLD, split_comm, test_idx);
+    else          source_main(MPI_COMM_WORLD, split_comm);
+  }
 
   yac_mpi_call(MPI_Comm_free(&split_comm), MPI_COMM_WORLD);
   xt_finalize();
@@ -268,12 +273,22 @@ static void source_main(MPI_Comm global_comm,
 }
 
 static void target_main(MPI_Comm global_comm,
-                        MPI_Comm target_comm) {
+                        MPI_Comm target_comm, int test_idx) {
 
   double coordinates_x[] = {-1.5,-0.5,0.5,1.5};
   double coordinates_y[] = {-1.5,-0.5,0.5,1.5};
-  double cell_coordinates_x[] = {-1.0,0.0,1.0};
-  double cell_coordinates_y[] = {-1.0,0.0,1.0};
+  double cell_coordinates_x[2][9] = {{-1.0, 0.0, 1.0,
+                                      -1.0, 0.0, 1.0,
+                                      -1.0, 0.0, 1.0},
+                                     { 0.0, 0.0, 1.0,
+                                       0.0, 0.0, 1.0,
+                                       1.0, 0.0, 1.0}};
+  double cell_coordinates_y[2][9] = {{-1.0,-1.0,-1.0,
+                                       0.0, 0.0, 0.0,
+                                       1.0, 1.0, 1.0},
+                                     { 0.0, 0.0, 0.0,
+                                       0.0, 0.0, 0.0,
+                                       1.0, 0.0, 0.0}};
   coordinate_pointer cell_coordinates = xmalloc(9 * sizeof(*cell_coordinates));
   size_t const num_cells[2] = {3,3};
   size_t local_start[2] = {0,0};
@@ -281,10 +296,10 @@ static void target_main(MPI_Comm global_comm,
   int with_halo = 0;
   for (size_t i = 0; i <= num_cells[0]; ++i) coordinates_x[i] *= YAC_RAD;
   for (size_t i = 0; i <= num_cells[1]; ++i) coordinates_y[i] *= YAC_RAD;
-  for (size_t i = 0, k = 0; i < num_cells[1]; ++i)
-    for (size_t j = 0; j < num_cells[0]; ++j, ++k)
-      LLtoXYZ_deg(
-        cell_coordinates_x[j], cell_coordinates_y[i], cell_coordinates[k]);
+  for (size_t i = 0; i < 9; ++i)
+    LLtoXYZ_deg(
+      cell_coordinates_x[test_idx][i], cell_coordinates_y[test_idx][i],
+      cell_coordinates[i]);
 
   struct basic_grid_data grid_data =
     yac_generate_basic_grid_data_reg2d(
@@ -332,7 +347,12 @@ static void target_main(MPI_Comm global_comm,
 
       // check generated interpolation
       {
-        double ref_tgt_field[9] = {2,3,4, 3,4,5, 4,5,6};
+        // target points are located on source vertices
+        double ref_tgt_field[9];
+        for (size_t j = 0; j < 9; ++j)
+          ref_tgt_field[j] =
+            cell_coordinates_x[test_idx][j] +
+            cell_coordinates_y[test_idx][j] + 4.0;
 
         double ** tgt_data = xmalloc(collection_size * sizeof(*tgt_data));
         for (size_t collection_idx = 0; collection_idx < collection_size;
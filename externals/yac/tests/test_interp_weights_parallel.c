@@ -53,6 +53,7 @@
 #include "yac_mpi.h"
 #include "dist_grid_utils.h"
 #include "io_utils.h"
+#include "setup_stats.h"
 
 #include <mpi.h>
 #include <yaxt.h>
@@ -1732,6 +1733,219 @@ int main(void) {
     yac_interp_weights_delete(weights);
   }
 
+  { // test pruning of small weights
+
+    struct interp_weights * weights =
+      yac_interp_weights_new(
+        MPI_COMM_WORLD, CELL, (enum yac_location[]){CELL}, 1);
+
+    struct remote_point srcs[] =
+      {{.global_id = 1,
+        .data = {.count = 1, .data.single = {.rank = 0, .orig_pos = 1}}},
+       {.global_id = 2,
+        .data = {.count = 1, .data.single = {.rank = 0, .orig_pos = 2}}},
+       {.global_id = 5,
+        .data = {.count = 1, .data.single = {.rank = 0, .orig_pos = 5}}}};
+
+    // tgt global_id: 2
+    //   0.6 * src global_id 1 + 0.395 * src global_id 2 +
+    //   0.005 * src global_id 5
+    // tgt global_id: 4
+    //   0.5 * src global_id 1 + 0.5 * src global_id 2
+    // tgt global_id: 6
+    //   0.002 * src global_id 1 - 0.002 * src global_id 2 +
+    //   1.0 * src global_id 5
+    double w[3][3] = {{0.6, 0.395, 0.005}, {0.5, 0.5}, {0.002, -0.002, 1.0}};
+    size_t num_src_per_tgt[3] = {3, 2, 3};
+
+    if (comm_rank < 3) {
+      struct remote_point remote_tgt_points[] =
+        {{.global_id = 2 * (comm_rank + 1),
+          .data = {.count = 1,
+                   .data.single = {.rank = 0,
+                                   .orig_pos = 2 * (comm_rank + 1)}}}};
+      struct remote_points tgts = {
+        .data = remote_tgt_points,
+        .count = sizeof(remote_tgt_points) / sizeof(remote_tgt_points[0]),
+      };
+      yac_interp_weights_add_wsum(
+        weights, &tgts, &num_src_per_tgt[comm_rank], srcs, w[comm_rank]);
+    }
+
+    if (yac_interp_weights_prune(weights, 0.0) != 0)
+      PUT_ERR("error in yac_interp_weights_prune (threshold 0.0)");
+    if (yac_interp_weights_prune(weights, 0.01) != 3)
+      PUT_ERR("error in yac_interp_weights_prune (threshold 0.01)");
+    if (yac_interp_weights_prune(weights, 0.01) != 0)
+      PUT_ERR("error in yac_interp_weights_prune (repeated pruning)");
+
+    struct interpolation * interpolation =
+      yac_interp_weights_get_interpolation(
+        weights, MAPPING_ON_SRC, 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0);
+
+    if (comm_rank == 0) {
+
+      double src_field_data[1][10] = {{1,2,3,4,5,6,7,8,9,10}};
+      double tgt_field_data[] = {-1,-1,-1,-1,-1,-1,-1,-1};
+
+      // the sum of the weights of each target point is preserved
+      double ref_tgt_field_data[] =
+        {-1,-1,(0.6*2.0+0.395*3.0)/0.995,-1,0.5*2.0+0.5*3.0,-1,6.0,-1};
+      double * src_field[1] = {src_field_data[0]};
+      double * tgt_field = tgt_field_data;
+      double ** src_fields = src_field;
+
+      yac_interpolation_execute(interpolation, &src_fields, &tgt_field);
+
+      for (size_t i = 0;
+            i < sizeof(tgt_field_data)/sizeof(tgt_field_data[0]); ++i)
+        if (fabs(tgt_field_data[i] - ref_tgt_field_data[i]) > 1e-9)
+          PUT_ERR("ERROR in pruned weights");
+
+    } else {
+
+      yac_interpolation_execute(interpolation, NULL, NULL);
+    }
+
+    yac_interpolation_delete(interpolation);
+
+    yac_interp_weights_delete(weights);
+  }
+
+  { // test automatic selection of the mapping side
+
+    // source field of rank r: src global_id 100 * r + i is at orig_pos i
+    double src_field_data[10];
+    for (size_t i = 0; i < 10; ++i)
+      src_field_data[i] = (double)(10 * comm_rank + (int)i);
+
+    for (int test_idx = 0; test_idx < 2; ++test_idx) {
+
+      struct interp_weights * weights =
+        yac_interp_weights_new(
+          MPI_COMM_WORLD, CELL, (enum yac_location[]){CELL}, 1);
+
+      double ref_tgt_field_data[4] = {-1,-1,-1,-1};
+      enum interp_weights_reorder_type ref_reorder;
+
+      if (test_idx == 0) {
+
+        // all four target points (rank 0) share two source points of
+        // rank 1 and each has one own source point on rank 0
+        // --> on the source side rank 1 would have to receive four
+        //     source values and send back four results, on the target
+        //     side rank 0 only has to receive the two shared values
+        // tgt global_id i (i = 0..3):
+        //   0.25 * src global_id 100 + 0.25 * src global_id 101 +
+        //   0.5 * src global_id 4 + i
+        if (comm_rank == 0) {
+          for (int i = 0; i < 4; ++i) {
+            struct remote_point remote_tgt_points[] =
+              {{.global_id = i,
+                .data = {.count = 1,
+                         .data.single = {.rank = 0, .orig_pos = i}}}};
+            struct remote_points tgts = {
+              .data = remote_tgt_points,
+              .count = 1,
+            };
+            struct remote_point srcs[] =
+              {{.global_id = 100,
+                .data = {.count = 1, .data.single = {.rank = 1, .orig_pos = 0}}},
+               {.global_id = 101,
+                .data = {.count = 1, .data.single = {.rank = 1, .orig_pos = 1}}},
+               {.global_id = 4 + i,
+                .data = {.count = 1,
+                         .data.single = {.rank = 0, .orig_pos = 4 + i}}}};
+            size_t num_src_per_tgt[] = {3};
+            double w[] = {0.25, 0.25, 0.5};
+            yac_interp_weights_add_wsum(
+              weights, &tgts, num_src_per_tgt, srcs, w);
+          }
+        }
+        for (int i = 0; i < 4; ++i)
+          ref_tgt_field_data[i] = 0.25 * 10.0 + 0.25 * 11.0 + 0.5 * (4 + i);
+        ref_reorder = MAPPING_ON_TGT;
+
+      } else {
+
+        // a single target point (rank 0) with four source points of rank 1
+        // --> on the source side only the result has to be sent
+        // tgt global_id 0:
+        //   0.25 * (src global_id 100 + 101 + 102 + 103)
+        if (comm_rank == 2) {
+          struct remote_point remote_tgt_points[] =
+            {{.global_id = 0,
+              .data = {.count = 1,
+                       .data.single = {.rank = 0, .orig_pos = 0}}}};
+          struct remote_points tgts = {
+            .data = remote_tgt_points,
+            .count = 1,
+          };
+          struct remote_point srcs[4];
+          for (int i = 0; i < 4; ++i)
+            srcs[i] =
+              (struct remote_point)
+                {.global_id = 100 + i,
+                 .data = {.count = 1,
+                          .data.single = {.rank = 1, .orig_pos = i}}};
+          size_t num_src_per_tgt[] = {4};
+          double w[] = {0.25, 0.25, 0.25, 0.25};
+          yac_interp_weights_add_wsum(
+            weights, &tgts, num_src_per_tgt, srcs, w);
+        }
+        ref_tgt_field_data[0] = 0.25 * (10.0 + 11.0 + 12.0 + 13.0);
+        ref_reorder = MAPPING_ON_SRC;
+      }
+
+      yac_setup_stats_start(YAC_SETUP_PHASE_INTERPOLATION);
+      struct interpolation * interpolation =
+        yac_interp_weights_get_interpolation(
+          weights, MAPPING_AUTO, 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_INTERPOLATION);
+
+      { // check the selected mapping side
+        char const * comp_names[] = {"comp"};
+        struct yac_setup_stats * stats =
+          yac_setup_stats_aggregate(
+            comp_names, 1, (int[]){1}, MPI_COMM_WORLD);
+        char const * counter_names[2] =
+          {"num_auto_mapping_on_source", "num_auto_mapping_on_target"};
+        for (int i = 0; i < 2; ++i) {
+          int64_t min_value, max_value, sum_value;
+          yac_setup_stats_get_counter(
+            stats, "comp", "setup/interpolation", counter_names[i],
+            &min_value, &max_value, &sum_value);
+          int64_t ref_value =
+            ((i == 0) == (ref_reorder == MAPPING_ON_SRC))?1:0;
+          if ((min_value != ref_value) || (max_value != ref_value))
+            PUT_ERR("ERROR in automatic selection of the mapping side");
+        }
+        yac_setup_stats_delete(stats);
+      }
+
+      if (yac_interp_weights_select_mapping_side(weights, 1, 0) != ref_reorder)
+        PUT_ERR("ERROR in yac_interp_weights_select_mapping_side");
+
+      double tgt_field_data[4] = {-1,-1,-1,-1};
+      double * src_field[1] = {src_field_data};
+      double ** src_fields = src_field;
+      double * tgt_field = tgt_field_data;
+
+      yac_interpolation_execute(
+        interpolation, (comm_rank == 0) || (comm_rank == 1)?&src_fields:NULL,
+        (comm_rank == 0)?&tgt_field:NULL);
+
+      if (comm_rank == 0)
+        for (size_t i = 0; i < 4; ++i)
+          if (fabs(tgt_field_data[i] - ref_tgt_field_data[i]) > 1e-9)
+            PUT_ERR("ERROR in interpolation with automatic mapping side");
+
+      yac_interpolation_delete(interpolation);
+
+      yac_interp_weights_delete(weights);
+    }
+  }
+
   { // test interfaces for multiple source fields,
     // the target points are available on all processes
 
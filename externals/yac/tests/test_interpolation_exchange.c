@@ -57,6 +57,7 @@
 static void check_exchange(
   struct yac_interpolation_exchange * exchange,
   int is_source, int is_target, int optional_put_get);
+static void count_complete(void * count);
 
 int main(void) {
 
@@ -196,4 +197,30 @@ static void check_exchange(
     PUT_ERR("ERROR in yac_interpolation_exchange_execute_get");
   if (!optional_put_get || is_source)
     yac_interpolation_exchange_wait(exchange, "check_exchange");
+
+  // put/get exchange with asynchronous get (the completion routine has to be
+  // called exactly once)
+  int complete_count = 0;
+  if (!optional_put_get || is_source)
+    yac_interpolation_exchange_execute_put(
+      exchange, &send_data, "check_exchange");
+  recv_data_[0] = -1.0, recv_data_[1] = -1.0;
+  if (!optional_put_get || is_target) {
+    yac_interpolation_exchange_execute_get_async(
+      exchange, &recv_data, count_complete, &complete_count, "check_exchange");
+    yac_interpolation_exchange_wait(exchange, "check_exchange");
+    yac_interpolation_exchange_wait(exchange, "check_exchange");
+  }
+  if (is_target && ((recv_data_[0] != 0.0) || (recv_data_[1] != 1.0)))
+    PUT_ERR("ERROR in yac_interpolation_exchange_execute_get_async");
+  if (complete_count != (is_target?1:0))
+    PUT_ERR("ERROR in yac_interpolation_exchange_execute_get_async "
+            "(completion routine)");
+  if (!optional_put_get || is_source)
+    yac_interpolation_exchange_wait(exchange, "check_exchange");
+}
+
+static void count_complete(void * count) {
+
+  ++*(int*)count;
 }
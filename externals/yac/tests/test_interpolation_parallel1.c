@@ -225,6 +225,10 @@ static void source_main(MPI_Comm global_comm, MPI_Comm source_comm,
 
     yac_interpolation_execute_put(interpolation, src_data);
 
+    // src_data is not modified until the interpolation is deleted, therefore
+    // it can be sent without being copied
+    yac_interpolation_execute_put_zero_copy(interpolation, src_data);
+
     yac_interpolation_delete(interpolation);
   }
 
@@ -333,37 +337,42 @@ static void target_main(MPI_Comm global_comm, MPI_Comm target_comm,
       yac_interp_weights_get_interpolation(
         weights, reorder_type, collection_size, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0);
 
-    for (unsigned i = 0; i < collection_size; ++i)
-      for (unsigned j = 0; j < 16; ++j)
-        target_field[i][j] = -1;
-
-    yac_interpolation_execute_get(interpolation, target_data);
-
-    //----------------------------
-    // check interpolation results
-    //----------------------------
-
-    double ref_target_data[2][16] = {{3.5,4.5,5.5,6.5,
-                                      9.5,10.5,11.5,12.5,
-                                      15.5,16.5,17.5,18.5,
-                                      21.5,22.5,23.5,24.5},
-                                     {6.5,7.5,1337,1337,
-                                      12.5,13.5,1337,1337,
-                                      18.5,19.5,1337,1337,
-                                      24.5,25.5,1337,1337}};
-
-    for (unsigned i = 0; i < collection_size; ++i) {
-      for (unsigned j = 0; j < 16; ++j) {
-        if ((double_are_equal(ref_target_data[my_target_rank][j], -1.0)) ||
-            (double_are_equal(ref_target_data[my_target_rank][j], 1337.0))) {
-          if (double_are_unequal(target_data[i][j],
-                                 ref_target_data[my_target_rank][j]))
-             PUT_ERR("error in interpolated data on target side\n");
-        } else {
-          if (double_are_unequal(
-                target_data[i][j],
-                ref_target_data[my_target_rank][j] + (double)(i * 30)))
-             PUT_ERR("error in interpolated data on target side\n");
+    // the first get receives the data of a regular put, the second one
+    // that of a zero-copy put
+    for (int k = 0; k < 2; ++k) {
+
+      for (unsigned i = 0; i < collection_size; ++i)
+        for (unsigned j = 0; j < 16; ++j)
+          target_field[i][j] = -1;
+
+      yac_interpolation_execute_get(interpolation, target_data);
+
+      //----------------------------
+      // check interpolation results
+      //----------------------------
+
+      double ref_target_data[2][16] = {{3.5,4.5,5.5,6.5,
+                                        9.5,10.5,11.5,12.5,
+                                        15.5,16.5,17.5,18.5,
+                                        21.5,22.5,23.5,24.5},
+                                       {6.5,7.5,1337,1337,
+                                        12.5,13.5,1337,1337,
+                                        18.5,19.5,1337,1337,
+                                        24.5,25.5,1337,1337}};
+
+      for (unsigned i = 0; i < collection_size; ++i) {
+        for (unsigned j = 0; j < 16; ++j) {
+          if ((double_are_equal(ref_target_data[my_target_rank][j], -1.0)) ||
+              (double_are_equal(ref_target_data[my_target_rank][j], 1337.0))) {
+            if (double_are_unequal(target_data[i][j],
+                                   ref_target_data[my_target_rank][j]))
+               PUT_ERR("error in interpolated data on target side\n");
+          } else {
+            if (double_are_unequal(
+                  target_data[i][j],
+                  ref_target_data[my_target_rank][j] + (double)(i * 30)))
+               PUT_ERR("error in interpolated data on target side\n");
+          }
         }
       }
     }
@@ -816,6 +816,8 @@ int main(int argc, char *argv[]) {
     //    9   | 0, 17, 2, 19 | 0.1, 0.2, 0.3, 0.4
     //   10   | 5, 6         | 2.2, 2.3
     //   11   | 21, 22       | 2.4, 2.5
+    //   12   | 13, 30       | 0.5, 0.25
+    // (rank 3 only uses local source points and does not send any data)
 
     // at first the source points required for each target point have to be
     // transfered to the respective target processes using src_redists
@@ -853,11 +855,11 @@ int main(int argc, char *argv[]) {
     }
 
     // positions of target points to be written
-    size_t tgt_pos[num_procs][4] = {{-1},{0,1,2,3},{0,1,2,3},{-1}};
+    size_t tgt_pos[num_procs][4] = {{-1},{0,1,2,3},{0,1,2,3},{0}};
     // number of entries in tgt_pos
-    size_t tgt_count[num_procs] = {0,4,4,0};
+    size_t tgt_count[num_procs] = {0,4,4,1};
     // number of source points per stencil
-    size_t num_src_per_tgt[num_procs][4] = {{-1},{4,4,4,1},{4,4,2,2},{-1}};
+    size_t num_src_per_tgt[num_procs][4] = {{-1},{4,4,4,1},{4,4,2,2},{2}};
     double weights[num_procs][13] =
       {{-1},
        {0.1,0.2,0.3,0.4,
@@ -868,7 +870,7 @@ int main(int argc, char *argv[]) {
         0.1,0.2,0.3,0.4,
         2.2,2.3,
         2.4,2.5},
-       {-1}};
+       {0.5,0.25}};
     // source field index for each source point used in the stencils (SIZE_MAX
     // indicates that the respective source point is in the halo buffer)
     size_t src_field_idx[num_procs][13] =
@@ -881,14 +883,14 @@ int main(int argc, char *argv[]) {
         SIZE_MAX,SIZE_MAX,SIZE_MAX,SIZE_MAX,
         SIZE_MAX,SIZE_MAX,
         SIZE_MAX,SIZE_MAX},
-       {-1}};
+       {0,1}};
     // source index; position of the respective source point within the source
     // field or halo buffer
     size_t src_idx[num_procs][13] =
       {{-1},
        {0,2,1,3, 1,3,0,1, 2,2,3,3, 3},
        {1,6,8,4, 0,5,1,6, 2,3, 7,8},
-       {-1}};
+       {1,2}};
 
     for (int scaling_factor_idx = 0;
          scaling_factor_idx < NUM_SCALING_FACTORS; ++scaling_factor_idx) {
@@ -920,12 +922,12 @@ int main(int argc, char *argv[]) {
             {{4,5,6,7},    {20,21,22,23}},
             {{8,9,10,11},  {24,25,26,27}},
             {{12,13,14,15},{28,29,30,31}}};
-          size_t const tgt_field_size[num_procs] = {0,4,4,0};
+          size_t const tgt_field_size[num_procs] = {0,4,4,1};
           double ref_tgt_data_raw[2][num_procs][collection_size][4] =
           {{{{UNSET}},
             {{SCALE(0+17+2+19),SCALE(2+19+20+5),SCALE(6+22+7+23),SCALE(23)}},
             {{SCALE(2+19+22+7),SCALE(0+17+2+19),SCALE(5+6),SCALE(21+22)}},
-            {{UNSET}}},
+            {{SCALE(13+30)}}},
           {{{UNSET}},
             {{SCALE(0.1*0+0.2*17+0.3*2+0.4*19),
               SCALE(0.5*2+0.6*19+0.7*20+0.8*5),
@@ -935,7 +937,7 @@ int main(int argc, char *argv[]) {
               SCALE(0.1*0+0.2*17+0.3*2+0.4*19),
               SCALE(2.2*5+2.3*6),
               SCALE(2.4*21+2.5*22)}},
-            {{UNSET}}}};
+            {{SCALE(0.5*13+0.25*30)}}}};
 
           if (check_interpolation(
                 interp, &src_data_raw[comm_rank][0][0],
@@ -1185,6 +1187,7 @@ static int check_interpolation_execute(
     if (tgt_data == NULL)
       while (!yac_interpolation_execute_test(interp));
   }
+  init_tgt_data(tgt_data, tgt_field_size, collection_size);
   if (tgt_data != NULL) yac_interpolation_execute_get(interp, tgt_data);
   diff_count +=
     check_tgt_data(tgt_data, ref_tgt_data_raw, tgt_field_size, collection_size);
@@ -1222,6 +1225,7 @@ static int check_interpolation_execute_frac(
     if (tgt_data == NULL)
       while (!yac_interpolation_execute_test(interp));
   }
+  init_tgt_data(tgt_data, tgt_field_size, collection_size);
   if (tgt_data != NULL) yac_interpolation_execute_get(interp, tgt_data);
   diff_count +=
     check_tgt_data(tgt_data, ref_tgt_data_raw, tgt_field_size, collection_size);
@@ -1270,7 +1274,7 @@ static int check_interpolation(
   struct interpolation * interp_copy = yac_interpolation_copy(interp);
   diff_count +=
     check_interpolation_execute(
-      interp, src_data, tgt_data, ref_tgt_data_raw,
+      interp_copy, src_data, tgt_data, ref_tgt_data_raw,
       tgt_field_size, collection_size);
   yac_interpolation_delete(interp_copy);
 
@@ -1351,7 +1355,7 @@ static int check_interpolation_frac(
   struct interpolation * interp_copy = yac_interpolation_copy(interp);
   diff_count +=
     check_interpolation_execute_frac(
-      interp, src_data, src_frac_data, tgt_data, ref_tgt_data_raw,
+      interp_copy, src_data, src_frac_data, tgt_data, ref_tgt_data_raw,
       tgt_field_size, collection_size);
   yac_interpolation_delete(interp_copy);
 
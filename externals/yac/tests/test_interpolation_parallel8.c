@@ -0,0 +1,341 @@
+/**
+ * @file test_interpolation_parallel8.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <mpi.h>
+#include "tests.h"
+#include "test_common.h"
+#include "interpolation.h"
+
+// tests yac_interpolation_add_sum_at_tgt and
+// yac_interpolation_add_weight_sum_mvp_at_tgt with enough target points
+// per process for the compressed sparse row (CSR) evaluation to be
+// distributed among threads (see CSR_MIN_TGT_COUNT_PARALLEL), the results
+// of the threaded evaluation have to be identical to the serial ones
+
+#define UNSET (1337.0)
+#define SCALE_FACTOR (0.5)
+#define SCALE_SUMMAND (1.0)
+
+enum {
+  NUM_PROCS = 4,
+  NUM_SRC_FIELDS = 2,
+  SRC_FIELD_SIZE = 512,
+  HALO_SIZE = SRC_FIELD_SIZE, // half of each source field of the neighbour
+  TGT_COUNT = 4096, // half of the targets only depend on local source points
+  MAX_NUM_SRC_PER_TGT = 4,
+  COLLECTION_SIZE = 2,
+  NUM_THREADS = 4,
+};
+
+static double src_value(int rank, size_t field_idx, size_t idx, size_t c) {
+
+  size_t global_id =
+    field_idx * NUM_PROCS * SRC_FIELD_SIZE + (size_t)rank * SRC_FIELD_SIZE + idx;
+  return (double)(global_id % 97) * 0.25 + (double)field_idx * 0.1 +
+         (double)c * 100.0;
+}
+
+static void get_stencil(
+  size_t tgt_idx, size_t * num_src, size_t * src_field_idx, size_t * src_idx,
+  double * weights);
+static int check_tgt_data(double ** tgt_data, double * ref_tgt_data);
+static void init_tgt_data(double ** tgt_data);
+#ifdef _OPENMP
+static int compare_threaded(
+  struct interpolation * interp, double *** src_data, double ** tgt_data);
+#endif
+
+int main(void) {
+
+  MPI_Init(NULL, NULL);
+  xt_initialize(MPI_COMM_WORLD);
+
+  int comm_rank, comm_size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (comm_size != NUM_PROCS) {
+    PUT_ERR("ERROR: wrong number of processes");
+    xt_finalize();
+    MPI_Finalize();
+    return TEST_EXIT_CODE;
+  }
+
+  // each process receives the even points of the first and the odd points
+  // of the second source field of its neighbour, the halo buffer contains
+  // the points of the first field followed by the ones of the second field
+  Xt_redist src_redists[NUM_SRC_FIELDS];
+  {
+    int neighbour = (comm_rank + 1) % NUM_PROCS;
+    Xt_int src_indices[SRC_FIELD_SIZE];
+    Xt_int dst_indices[SRC_FIELD_SIZE / 2];
+    for (size_t field_idx = 0; field_idx < NUM_SRC_FIELDS; ++field_idx) {
+      Xt_int field_offset =
+        (Xt_int)(field_idx * NUM_PROCS * SRC_FIELD_SIZE);
+      for (size_t i = 0; i < SRC_FIELD_SIZE; ++i)
+        src_indices[i] =
+          field_offset + (Xt_int)(comm_rank * SRC_FIELD_SIZE) + (Xt_int)i;
+      for (size_t i = 0; i < SRC_FIELD_SIZE / 2; ++i)
+        dst_indices[i] =
+          field_offset + (Xt_int)(neighbour * SRC_FIELD_SIZE) +
+          (Xt_int)(2 * i + field_idx);
+      Xt_idxlist src_idxlist = xt_idxvec_new(src_indices, SRC_FIELD_SIZE);
+      Xt_idxlist dst_idxlist = xt_idxvec_new(dst_indices, SRC_FIELD_SIZE / 2);
+      Xt_xmap xmap =
+        xt_xmap_all2all_new(src_idxlist, dst_idxlist, MPI_COMM_WORLD);
+      src_redists[field_idx] = xt_redist_p2p_new(xmap, MPI_DOUBLE);
+      xt_xmap_delete(xmap);
+      xt_idxlist_delete(dst_idxlist);
+      xt_idxlist_delete(src_idxlist);
+    }
+  }
+
+  // generate stencils (target points are written in reverse order)
+  size_t * tgt_pos = xmalloc(TGT_COUNT * sizeof(*tgt_pos));
+  size_t * num_src_per_tgt = xmalloc(TGT_COUNT * sizeof(*num_src_per_tgt));
+  size_t * src_field_idx =
+    xmalloc(TGT_COUNT * MAX_NUM_SRC_PER_TGT * sizeof(*src_field_idx));
+  size_t * src_idx =
+    xmalloc(TGT_COUNT * MAX_NUM_SRC_PER_TGT * sizeof(*src_idx));
+  double * weights =
+    xmalloc(TGT_COUNT * MAX_NUM_SRC_PER_TGT * sizeof(*weights));
+  size_t total_num_src = 0;
+  for (size_t i = 0; i < TGT_COUNT; ++i) {
+    tgt_pos[i] = TGT_COUNT - 1 - i;
+    get_stencil(
+      i, num_src_per_tgt + i, src_field_idx + total_num_src,
+      src_idx + total_num_src, weights + total_num_src);
+    total_num_src += num_src_per_tgt[i];
+  }
+
+  // source data
+  double * src_data_raw =
+    xmalloc(COLLECTION_SIZE * NUM_SRC_FIELDS * SRC_FIELD_SIZE *
+            sizeof(*src_data_raw));
+  double ** src_field_data =
+    xmalloc(COLLECTION_SIZE * NUM_SRC_FIELDS * sizeof(*src_field_data));
+  double *** src_data = xmalloc(COLLECTION_SIZE * sizeof(*src_data));
+  for (size_t c = 0; c < COLLECTION_SIZE; ++c) {
+    src_data[c] = src_field_data + c * NUM_SRC_FIELDS;
+    for (size_t field_idx = 0; field_idx < NUM_SRC_FIELDS; ++field_idx) {
+      src_data[c][field_idx] =
+        src_data_raw + (c * NUM_SRC_FIELDS + field_idx) * SRC_FIELD_SIZE;
+      for (size_t i = 0; i < SRC_FIELD_SIZE; ++i)
+        src_data[c][field_idx][i] = src_value(comm_rank, field_idx, i, c);
+    }
+  }
+
+  // halo data (as received from the neighbour)
+  double halo_data[COLLECTION_SIZE][HALO_SIZE];
+  for (size_t c = 0; c < COLLECTION_SIZE; ++c)
+    for (size_t i = 0; i < HALO_SIZE; ++i)
+      halo_data[c][i] =
+        src_value(
+          (comm_rank + 1) % NUM_PROCS, i / (HALO_SIZE / 2),
+          2 * (i % (HALO_SIZE / 2)) + i / (HALO_SIZE / 2), c);
+
+  // target data
+  double * tgt_data_raw =
+    xmalloc(COLLECTION_SIZE * TGT_COUNT * sizeof(*tgt_data_raw));
+  double * tgt_data[COLLECTION_SIZE];
+  for (size_t c = 0; c < COLLECTION_SIZE; ++c)
+    tgt_data[c] = tgt_data_raw + c * TGT_COUNT;
+  double * ref_tgt_data =
+    xmalloc(COLLECTION_SIZE * TGT_COUNT * sizeof(*ref_tgt_data));
+
+  for (int with_weights = 0; with_weights < 2; ++with_weights) {
+
+    // reference results (summation in stencil order)
+    for (size_t c = 0; c < COLLECTION_SIZE; ++c) {
+      for (size_t i = 0, k = 0; i < TGT_COUNT; ++i) {
+        double tgt_value = 0.0;
+        for (size_t j = 0; j < num_src_per_tgt[i]; ++j, ++k) {
+          double value =
+            (src_field_idx[k] == SIZE_MAX)?
+              halo_data[c][src_idx[k]]:
+              src_data[c][src_field_idx[k]][src_idx[k]];
+          tgt_value += with_weights?(weights[k] * value):value;
+        }
+        ref_tgt_data[c * TGT_COUNT + tgt_pos[i]] =
+          tgt_value * SCALE_FACTOR + SCALE_SUMMAND;
+      }
+    }
+
+    struct interpolation * interp =
+      yac_interpolation_new(
+        COLLECTION_SIZE, YAC_FRAC_MASK_NO_VALUE, SCALE_FACTOR, SCALE_SUMMAND);
+    if (with_weights)
+      yac_interpolation_add_weight_sum_mvp_at_tgt(
+        interp, src_redists, tgt_pos, TGT_COUNT, num_src_per_tgt, weights,
+        src_field_idx, src_idx, NUM_SRC_FIELDS);
+    else
+      yac_interpolation_add_sum_at_tgt(
+        interp, src_redists, tgt_pos, TGT_COUNT, num_src_per_tgt,
+        src_field_idx, src_idx, NUM_SRC_FIELDS);
+    struct interpolation * interp_copy = yac_interpolation_copy(interp);
+
+    struct interpolation * interps[2] = {interp, interp_copy};
+    for (int i = 0; i < 2; ++i) {
+
+      // synchronous exchange
+      init_tgt_data(tgt_data);
+      yac_interpolation_execute(interps[i], src_data, tgt_data);
+      if (check_tgt_data(tgt_data, ref_tgt_data))
+        PUT_ERR("ERROR in yac_interpolation_execute");
+
+      // first put then get
+      init_tgt_data(tgt_data);
+      yac_interpolation_execute_put(interps[i], src_data);
+      yac_interpolation_execute_get(interps[i], tgt_data);
+      if (check_tgt_data(tgt_data, ref_tgt_data))
+        PUT_ERR("ERROR in yac_interpolation_execute_put/get");
+
+#ifdef _OPENMP
+      if (compare_threaded(interps[i], src_data, tgt_data))
+        PUT_ERR("ERROR: threaded results differ from serial ones");
+#endif
+    }
+
+    yac_interpolation_delete(interp_copy);
+    yac_interpolation_delete(interp);
+  }
+
+  free(ref_tgt_data);
+  free(tgt_data_raw);
+  free(src_data);
+  free(src_field_data);
+  free(src_data_raw);
+  free(weights);
+  free(src_idx);
+  free(src_field_idx);
+  free(num_src_per_tgt);
+  free(tgt_pos);
+  for (size_t field_idx = 0; field_idx < NUM_SRC_FIELDS; ++field_idx)
+    xt_redist_delete(src_redists[field_idx]);
+
+  xt_finalize();
+  MPI_Finalize();
+
+  return TEST_EXIT_CODE;
+}
+
+// even targets only depend on local source points, odd targets alternate
+// between halo and local source points
+static void get_stencil(
+  size_t tgt_idx, size_t * num_src, size_t * src_field_idx, size_t * src_idx,
+  double * weights) {
+
+  int is_local = !(tgt_idx & 1);
+  *num_src = is_local?(1 + tgt_idx % 4):(2 + tgt_idx % 3);
+
+  for (size_t k = 0; k < *num_src; ++k) {
+    if (is_local) {
+      src_field_idx[k] = k % NUM_SRC_FIELDS;
+      src_idx[k] = (3 * tgt_idx + 17 * k) % SRC_FIELD_SIZE;
+    } else if (k & 1) {
+      src_field_idx[k] = (k / 2) % NUM_SRC_FIELDS;
+      src_idx[k] = (tgt_idx + k) % SRC_FIELD_SIZE;
+    } else {
+      src_field_idx[k] = SIZE_MAX;
+      src_idx[k] = (5 * tgt_idx + 31 * k) % HALO_SIZE;
+    }
+    weights[k] = 0.25 + (double)((tgt_idx + 7 * k) % 13) * 0.125;
+  }
+}
+
+static void init_tgt_data(double ** tgt_data) {
+
+  for (size_t c = 0; c < COLLECTION_SIZE; ++c)
+    for (size_t i = 0; i < TGT_COUNT; ++i) tgt_data[c][i] = UNSET;
+}
+
+static int check_tgt_data(double ** tgt_data, double * ref_tgt_data) {
+
+  int diff_count = 0;
+  for (size_t c = 0; c < COLLECTION_SIZE; ++c)
+    for (size_t i = 0; i < TGT_COUNT; ++i)
+      if (fabs(tgt_data[c][i] - ref_tgt_data[c * TGT_COUNT + i]) > 1e-9)
+        ++diff_count;
+  return diff_count;
+}
+
+#ifdef _OPENMP
+// compares the results of the serial and the threaded evaluation bitwise
+static int compare_threaded(
+  struct interpolation * interp, double *** src_data, double ** tgt_data) {
+
+  int max_threads = omp_get_max_threads();
+  int diff_count = 0;
+
+  double * serial_tgt_data_raw =
+    xmalloc(COLLECTION_SIZE * TGT_COUNT * sizeof(*serial_tgt_data_raw));
+  double * serial_tgt_data[COLLECTION_SIZE];
+  for (size_t c = 0; c < COLLECTION_SIZE; ++c)
+    serial_tgt_data[c] = serial_tgt_data_raw + c * TGT_COUNT;
+
+  for (int use_put_get = 0; use_put_get < 2; ++use_put_get) {
+
+    int num_threads[2] = {1, NUM_THREADS};
+    double ** results[2] = {serial_tgt_data, tgt_data};
+    for (int i = 0; i < 2; ++i) {
+      omp_set_num_threads(num_threads[i]);
+      init_tgt_data(results[i]);
+      if (use_put_get) {
+        yac_interpolation_execute_put(interp, src_data);
+        yac_interpolation_execute_get(interp, results[i]);
+      } else {
+        yac_interpolation_execute(interp, src_data, results[i]);
+      }
+    }
+
+    for (size_t c = 0; c < COLLECTION_SIZE; ++c)
+      if (memcmp(serial_tgt_data[c], tgt_data[c],
+                 TGT_COUNT * sizeof(**tgt_data)))
+        ++diff_count;
+  }
+
+  omp_set_num_threads(max_threads);
+  free(serial_tgt_data_raw);
+
+  return diff_count;
+}
+#endif
@@ -217,6 +217,33 @@ int main(void) {
     free(ref_io_ranks);
   }
 
+  { // parallel NetCDF
+
+    // clear environment
+    clear_yac_io_env();
+
+    if (yac_get_io_parallel_netcdf(MPI_COMM_WORLD))
+      PUT_ERR("parallel NetCDF should be disabled by default");
+
+    // the environment is only evaluated on rank 0
+    if (comm_rank == 0) setenv("YAC_IO_PARALLEL_NETCDF", "1", 1);
+
+#ifdef YAC_NETCDF_PARALLEL_ENABLED
+    int ref_parallel_netcdf = 1;
+#else
+    int ref_parallel_netcdf = 0;
+#endif
+    if (yac_get_io_parallel_netcdf(MPI_COMM_WORLD) != ref_parallel_netcdf)
+      PUT_ERR("wrong parallel NetCDF flag");
+
+    if (comm_rank == 0) setenv("YAC_IO_PARALLEL_NETCDF", "0", 1);
+
+    if (yac_get_io_parallel_netcdf(MPI_COMM_WORLD))
+      PUT_ERR("parallel NetCDF should be disabled");
+
+    clear_yac_io_env();
+  }
+
   MPI_Finalize();
 
   return TEST_EXIT_CODE;
@@ -0,0 +1,257 @@
+/**
+ * @file test_lazy_setup_c.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <yaxt.h>
+#include "tests.h"
+#include "yac_interface.h"
+
+#define YAC_RAD (0.01745329251994329576923690768489) // M_PI / 180
+
+/* This test checks the lazy setup of interpolations. Both components first
+ * put their source field and afterwards get their target field. Hence, the
+ * interpolations of both couples have to be generated on the first put. */
+
+#define NUM_STEPS (3)
+
+static void run_comp_a(int with_eager_field);
+static void run_comp_b(void);
+
+int main (void) {
+
+  MPI_Init(NULL, NULL);
+  xt_initialize(MPI_COMM_WORLD);
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  for (int with_eager_field = 0; with_eager_field < 2; ++with_eager_field) {
+    switch(rank) {
+      case(0):
+        run_comp_a(with_eager_field);
+        break;
+      case(1):
+        run_comp_b();
+        break;
+      default:
+        PUT_ERR("wrong number of processes (has to be 2)");
+        break;
+    }
+  }
+
+  xt_finalize();
+  MPI_Finalize();
+  return TEST_EXIT_CODE;
+}
+
+static void run_comp_a(int with_eager_field) {
+
+  // initialise YAC default instance
+  yac_cinit();
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+  yac_cdef_datetime("2000-01-01T00:00:00", "2000-01-01T00:00:12");
+  yac_cenable_lazy_setup();
+
+  // define local component
+  int comp_id;
+  yac_cdef_comp("comp_A", &comp_id);
+
+  int nbr_vertices = 4;
+  int nbr_cells = 2;
+  int nbr_vertices_per_cell[2] = {3,3};
+  double x_vertices[4] =
+    {0.0 * YAC_RAD, -1.0 * YAC_RAD, 1.0 * YAC_RAD, 0.0 * YAC_RAD};
+  double y_vertices[4] =
+    {1.0 * YAC_RAD, 0.0 * YAC_RAD, 0.0 * YAC_RAD, -1.0 * YAC_RAD};
+  int cell_to_vertex[6] = {0,1,2, 1,3,2};
+
+  /* define local grid
+
+      0
+     / \
+    / o \
+   /     \
+  1-------2   Eq.
+   \     /
+    \ o /
+     \ /
+      3
+
+  */
+  int grid_id;
+  yac_cdef_grid_unstruct(
+    "grid_A", nbr_vertices, nbr_cells, nbr_vertices_per_cell,
+    x_vertices, y_vertices, cell_to_vertex, &grid_id);
+
+  double x_cells[2] = {0.0 * YAC_RAD, 0.0 * YAC_RAD};
+  double y_cells[2] = {0.5 * YAC_RAD, -0.5 * YAC_RAD};
+
+  int cell_point_id;
+  yac_cdef_points_unstruct(
+    grid_id, nbr_cells, YAC_LOCATION_CELL, x_cells, y_cells, &cell_point_id);
+
+  // define fields
+  int src_field_id, tgt_field_id;
+  int collection_size = 1;
+  yac_cdef_field(
+    "A_to_B", comp_id, &cell_point_id, 1,
+    collection_size, "1", YAC_TIME_UNIT_SECOND, &src_field_id);
+  yac_cdef_field(
+    "B_to_A", comp_id, &cell_point_id, 1,
+    collection_size, "1", YAC_TIME_UNIT_SECOND, &tgt_field_id);
+
+  // marking a field on a single process disables the lazy setup for all
+  // couples of the component pair
+  if (with_eager_field) yac_cset_field_eager_setup(src_field_id);
+
+  // generate coupling
+  yac_cenddef();
+
+  // there is no outstanding put before the first exchange
+  int flag;
+  yac_ctest(src_field_id, &flag);
+  if (!flag) PUT_ERR("ERROR in yac_ctest");
+
+  for (int step = 0; step < NUM_STEPS; ++step) {
+
+    float send_field_data[2] = {3.0f, 4.0f};
+    float * send_field_[1] = {&send_field_data[0]};
+    float ** send_field[1] = {&send_field_[0]};
+    int info, ierror;
+    yac_cput_float(src_field_id, collection_size, send_field, &info, &ierror);
+
+    double recv_field_data[2] = {-1.0, -1.0};
+    double * recv_field[1] = {&recv_field_data[0]};
+    yac_cget(tgt_field_id, collection_size, recv_field, &info, &ierror);
+
+    if ((recv_field_data[0] != 20.0) || (recv_field_data[1] != 10.0))
+      PUT_ERR("ERROR: wrong results for B_to_A");
+  }
+
+  // finalise YAC default instance
+  yac_cfinalize();
+}
+
+static void run_comp_b(void) {
+
+  // initialise YAC default instance
+  yac_cinit();
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+  yac_cdef_datetime("2000-01-01T00:00:00", "2000-01-01T00:00:12");
+  yac_cenable_lazy_setup();
+
+  // define local component
+  int comp_id;
+  yac_cdef_comp("comp_B", &comp_id);
+
+  int nbr_vertices[2] = {2,3};
+  int cyclic[2] = {0,0};
+  double x_vertices[2] = {-0.5 * YAC_RAD, 0.5 * YAC_RAD};
+  double y_vertices[3] = {-1.0 * YAC_RAD, 0.0 * YAC_RAD, 1.0 * YAC_RAD};
+
+  /* define local grid
+
+  4-------5
+  |       |
+  |   o   |
+  |       |
+  2-------3
+  |       |
+  |   o   |
+  |       |
+  0-------1
+
+  */
+  int grid_id;
+  yac_cdef_grid_reg2d(
+    "grid_B", nbr_vertices, cyclic, x_vertices, y_vertices, &grid_id);
+
+  int nbr_cells[2] = {1,2};
+  double x_cells[1] = {0.0 * YAC_RAD};
+  double y_cells[2] = {-0.5 * YAC_RAD, 0.5 * YAC_RAD};
+
+  int cell_point_id;
+  yac_cdef_points_reg2d(
+    grid_id, nbr_cells, YAC_LOCATION_CELL, x_cells, y_cells, &cell_point_id);
+
+  // define fields
+  int src_field_id, tgt_field_id;
+  int collection_size = 1;
+  yac_cdef_field(
+    "B_to_A", comp_id, &cell_point_id, 1,
+    collection_size, "1", YAC_TIME_UNIT_SECOND, &src_field_id);
+  yac_cdef_field(
+    "A_to_B", comp_id, &cell_point_id, 1,
+    collection_size, "1", YAC_TIME_UNIT_SECOND, &tgt_field_id);
+
+  // define interpolation stack
+  int interp_stack;
+  yac_cget_interp_stack_config(&interp_stack);
+  yac_cadd_interp_stack_config_nnn(interp_stack, YAC_NNN_AVG, 1, 0.0);
+
+  // define couplings
+  yac_cdef_couple(
+    "comp_A", "grid_A", "A_to_B", "comp_B", "grid_B", "A_to_B",
+    "PT01.000S", YAC_TIME_UNIT_ISO_FORMAT, YAC_REDUCTION_TIME_NONE,
+    interp_stack, 0, 0);
+  yac_cdef_couple(
+    "comp_B", "grid_B", "B_to_A", "comp_A", "grid_A", "B_to_A",
+    "PT01.000S", YAC_TIME_UNIT_ISO_FORMAT, YAC_REDUCTION_TIME_NONE,
+    interp_stack, 0, 0);
+  yac_cfree_interp_stack_config(interp_stack);
+
+  // generate coupling
+  yac_cenddef();
+
+  for (int step = 0; step < NUM_STEPS; ++step) {
+
+    double send_field_data[2] = {10.0, 20.0};
+    double * send_field_[1] = {&send_field_data[0]};
+    double ** send_field[1] = {&send_field_[0]};
+    int info, ierror;
+    yac_cput(src_field_id, collection_size, send_field, &info, &ierror);
+
+    double recv_field_data[2] = {-1.0, -1.0};
+    double * recv_field[1] = {&recv_field_data[0]};
+    yac_cget(tgt_field_id, collection_size, recv_field, &info, &ierror);
+
+    if ((recv_field_data[0] != 4.0) || (recv_field_data[1] != 3.0))
+      PUT_ERR("ERROR: wrong results for A_to_B");
+  }
+
+  // finalise YAC default instance
+  yac_cfinalize();
+}
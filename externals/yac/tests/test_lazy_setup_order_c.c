@@ -0,0 +1,154 @@
+/**
+ * @file test_lazy_setup_order_c.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <yaxt.h>
+#include "tests.h"
+#include "yac_interface.h"
+
+#define YAC_RAD (0.01745329251994329576923690768489) // M_PI / 180
+
+/* This test checks the detection of an inconsistent order of the first
+ * exchanges of lazily set up component pairs. The first process runs comp_A,
+ * the second one comp_B and comp_C. The first process starts with an
+ * exchange between comp_A and comp_C, while the second one starts with an
+ * exchange between comp_A and comp_B. Without the check, both processes
+ * would wait for each other in the setups of different component pairs.
+ * This test is expected to abort. */
+
+static void def_grid(
+  char const * grid_name, int comp_id, char const ** field_names,
+  int num_fields, int * field_ids) {
+
+  int nbr_vertices[2] = {2,3};
+  int cyclic[2] = {0,0};
+  double x_vertices[2] = {-0.5 * YAC_RAD, 0.5 * YAC_RAD};
+  double y_vertices[3] = {-1.0 * YAC_RAD, 0.0 * YAC_RAD, 1.0 * YAC_RAD};
+
+  int grid_id;
+  yac_cdef_grid_reg2d(
+    grid_name, nbr_vertices, cyclic, x_vertices, y_vertices, &grid_id);
+
+  int nbr_cells[2] = {1,2};
+  double x_cells[1] = {0.0 * YAC_RAD};
+  double y_cells[2] = {-0.5 * YAC_RAD, 0.5 * YAC_RAD};
+
+  int cell_point_id;
+  yac_cdef_points_reg2d(
+    grid_id, nbr_cells, YAC_LOCATION_CELL, x_cells, y_cells, &cell_point_id);
+
+  for (int i = 0; i < num_fields; ++i)
+    yac_cdef_field(
+      field_names[i], comp_id, &cell_point_id, 1, 1, "1",
+      YAC_TIME_UNIT_SECOND, field_ids + i);
+}
+
+int main (void) {
+
+  MPI_Init(NULL, NULL);
+  xt_initialize(MPI_COMM_WORLD);
+
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (size != 2) {
+    PUT_ERR("wrong number of processes (has to be 2)");
+    xt_finalize();
+    MPI_Finalize();
+    return TEST_EXIT_CODE;
+  }
+
+  yac_cinit();
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+  yac_cdef_datetime("2000-01-01T00:00:00", "2000-01-01T00:00:12");
+  yac_cenable_lazy_setup();
+
+  char const * comp_names[2][2] = {{"comp_A", NULL}, {"comp_B", "comp_C"}};
+  int num_comps = (rank == 0)?1:2;
+  int comp_ids[2];
+  yac_cdef_comps(comp_names[rank], num_comps, comp_ids);
+
+  char const * grid_names[2][2] = {{"grid_A", NULL}, {"grid_B", "grid_C"}};
+  char const * field_names[2] = {"A_to_B", "A_to_C"};
+  int field_ids[2];
+  if (rank == 0)
+    def_grid(grid_names[0][0], comp_ids[0], field_names, 2, field_ids);
+  else
+    for (int i = 0; i < 2; ++i)
+      def_grid(
+        grid_names[1][i], comp_ids[i], field_names + i, 1, field_ids + i);
+
+  if (rank == 0) {
+    int interp_stack;
+    yac_cget_interp_stack_config(&interp_stack);
+    yac_cadd_interp_stack_config_nnn(interp_stack, YAC_NNN_AVG, 1, 0.0);
+    for (int i = 0; i < 2; ++i)
+      yac_cdef_couple(
+        "comp_A", "grid_A", field_names[i],
+        comp_names[1][i], grid_names[1][i], field_names[i],
+        "1", YAC_TIME_UNIT_SECOND, YAC_REDUCTION_TIME_NONE,
+        interp_stack, 0, 0);
+    yac_cfree_interp_stack_config(interp_stack);
+  }
+
+  yac_cenddef();
+
+  int info, ierror;
+  if (rank == 0) {
+
+    // first exchange of the pair (comp_A, comp_C)
+    double send_field_data[2] = {1.0, 2.0};
+    double * send_field_[1] = {&send_field_data[0]};
+    double ** send_field[1] = {&send_field_[0]};
+    yac_cput(field_ids[1], 1, send_field, &info, &ierror);
+
+  } else {
+
+    // first exchange of the pair (comp_A, comp_B)
+    double recv_field_data[2];
+    double * recv_field[1] = {&recv_field_data[0]};
+    yac_cget(field_ids[0], 1, recv_field, &info, &ierror);
+  }
+
+  PUT_ERR("ERROR: inconsistent order of lazy setups was not detected");
+
+  yac_cfinalize();
+
+  xt_finalize();
+  MPI_Finalize();
+  return TEST_EXIT_CODE;
+}
@@ -849,6 +849,44 @@ static void check_partial_areas(
   yac_compute_overlap_areas(
     nSourceCells, SourceCells, TargetCell, partial_areas);
 
+  { // the reentrant and the batched version have to give identical results
+
+    struct yac_clipping_buffer * buffer = yac_clipping_buffer_new();
+    double partial_areas_r[nSourceCells];
+    for (int i = 0; i < 2; ++i) { // second iteration reuses the buffer
+      yac_compute_overlap_areas_r(
+        buffer, nSourceCells, SourceCells, TargetCell, partial_areas_r);
+      for (size_t j = 0; j < nSourceCells; ++j)
+        if (partial_areas_r[j] != partial_areas[j])
+          PUT_ERR("ERROR in yac_compute_overlap_areas_r\n");
+    }
+    yac_clipping_buffer_delete(buffer);
+
+    // batch containing the target cell multiple times (the second entry has
+    // no source cells)
+    enum {NUM_BATCH_TGT = 4};
+    struct grid_cell batch_tgt_cells[NUM_BATCH_TGT];
+    size_t batch_num_src_per_tgt[NUM_BATCH_TGT];
+    struct grid_cell * batch_src_cells =
+      xmalloc((NUM_BATCH_TGT - 1) * nSourceCells * sizeof(*batch_src_cells));
+    double * batch_areas =
+      xmalloc((NUM_BATCH_TGT - 1) * nSourceCells * sizeof(*batch_areas));
+    for (size_t i = 0, k = 0; i < NUM_BATCH_TGT; ++i) {
+      batch_tgt_cells[i] = TargetCell;
+      batch_num_src_per_tgt[i] = (i == 1)?0:nSourceCells;
+      for (size_t j = 0; j < batch_num_src_per_tgt[i]; ++j, ++k)
+        batch_src_cells[k] = SourceCells[j];
+    }
+    yac_compute_overlap_info_batch(
+      NUM_BATCH_TGT, batch_tgt_cells, batch_num_src_per_tgt,
+      batch_src_cells, batch_areas, NULL);
+    for (size_t i = 0; i < (NUM_BATCH_TGT - 1) * nSourceCells; ++i)
+      if (batch_areas[i] != partial_areas[i % nSourceCells])
+        PUT_ERR("ERROR in yac_compute_overlap_info_batch\n");
+    free(batch_areas);
+    free(batch_src_cells);
+  }
+
   double partial_areas_sum = 0.0;
   double weights[nSourceCells];
   for (size_t i = 0; i < nSourceCells; ++i) {
@@ -45,6 +45,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <float.h>
+#include <string.h>
 
 #include "tests.h"
 #include "test_common.h"
@@ -58,6 +59,7 @@ static void single_point_test();
 static void empty_branch_test(size_t num_points);
 static void zero_balance_point();
 static void duplicated_point_test();
+static void batch_test(size_t num_points, size_t num_search_points);
 
 int main(void) {
 
@@ -75,6 +77,8 @@ int main(void) {
   empty_branch_test(128);
   zero_balance_point();
   duplicated_point_test();
+  batch_test(1000, 2000);
+  batch_test(5, 1000);
 
   return TEST_EXIT_CODE;
 }
@@ -489,3 +493,96 @@ static void duplicated_point_test() {
   free(result_coordinates_xyz);
   yac_delete_point_sphere_part_search(search);
 }
+
+static void batch_test(size_t num_points, size_t num_search_points) {
+
+  double (*coordinates_xyz)[3] =
+    xmalloc((num_points + num_search_points) * sizeof(*coordinates_xyz));
+  double (*search_coordinates_xyz)[3] = coordinates_xyz + num_points;
+  yac_int * global_ids = xmalloc(num_points * sizeof(*global_ids));
+
+  for (size_t i = 0; i < num_points + num_search_points; ++i)
+    gen_random_point(coordinates_xyz[i]);
+  for (size_t i = 0; i < num_points; ++i) global_ids[i] = (yac_int)i;
+
+  // some search points match source points exactly
+  for (size_t i = 0; i < num_search_points; i += 7)
+    memcpy(search_coordinates_xyz[i], coordinates_xyz[i % num_points],
+           3 * sizeof(double));
+
+  struct point_sphere_part_search * search =
+    yac_point_sphere_part_search_new(num_points, coordinates_xyz, global_ids);
+
+  double * cos_angles[2] = {NULL, NULL};
+  size_t cos_angles_array_size[2] = {0, 0};
+  double (*result_coordinates_xyz[2])[3] = {NULL, NULL};
+  size_t result_coordinates_xyz_array_size[2] = {0, 0};
+  size_t * local_point_ids[2] = {NULL, NULL};
+  size_t local_point_ids_array_size[2] = {0, 0};
+  size_t * num_local_point_ids =
+    xmalloc(2 * num_search_points * sizeof(*num_local_point_ids));
+
+  size_t ns[] = {1, 4, 9};
+
+  for (size_t i = 0; i < sizeof(ns) / sizeof(ns[0]); ++i) {
+
+    if (ns[i] > num_points) continue;
+
+    // reference results
+    yac_point_sphere_part_search_NNN(
+      search, num_search_points, search_coordinates_xyz, ns[i],
+      &cos_angles[0], &cos_angles_array_size[0],
+      &result_coordinates_xyz[0], &result_coordinates_xyz_array_size[0],
+      &local_point_ids[0], &local_point_ids_array_size[0],
+      num_local_point_ids);
+
+    // batched search has to return exactly the same results
+    yac_point_sphere_part_search_NNN_batch(
+      search, num_search_points, search_coordinates_xyz, ns[i],
+      &cos_angles[1], &cos_angles_array_size[1],
+      &result_coordinates_xyz[1], &result_coordinates_xyz_array_size[1],
+      &local_point_ids[1], &local_point_ids_array_size[1],
+      num_local_point_ids + num_search_points);
+
+    size_t total_num_results = 0;
+    for (size_t j = 0; j < num_search_points; ++j) {
+      if (num_local_point_ids[j] != num_local_point_ids[num_search_points + j])
+        PUT_ERR("ERROR in yac_point_sphere_part_search_NNN_batch: "
+                "wrong number of results");
+      total_num_results += num_local_point_ids[j];
+    }
+
+    if (memcmp(local_point_ids[0], local_point_ids[1],
+               total_num_results * sizeof(*local_point_ids[0])) ||
+        memcmp(cos_angles[0], cos_angles[1],
+               total_num_results * sizeof(*cos_angles[0])) ||
+        memcmp(result_coordinates_xyz[0], result_coordinates_xyz[1],
+               total_num_results * sizeof(*result_coordinates_xyz[0])))
+      PUT_ERR("ERROR in yac_point_sphere_part_search_NNN_batch: "
+              "wrong results");
+
+    // optional results are not required
+    yac_point_sphere_part_search_NNN_batch(
+      search, num_search_points, search_coordinates_xyz, ns[i],
+      NULL, NULL, NULL, NULL, &local_point_ids[1],
+      &local_point_ids_array_size[1], num_local_point_ids + num_search_points);
+
+    if (memcmp(num_local_point_ids, num_local_point_ids + num_search_points,
+               num_search_points * sizeof(*num_local_point_ids)) ||
+        memcmp(local_point_ids[0], local_point_ids[1],
+               total_num_results * sizeof(*local_point_ids[0])))
+      PUT_ERR("ERROR in yac_point_sphere_part_search_NNN_batch: "
+              "wrong results");
+  }
+
+  yac_delete_point_sphere_part_search(search);
+
+  for (int i = 0; i < 2; ++i) {
+    free(cos_angles[i]);
+    free(result_coordinates_xyz[i]);
+    free(local_point_ids[i]);
+  }
+  free(num_local_point_ids);
+  free(global_ids);
+  free(coordinates_xyz);
+}
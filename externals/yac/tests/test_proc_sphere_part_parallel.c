@@ -49,6 +49,10 @@
 #include "proc_sphere_part.h"
 #include "yac_mpi.h"
 
+static void check_redist(
+  struct proc_sphere_part_node * proc_sphere_part, struct dist_cell * cells,
+  size_t num_cells, uint64_t ref_global_num_cells);
+
 int main(void) {
 
   MPI_Init(NULL, NULL);
@@ -59,64 +63,105 @@ int main(void) {
 
   YAC_ASSERT(comm_size == 5, "ERROR wrong number of processes (has to be 5)")
 
-  {
-    // one process has no data
-    double x_vertices[18] = {0,20,40,60,80,
-                             100,120,140,160,180,
-                             200,220,240,260,280,
-                             300,320,340};
-    double y_vertices[9] = {-80,-60,-40,-20,0,20,40,60,80};
-    size_t local_start[5][2] = {{0,0},{7,0},{0,0},{0,3},{7,3}};
-    size_t local_count[5][2] = {{10,6},{10,6},{0,0},{10,6},{10,6}};
-    size_t num_cells = local_count[comm_rank][0] * local_count[comm_rank][1];
-    struct dist_cell * cells = xmalloc(num_cells * sizeof(*cells));
-
-    for (size_t i = 0, k = 0; i < local_count[comm_rank][1]; ++i)
-      for (size_t j = 0; j < local_count[comm_rank][0]; ++j, ++k)
-        LLtoXYZ_deg(
-          x_vertices[local_start[comm_rank][0]+j],
-          y_vertices[local_start[comm_rank][1]+i], cells[k].coord);
-
-    struct proc_sphere_part_node * proc_sphere_part =
-      yac_redistribute_cells(&cells, &num_cells, MPI_COMM_WORLD);
-
-    free(cells);
-
-    yac_proc_sphere_part_node_delete(proc_sphere_part);
-  }
+  // test all redistribution algorithms
+  char const * redist_modes[] = {"recursive", "single_pass"};
+  enum {NUM_MODES = sizeof(redist_modes) / sizeof(redist_modes[0])};
 
-  {
-    double coords[5][2][3] =
-      {{{1,0,0},{-1,0,0}},
-       {{0,1,0}},
-       {{0,-1,0}},
-       {{0,0,1}},
-       {{0,0,-1}}};
-    size_t num_cells[5] = {2,1,1,1,1};
-    struct dist_cell * cells = xmalloc(2 * sizeof(*cells));
+  for (int mode = 0; mode < NUM_MODES; ++mode) {
 
-    for (int i = 0; i < num_cells[comm_rank]; ++i)
-      for (int j = 0; j < 3; ++j)
-        cells[i].coord[j] = coords[comm_rank][i][j];
+    if (comm_rank == 0)
+      setenv(YAC_PROC_SPHERE_PART_REDIST_ENV, redist_modes[mode], 1);
 
-    struct proc_sphere_part_node * proc_sphere_part =
-      yac_redistribute_cells(&cells, &num_cells[comm_rank], MPI_COMM_WORLD);
+    {
+      // one process has no data
+      double x_vertices[18] = {0,20,40,60,80,
+                               100,120,140,160,180,
+                               200,220,240,260,280,
+                               300,320,340};
+      double y_vertices[9] = {-80,-60,-40,-20,0,20,40,60,80};
+      size_t local_start[5][2] = {{0,0},{7,0},{0,0},{0,3},{7,3}};
+      size_t local_count[5][2] = {{10,6},{10,6},{0,0},{10,6},{10,6}};
+      size_t num_cells = local_count[comm_rank][0] * local_count[comm_rank][1];
+      struct dist_cell * cells = xmalloc(num_cells * sizeof(*cells));
 
-    free(cells);
+      for (size_t i = 0, k = 0; i < local_count[comm_rank][1]; ++i)
+        for (size_t j = 0; j < local_count[comm_rank][0]; ++j, ++k)
+          LLtoXYZ_deg(
+            x_vertices[local_start[comm_rank][0]+j],
+            y_vertices[local_start[comm_rank][1]+i], cells[k].coord);
 
-    yac_proc_sphere_part_node_delete(proc_sphere_part);
-  }
+      struct proc_sphere_part_node * proc_sphere_part =
+        yac_redistribute_cells(&cells, &num_cells, MPI_COMM_WORLD);
+
+      check_redist(proc_sphere_part, cells, num_cells, 17 * 9);
+
+      free(cells);
+
+      yac_proc_sphere_part_node_delete(proc_sphere_part);
+    }
+
+    {
+      double coords[5][2][3] =
+        {{{1,0,0},{-1,0,0}},
+         {{0,1,0}},
+         {{0,-1,0}},
+         {{0,0,1}},
+         {{0,0,-1}}};
+      size_t num_cells[5] = {2,1,1,1,1};
+      struct dist_cell * cells = xmalloc(2 * sizeof(*cells));
+
+      for (int i = 0; i < num_cells[comm_rank]; ++i)
+        for (int j = 0; j < 3; ++j)
+          cells[i].coord[j] = coords[comm_rank][i][j];
+
+      struct proc_sphere_part_node * proc_sphere_part =
+        yac_redistribute_cells(&cells, &num_cells[comm_rank], MPI_COMM_WORLD);
+
+      check_redist(proc_sphere_part, cells, num_cells[comm_rank], 6);
 
-  {
-    size_t num_cells = 0;
+      free(cells);
 
-    struct proc_sphere_part_node * proc_sphere_part =
-      yac_redistribute_cells(NULL, &num_cells, MPI_COMM_WORLD);
+      yac_proc_sphere_part_node_delete(proc_sphere_part);
+    }
 
-    yac_proc_sphere_part_node_delete(proc_sphere_part);
+    {
+      size_t num_cells = 0;
+
+      struct proc_sphere_part_node * proc_sphere_part =
+        yac_redistribute_cells(NULL, &num_cells, MPI_COMM_WORLD);
+
+      yac_proc_sphere_part_node_delete(proc_sphere_part);
+    }
+
+    if (comm_rank == 0) unsetenv(YAC_PROC_SPHERE_PART_REDIST_ENV);
   }
 
   MPI_Finalize();
 
   return TEST_EXIT_CODE;
 }
+
+static void check_redist(
+  struct proc_sphere_part_node * proc_sphere_part, struct dist_cell * cells,
+  size_t num_cells, uint64_t ref_global_num_cells) {
+
+  int comm_rank;
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+
+  // all local cells have to be assigned to the local process
+  for (size_t i = 0; i < num_cells; ++i) {
+    int rank;
+    yac_proc_sphere_part_do_point_search(
+      proc_sphere_part, &(cells[i].coord), 1, &rank);
+    if (rank != comm_rank) PUT_ERR("ERROR in yac_redistribute_cells");
+  }
+
+  // each cell has to be on exactly one process
+  uint64_t global_num_cells = (uint64_t)num_cells;
+  yac_mpi_call(
+    MPI_Allreduce(
+      MPI_IN_PLACE, &global_num_cells, 1, MPI_UINT64_T, MPI_SUM,
+      MPI_COMM_WORLD), MPI_COMM_WORLD);
+  if (global_num_cells != ref_global_num_cells)
+    PUT_ERR("ERROR in yac_redistribute_cells");
+}
@@ -0,0 +1,201 @@
+/**
+ * @file test_progress_thread.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <mpi.h>
+
+#include "yac_interface.h"
+#include "tests.h"
+
+/* Checks that puts and gets stay consistent while the background progress
+ * thread is driving the completion of outstanding puts, including stopping
+ * and restarting the thread in the middle of a run. The weights of the third
+ * field are applied on the target side, such that the progress thread also
+ * evaluates target points once their source data has been received. The
+ * thread is left running at the end to check that yac_cfinalize stops it. */
+
+#define NUM_STEPS (60)
+#define NUM_FIELDS (3)
+
+static int comp_id, grid_id, point_id, field_ids[NUM_FIELDS];
+
+static void defs(const char* comp_name){
+
+  yac_cdef_comp(comp_name, &comp_id);
+
+  int nbr_vertices[2] = {3, 3};
+  int cyclic[2] = {0,0};
+  double x_vertices[3] = {-1, 0, 1};
+  double y_vertices[3] = {-1, 0, 1};
+  yac_cdef_grid_reg2d(
+    comp_name, nbr_vertices, cyclic, x_vertices, y_vertices, &grid_id);
+
+  yac_cdef_points_reg2d(grid_id, nbr_vertices, YAC_LOCATION_CORNER,
+    x_vertices, y_vertices, &point_id );
+
+  yac_cdef_field("field1", comp_id, &point_id, 1, 1, "1",
+    YAC_TIME_UNIT_SECOND, &field_ids[0]);
+  yac_cdef_field("field2", comp_id, &point_id, 1, 1, "1",
+    YAC_TIME_UNIT_SECOND, &field_ids[1]);
+  yac_cdef_field("field3", comp_id, &point_id, 1, 1, "1",
+    YAC_TIME_UNIT_SECOND, &field_ids[2]);
+
+  yac_csync_def();
+
+  int interp_stack_id;
+  yac_cget_interp_stack_config(&interp_stack_id);
+  yac_cadd_interp_stack_config_nnn(
+    interp_stack_id, YAC_NNN_AVG, 1, 1.0);
+
+  yac_cdef_couple("compA", "compA", "field1",
+    "compB", "compB", "field1",
+    "1", YAC_TIME_UNIT_SECOND, YAC_REDUCTION_TIME_NONE,
+    interp_stack_id, 0, 0);
+  yac_cdef_couple("compA", "compA", "field2",
+    "compB", "compB", "field2",
+    "1", YAC_TIME_UNIT_SECOND, YAC_REDUCTION_TIME_NONE,
+    interp_stack_id, 0, 0);
+  yac_cfree_interp_stack_config(interp_stack_id);
+
+  // each target point is the average of multiple source points, which is
+  // computed on the target side
+  yac_cget_interp_stack_config(&interp_stack_id);
+  yac_cadd_interp_stack_config_nnn(
+    interp_stack_id, YAC_NNN_AVG, 4, 1.0);
+  int ext_couple_config;
+  yac_cget_ext_couple_config(&ext_couple_config);
+  yac_cset_ext_couple_config_mapping_side(ext_couple_config, 0);
+  yac_cdef_couple_custom("compA", "compA", "field3",
+    "compB", "compB", "field3",
+    "1", YAC_TIME_UNIT_SECOND, YAC_REDUCTION_TIME_NONE,
+    interp_stack_id, 0, 0, ext_couple_config);
+  yac_cfree_ext_couple_config(ext_couple_config);
+  yac_cfree_interp_stack_config(interp_stack_id);
+
+  yac_cenddef();
+}
+
+// the third field is constant in space, such that the average of any
+// source points is exact
+static double get_field_value(int field_idx, int t, int i) {
+  return
+    (field_idx < 2)?(double)(100 * field_idx + t + i):(double)(200 + t);
+}
+
+static void compA(){
+
+  defs("compA");
+
+  double buffer[9];
+  for (int t = 0; t < NUM_STEPS; ++t) {
+
+    // stop the thread for a few steps and restart it with another interval
+    if (t == NUM_STEPS / 3) yac_cdisable_progress_thread();
+    if (t == NUM_STEPS / 2) yac_cenable_progress_thread(50);
+
+    for (int j = 0; j < NUM_FIELDS; ++j) {
+      int info, ierror;
+      for (int i = 0; i < 9; ++i) buffer[i] = get_field_value(j, t, i);
+      yac_cput_(field_ids[j], 1, buffer, &info, &ierror);
+      if (info != YAC_ACTION_COUPLING) PUT_ERR("wrong put action");
+      if (ierror != 0) PUT_ERR("error in yac_cput_");
+    }
+
+    // give the puts some time to complete in the background
+    usleep(100);
+
+    int flag;
+    for (int j = 0; j < NUM_FIELDS; ++j) yac_ctest(field_ids[j], &flag);
+  }
+}
+
+static void compB(){
+
+  defs("compB");
+
+  double buffer[9];
+  for (int t = 0; t < NUM_STEPS; ++t) {
+    for (int j = 0; j < NUM_FIELDS; ++j) {
+      int info, ierror;
+      yac_cget_(field_ids[j], 1, buffer, &info, &ierror);
+      if (info != YAC_ACTION_COUPLING) PUT_ERR("wrong get action");
+      if (ierror != 0) PUT_ERR("error in yac_cget_");
+      for (int i = 0; i < 9; ++i)
+        if (buffer[i] != get_field_value(j, t, i))
+          PUT_ERR("wrong get result");
+    }
+  }
+}
+
+int main(void) {
+
+  int provided;
+  MPI_Init_thread(NULL, NULL, MPI_THREAD_MULTIPLE, &provided);
+
+  if(provided < MPI_THREAD_MULTIPLE){
+    printf(
+      "Skip test due to not compatible MPI (MPI_Query_thread: %d)\n",
+      provided);
+    MPI_Finalize();
+    return 77;
+  }
+
+  int size, rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (size != 2) {
+    fputs("wrong number of processes (has to be 2)\n", stderr);
+    exit(EXIT_FAILURE);
+  }
+
+  yac_cinit();
+  yac_cdef_datetime("2023-01-09T14:20:00", "2023-01-09T14:21:00");
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+
+  yac_cenable_progress_thread(10);
+
+  if (rank == 0) compA();
+  else           compB();
+
+  yac_cfinalize();
+
+  MPI_Finalize();
+
+  return TEST_EXIT_CODE;
+}
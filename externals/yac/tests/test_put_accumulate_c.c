@@ -0,0 +1,334 @@
+/**
+ * @file test_put_accumulate_c.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <float.h>
+#include "tests.h"
+#include "test_common.h"
+#include "yac_interface.h"
+
+/* This test checks the results of all time reduction operations of yac_cput
+ * and yac_cput_frac with and without a put mask (source field mask). The
+ * source and target grids are identical and the interpolation maps each
+ * source point to the target point at the same location (weight 1.0). All
+ * data is chosen such that the reference results can be computed exactly. */
+
+enum {
+  NUM_OPS = 4,
+  NUM_FIELDS = NUM_OPS * 2 * 2, // (operation, put mask, fractional mask)
+  COLLECTION_SIZE = 2,
+  NUM_POINTS = 9,
+  COUPLING_DT = 4,
+  NUM_STEPS = 3 * COUPLING_DT + 1,
+};
+
+#define FRAC_MASK_VALUE (1337.0)
+#define RECV_INIT_VALUE (-1.0)
+
+// points 1 and 5 are masked for fields with put mask
+static int const field_mask[NUM_POINTS] = {1, 0, 1, 1, 1, 0, 1, 1, 1};
+
+static double get_send_value(int t, int h, int j) {
+  return (double)(10 * h + j + ((7 * t + 3 * j) % 5) - 2);
+}
+
+// the fractional mask of the last point is always zero
+static double get_frac_mask_value(int t, int h, int j) {
+  static double const frac_values[4] = {0.0, 0.25, 0.5, 1.0};
+  return (j == NUM_POINTS - 1)?0.0:frac_values[(t + j + h) % 4];
+}
+
+static void init_ref(
+  double acc[NUM_FIELDS][COLLECTION_SIZE][NUM_POINTS],
+  double frac_acc[NUM_FIELDS][COLLECTION_SIZE][NUM_POINTS],
+  int const time_ops[NUM_OPS]) {
+
+  for (int i = 0; i < NUM_FIELDS; ++i) {
+    int time_op = time_ops[i / 4];
+    double init_value =
+      (time_op == YAC_REDUCTION_TIME_MINIMUM)?DBL_MAX:
+      ((time_op == YAC_REDUCTION_TIME_MAXIMUM)?-DBL_MAX:0.0);
+    for (int h = 0; h < COLLECTION_SIZE; ++h) {
+      for (int j = 0; j < NUM_POINTS; ++j) {
+        acc[i][h][j] = init_value;
+        frac_acc[i][h][j] = 0.0;
+      }
+    }
+  }
+}
+
+// accumulates the data of one timestep into the reference
+static void accumulate_ref(
+  double acc[NUM_FIELDS][COLLECTION_SIZE][NUM_POINTS],
+  double frac_acc[NUM_FIELDS][COLLECTION_SIZE][NUM_POINTS],
+  int const time_ops[NUM_OPS], int t) {
+
+  for (int i = 0; i < NUM_FIELDS; ++i) {
+
+    int time_op = time_ops[i / 4];
+    int with_put_mask = (i / 2) % 2;
+    int with_frac_mask = i % 2;
+
+    for (int h = 0; h < COLLECTION_SIZE; ++h) {
+      for (int j = 0; j < NUM_POINTS; ++j) {
+
+        if (with_put_mask && !field_mask[j]) continue;
+
+        double frac = (with_frac_mask)?get_frac_mask_value(t, h, j):1.0;
+        if (frac == 0.0) continue;
+        double value = get_send_value(t, h, j) * frac;
+
+        if ((time_op == YAC_REDUCTION_TIME_ACCUMULATE) ||
+            (time_op == YAC_REDUCTION_TIME_AVERAGE)) {
+          acc[i][h][j] += value;
+          frac_acc[i][h][j] += frac;
+        } else if (((time_op == YAC_REDUCTION_TIME_MINIMUM) &&
+                    (acc[i][h][j] > value)) ||
+                   ((time_op == YAC_REDUCTION_TIME_MAXIMUM) &&
+                    (acc[i][h][j] < value))) {
+          acc[i][h][j] = value;
+          frac_acc[i][h][j] = frac;
+        }
+      }
+    }
+  }
+}
+
+// computes the value that is expected at the target for a coupling step
+static double get_ref_recv_value(
+  double acc, double frac_acc, int time_op, int with_frac_mask,
+  int with_put_mask, int j, int count) {
+
+  if (with_put_mask && !field_mask[j]) return RECV_INIT_VALUE;
+
+  double weight = 1.0 / (double)count;
+
+  if (!with_frac_mask)
+    return (time_op == YAC_REDUCTION_TIME_AVERAGE)?(acc * weight):acc;
+
+  // accumulation and averaging average the fractional mask
+  if ((time_op == YAC_REDUCTION_TIME_ACCUMULATE) ||
+      (time_op == YAC_REDUCTION_TIME_AVERAGE)) frac_acc *= weight;
+  if (frac_acc == 0.0) return FRAC_MASK_VALUE;
+  if (time_op == YAC_REDUCTION_TIME_AVERAGE) acc *= weight;
+  return acc / frac_acc;
+}
+
+int main (void) {
+
+  yac_cinit();
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+  yac_cdef_datetime("1850-01-01T00:00:00", "1850-01-03T00:00:00");
+
+  int size, rank;
+  MPI_Comm_rank ( MPI_COMM_WORLD, &rank );
+  MPI_Comm_size ( MPI_COMM_WORLD, &size );
+
+  if (size != 2) {
+    fputs("wrong number of processes (has to be 2)\n", stderr);
+    exit(EXIT_FAILURE);
+  }
+
+  int is_target = rank == 1;
+  char const * comp_name = (is_target)?"target_comp":"source_comp";
+  char const * grid_name = (is_target)?"target_grid":"source_grid";
+
+  // define local component
+  int comp_id;
+  yac_cdef_comp(comp_name, &comp_id);
+
+  // define grid (both components use an identical grid)
+  int grid_id;
+  yac_cdef_grid_reg2d(
+    grid_name, (int[2]){3,3}, (int[2]){0,0},
+    (double[]){0,1,2}, (double[]){0,1,2}, &grid_id);
+
+  // define points at the vertices of the grid
+  int point_id;
+  yac_cdef_points_reg2d(
+    grid_id, (int[2]){3,3}, YAC_LOCATION_CORNER,
+    (double[]){0,1,2}, (double[]){0,1,2}, &point_id);
+
+  // the same mask is used for source and target, such that the targets of
+  // masked source points are not written
+  int mask_id;
+  yac_cdef_mask(
+    grid_id, NUM_POINTS, YAC_LOCATION_CORNER, field_mask, &mask_id);
+
+  // define fields
+  int const time_ops[NUM_OPS] =
+    {YAC_REDUCTION_TIME_ACCUMULATE,
+     YAC_REDUCTION_TIME_AVERAGE,
+     YAC_REDUCTION_TIME_MINIMUM,
+     YAC_REDUCTION_TIME_MAXIMUM};
+  char const * op_names[NUM_OPS] = {"accu", "avg", "min", "max"};
+  // the target only calls get on coupling steps
+  char const * timestep = (is_target)?"4":"1";
+  char field_names[NUM_FIELDS][64];
+  int field_ids[NUM_FIELDS];
+  for (int i = 0; i < NUM_FIELDS; ++i) {
+    int with_put_mask = (i / 2) % 2;
+    int with_frac_mask = i % 2;
+    sprintf(
+      field_names[i], "%s_%s_%s", op_names[i / 4],
+      (with_put_mask)?"put_mask":"no_put_mask",
+      (with_frac_mask)?"frac_mask":"no_frac_mask");
+    if (with_put_mask)
+      yac_cdef_field_mask(
+        field_names[i], comp_id, &point_id, &mask_id, 1,
+        COLLECTION_SIZE, timestep, YAC_TIME_UNIT_SECOND, &field_ids[i]);
+    else
+      yac_cdef_field(
+        field_names[i], comp_id, &point_id, 1,
+        COLLECTION_SIZE, timestep, YAC_TIME_UNIT_SECOND, &field_ids[i]);
+    if (with_frac_mask)
+      yac_cenable_field_frac_mask(
+        comp_name, grid_name, field_names[i], FRAC_MASK_VALUE);
+  }
+
+  // define interpolation stack
+  int interp_stack_nnn;
+  yac_cget_interp_stack_config(&interp_stack_nnn);
+  yac_cadd_interp_stack_config_nnn(
+    interp_stack_nnn, YAC_NNN_AVG, 1, 0.0);
+
+  // define couplings
+  for (int i = 0; i < NUM_FIELDS; ++i)
+    yac_cdef_couple(
+      "source_comp", "source_grid", field_names[i],
+      "target_comp", "target_grid", field_names[i],
+      "4", YAC_TIME_UNIT_SECOND, time_ops[i / 4],
+      interp_stack_nnn, 0, 0);
+  yac_cfree_interp_stack_config(interp_stack_nnn);
+
+  yac_cenddef ( );
+
+  double ref_acc[NUM_FIELDS][COLLECTION_SIZE][NUM_POINTS];
+  double ref_frac_acc[NUM_FIELDS][COLLECTION_SIZE][NUM_POINTS];
+  init_ref(ref_acc, ref_frac_acc, time_ops);
+  int count = 0;
+
+  // do time steps (the first timestep is coupled directly)
+  for (int t = 0; t < NUM_STEPS; ++t) {
+
+    int is_coupling_step = (t % COUPLING_DT) == 0;
+
+    accumulate_ref(ref_acc, ref_frac_acc, time_ops, t);
+    ++count;
+
+    if (!is_target) {
+
+      // for fields with put mask, the data of masked points is invalid and
+      // must not contribute to any result
+      double send_field[2][COLLECTION_SIZE][NUM_POINTS];
+      double frac_mask[COLLECTION_SIZE][NUM_POINTS];
+      for (int h = 0; h < COLLECTION_SIZE; ++h) {
+        for (int j = 0; j < NUM_POINTS; ++j) {
+          send_field[0][h][j] = get_send_value(t, h, j);
+          send_field[1][h][j] =
+            (field_mask[j])?get_send_value(t, h, j):-1.0e10;
+          frac_mask[h][j] = get_frac_mask_value(t, h, j);
+        }
+      }
+
+      for (int i = 0; i < NUM_FIELDS; ++i) {
+
+        int info, ierror;
+        int with_put_mask = (i / 2) % 2;
+        int with_frac_mask = i % 2;
+
+        if (with_frac_mask)
+          yac_cput_frac_(
+            field_ids[i], COLLECTION_SIZE, &send_field[with_put_mask][0][0],
+            &frac_mask[0][0], &info, &ierror);
+        else
+          yac_cput_(
+            field_ids[i], COLLECTION_SIZE, &send_field[with_put_mask][0][0],
+            &info, &ierror);
+
+        int ref_send_info =
+          (is_coupling_step)?YAC_ACTION_COUPLING:YAC_ACTION_REDUCTION;
+        if (info != ref_send_info) PUT_ERR("error in yac_cput_: wrong info");
+        if (ierror) PUT_ERR("error in yac_cput_: wrong ierror");
+      }
+
+    } else if (is_coupling_step) {
+
+      for (int i = 0; i < NUM_FIELDS; ++i) {
+
+        double recv_field[COLLECTION_SIZE][NUM_POINTS];
+        for (int h = 0; h < COLLECTION_SIZE; ++h)
+          for (int j = 0; j < NUM_POINTS; ++j)
+            recv_field[h][j] = RECV_INIT_VALUE;
+
+        int info, ierror;
+        yac_cget_(
+          field_ids[i], COLLECTION_SIZE, &recv_field[0][0], &info, &ierror);
+
+        if (info != YAC_ACTION_COUPLING)
+          PUT_ERR("error in yac_cget_: wrong info");
+        if (ierror) PUT_ERR("error in yac_cget_: wrong ierror");
+
+        int with_put_mask = (i / 2) % 2;
+        int with_frac_mask = i % 2;
+        for (int h = 0; h < COLLECTION_SIZE; ++h) {
+          for (int j = 0; j < NUM_POINTS; ++j) {
+            double ref_value =
+              get_ref_recv_value(
+                ref_acc[i][h][j], ref_frac_acc[i][h][j], time_ops[i / 4],
+                with_frac_mask, with_put_mask, j, count);
+            if (recv_field[h][j] != ref_value) {
+              fprintf(
+                stderr, "field %s t %d h %d j %d: %.17g != %.17g\n",
+                field_names[i], t, h, j, recv_field[h][j], ref_value);
+              PUT_ERR("error in yac_cget_: wrong recv_field");
+            }
+          }
+        }
+      }
+    }
+
+    // reset the reference after each coupling step
+    if (is_coupling_step) {
+      init_ref(ref_acc, ref_frac_acc, time_ops);
+      count = 0;
+    }
+  }
+
+  yac_cfinalize ();
+
+  return TEST_EXIT_CODE;
+}
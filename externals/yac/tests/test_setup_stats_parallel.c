@@ -0,0 +1,341 @@
+/**
+ * @file test_setup_stats_parallel.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "tests.h"
+#include "setup_stats.h"
+#include "grid.h"
+#include "yac_interface.h"
+#include "yac_mpi.h"
+#include "utils.h"
+
+#include <mpi.h>
+
+// tests the gathering and aggregation of the setup statistics
+
+static char const * comp_names[] = {"comp_a", "comp_b", "comp_c"};
+enum {NUM_COMPS = sizeof(comp_names) / sizeof(comp_names[0])};
+
+static void check_timer(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, int is_zero);
+static void check_counter(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, char const * counter_name,
+  int64_t ref_min, int64_t ref_max, int64_t ref_sum);
+static int file_contains(char const * file_name, char const * string);
+static void test_instance(int comm_rank);
+
+int main(void) {
+
+  MPI_Init(NULL, NULL);
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (comm_size != 4) {
+    PUT_ERR("ERROR: wrong number of processes");
+    MPI_Finalize();
+    return TEST_EXIT_CODE;
+  }
+
+  // ranks 0 and 1 => comp_a
+  // ranks 2 and 3 => comp_b
+  // no rank       => comp_c
+  int local_comp_flag[NUM_COMPS] = {comm_rank < 2, comm_rank >= 2, 0};
+
+  { // timers and counters of nested and overlapping phases
+
+    yac_setup_stats_start(YAC_SETUP_PHASE_SETUP);
+    yac_setup_stats_add(YAC_SETUP_COUNTER_BYTES_EXCHANGED, comm_rank + 1);
+    // a phase may be started multiple times (only the outermost
+    // start/stop pair is timed)
+    yac_setup_stats_start(YAC_SETUP_PHASE_SETUP);
+    yac_setup_stats_add(YAC_SETUP_COUNTER_BYTES_EXCHANGED, comm_rank + 1);
+    if (comm_rank == 0) {
+      yac_setup_stats_start(YAC_SETUP_PHASE_DO_SEARCH);
+      yac_setup_stats_add(YAC_SETUP_COUNTER_NUM_STENCILS, 10);
+      yac_setup_stats_stop(YAC_SETUP_PHASE_DO_SEARCH);
+    }
+    yac_setup_stats_stop(YAC_SETUP_PHASE_SETUP);
+    yac_setup_stats_stop(YAC_SETUP_PHASE_SETUP);
+
+    // counters are not added to inactive phases
+    yac_setup_stats_add(YAC_SETUP_COUNTER_NUM_STENCILS, 1000);
+
+    struct yac_setup_stats * stats =
+      yac_setup_stats_aggregate(
+        comp_names, NUM_COMPS, local_comp_flag, MPI_COMM_WORLD);
+
+    check_timer(stats, "comp_a", "setup", 0);
+    check_timer(stats, "comp_b", "setup", 0);
+    check_timer(stats, "comp_c", "setup", 1);
+    check_timer(stats, "comp_a", "setup/interp_weights/do_search", 0);
+    check_timer(stats, "comp_b", "setup/interp_weights/do_search", 1);
+    check_timer(stats, "comp_a", "setup/sync_def", 1);
+
+    check_counter(stats, "comp_a", "setup", "bytes_exchanged", 2, 4, 6);
+    check_counter(stats, "comp_b", "setup", "bytes_exchanged", 6, 8, 14);
+    check_counter(stats, "comp_c", "setup", "bytes_exchanged", 0, 0, 0);
+    check_counter(stats, "comp_a", "setup", "num_stencils", 0, 10, 10);
+    check_counter(
+      stats, "comp_a", "setup/interp_weights/do_search", "num_stencils",
+      0, 10, 10);
+    check_counter(
+      stats, "comp_a", "setup/interp_weights/do_search", "bytes_exchanged",
+      0, 0, 0);
+    check_counter(
+      stats, "comp_b", "setup/interp_weights/do_search", "num_stencils",
+      0, 0, 0);
+
+    yac_setup_stats_delete(stats);
+  }
+
+  { // the data exchanged by yac_alltoallv_p2p is counted
+
+    yac_setup_stats_start(YAC_SETUP_PHASE_INTERP_GRID);
+
+    size_t sendcounts[4], recvcounts[4], sdispls[4], rdispls[4];
+    double send_buffer[4], recv_buffer[4];
+    for (int i = 0; i < 4; ++i) {
+      sendcounts[i] = 1, recvcounts[i] = 1;
+      sdispls[i] = (size_t)i, rdispls[i] = (size_t)i;
+      send_buffer[i] = (double)comm_rank;
+    }
+    yac_alltoallv_p2p(
+      send_buffer, sendcounts, sdispls, recv_buffer, recvcounts, rdispls,
+      sizeof(double), MPI_DOUBLE, MPI_COMM_WORLD);
+    for (int i = 0; i < 4; ++i)
+      if (recv_buffer[i] != (double)i)
+        PUT_ERR("ERROR in yac_alltoallv_p2p");
+
+    yac_setup_stats_stop(YAC_SETUP_PHASE_INTERP_GRID);
+
+    struct yac_setup_stats * stats =
+      yac_setup_stats_aggregate(
+        comp_names, NUM_COMPS, local_comp_flag, MPI_COMM_WORLD);
+
+    // data sent to the process itself is not counted
+    check_counter(
+      stats, "comp_a", "setup/interp_grid", "bytes_exchanged",
+      3 * sizeof(double), 3 * sizeof(double), 6 * sizeof(double));
+
+    // statistics are reset after each aggregation
+    check_timer(stats, "comp_a", "setup", 1);
+    check_counter(stats, "comp_b", "setup", "bytes_exchanged", 0, 0, 0);
+
+    // only phases that were passed through are written to the file
+    char const * file_name = "test_setup_stats_parallel.json";
+    yac_setup_stats_write_json(stats, file_name, MPI_COMM_WORLD);
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (comm_rank == 0) {
+      if (!file_contains(file_name, "\"name\": \"comp_a\""))
+        PUT_ERR("ERROR in yac_setup_stats_write_json");
+      if (!file_contains(file_name, "\"name\": \"setup/interp_grid\""))
+        PUT_ERR("ERROR in yac_setup_stats_write_json");
+      if (file_contains(file_name, "\"name\": \"setup\""))
+        PUT_ERR("ERROR in yac_setup_stats_write_json");
+      unlink(file_name);
+    }
+
+    yac_setup_stats_delete(stats);
+  }
+
+  { // the statistics file is only written if the environment variable is set
+
+    unsetenv(YAC_SETUP_STATS_FILE_ENV);
+    char * file_name = yac_setup_stats_get_file_name(MPI_COMM_WORLD);
+    if (file_name != NULL) PUT_ERR("ERROR in yac_setup_stats_get_file_name");
+    free(file_name);
+
+    // only the root process evaluates the environment
+    if (comm_rank == 0) setenv(YAC_SETUP_STATS_FILE_ENV, "stats.json", 1);
+    file_name = yac_setup_stats_get_file_name(MPI_COMM_WORLD);
+    if ((file_name == NULL) || strcmp(file_name, "stats.json"))
+      PUT_ERR("ERROR in yac_setup_stats_get_file_name");
+    free(file_name);
+    unsetenv(YAC_SETUP_STATS_FILE_ENV);
+  }
+
+  test_instance(comm_rank);
+
+  MPI_Finalize();
+
+  return TEST_EXIT_CODE;
+}
+
+static void test_instance(int comm_rank) {
+
+  char const * file_name = "test_setup_stats_parallel_instance.json";
+  if (comm_rank == 0) setenv(YAC_SETUP_STATS_FILE_ENV, file_name, 1);
+
+  yac_cinit();
+  yac_cdef_datetime("2000-01-01T00:00:00", "2000-01-01T00:00:10");
+  yac_cdef_calendar(YAC_PROLEPTIC_GREGORIAN);
+
+  // ranks 0 and 1 => comp_a
+  // ranks 2 and 3 => comp_b
+  int is_comp_a = comm_rank < 2;
+  int comp_id;
+  yac_cdef_comp(comp_names[!is_comp_a], &comp_id);
+
+  // each process defines one row of a 3x2 regular grid
+  enum {NX = 3};
+  int n_vertices[2] = {NX + 1, 2};
+  int n_cells[2] = {NX, 1};
+  int cyclic[2] = {0, 0};
+  double vertex_lon[NX + 1], vertex_lat[2], cell_lon[NX], cell_lat[1];
+  for (int i = 0; i <= NX; ++i) vertex_lon[i] = (double)i * YAC_RAD;
+  for (int i = 0; i < NX; ++i) cell_lon[i] = ((double)i + 0.5) * YAC_RAD;
+  vertex_lat[0] = (double)(comm_rank & 1) * YAC_RAD;
+  vertex_lat[1] = (double)((comm_rank & 1) + 1) * YAC_RAD;
+  cell_lat[0] = ((double)(comm_rank & 1) + 0.5) * YAC_RAD;
+
+  int grid_id, point_id, field_id;
+  yac_cdef_grid_reg2d(
+    is_comp_a?"grid_a":"grid_b", n_vertices, cyclic,
+    vertex_lon, vertex_lat, &grid_id);
+  yac_cdef_points_reg2d(
+    grid_id, n_cells, YAC_LOCATION_CELL, cell_lon, cell_lat, &point_id);
+  yac_cdef_field(
+    "field", comp_id, &point_id, 1, 1, "1", YAC_TIME_UNIT_SECOND, &field_id);
+
+  if (comm_rank == 0) {
+    int fixed_interp;
+    yac_cget_interp_stack_config(&fixed_interp);
+    yac_cadd_interp_stack_config_fixed(fixed_interp, -1.0);
+    yac_cdef_couple(
+      "comp_a", "grid_a", "field", "comp_b", "grid_b", "field",
+      "1", YAC_TIME_UNIT_SECOND, YAC_REDUCTION_TIME_NONE, fixed_interp, 0, 0);
+    yac_cfree_interp_stack_config(fixed_interp);
+  }
+
+  yac_cenddef();
+
+  for (int i = 0; i < 2; ++i) {
+    double min_time, max_time, avg_time;
+    yac_cget_setup_timer(
+      comp_names[i], "setup", &min_time, &max_time, &avg_time);
+    if (!(min_time > 0.0) || (min_time > avg_time) || (avg_time > max_time))
+      PUT_ERR("ERROR in yac_cget_setup_timer");
+  }
+
+  // all target cells get a stencil from the fixed interpolation
+  int64_t total_num_stencils = 0;
+  for (int i = 0; i < 2; ++i) {
+    int64_t min_value, max_value, sum_value;
+    yac_cget_setup_counter(
+      comp_names[i], "setup/interp_weights/do_search/fixed", "num_stencils",
+      &min_value, &max_value, &sum_value);
+    if ((min_value < 0) || (min_value > max_value) || (max_value > sum_value))
+      PUT_ERR("ERROR in yac_cget_setup_counter");
+    total_num_stencils += sum_value;
+  }
+  if (total_num_stencils != 2 * NX)
+    PUT_ERR("ERROR in yac_cget_setup_counter");
+
+  {
+    int64_t min_value, max_value, sum_value;
+    yac_cget_setup_counter(
+      "comp_b", "setup/dist_grid_pair", "bytes_exchanged",
+      &min_value, &max_value, &sum_value);
+    if (!(sum_value > 0)) PUT_ERR("ERROR in yac_cget_setup_counter");
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if (comm_rank == 0) {
+    if (!file_contains(file_name, "\"name\": \"comp_b\""))
+      PUT_ERR("ERROR in statistics file");
+    if (!file_contains(
+          file_name, "\"name\": \"setup/interp_weights/do_search/fixed\""))
+      PUT_ERR("ERROR in statistics file");
+    unlink(file_name);
+    unsetenv(YAC_SETUP_STATS_FILE_ENV);
+  }
+
+  yac_cfinalize();
+}
+
+static void check_timer(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, int is_zero) {
+
+  double min_time, max_time, avg_time;
+  yac_setup_stats_get_timer(
+    stats, comp_name, phase_name, &min_time, &max_time, &avg_time);
+
+  if (is_zero) {
+    if ((min_time != 0.0) || (max_time != 0.0) || (avg_time != 0.0))
+      PUT_ERR("ERROR in yac_setup_stats_get_timer");
+  } else {
+    if ((min_time < 0.0) || (min_time > avg_time) || (avg_time > max_time) ||
+        !(max_time > 0.0))
+      PUT_ERR("ERROR in yac_setup_stats_get_timer");
+  }
+}
+
+static void check_counter(
+  struct yac_setup_stats * stats, char const * comp_name,
+  char const * phase_name, char const * counter_name,
+  int64_t ref_min, int64_t ref_max, int64_t ref_sum) {
+
+  int64_t min_value, max_value, sum_value;
+  yac_setup_stats_get_counter(
+    stats, comp_name, phase_name, counter_name,
+    &min_value, &max_value, &sum_value);
+
+  if ((min_value != ref_min) || (max_value != ref_max) ||
+      (sum_value != ref_sum))
+    PUT_ERR("ERROR in yac_setup_stats_get_counter");
+}
+
+static int file_contains(char const * file_name, char const * string) {
+
+  FILE * file = fopen(file_name, "r");
+  if (file == NULL) return 0;
+
+  char buffer[1024];
+  int found = 0;
+  while (!found && (fgets(buffer, sizeof(buffer), file) != NULL))
+    found = strstr(buffer, string) != NULL;
+  fclose(file);
+
+  return found;
+}
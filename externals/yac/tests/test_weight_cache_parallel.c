@@ -0,0 +1,420 @@
+/**
+ * @file test_weight_cache_parallel.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tests.h"
+#include "test_common.h"
+#include "geometry.h"
+#include "interp_method.h"
+#include "interp_stack_config.h"
+#include "weight_cache.h"
+#include "dist_grid_utils.h"
+#include "yac_mpi.h"
+#include "utils.h"
+
+#include <mpi.h>
+#include <yaxt.h>
+
+// tests the generation of cache file names and the storing and loading of
+// interpolation weights through the weight cache
+
+static char const * grid_names[2] = {"src_grid", "tgt_grid"};
+static char const cache_dir[] = ".";
+
+struct test_grid {
+  struct yac_basic_grid * grids[2];
+  struct basic_grid_data grid_data[2];
+  struct dist_grid_pair * grid_pair;
+  struct interp_grid * interp_grid;
+};
+
+static struct test_grid generate_test_grid(
+  MPI_Comm comm, int reverse_decomp, enum yac_location src_location);
+static void delete_test_grid(struct test_grid test_grid);
+static struct yac_interp_stack_config * generate_interp_stack(
+  double fixed_value);
+static void compare_weights(
+  struct test_grid test_grid,
+  struct interp_weights * ref_weights, struct interp_weights * weights);
+static char * get_file_name(
+  struct interp_grid * interp_grid,
+  struct yac_interp_stack_config * interp_stack);
+
+int main(void) {
+
+  MPI_Init(NULL, NULL);
+
+  xt_initialize(MPI_COMM_WORLD);
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (comm_size != 4) {
+    PUT_ERR("ERROR: wrong number of processes");
+    xt_finalize();
+    MPI_Finalize();
+    return TEST_EXIT_CODE;
+  }
+
+  { // the weight cache is only enabled if the environment variable is set
+
+    unsetenv(YAC_WEIGHT_CACHE_DIR_ENV);
+    char * dir = yac_weight_cache_get_dir(MPI_COMM_WORLD);
+    if (dir != NULL) PUT_ERR("ERROR in yac_weight_cache_get_dir");
+    free(dir);
+
+    // only the root process evaluates the environment
+    if (comm_rank == 0) setenv(YAC_WEIGHT_CACHE_DIR_ENV, cache_dir, 1);
+    dir = yac_weight_cache_get_dir(MPI_COMM_WORLD);
+    if ((dir == NULL) || strcmp(dir, cache_dir))
+      PUT_ERR("ERROR in yac_weight_cache_get_dir");
+    free(dir);
+    unsetenv(YAC_WEIGHT_CACHE_DIR_ENV);
+  }
+
+  struct yac_interp_stack_config * interp_stack = generate_interp_stack(-1.0);
+
+  struct test_grid test_grid =
+    generate_test_grid(MPI_COMM_WORLD, 0, CORNER);
+  struct yac_weight_cache_key * key =
+    yac_weight_cache_key_new(test_grid.interp_grid, interp_stack);
+
+  if (key == NULL) {
+    PUT_ERR("ERROR in yac_weight_cache_key_new");
+    yac_interp_stack_config_delete(interp_stack);
+    delete_test_grid(test_grid);
+    xt_finalize();
+    MPI_Finalize();
+    return TEST_EXIT_CODE;
+  }
+
+  char * file_name = yac_weight_cache_get_file_name(cache_dir, key);
+
+  { // all processes have to get the same file name
+    int len = (int)strlen(file_name) + 1, max_len;
+    yac_mpi_call(
+      MPI_Allreduce(
+        &len, &max_len, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD), MPI_COMM_WORLD);
+    char * root_file_name = xcalloc((size_t)max_len, 1);
+    if (comm_rank == 0) strcpy(root_file_name, file_name);
+    yac_mpi_call(
+      MPI_Bcast(root_file_name, max_len, MPI_CHAR, 0, MPI_COMM_WORLD),
+      MPI_COMM_WORLD);
+    if (strcmp(root_file_name, file_name))
+      PUT_ERR("ERROR in yac_weight_cache_get_file_name");
+    free(root_file_name);
+  }
+
+  { // the file name is independent of the decomposition
+
+    struct test_grid reverse_test_grid =
+      generate_test_grid(MPI_COMM_WORLD, 1, CORNER);
+    char * reverse_file_name =
+      get_file_name(reverse_test_grid.interp_grid, interp_stack);
+    if (strcmp(file_name, reverse_file_name))
+      PUT_ERR("ERROR in yac_weight_cache_get_file_name");
+    free(reverse_file_name);
+    delete_test_grid(reverse_test_grid);
+  }
+
+  { // a different interpolation stack results in a different file name
+
+    struct yac_interp_stack_config * other_interp_stack =
+      generate_interp_stack(-2.0);
+    char * other_file_name =
+      get_file_name(test_grid.interp_grid, other_interp_stack);
+    if (!strcmp(file_name, other_file_name))
+      PUT_ERR("ERROR in yac_weight_cache_get_file_name");
+    free(other_file_name);
+    yac_interp_stack_config_delete(other_interp_stack);
+  }
+
+  { // a different source field results in a different file name
+
+    struct test_grid other_test_grid =
+      generate_test_grid(MPI_COMM_WORLD, 0, CELL);
+    char * other_file_name =
+      get_file_name(other_test_grid.interp_grid, interp_stack);
+    if (!strcmp(file_name, other_file_name))
+      PUT_ERR("ERROR in yac_weight_cache_get_file_name");
+    free(other_file_name);
+    delete_test_grid(other_test_grid);
+  }
+
+  { // stacks containing user callbacks are not cached
+
+    struct yac_interp_stack_config * callback_interp_stack =
+      yac_interp_stack_config_new();
+    yac_interp_stack_config_add_user_callback(
+      callback_interp_stack, "compute_weights");
+    yac_interp_stack_config_add_fixed(callback_interp_stack, -1.0);
+    char * callback_file_name =
+      get_file_name(test_grid.interp_grid, callback_interp_stack);
+    if (callback_file_name != NULL)
+      PUT_ERR("ERROR in yac_weight_cache_key_new");
+    yac_interp_stack_config_delete(callback_interp_stack);
+  }
+
+  // compute the reference weights
+  struct interp_method ** method_stack =
+    yac_interp_stack_config_generate(interp_stack);
+  struct interp_weights * ref_weights =
+    yac_interp_method_do_search(method_stack, test_grid.interp_grid);
+  yac_interp_method_delete(method_stack);
+  free(method_stack);
+
+  // the cache is empty
+  if (comm_rank == 0) unlink(file_name);
+  if (yac_weight_cache_lookup(file_name, key, MPI_COMM_WORLD))
+    PUT_ERR("ERROR in yac_weight_cache_lookup");
+
+  { // a file that was generated for a different key is not used (emulates
+    // a collision of the hash used for the file name)
+
+    struct yac_interp_stack_config * other_interp_stack =
+      generate_interp_stack(-2.0);
+    struct yac_weight_cache_key * other_key =
+      yac_weight_cache_key_new(test_grid.interp_grid, other_interp_stack);
+    yac_weight_cache_store(
+      file_name, other_key, ref_weights, grid_names[0], grid_names[1],
+      MPI_COMM_WORLD);
+    if (yac_weight_cache_lookup(file_name, key, MPI_COMM_WORLD))
+      PUT_ERR("ERROR in yac_weight_cache_lookup");
+    if (!yac_weight_cache_lookup(file_name, other_key, MPI_COMM_WORLD))
+      PUT_ERR("ERROR in yac_weight_cache_lookup");
+    yac_weight_cache_key_delete(other_key);
+    yac_interp_stack_config_delete(other_interp_stack);
+  }
+
+  { // a file without key (or with an outdated key) is not used
+
+    yac_interp_weights_write_to_binary_file(
+      ref_weights, file_name, grid_names[0], grid_names[1], NULL, 0);
+    if (yac_weight_cache_lookup(file_name, key, MPI_COMM_WORLD))
+      PUT_ERR("ERROR in yac_weight_cache_lookup");
+  }
+
+  { // a file that is not a binary weight file is not used
+
+    if (comm_rank == 0) {
+      FILE * file = fopen(file_name, "w");
+      fputs("not a weight file", file);
+      fclose(file);
+    }
+    if (yac_weight_cache_lookup(file_name, key, MPI_COMM_WORLD))
+      PUT_ERR("ERROR in yac_weight_cache_lookup");
+  }
+
+  yac_weight_cache_store(
+    file_name, key, ref_weights, grid_names[0], grid_names[1],
+    MPI_COMM_WORLD);
+
+  if (!yac_weight_cache_lookup(file_name, key, MPI_COMM_WORLD))
+    PUT_ERR("ERROR in yac_weight_cache_lookup");
+
+  { // load the weights with the same decomposition
+
+    struct interp_weights * weights =
+      yac_weight_cache_load(
+        file_name, test_grid.interp_grid, grid_names[0], grid_names[1]);
+    compare_weights(test_grid, ref_weights, weights);
+    yac_interp_weights_delete(weights);
+  }
+
+  { // load the weights with a different decomposition
+
+    struct test_grid reverse_test_grid =
+      generate_test_grid(MPI_COMM_WORLD, 1, CORNER);
+    method_stack = yac_interp_stack_config_generate(interp_stack);
+    struct interp_weights * reverse_ref_weights =
+      yac_interp_method_do_search(method_stack, reverse_test_grid.interp_grid);
+    yac_interp_method_delete(method_stack);
+    free(method_stack);
+    struct interp_weights * weights =
+      yac_weight_cache_load(
+        file_name, reverse_test_grid.interp_grid,
+        grid_names[0], grid_names[1]);
+    compare_weights(reverse_test_grid, reverse_ref_weights, weights);
+    yac_interp_weights_delete(weights);
+    yac_interp_weights_delete(reverse_ref_weights);
+    delete_test_grid(reverse_test_grid);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if (comm_rank == 0) unlink(file_name);
+
+  yac_interp_weights_delete(ref_weights);
+  free(file_name);
+  yac_weight_cache_key_delete(key);
+  yac_interp_stack_config_delete(interp_stack);
+  delete_test_grid(test_grid);
+
+  xt_finalize();
+  MPI_Finalize();
+
+  return TEST_EXIT_CODE;
+}
+
+static struct test_grid generate_test_grid(
+  MPI_Comm comm, int reverse_decomp, enum yac_location src_location) {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  // the source grid is a 4x4 grid covering 0-4 degree, the target grid is
+  // a 4x4 grid covering 0.5-4.5 degree; the rows of cells are distributed
+  // among the processes
+
+  double coordinates_x[2][5] =
+    {{0.0,1.0,2.0,3.0,4.0}, {0.5,1.5,2.5,3.5,4.5}};
+  double coordinates_y[2][5] =
+    {{0.0,1.0,2.0,3.0,4.0}, {0.5,1.5,2.5,3.5,4.5}};
+  size_t const num_cells[2] = {4,4};
+  int decomp_rank = reverse_decomp?(comm_size - comm_rank - 1):comm_rank;
+  size_t local_start[2] =
+    {0, ((size_t)decomp_rank * num_cells[1]) / (size_t)comm_size};
+  size_t local_count[2] =
+    {num_cells[0],
+     (((size_t)decomp_rank + 1) * num_cells[1]) / (size_t)comm_size -
+     local_start[1]};
+  int with_halo = 0;
+
+  struct test_grid test_grid;
+  for (int i = 0; i < 2; ++i) {
+    for (size_t j = 0; j <= num_cells[0]; ++j) coordinates_x[i][j] *= YAC_RAD;
+    for (size_t j = 0; j <= num_cells[1]; ++j) coordinates_y[i][j] *= YAC_RAD;
+    test_grid.grid_data[i] =
+      yac_generate_basic_grid_data_reg2d(
+        coordinates_x[i], coordinates_y[i], num_cells,
+        local_start, local_count, with_halo);
+    test_grid.grids[i] =
+      yac_basic_grid_new(grid_names[i], test_grid.grid_data[i]);
+  }
+
+  test_grid.grid_pair =
+    yac_dist_grid_pair_new(test_grid.grids[0], test_grid.grids[1], comm);
+
+  struct interp_field src_fields[] =
+    {{.location = src_location,
+      .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX}};
+  size_t num_src_fields = sizeof(src_fields) / sizeof(src_fields[0]);
+  struct interp_field tgt_field =
+    {.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX};
+
+  test_grid.interp_grid =
+    yac_interp_grid_new(test_grid.grid_pair, grid_names[0], grid_names[1],
+                        num_src_fields, src_fields, tgt_field);
+
+  return test_grid;
+}
+
+static void delete_test_grid(struct test_grid test_grid) {
+
+  yac_interp_grid_delete(test_grid.interp_grid);
+  yac_dist_grid_pair_delete(test_grid.grid_pair);
+  yac_basic_grid_delete(test_grid.grids[1]);
+  yac_basic_grid_delete(test_grid.grids[0]);
+}
+
+static struct yac_interp_stack_config * generate_interp_stack(
+  double fixed_value) {
+
+  struct yac_interp_stack_config * interp_stack =
+    yac_interp_stack_config_new();
+  yac_interp_stack_config_add_average(interp_stack, AVG_ARITHMETIC, 0);
+  yac_interp_stack_config_add_fixed(interp_stack, fixed_value);
+  return interp_stack;
+}
+
+static void compare_weights(
+  struct test_grid test_grid,
+  struct interp_weights * ref_weights, struct interp_weights * weights) {
+
+  if (yac_interp_weights_get_interp_count(ref_weights) !=
+      yac_interp_weights_get_interp_count(weights))
+    PUT_ERR("ERROR in yac_interp_weights_get_interp_count");
+
+  struct interpolation * interpolations[2] =
+    {yac_interp_weights_get_interpolation(
+       ref_weights, MAPPING_ON_SRC, 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0),
+     yac_interp_weights_get_interpolation(
+       weights, MAPPING_ON_SRC, 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0)};
+
+  struct basic_grid_data * grid_data = test_grid.grid_data;
+
+  double * src_field =
+    xmalloc(grid_data[0].num_vertices * sizeof(*src_field));
+  double ** src_fields = &src_field;
+  for (size_t i = 0; i < grid_data[0].num_vertices; ++i)
+    src_field[i] = (double)(grid_data[0].vertex_ids[i]);
+
+  double * tgt_field[2];
+  for (int i = 0; i < 2; ++i) {
+    tgt_field[i] = xmalloc(grid_data[1].num_vertices * sizeof(*tgt_field[i]));
+    for (size_t j = 0; j < grid_data[1].num_vertices; ++j)
+      tgt_field[i][j] = -3.0;
+    yac_interpolation_execute(interpolations[i], &src_fields, &tgt_field[i]);
+  }
+
+  for (size_t i = 0; i < grid_data[1].num_vertices; ++i)
+    if (fabs(tgt_field[0][i] - tgt_field[1][i]) > 1e-12)
+      PUT_ERR("wrong interpolation result");
+
+  free(tgt_field[1]);
+  free(tgt_field[0]);
+  free(src_field);
+  yac_interpolation_delete(interpolations[1]);
+  yac_interpolation_delete(interpolations[0]);
+}
+
+static char * get_file_name(
+  struct interp_grid * interp_grid,
+  struct yac_interp_stack_config * interp_stack) {
+
+  struct yac_weight_cache_key * key =
+    yac_weight_cache_key_new(interp_grid, interp_stack);
+  if (key == NULL) return NULL;
+  char * file_name = yac_weight_cache_get_file_name(cache_dir, key);
+  yac_weight_cache_key_delete(key);
+  return file_name;
+}
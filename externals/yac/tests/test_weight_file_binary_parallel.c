@@ -0,0 +1,263 @@
+/**
+ * @file test_weight_file_binary_parallel.c
+ */
+/*
+ * This file is part of YAC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are
+ * met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the DKRZ GmbH nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tests.h"
+#include "test_common.h"
+#include "geometry.h"
+#include "interp_method.h"
+#include "interp_method_avg.h"
+#include "interp_method_file.h"
+#include "interp_method_fixed.h"
+#include "weight_file_binary.h"
+#include "dist_grid_utils.h"
+#include "yac_mpi.h"
+
+#include <mpi.h>
+#include <yaxt.h>
+
+// tests writing and reading of binary weight files with the same and with
+// a different decomposition
+
+enum interp_weights_reorder_type reorder_types[] =
+  {MAPPING_ON_SRC, MAPPING_ON_TGT};
+size_t num_reorder_types = sizeof(reorder_types) / sizeof(reorder_types[0]);
+static char const * grid_names[2] = {"src_grid", "tgt_grid"};
+static char const file_name[] =
+  "test_weight_file_binary_parallel" YAC_BINARY_WEIGHT_FILE_SUFFIX;
+
+static void check_weight_file(
+  MPI_Comm comm, int write_file, int reverse_decomp);
+
+int main(void) {
+
+  MPI_Init(NULL, NULL);
+
+  xt_initialize(MPI_COMM_WORLD);
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank), MPI_COMM_WORLD);
+  yac_mpi_call(MPI_Comm_size(MPI_COMM_WORLD, &comm_size), MPI_COMM_WORLD);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if (comm_size != 4) {
+    PUT_ERR("ERROR: wrong number of processes");
+    xt_finalize();
+    MPI_Finalize();
+    return TEST_EXIT_CODE;
+  }
+
+  if (!yac_binary_weight_file_check_suffix(file_name))
+    PUT_ERR("ERROR in yac_binary_weight_file_check_suffix");
+  if (yac_binary_weight_file_check_suffix("weights.nc"))
+    PUT_ERR("ERROR in yac_binary_weight_file_check_suffix");
+
+  { // the layout computation detects invalid counts in the header
+
+    struct yac_binary_weight_file_header header;
+    memset(&header, 0, sizeof(header));
+    header.num_slices = 4;
+    header.num_src_fields = 1;
+    header.num_links = 16;
+    struct yac_binary_weight_file_layout layout;
+    if (!yac_binary_weight_file_get_layout(&header, &layout) ||
+        (layout.file_size <
+         layout.link_weight + header.num_links * sizeof(double)))
+      PUT_ERR("ERROR in yac_binary_weight_file_get_layout");
+
+    uint64_t * counts[] =
+      {&header.num_slices, &header.num_src_fields, &header.num_fixed_values,
+       &header.num_links, &header.num_fixed_tgt, &header.src_grid_name_len,
+       &header.tgt_grid_name_len, &header.key_size};
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i) {
+      uint64_t count = *(counts[i]);
+      uint64_t invalid_counts[] = {UINT64_MAX, UINT64_MAX - 32};
+      for (size_t j = 0; j < 2; ++j) {
+        *(counts[i]) = invalid_counts[j];
+        if (yac_binary_weight_file_get_layout(&header, &layout))
+          PUT_ERR("ERROR in yac_binary_weight_file_get_layout");
+      }
+      *(counts[i]) = count;
+    }
+  }
+
+  // write the weight file and read it with the same decomposition
+  check_weight_file(MPI_COMM_WORLD, 1, 0);
+
+  if (!yac_binary_weight_file_check_magic(file_name))
+    PUT_ERR("ERROR in yac_binary_weight_file_check_magic");
+
+  // files written without key only match an empty key
+  if (!yac_binary_weight_file_check_key(file_name, NULL, 0))
+    PUT_ERR("ERROR in yac_binary_weight_file_check_key");
+  if (yac_binary_weight_file_check_key(file_name, "key", 3))
+    PUT_ERR("ERROR in yac_binary_weight_file_check_key");
+
+  // read the weight file with a different distribution of the basic grids
+  check_weight_file(MPI_COMM_WORLD, 0, 1);
+
+  // read the weight file with a different number of processes
+  MPI_Comm split_comm;
+  yac_mpi_call(
+    MPI_Comm_split(
+      MPI_COMM_WORLD, comm_rank < 3, 0, &split_comm), MPI_COMM_WORLD);
+  if (comm_rank < 3) check_weight_file(split_comm, 0, 0);
+  yac_mpi_call(MPI_Comm_free(&split_comm), MPI_COMM_WORLD);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if (comm_rank == 0) unlink(file_name);
+
+  xt_finalize();
+  MPI_Finalize();
+
+  return TEST_EXIT_CODE;
+}
+
+static void check_weight_file(
+  MPI_Comm comm, int write_file, int reverse_decomp) {
+
+  int comm_rank, comm_size;
+  yac_mpi_call(MPI_Comm_rank(comm, &comm_rank), comm);
+  yac_mpi_call(MPI_Comm_size(comm, &comm_size), comm);
+
+  // the source grid is a 4x4 grid covering 0-4 degree, the target grid is
+  // a 4x4 grid covering 0.5-4.5 degree (target points outside of the source
+  // grid get a fixed value); the rows of cells are distributed among the
+  // processes
+
+  double coordinates_x[2][5] =
+    {{0.0,1.0,2.0,3.0,4.0}, {0.5,1.5,2.5,3.5,4.5}};
+  double coordinates_y[2][5] =
+    {{0.0,1.0,2.0,3.0,4.0}, {0.5,1.5,2.5,3.5,4.5}};
+  size_t const num_cells[2] = {4,4};
+  int decomp_rank = reverse_decomp?(comm_size - comm_rank - 1):comm_rank;
+  size_t local_start[2] =
+    {0, ((size_t)decomp_rank * num_cells[1]) / (size_t)comm_size};
+  size_t local_count[2] =
+    {num_cells[0],
+     (((size_t)decomp_rank + 1) * num_cells[1]) / (size_t)comm_size -
+     local_start[1]};
+  int with_halo = 0;
+
+  struct yac_basic_grid * grids[2];
+  struct basic_grid_data grid_data[2];
+  for (int i = 0; i < 2; ++i) {
+    for (size_t j = 0; j <= num_cells[0]; ++j) coordinates_x[i][j] *= YAC_RAD;
+    for (size_t j = 0; j <= num_cells[1]; ++j) coordinates_y[i][j] *= YAC_RAD;
+    grid_data[i] =
+      yac_generate_basic_grid_data_reg2d(
+        coordinates_x[i], coordinates_y[i], num_cells,
+        local_start, local_count, with_halo);
+    grids[i] = yac_basic_grid_new(grid_names[i], grid_data[i]);
+  }
+
+  struct dist_grid_pair * grid_pair =
+    yac_dist_grid_pair_new(grids[0], grids[1], comm);
+
+  struct interp_field src_fields[] =
+    {{.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX}};
+  size_t num_src_fields = sizeof(src_fields) / sizeof(src_fields[0]);
+  struct interp_field tgt_field =
+    {.location = CORNER, .coordinates_idx = SIZE_MAX, .masks_idx = SIZE_MAX};
+
+  struct interp_grid * interp_grid =
+    yac_interp_grid_new(grid_pair, grid_names[0], grid_names[1],
+                        num_src_fields, src_fields, tgt_field);
+
+  struct interp_method * ref_method_stack[] =
+    {yac_interp_method_avg_new(AVG_ARITHMETIC, 0),
+     yac_interp_method_fixed_new(-1.0), NULL};
+  struct interp_weights * ref_weights =
+    yac_interp_method_do_search(ref_method_stack, interp_grid);
+  yac_interp_method_delete(ref_method_stack);
+
+  if (write_file)
+    yac_interp_weights_write_to_file(
+      ref_weights, file_name, grid_names[0], grid_names[1]);
+
+  // target points not covered by the weight file would get a different
+  // fixed value
+  struct interp_method * file_method_stack[] =
+    {yac_interp_method_file_new(file_name, grid_names[0], grid_names[1]),
+     yac_interp_method_fixed_new(-2.0), NULL};
+  struct interp_weights * file_weights =
+    yac_interp_method_do_search(file_method_stack, interp_grid);
+  yac_interp_method_delete(file_method_stack);
+
+  if (yac_interp_weights_get_interp_count(ref_weights) !=
+      yac_interp_weights_get_interp_count(file_weights))
+    PUT_ERR("ERROR in yac_interp_weights_get_interp_count");
+
+  for (size_t i = 0; i < num_reorder_types; ++i) {
+
+    struct interpolation * interpolations[2] =
+      {yac_interp_weights_get_interpolation(
+         ref_weights, reorder_types[i], 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0),
+       yac_interp_weights_get_interpolation(
+         file_weights, reorder_types[i], 1, YAC_FRAC_MASK_NO_VALUE, 1.0, 0.0)};
+
+    double * src_field =
+      xmalloc(grid_data[0].num_vertices * sizeof(*src_field));
+    double ** src_fields = &src_field;
+    for (size_t j = 0; j < grid_data[0].num_vertices; ++j)
+      src_field[j] = (double)(grid_data[0].vertex_ids[j]);
+
+    double * tgt_field[2];
+    for (int j = 0; j < 2; ++j) {
+      tgt_field[j] = xmalloc(grid_data[1].num_vertices * sizeof(*tgt_field[j]));
+      for (size_t k = 0; k < grid_data[1].num_vertices; ++k)
+        tgt_field[j][k] = -3.0;
+      yac_interpolation_execute(interpolations[j], &src_fields, &tgt_field[j]);
+    }
+
+    for (size_t j = 0; j < grid_data[1].num_vertices; ++j)
+      if (fabs(tgt_field[0][j] - tgt_field[1][j]) > 1e-12)
+        PUT_ERR("wrong interpolation result");
+
+    free(tgt_field[1]);
+    free(tgt_field[0]);
+    free(src_field);
+    yac_interpolation_delete(interpolations[1]);
+    yac_interpolation_delete(interpolations[0]);
+  }
+
+  yac_interp_weights_delete(file_weights);
+  yac_interp_weights_delete(ref_weights);
+  yac_interp_grid_delete(interp_grid);
+  yac_dist_grid_pair_delete(grid_pair);
+  yac_basic_grid_delete(grids[1]);
+  yac_basic_grid_delete(grids[0]);
+}
@@ -477,3 +477,264 @@ void check_weight_file(char const * file_name, int const * ref_src_address,
   // close file
   HANDLE_ERROR(nc_close(ncid));
 }
+
+// reads the length of a dimension (returns 0, if the dimension does not
+// exist)
+static size_t get_dim_len(int ncid, char const * dim_name) {
+
+  int dimid;
+  size_t dim_len = 0;
+  if (nc_inq_dimid(ncid, dim_name, &dimid) == NC_NOERR)
+    HANDLE_ERROR(nc_inq_dimlen(ncid, dimid, &dim_len));
+  return dim_len;
+}
+
+static char * get_global_att_text(int ncid, char const * att_name) {
+
+  size_t att_len;
+  HANDLE_ERROR(nc_inq_attlen(ncid, NC_GLOBAL, att_name, &att_len));
+  char * att_text = xmalloc(att_len + 1);
+  att_text[att_len] = '\0';
+  HANDLE_ERROR(nc_get_att_text(ncid, NC_GLOBAL, att_name, att_text));
+  return att_text;
+}
+
+// computes the target index for data that is split into multiple parts
+static int * compute_tgt_index(
+  int const * tgt_address, int const * part_sizes, size_t num_parts,
+  size_t block_size, size_t * index_size) {
+
+  *index_size = 0;
+  for (size_t i = 0; i < num_parts; ++i)
+    *index_size += ((size_t)(part_sizes[i]) + block_size - 1) / block_size;
+
+  int * index = xmalloc(*index_size * sizeof(*index));
+  for (size_t i = 0, k = 0, offset = 0; i < num_parts;
+       offset += (size_t)(part_sizes[i++]))
+    for (size_t j = 0; j < (size_t)(part_sizes[i]); j += block_size, ++k)
+      index[k] = tgt_address[offset + j];
+
+  return index;
+}
+
+static void put_tgt_index(
+  int ncid, char const * var_name, char const * dim_name,
+  int const * tgt_address, int const * part_sizes, size_t num_parts,
+  size_t block_size) {
+
+  size_t index_size;
+  int * index =
+    compute_tgt_index(
+      tgt_address, part_sizes, num_parts, block_size, &index_size);
+
+  int dimid, var_id;
+  int block_size_int = (int)block_size;
+  HANDLE_ERROR(nc_redef(ncid));
+  HANDLE_ERROR(nc_def_dim(ncid, dim_name, index_size, &dimid));
+  HANDLE_ERROR(nc_def_var(ncid, var_name, NC_INT, 1, &dimid, &var_id));
+  HANDLE_ERROR(
+    nc_put_att_int(ncid, var_id, "block_size", NC_INT, 1, &block_size_int));
+  HANDLE_ERROR(nc_enddef(ncid));
+  HANDLE_ERROR(nc_put_var_int(ncid, var_id, index));
+
+  free(index);
+}
+
+void copy_weight_file(
+  char const * file_name, char const * copy_file_name, size_t block_size) {
+
+  int ncid, var_id;
+
+  // read data
+  yac_nc_open(file_name, NC_NOWRITE, &ncid);
+
+  size_t num_links = get_dim_len(ncid, "num_links");
+  size_t num_src_fields = get_dim_len(ncid, "num_src_fields");
+  size_t num_fixed_values = get_dim_len(ncid, "num_fixed_values");
+  size_t num_fixed_tgt = get_dim_len(ncid, "num_fixed_dst");
+
+  YAC_ASSERT(
+    (num_links == 0) || (get_dim_len(ncid, "num_wgts") == 1),
+    "ERROR(copy_weight_file): test only supports num_wgts == 1")
+
+  char * src_grid_name = get_global_att_text(ncid, "src_grid_name");
+  char * tgt_grid_name = get_global_att_text(ncid, "dst_grid_name");
+
+  int * src_address = xmalloc(num_links * sizeof(*src_address));
+  int * tgt_address = xmalloc(num_links * sizeof(*tgt_address));
+  double * weights = xmalloc(num_links * sizeof(*weights));
+  int * num_links_per_src_field =
+    xmalloc(num_src_fields * sizeof(*num_links_per_src_field));
+  enum yac_location * src_locations =
+    xmalloc(num_src_fields * sizeof(*src_locations));
+  enum yac_location tgt_location;
+  double * fixed_values = xmalloc(num_fixed_values * sizeof(*fixed_values));
+  int * num_tgt_per_fixed_value =
+    xmalloc(num_fixed_values * sizeof(*num_tgt_per_fixed_value));
+  int * tgt_address_fixed = xmalloc(num_fixed_tgt * sizeof(*tgt_address_fixed));
+
+  if (num_links > 0) {
+    yac_nc_inq_varid(ncid, "src_address", &var_id);
+    HANDLE_ERROR(nc_get_var_int(ncid, var_id, src_address));
+    yac_nc_inq_varid(ncid, "dst_address", &var_id);
+    HANDLE_ERROR(nc_get_var_int(ncid, var_id, tgt_address));
+    yac_nc_inq_varid(ncid, "remap_matrix", &var_id);
+    HANDLE_ERROR(nc_get_var_double(ncid, var_id, weights));
+    yac_nc_inq_varid(ncid, "num_links_per_src_field", &var_id);
+    HANDLE_ERROR(nc_get_var_int(ncid, var_id, num_links_per_src_field));
+  } else {
+    for (size_t i = 0; i < num_src_fields; ++i)
+      num_links_per_src_field[i] = 0;
+  }
+
+  yac_nc_inq_varid(ncid, "src_locations", &var_id);
+  for (size_t i = 0; i < num_src_fields; ++i) {
+    char loc_str[YAC_MAX_LOC_STR_LEN];
+    size_t str_start[2] = {i, 0};
+    size_t str_count[2] = {1, YAC_MAX_LOC_STR_LEN};
+    HANDLE_ERROR(nc_get_vara_text(ncid, var_id, str_start, str_count, loc_str));
+    src_locations[i] = yac_str2loc(loc_str);
+  }
+
+  yac_nc_inq_varid(ncid, "dst_location", &var_id);
+  {
+    char loc_str[YAC_MAX_LOC_STR_LEN];
+    HANDLE_ERROR(nc_get_var_text(ncid, var_id, loc_str));
+    tgt_location = yac_str2loc(loc_str);
+  }
+
+  if (num_fixed_values > 0) {
+    yac_nc_inq_varid(ncid, "fixed_values", &var_id);
+    HANDLE_ERROR(nc_get_var_double(ncid, var_id, fixed_values));
+    yac_nc_inq_varid(ncid, "num_dst_per_fixed_value", &var_id);
+    HANDLE_ERROR(nc_get_var_int(ncid, var_id, num_tgt_per_fixed_value));
+    yac_nc_inq_varid(ncid, "dst_address_fixed", &var_id);
+    HANDLE_ERROR(nc_get_var_int(ncid, var_id, tgt_address_fixed));
+  }
+
+  HANDLE_ERROR(nc_close(ncid));
+
+  // the addresses in the file start at one, write_weight_file expects
+  // zero-based indices
+  for (size_t i = 0; i < num_links; ++i) {
+    --src_address[i];
+    --tgt_address[i];
+  }
+  for (size_t i = 0; i < num_fixed_tgt; ++i) --tgt_address_fixed[i];
+
+  // write copy
+  write_weight_file(
+    copy_file_name, src_address, tgt_address, weights, (unsigned)num_links,
+    src_locations, (unsigned)num_src_fields, num_links_per_src_field,
+    tgt_address_fixed, (unsigned)num_fixed_tgt, fixed_values,
+    num_tgt_per_fixed_value, (unsigned)num_fixed_values, tgt_location,
+    src_grid_name, tgt_grid_name);
+
+  // add target index
+  if (block_size > 0) {
+
+    for (size_t i = 0; i < num_links; ++i) ++tgt_address[i];
+    for (size_t i = 0; i < num_fixed_tgt; ++i) ++tgt_address_fixed[i];
+
+    yac_nc_open(copy_file_name, NC_WRITE, &ncid);
+    if (num_links > 0)
+      put_tgt_index(
+        ncid, "dst_address_index", "num_dst_index", tgt_address,
+        num_links_per_src_field, num_src_fields, block_size);
+    if (num_fixed_values > 0)
+      put_tgt_index(
+        ncid, "dst_address_fixed_index", "num_dst_fixed_index",
+        tgt_address_fixed, num_tgt_per_fixed_value, num_fixed_values,
+        block_size);
+    HANDLE_ERROR(nc_close(ncid));
+  }
+
+  free(tgt_address_fixed);
+  free(num_tgt_per_fixed_value);
+  free(fixed_values);
+  free(src_locations);
+  free(num_links_per_src_field);
+  free(weights);
+  free(tgt_address);
+  free(src_address);
+  free(tgt_grid_name);
+  free(src_grid_name);
+}
+
+// checks a target index against the target addresses
+static void check_tgt_index(
+  int ncid, char const * var_name, char const * dim_name,
+  char const * tgt_address_var_name, char const * part_sizes_var_name,
+  char const * parts_dim_name) {
+
+  int var_id;
+  if (nc_inq_varid(ncid, var_name, &var_id) != NC_NOERR) {
+    PUT_ERR("missing target index\n");
+    return;
+  }
+
+  int block_size;
+  HANDLE_ERROR(nc_get_att_int(ncid, var_id, "block_size", &block_size));
+  if (block_size <= 0) {
+    PUT_ERR("invalid block size of target index\n");
+    return;
+  }
+
+  size_t index_size = get_dim_len(ncid, dim_name);
+  int * index = xmalloc(index_size * sizeof(*index));
+  HANDLE_ERROR(nc_get_var_int(ncid, var_id, index));
+
+  size_t num_parts = get_dim_len(ncid, parts_dim_name);
+  int * part_sizes = xmalloc(num_parts * sizeof(*part_sizes));
+  yac_nc_inq_varid(ncid, part_sizes_var_name, &var_id);
+  HANDLE_ERROR(nc_get_var_int(ncid, var_id, part_sizes));
+
+  size_t num_entries = 0;
+  for (size_t i = 0; i < num_parts; ++i)
+    num_entries += (size_t)(part_sizes[i]);
+  int * tgt_address = xmalloc(num_entries * sizeof(*tgt_address));
+  yac_nc_inq_varid(ncid, tgt_address_var_name, &var_id);
+  HANDLE_ERROR(nc_get_var_int(ncid, var_id, tgt_address));
+
+  // the entries of each part have to be sorted by their target address
+  for (size_t i = 0, offset = 0; i < num_parts;
+       offset += (size_t)(part_sizes[i++]))
+    for (size_t j = 1; j < (size_t)(part_sizes[i]); ++j)
+      if (tgt_address[offset + j - 1] > tgt_address[offset + j])
+        PUT_ERR("target addresses are not sorted\n");
+
+  size_t ref_index_size;
+  int * ref_index =
+    compute_tgt_index(
+      tgt_address, part_sizes, num_parts, (size_t)block_size,
+      &ref_index_size);
+
+  if (ref_index_size != index_size) {
+    PUT_ERR("wrong target index size\n");
+  } else {
+    for (size_t i = 0; i < index_size; ++i)
+      if (ref_index[i] != index[i]) PUT_ERR("wrong target index\n");
+  }
+
+  free(ref_index);
+  free(tgt_address);
+  free(part_sizes);
+  free(index);
+}
+
+void check_weight_file_tgt_index(char const * file_name) {
+
+  int ncid;
+  yac_nc_open(file_name, NC_NOWRITE, &ncid);
+
+  if (get_dim_len(ncid, "num_links") > 0)
+    check_tgt_index(
+      ncid, "dst_address_index", "num_dst_index", "dst_address",
+      "num_links_per_src_field", "num_src_fields");
+  if (get_dim_len(ncid, "num_fixed_values") > 0)
+    check_tgt_index(
+      ncid, "dst_address_fixed_index", "num_dst_fixed_index",
+      "dst_address_fixed", "num_dst_per_fixed_value", "num_fixed_values");
+
+  HANDLE_ERROR(nc_close(ncid));
+}
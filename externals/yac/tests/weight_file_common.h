@@ -125,5 +125,27 @@ void check_weight_file(char const * file_name, int const * ref_src_address,
                        char const * ref_src_grid_name,
                        char const * ref_tgt_grid_name);
 
+/**
+ * creates a copy of a weight file, the copy contains a target index with
+ * the provided block size (see write_tgt_index in interp_weights.c)
+ * @param[in] file_name      name of the weight file
+ * @param[in] copy_file_name name of the copy
+ * @param[in] block_size     block size of the target index (if zero, the
+ *                           copy does not contain a target index)
+ * @remark the entries of each part of the weight file have to be sorted by
+ *         their target address, if block_size is non-zero
+ */
+void copy_weight_file(
+  char const * file_name, char const * copy_file_name, size_t block_size);
+
+/**
+ * checks whether a weight file contains a target index (see write_tgt_index
+ * in interp_weights.c) that is consistent with the data in the file
+ * @param[in] file_name name of the weight file that is to be checked
+ * @remark routine adds the number of differences found to the global variable
+ *         \ref err_count__ (see \ref tests.h)
+ */
+void check_weight_file_tgt_index(char const * file_name);
+
 #endif // WEIGHT_FILE_COMMON_H
 